@@ -10,6 +10,12 @@ LIBCONTAINER_ZERO_ON_RELEASE := 1
 LIBCONTAINER_ARRAY_DEFAULT_CAPACITY :=
 LIBCONTAINER_HASHMAP_LOAD_FACTOR :=
 LIBCONTAINER_HASHMAP_DEFAULT_CAPACITY :=
+LIBCONTAINER_HASHMAP_SHRINK_FACTOR :=
+LIBCONTAINER_HASHMAP_SMALL_CAPACITY :=
+LIBCONTAINER_HASHMAP_CONCURRENT_SHARDS :=
+LIBCONTAINER_BTREE_NODE_SIZE :=
+LIBCONTAINER_POOL_SLAB_SIZE :=
+LIBCONTAINER_POOL_INLINE_KEY_SIZE :=
 
 ifdef VERBOSE_TEST_SUCCESS
 TUNING_PARAMETERS += -DVERBOSE_TEST_SUCCESS
@@ -31,6 +37,30 @@ ifdef LIBCONTAINER_HASHMAP_DEFAULT_CAPACITY
 TUNING_PARAMETERS += -DLIBCONTAINER_HASHMAP_DEFAULT_CAPACITY=$(LIBCONTAINER_HASHMAP_DEFAULT_CAPACITY)
 endif
 
+ifdef LIBCONTAINER_HASHMAP_SHRINK_FACTOR
+TUNING_PARAMETERS += -DLIBCONTAINER_HASHMAP_SHRINK_FACTOR=$(LIBCONTAINER_HASHMAP_SHRINK_FACTOR)
+endif
+
+ifdef LIBCONTAINER_HASHMAP_SMALL_CAPACITY
+TUNING_PARAMETERS += -DLIBCONTAINER_HASHMAP_SMALL_CAPACITY=$(LIBCONTAINER_HASHMAP_SMALL_CAPACITY)
+endif
+
+ifdef LIBCONTAINER_HASHMAP_CONCURRENT_SHARDS
+TUNING_PARAMETERS += -DLIBCONTAINER_HASHMAP_CONCURRENT_SHARDS=$(LIBCONTAINER_HASHMAP_CONCURRENT_SHARDS)
+endif
+
+ifdef LIBCONTAINER_BTREE_NODE_SIZE
+TUNING_PARAMETERS += -DLIBCONTAINER_BTREE_NODE_SIZE=$(LIBCONTAINER_BTREE_NODE_SIZE)
+endif
+
+ifdef LIBCONTAINER_POOL_SLAB_SIZE
+TUNING_PARAMETERS += -DLIBCONTAINER_POOL_SLAB_SIZE=$(LIBCONTAINER_POOL_SLAB_SIZE)
+endif
+
+ifdef LIBCONTAINER_POOL_INLINE_KEY_SIZE
+TUNING_PARAMETERS += -DLIBCONTAINER_POOL_INLINE_KEY_SIZE=$(LIBCONTAINER_POOL_INLINE_KEY_SIZE)
+endif
+
 #	Add in the version and build-time info macros
 TUNING_PARAMETERS += -DLIBCONTAINER_MAJOR_VERSION=$(MAJOR_VERSION)
 TUNING_PARAMETERS += -DLIBCONTAINER_MINOR_VERSION=$(MINOR_VERSION)
@@ -0,0 +1,123 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+    Helpers shared by the benchmark programs. Each benchmark is built as a single
+    translation unit against the release library, so these are static inline
+    functions, and this header must be included before any system header.
+*/
+
+#ifndef LIBCONTAINER_BENCH_COMMON_H
+#define LIBCONTAINER_BENCH_COMMON_H
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+    NextRandom
+
+    This function advances an xorshift generator, kept to 32 bits so the sequence
+    is identical regardless of the width of long.
+
+    Inputs:
+    State   -   Pointer to the (nonzero) state of the generator.
+
+    Outputs:
+    unsigned long   -   The next value of the sequence.
+*/
+static inline unsigned long NextRandom(unsigned long *State) {
+
+    *State ^= (*State << 13) & 0xFFFFFFFFUL;
+    *State ^= (*State >> 17);
+    *State ^= (*State << 5) & 0xFFFFFFFFUL;
+    return *State;
+}
+
+/*
+    ElapsedSeconds
+
+    This function returns the time between two readings of CLOCK_MONOTONIC.
+
+    Inputs:
+    Start   -   The earlier reading.
+    End     -   The later reading.
+
+    Outputs:
+    double  -   The seconds elapsed from Start to End.
+*/
+static inline double ElapsedSeconds(const struct timespec *Start, const struct timespec *End) {
+    return (double)(End->tv_sec - Start->tv_sec) + (double)(End->tv_nsec - Start->tv_nsec) / 1e9;
+}
+
+/*
+    BenchArgument
+
+    This function reads an optional numeric command-line argument.
+
+    Inputs:
+    argc    -   The argument count given to main().
+    argv    -   The argument vector given to main().
+    Index   -   The position of the argument within argv.
+    Default -   The value to use when the argument is not given.
+
+    Outputs:
+    long    -   The value of the argument, or Default.
+*/
+static inline long BenchArgument(int argc, char **argv, int Index, long Default) {
+    return (argc > Index) ? atol(argv[Index]) : Default;
+}
+
+/*
+    BenchFailed
+
+    This function reports that a benchmark could not be prepared, once any
+    resources it had acquired are released.
+
+    Inputs:
+    None
+
+    Outputs:
+    int     -   The exit status of main() for a benchmark which failed to run.
+*/
+static inline int BenchFailed(void) {
+    fprintf(stderr, "%s\n", "Error: Failed to prepare benchmark.");
+    return 1;
+}
+
+/*
+    ReleaseNothing
+
+    This function is a ReleaseFunc_t for Values which are owned elsewhere, or which
+    are not pointers at all.
+*/
+static inline void ReleaseNothing(__attribute__((unused)) void *Value) {
+    return;
+}
+
+#endif
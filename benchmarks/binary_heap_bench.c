@@ -0,0 +1,151 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+    Push/Pop throughput benchmark for the Binary_Heap_t.
+
+    Heaps of increasing size are filled with random integer priorities and then
+    drained, reporting the mean cost of one Push plus one Pop. The node-based heap
+    created by Binary_Heap_Create() is compared against the inline heaps created by
+    Binary_Heap_CreateInline() with 2, 4 and 8 children per item.
+
+    The cost of loading a Heap from empty is then reported, comparing one Push
+    per item against a single Binary_Heap_PushN() call building the Heap bottom-up.
+
+    Usage: binary_heap_bench [MaxItemCount]
+*/
+
+#include "bench_common.h"
+
+#define LIBCONTAINER_ENABLE_BINARY_HEAP
+#include "../include/libcontainer.h"
+
+/*
+    Arity 0 selects the node-based heap, anything else the inline heap of that Arity.
+*/
+static double RunHeap(int *Keys, long Count, size_t Arity) {
+
+    Binary_Heap_t *            Heap = NULL;
+    Binary_Heap_KeyValuePair_t Pair = {NULL, NULL};
+    struct timespec            Start, End;
+    long                       i = 0;
+
+    if ( 0 == Arity ) {
+        Heap = Binary_Heap_Create(CompareFunc_Int_Descending, NULL);
+    } else {
+        Heap = Binary_Heap_CreateInline(CompareFunc_Int_Descending, sizeof(int), Arity);
+    }
+    if ( NULL == Heap ) {
+        return 0.0;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for ( i = 0; i < Count; i++ ) {
+        /* Values are held by reference, as a scheduler would hold its tasks. */
+        Binary_Heap_Push(Heap, &Keys[i], sizeof(int), &Keys[i], 0, NULL);
+    }
+    for ( i = 0; i < Count; i++ ) {
+        Pair = Binary_Heap_Pop(Heap);
+        if ( (0 == Arity) && (NULL != Pair.Key) ) {
+            free(Pair.Key);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    Binary_Heap_Release(Heap);
+
+    return ElapsedSeconds(&Start, &End) * 1e9 / (double)Count;
+}
+
+/*
+    Arity 0 selects the node-based heap, anything else the inline heap of that Arity.
+*/
+static double RunBuild(int *Keys, long Count, size_t Arity, bool Bulk) {
+
+    Binary_Heap_t * Heap = NULL;
+    struct timespec Start, End;
+    long            i = 0;
+
+    if ( 0 == Arity ) {
+        Heap = Binary_Heap_Create(CompareFunc_Int_Descending, NULL);
+    } else {
+        Heap = Binary_Heap_CreateInline(CompareFunc_Int_Descending, sizeof(int), Arity);
+    }
+    if ( NULL == Heap ) {
+        return 0.0;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    if ( Bulk ) {
+        Binary_Heap_PushN(Heap, Keys, sizeof(int), NULL, 0, (size_t)Count, NULL);
+    } else {
+        for ( i = 0; i < Count; i++ ) {
+            Binary_Heap_Push(Heap, &Keys[i], sizeof(int), NULL, 0, NULL);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    Binary_Heap_Release(Heap);
+
+    return ElapsedSeconds(&Start, &End) * 1e9 / (double)Count;
+}
+
+int main(int argc, char **argv) {
+
+    int *         Keys     = NULL;
+    long          MaxCount = 1000000L, Count = 0, i = 0;
+    unsigned long Seed     = 2463534242UL;
+
+    MaxCount = BenchArgument(argc, argv, 1, MaxCount);
+
+    Keys = (int *)calloc((size_t)(MaxCount > 0 ? MaxCount : 1), sizeof(int));
+    if ( (NULL == Keys) || (MaxCount < 1) ) {
+        free(Keys);
+        return BenchFailed();
+    }
+
+    for ( i = 0; i < MaxCount; i++ ) {
+        Keys[i] = (int)(NextRandom(&Seed) & 0x7FFFFFFF);
+    }
+
+    printf("Binary_Heap_t Push + Pop cost, random integer priorities (ns/item)\n");
+    printf("%-12s %12s %12s %12s %12s\n", "Items", "Nodes", "Inline-2", "Inline-4", "Inline-8");
+    for ( Count = 1000; Count <= MaxCount; Count *= 10 ) {
+        printf("%-12ld %12.1f %12.1f %12.1f %12.1f\n", Count, RunHeap(Keys, Count, 0),
+               RunHeap(Keys, Count, 2), RunHeap(Keys, Count, 4), RunHeap(Keys, Count, 8));
+    }
+
+    printf("\nBinary_Heap_t build cost from empty, random integer priorities (ns/item)\n");
+    printf("%-12s %12s %12s %12s %12s\n", "Items", "Nodes-Push", "Nodes-PushN", "Inline-Push",
+           "Inline-PushN");
+    for ( Count = 1000; Count <= MaxCount; Count *= 10 ) {
+        printf("%-12ld %12.1f %12.1f %12.1f %12.1f\n", Count, RunBuild(Keys, Count, 0, false),
+               RunBuild(Keys, Count, 0, true), RunBuild(Keys, Count, 4, false),
+               RunBuild(Keys, Count, 4, true));
+    }
+
+    free(Keys);
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+    Insert-scaling benchmark for the Binary_Tree_t.
+
+    Trees of increasing size are populated with shuffled integer keys, reporting
+    the mean cost of each insertion. With the AVL rebalancing running in O(log n)
+    per operation, the time per insert should grow only logarithmically with the
+    size of the tree. The per-item cost of a full in-order DoCallbackArg() scan and
+    of the Clear() tearing the tree down are reported alongside, and should both
+    stay flat as the tree grows.
+
+    Usage: binary_tree_insert_bench [MaxKeyCount]
+*/
+
+#include "bench_common.h"
+
+#define LIBCONTAINER_ENABLE_BINARY_TREE
+#include "../include/libcontainer.h"
+
+static int SumCallback(void *KeyValuePair, void *Args) {
+    *(long *)Args += *(int *)((Binary_Tree_KeyValuePair_t *)KeyValuePair)->Value;
+    return 0;
+}
+
+static void RunTree(int *Keys, long KeyCount, double *Insert, double *Scan, double *Clear) {
+
+    Binary_Tree_t * Tree = NULL;
+    struct timespec Start, End;
+    long            i = 0, Sum = 0;
+
+    *Insert = *Scan = *Clear = 0.0;
+
+    Tree = Binary_Tree_Create(CompareFunc_Int_Ascending, sizeof(int), NULL, Policy_Error);
+    if ( NULL == Tree ) {
+        return;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for ( i = 0; i < KeyCount; i++ ) {
+        if ( 0 != Binary_Tree_Insert(Tree, &Keys[i], sizeof(int), &Keys[i], sizeof(int), NULL) ) {
+            fprintf(stderr, "Warning: failed to insert key %d.\n", Keys[i]);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+    *Insert = ElapsedSeconds(&Start, &End) * 1e9 / (double)KeyCount;
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    Binary_Tree_DoCallbackArg(Tree, Direction_InOrder, SumCallback, &Sum);
+    clock_gettime(CLOCK_MONOTONIC, &End);
+    *Scan = ElapsedSeconds(&Start, &End) * 1e9 / (double)KeyCount;
+
+    if ( Sum != (KeyCount * (KeyCount - 1)) / 2 ) {
+        fprintf(stderr, "Warning: scan visited the wrong keys (sum %ld).\n", Sum);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    Binary_Tree_Clear(Tree);
+    clock_gettime(CLOCK_MONOTONIC, &End);
+    *Clear = ElapsedSeconds(&Start, &End) * 1e9 / (double)KeyCount;
+
+    Binary_Tree_Release(Tree);
+}
+
+int main(int argc, char **argv) {
+
+    int *         Keys = NULL, Swap = 0;
+    long          MaxKeyCount = 1000000L, KeyCount = 0, i = 0, j = 0;
+    unsigned long Seed = 2463534242UL;
+    double        Insert = 0.0, Scan = 0.0, Clear = 0.0;
+
+    MaxKeyCount = BenchArgument(argc, argv, 1, MaxKeyCount);
+
+    Keys = (int *)calloc((size_t)(MaxKeyCount > 0 ? MaxKeyCount : 1), sizeof(int));
+    if ( (NULL == Keys) || (MaxKeyCount < 1) ) {
+        free(Keys);
+        return BenchFailed();
+    }
+
+    printf("Binary_Tree_t costs, shuffled integer keys (ns/item)\n");
+    printf("%-12s %16s %16s %16s\n", "Keys", "Insert", "Scan", "Clear");
+    for ( KeyCount = 1000; KeyCount <= MaxKeyCount; KeyCount *= 10 ) {
+        for ( i = 0; i < KeyCount; i++ ) {
+            Keys[i] = (int)i;
+        }
+        for ( i = KeyCount - 1; i > 0; i-- ) {
+            j       = (long)(NextRandom(&Seed) % (unsigned long)(i + 1));
+            Swap    = Keys[i];
+            Keys[i] = Keys[j];
+            Keys[j] = Swap;
+        }
+        RunTree(Keys, KeyCount, &Insert, &Scan, &Clear);
+        printf("%-12ld %16.1f %16.1f %16.1f\n", KeyCount, Insert, Scan, Clear);
+    }
+
+    free(Keys);
+
+    return 0;
+}
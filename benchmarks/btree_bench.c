@@ -0,0 +1,149 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+    Lookup and scan benchmark for the BTree_t and the frozen Binary_Tree_Frozen_t,
+    against the Binary_Tree_t.
+
+    Both trees are populated with the same shuffled integer keys, and the Binary
+    Tree is then frozen. Each is timed performing random lookups and a full
+    in-order scan, reporting the mean cost per item.
+
+    Usage: btree_bench [KeyCount] [Lookups]
+*/
+
+#include "bench_common.h"
+
+#define LIBCONTAINER_ENABLE_BINARY_TREE
+#define LIBCONTAINER_ENABLE_BTREE
+#include "../include/libcontainer.h"
+
+static int CountItem(__attribute__((unused)) void *KeyValuePair, void *Args) {
+    (*(long *)Args)++;
+    return 0;
+}
+
+int main(int argc, char **argv) {
+
+    Binary_Tree_t *            Binary = NULL;
+    BTree_t *                  BTree  = NULL;
+    Binary_Tree_Frozen_t *     Frozen = NULL;
+    Binary_Tree_KeyValuePair_t Pair   = {NULL, NULL};
+    struct timespec            Start, End;
+    int *                      Keys = NULL, Key = 0, Swap = 0;
+    long                       KeyCount = 1000000L, Lookups = 1000000L, i = 0, j = 0, Found = 0;
+    unsigned long              Seed = 2463534242UL;
+    double                     BinaryLookup = 0.0, BTreeLookup = 0.0, BinaryScan = 0.0,
+           BTreeScan = 0.0, FrozenLookup = 0.0, FrozenScan = 0.0;
+
+    KeyCount = BenchArgument(argc, argv, 1, KeyCount);
+    Lookups  = BenchArgument(argc, argv, 2, Lookups);
+
+    Keys   = (int *)calloc((size_t)(KeyCount > 0 ? KeyCount : 1), sizeof(int));
+    Binary = Binary_Tree_Create(CompareFunc_Int_Ascending, sizeof(int), NULL, Policy_Error);
+    BTree  = BTree_Create(CompareFunc_Int_Ascending, sizeof(int), NULL, Policy_Error);
+    if ( (NULL == Keys) || (NULL == Binary) || (NULL == BTree) || (KeyCount < 1) ) {
+        return BenchFailed();
+    }
+
+    for ( i = 0; i < KeyCount; i++ ) {
+        Keys[i] = (int)i;
+    }
+    for ( i = KeyCount - 1; i > 0; i-- ) {
+        j       = (long)(NextRandom(&Seed) % (unsigned long)(i + 1));
+        Swap    = Keys[i];
+        Keys[i] = Keys[j];
+        Keys[j] = Swap;
+    }
+    for ( i = 0; i < KeyCount; i++ ) {
+        Binary_Tree_Insert(Binary, &Keys[i], sizeof(int), &Keys[i], sizeof(int), NULL);
+        BTree_Insert(BTree, &Keys[i], sizeof(int), &Keys[i], sizeof(int), NULL);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for ( i = 0; i < Lookups; i++ ) {
+        Key = (int)(NextRandom(&Seed) % (unsigned long)KeyCount);
+        Found += (NULL != Binary_Tree_Get(Binary, &Key, sizeof(Key)));
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+    BinaryLookup = ElapsedSeconds(&Start, &End) * 1e9 / (double)Lookups;
+
+    Frozen = Binary_Tree_Freeze(Binary);
+    if ( NULL == Frozen ) {
+        fprintf(stderr, "%s\n", "Error: Failed to freeze Binary_Tree_t.");
+        return 1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for ( i = 0; i < Lookups; i++ ) {
+        Key = (int)(NextRandom(&Seed) % (unsigned long)KeyCount);
+        Found += (NULL != BTree_Get(BTree, &Key, sizeof(Key)));
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+    BTreeLookup = ElapsedSeconds(&Start, &End) * 1e9 / (double)Lookups;
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for ( Pair = Binary_Tree_Next(Binary, Direction_InOrder); NULL != Pair.Key;
+          Pair = Binary_Tree_Next(Binary, Direction_InOrder) ) {
+        Found++;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+    BinaryScan = ElapsedSeconds(&Start, &End) * 1e9 / (double)KeyCount;
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    BTREE_FOREACH(BTree, Pair) { Found++; }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+    BTreeScan = ElapsedSeconds(&Start, &End) * 1e9 / (double)KeyCount;
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for ( i = 0; i < Lookups; i++ ) {
+        Key = (int)(NextRandom(&Seed) % (unsigned long)KeyCount);
+        Found += (NULL != Binary_Tree_FrozenGet(Frozen, &Key, sizeof(Key)));
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+    FrozenLookup = ElapsedSeconds(&Start, &End) * 1e9 / (double)Lookups;
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    Binary_Tree_FrozenRangeCallback(Frozen, NULL, 0, NULL, 0, CountItem, &Found);
+    clock_gettime(CLOCK_MONOTONIC, &End);
+    FrozenScan = ElapsedSeconds(&Start, &End) * 1e9 / (double)KeyCount;
+
+    if ( Found != 3 * (Lookups + KeyCount) ) {
+        fprintf(stderr, "Warning: only found %ld of %ld items.\n", Found,
+                3 * (Lookups + KeyCount));
+    }
+
+    printf("Ordered map cost, %ld shuffled integer keys (ns/item)\n", KeyCount);
+    printf("%-16s %16s %16s\n", "Container", "Lookup", "Scan");
+    printf("%-16s %16.1f %16.1f\n", "Binary_Tree_t", BinaryLookup, BinaryScan);
+    printf("%-16s %16.1f %16.1f\n", "BTree_t", BTreeLookup, BTreeScan);
+    printf("%-16s %16.1f %16.1f\n", "Frozen", FrozenLookup, FrozenScan);
+
+    Binary_Tree_FrozenRelease(Frozen);
+    Binary_Tree_Release(Binary);
+    BTree_Release(BTree);
+    free(Keys);
+
+    return 0;
+}
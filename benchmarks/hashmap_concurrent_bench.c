@@ -0,0 +1,151 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+    Read-scaling benchmark for the concurrent Hashmap_t.
+
+    A map of integer keys is populated once, and then an increasing number of
+    threads perform random lookups against it. The same workload is run against
+    a regular Hashmap_t guarded by a single global mutex, and against a Hashmap_t
+    created with Hashmap_CreateConcurrent(), reporting the aggregate lookup rate.
+
+    Usage: hashmap_concurrent_bench [MaxThreads] [KeyCount] [LookupsPerThread]
+*/
+
+#include "bench_common.h"
+
+#include <pthread.h>
+
+#define LIBCONTAINER_ENABLE_HASHMAP
+#include "../include/libcontainer.h"
+
+typedef struct Bench_Worker_t {
+    Hashmap_t *      Map;
+    pthread_mutex_t *Lock;
+    unsigned long    Seed;
+    long             KeyCount;
+    long             Lookups;
+    long             Found;
+} Bench_Worker_t;
+
+static void *LookupWorker(void *Args) {
+
+    Bench_Worker_t *Worker = (Bench_Worker_t *)Args;
+    long            i = 0;
+    int             Key = 0;
+
+    for ( i = 0; i < Worker->Lookups; i++ ) {
+        Key = (int)(NextRandom(&Worker->Seed) % (unsigned long)Worker->KeyCount);
+        if ( NULL != Worker->Lock ) {
+            pthread_mutex_lock(Worker->Lock);
+        }
+        if ( NULL != Hashmap_Retrieve(Worker->Map, &Key, 0) ) {
+            Worker->Found++;
+        }
+        if ( NULL != Worker->Lock ) {
+            pthread_mutex_unlock(Worker->Lock);
+        }
+    }
+
+    return NULL;
+}
+
+static double RunLookups(Hashmap_t *Map, pthread_mutex_t *Lock, int Threads, long KeyCount,
+                         long Lookups) {
+
+    pthread_t *     Handles = NULL;
+    Bench_Worker_t *Workers = NULL;
+    struct timespec Start, End;
+    int             i = 0;
+
+    Handles = (pthread_t *)calloc((size_t)Threads, sizeof(pthread_t));
+    Workers = (Bench_Worker_t *)calloc((size_t)Threads, sizeof(Bench_Worker_t));
+    if ( (NULL == Handles) || (NULL == Workers) ) {
+        free(Handles);
+        free(Workers);
+        return 0.0;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for ( i = 0; i < Threads; i++ ) {
+        Workers[i].Map      = Map;
+        Workers[i].Lock     = Lock;
+        Workers[i].Seed     = 2463534242UL + (unsigned long)i * 7919UL;
+        Workers[i].KeyCount = KeyCount;
+        Workers[i].Lookups  = Lookups;
+        pthread_create(&Handles[i], NULL, LookupWorker, &Workers[i]);
+    }
+    for ( i = 0; i < Threads; i++ ) {
+        pthread_join(Handles[i], NULL);
+        if ( Workers[i].Found != Lookups ) {
+            fprintf(stderr, "Warning: worker %d only found %ld of %ld keys.\n", i, Workers[i].Found,
+                    Lookups);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    free(Handles);
+    free(Workers);
+
+    return ((double)Threads * (double)Lookups) / ElapsedSeconds(&Start, &End) / 1e6;
+}
+
+int main(int argc, char **argv) {
+
+    Hashmap_t *     Global = NULL, *Concurrent = NULL;
+    pthread_mutex_t GlobalLock;
+    int             MaxThreads = 32, Threads = 0, Key = 0;
+    long            KeyCount = 1L << 16, Lookups = 1L << 20;
+
+    MaxThreads = (int)BenchArgument(argc, argv, 1, MaxThreads);
+    KeyCount   = BenchArgument(argc, argv, 2, KeyCount);
+    Lookups    = BenchArgument(argc, argv, 3, Lookups);
+
+    Global     = Hashmap_Create(HashFunc_Int, 0, NULL);
+    Concurrent = Hashmap_CreateConcurrent(HashFunc_Int, 0, NULL, 0);
+    if ( (NULL == Global) || (NULL == Concurrent) || (MaxThreads < 1) || (KeyCount < 1) ) {
+        return BenchFailed();
+    }
+    pthread_mutex_init(&GlobalLock, NULL);
+
+    for ( Key = 0; Key < KeyCount; Key++ ) {
+        Hashmap_Insert(Global, &Key, &Key, 0, sizeof(Key), NULL);
+        Hashmap_Insert(Concurrent, &Key, &Key, 0, sizeof(Key), NULL);
+    }
+
+    printf("Hashmap_t lookup throughput, %ld keys, %ld lookups per thread (Mops/s)\n", KeyCount,
+           Lookups);
+    printf("%-8s %16s %16s\n", "Threads", "Global Mutex", "Concurrent");
+    for ( Threads = 1; Threads <= MaxThreads; Threads *= 2 ) {
+        printf("%-8d %16.2f %16.2f\n", Threads,
+               RunLookups(Global, &GlobalLock, Threads, KeyCount, Lookups),
+               RunLookups(Concurrent, NULL, Threads, KeyCount, Lookups));
+    }
+
+    pthread_mutex_destroy(&GlobalLock);
+    Hashmap_Release(Global);
+    Hashmap_Release(Concurrent);
+
+    return 0;
+}
@@ -0,0 +1,331 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+    Push/Pop throughput benchmark for the Priority_Queue_t.
+
+    Queues of increasing size are filled with random integer priorities and then
+    drained, reporting the mean cost of one Push plus one Pop. The Queue created by
+    Priority_Queue_Create() is compared against the typed Queues created by
+    Priority_Queue_CreateTyped() for int, int64_t and double priorities.
+
+    The "hold" model of an event simulation is then run, where a Queue of pending
+    events repeatedly has its earliest event popped and a new one pushed some random
+    time after it. This is the monotone workload Priority_Queue_CreateMonotone() is
+    intended for, and is reported as the mean cost of one Pop plus one Push.
+
+    Finally, the rebalancing of sharded Queues is modelled by repeatedly merging a
+    Queue of newly pushed items into one which already holds several times as many.
+    Popping and pushing every item across is compared against Priority_Queue_Merge(),
+    for Queues from both Priority_Queue_Create() and Priority_Queue_CreateMeldable().
+
+    Last, a bounded cache which serves its highest item and evicts its lowest is run,
+    keeping a pair of Queues of opposite orders in step through their Handles, against
+    the single Queue of Priority_Queue_CreateDoubleEnded().
+
+    Usage: priority_queue_bench [MaxItemCount]
+*/
+
+#include "bench_common.h"
+
+#include <stdint.h>
+
+#define LIBCONTAINER_ENABLE_PRIORITY_QUEUE
+#include "../include/libcontainer.h"
+
+/*
+    One cached item when held by a pair of Queues, holding its Handle within each.
+*/
+typedef struct Bench_Entry_t {
+    Priority_Queue_Handle_t *High;
+    Priority_Queue_Handle_t *Low;
+} Bench_Entry_t;
+
+/*
+    A Type of -1 selects the Queue from Priority_Queue_Create(), -2 the Queue from
+    Priority_Queue_CreateMeldable(), and anything else a typed Queue.
+*/
+static double RunQueue(int *Priorities, long Count, int Type) {
+
+    Priority_Queue_t *Queue = NULL;
+    struct timespec   Start, End;
+    int64_t           Wide = 0;
+    double            Real = 0;
+    long              i    = 0;
+
+    if ( -2 == Type ) {
+        Queue = Priority_Queue_CreateMeldable(false);
+    } else if ( Type < 0 ) {
+        Queue = Priority_Queue_Create(false);
+    } else {
+        Queue = Priority_Queue_CreateTyped((Priority_Queue_Priority_t)Type, false);
+    }
+    if ( NULL == Queue ) {
+        return 0.0;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for ( i = 0; i < Count; i++ ) {
+        /* Values are held by reference, as a scheduler would hold its tasks. */
+        switch ( Type ) {
+            case Priority_Int64:
+                Wide = Priorities[i];
+                Priority_Queue_PushTyped(Queue, &Wide, &Priorities[i], 0, NULL);
+                break;
+            case Priority_Double:
+                Real = Priorities[i];
+                Priority_Queue_PushTyped(Queue, &Real, &Priorities[i], 0, NULL);
+                break;
+            default: Priority_Queue_Push(Queue, Priorities[i], &Priorities[i], 0, NULL); break;
+        }
+    }
+    for ( i = 0; i < Count; i++ ) {
+        Priority_Queue_Pop(Queue);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    Priority_Queue_Release(Queue);
+
+    return ElapsedSeconds(&Start, &End) * 1e9 / (double)Count;
+}
+
+/*
+    Kind 0 selects Priority_Queue_Create(), 1 a typed int64_t Queue, and 2 a monotone one.
+*/
+static double RunHold(int *Delays, long Count, int Kind) {
+
+    Priority_Queue_t *Queue = NULL;
+    struct timespec   Start, End;
+    int64_t           Now = 0, Next = 0;
+    long              i = 0, Holds = 4 * Count;
+    int               Priority = 0;
+
+    switch ( Kind ) {
+        case 1: Queue = Priority_Queue_CreateTyped(Priority_Int64, false); break;
+        case 2: Queue = Priority_Queue_CreateMonotone(Priority_Int64); break;
+        default: Queue = Priority_Queue_Create(false); break;
+    }
+    if ( NULL == Queue ) {
+        return 0.0;
+    }
+
+    /* Delays are kept to 16 bits, so the int Priorities of Priority_Queue_Create() never wrap. */
+    for ( i = 0; i < Count; i++ ) {
+        Next = Delays[i] & 0xFFFF;
+        if ( 0 == Kind ) {
+            Priority_Queue_Push(Queue, (int)Next, NULL, 0, NULL);
+        } else {
+            Priority_Queue_PushTyped(Queue, &Next, NULL, 0, NULL);
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for ( i = 0; i < Holds; i++ ) {
+        if ( 0 == Kind ) {
+            Now      = Priority_Queue_Pop(Queue).Priority;
+            Priority = (int)(Now + (Delays[i % Count] & 0xFFFF));
+            Priority_Queue_Push(Queue, Priority, NULL, 0, NULL);
+        } else {
+            Priority_Queue_PopTyped(Queue, &Now);
+            Next = Now + (Delays[i % Count] & 0xFFFF);
+            Priority_Queue_PushTyped(Queue, &Next, NULL, 0, NULL);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    Priority_Queue_Release(Queue);
+
+    return ElapsedSeconds(&Start, &End) * 1e9 / (double)Holds;
+}
+
+/*
+    Kind 0 pops and pushes every item across between Queues from Priority_Queue_Create(),
+    1 merges such Queues with Priority_Queue_Merge(), and 2 merges meldable Queues.
+*/
+static double RunMerge(int *Priorities, long Count, int Kind) {
+
+    Priority_Queue_t *    Dst = NULL, *Src = NULL;
+    Priority_Queue_Item_t Item = {0, NULL};
+    struct timespec       Start, End;
+    double                Elapsed = 0.0;
+    long                  i = 0, Round = 0, Rounds = 4;
+
+    if ( 2 == Kind ) {
+        Dst = Priority_Queue_CreateMeldable(false);
+        Src = Priority_Queue_CreateMeldable(false);
+    } else {
+        Dst = Priority_Queue_Create(false);
+        Src = Priority_Queue_Create(false);
+    }
+    if ( (NULL == Dst) || (NULL == Src) ) {
+        Priority_Queue_Release(Dst);
+        Priority_Queue_Release(Src);
+        return 0.0;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        Priority_Queue_Push(Dst, Priorities[i], &Priorities[i], 0, ReleaseNothing);
+    }
+
+    for ( Round = 0; Round < Rounds; Round++ ) {
+        for ( i = 0; i < Count / 4; i++ ) {
+            Priority_Queue_Push(Src, Priorities[i], &Priorities[i], 0, ReleaseNothing);
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &Start);
+        if ( 0 == Kind ) {
+            while ( !Priority_Queue_IsEmpty(Src) ) {
+                Item = Priority_Queue_Pop(Src);
+                Priority_Queue_Push(Dst, Item.Priority, Item.Value, 0, ReleaseNothing);
+            }
+        } else {
+            Priority_Queue_Merge(Dst, Src);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &End);
+
+        Elapsed += ElapsedSeconds(&Start, &End);
+    }
+
+    Priority_Queue_Release(Dst);
+    Priority_Queue_Release(Src);
+
+    return Elapsed * 1e6 / (double)Rounds;
+}
+
+/*
+    Kind 0 keeps a pair of Queues from Priority_Queue_Create() in step, and 1 uses a
+    single double-ended Queue. Every step pushes an item, then alternately serves the
+    highest and evicts the lowest, so the cache stays at Count items.
+*/
+static double RunBounded(int *Priorities, long Count, int Kind) {
+
+    Priority_Queue_t *    High = NULL, *Low = NULL;
+    Priority_Queue_Item_t Item = {0, NULL};
+    Bench_Entry_t *       Entries = NULL, *Entry = NULL;
+    struct timespec       Start, End;
+    long                  i = 0, Steps = 4 * Count;
+
+    Entries = (Bench_Entry_t *)calloc((size_t)(Count + Steps), sizeof(Bench_Entry_t));
+    High    = (0 == Kind) ? Priority_Queue_Create(true) : Priority_Queue_CreateDoubleEnded(true);
+    Low     = (0 == Kind) ? Priority_Queue_Create(false) : NULL;
+    if ( (NULL == Entries) || (NULL == High) || ((0 == Kind) && (NULL == Low)) ) {
+        free(Entries);
+        Priority_Queue_Release(High);
+        Priority_Queue_Release(Low);
+        return 0.0;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for ( i = 0; i < Count + Steps; i++ ) {
+        Entry = &Entries[i];
+        if ( 0 == Kind ) {
+            Entry->High = Priority_Queue_PushHandle(High, Priorities[i % Count], Entry, 0,
+                                                    ReleaseNothing);
+            Entry->Low  = Priority_Queue_PushHandle(Low, Priorities[i % Count], Entry, 0,
+                                                   ReleaseNothing);
+        } else {
+            Priority_Queue_Push(High, Priorities[i % Count], Entry, 0, ReleaseNothing);
+        }
+
+        if ( i < Count ) {
+            continue;
+        }
+
+        if ( 0 == Kind ) {
+            if ( 0 == (i % 2) ) {
+                Item = Priority_Queue_Pop(High);
+                Priority_Queue_RemoveHandle(Low, ((Bench_Entry_t *)Item.Value)->Low);
+            } else {
+                Item = Priority_Queue_Pop(Low);
+                Priority_Queue_RemoveHandle(High, ((Bench_Entry_t *)Item.Value)->High);
+            }
+        } else if ( 0 == (i % 2) ) {
+            Priority_Queue_Pop(High);
+        } else {
+            Priority_Queue_PopBack(High);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    free(Entries);
+    Priority_Queue_Release(High);
+    Priority_Queue_Release(Low);
+
+    return ElapsedSeconds(&Start, &End) * 1e9 / (double)(Count + Steps);
+}
+
+int main(int argc, char **argv) {
+
+    int *         Priorities = NULL;
+    long          MaxCount   = 1000000L, Count = 0, i = 0;
+    unsigned long Seed       = 2463534242UL;
+
+    MaxCount = BenchArgument(argc, argv, 1, MaxCount);
+
+    Priorities = (int *)calloc((size_t)(MaxCount > 0 ? MaxCount : 1), sizeof(int));
+    if ( (NULL == Priorities) || (MaxCount < 1) ) {
+        free(Priorities);
+        return BenchFailed();
+    }
+
+    for ( i = 0; i < MaxCount; i++ ) {
+        Priorities[i] = (int)(NextRandom(&Seed) & 0x7FFFFFFF);
+    }
+
+    printf("Priority_Queue_t Push + Pop cost, random integer priorities (ns/item)\n");
+    printf("%-12s %12s %12s %12s %12s %12s\n", "Items", "Create", "Meldable", "Typed-Int",
+           "Typed-Int64", "Typed-Double");
+    for ( Count = 1000; Count <= MaxCount; Count *= 10 ) {
+        printf("%-12ld %12.1f %12.1f %12.1f %12.1f %12.1f\n", Count,
+               RunQueue(Priorities, Count, -1), RunQueue(Priorities, Count, -2),
+               RunQueue(Priorities, Count, Priority_Int),
+               RunQueue(Priorities, Count, Priority_Int64),
+               RunQueue(Priorities, Count, Priority_Double));
+    }
+
+    printf("\nPriority_Queue_t hold model, Pop + Push of a later event (ns/event)\n");
+    printf("%-12s %12s %12s %12s\n", "Pending", "Create", "Typed-Int64", "Monotone");
+    for ( Count = 1000; Count <= MaxCount; Count *= 10 ) {
+        printf("%-12ld %12.1f %12.1f %12.1f\n", Count, RunHold(Priorities, Count, 0),
+               RunHold(Priorities, Count, 1), RunHold(Priorities, Count, 2));
+    }
+
+    printf("\nPriority_Queue_t merge of Items/4 new items into Items (us/merge)\n");
+    printf("%-12s %14s %14s %14s\n", "Items", "Pop + Push", "Merge-Create", "Merge-Meldable");
+    for ( Count = 1000; Count <= MaxCount; Count *= 10 ) {
+        printf("%-12ld %14.1f %14.1f %14.1f\n", Count, RunMerge(Priorities, Count, 0),
+               RunMerge(Priorities, Count, 1), RunMerge(Priorities, Count, 2));
+    }
+
+    printf("\nPriority_Queue_t bounded cache, Push then serve highest or evict lowest (ns/item)\n");
+    printf("%-12s %14s %14s\n", "Items", "Two Queues", "Double-Ended");
+    for ( Count = 1000; Count <= MaxCount; Count *= 10 ) {
+        printf("%-12ld %14.1f %14.1f\n", Count, RunBounded(Priorities, Count, 0),
+               RunBounded(Priorities, Count, 1));
+    }
+
+    free(Priorities);
+
+    return 0;
+}
@@ -0,0 +1,172 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+/*
+    Thread-scaling benchmark for the concurrent Priority_Queue_t.
+
+    A Queue is filled with random integer priorities, and then an increasing number
+    of threads each repeatedly Pop an item and Push it back some random distance later,
+    as the workers of a task scheduler would. The same workload is run against a Queue
+    from Priority_Queue_Create() and a typed int Queue, each guarded by a single global
+    mutex, and against a Queue from Priority_Queue_CreateConcurrent() with four heaps
+    per thread, reporting the aggregate rate of Pop + Push pairs.
+
+    Usage: priority_queue_concurrent_bench [MaxThreads] [ItemCount] [OpsPerThread]
+*/
+
+#include "bench_common.h"
+
+#include <pthread.h>
+
+#define LIBCONTAINER_ENABLE_PRIORITY_QUEUE
+#include "../include/libcontainer.h"
+
+typedef struct Bench_Worker_t {
+    Priority_Queue_t *Queue;
+    pthread_mutex_t * Lock;
+    unsigned long     Seed;
+    long              Ops;
+    long              Empty;
+} Bench_Worker_t;
+
+static void *HoldWorker(void *Args) {
+
+    Bench_Worker_t *      Worker = (Bench_Worker_t *)Args;
+    Priority_Queue_Item_t Item   = {0, NULL};
+    unsigned long         Next   = 0;
+    long                  i      = 0;
+
+    for ( i = 0; i < Worker->Ops; i++ ) {
+        if ( NULL != Worker->Lock ) {
+            pthread_mutex_lock(Worker->Lock);
+        }
+        Item = Priority_Queue_Pop(Worker->Queue);
+        if ( NULL != Worker->Lock ) {
+            pthread_mutex_unlock(Worker->Lock);
+        }
+
+        if ( NULL == Item.Value ) {
+            Worker->Empty++;
+            continue;
+        }
+
+        /* Priorities are kept well clear of INT_MAX by wrapping them at 2^30. */
+        Next          = (unsigned long)Item.Priority + (NextRandom(&Worker->Seed) & 0xFFFF);
+        Item.Priority = (int)(Next & 0x3FFFFFFFUL);
+
+        if ( NULL != Worker->Lock ) {
+            pthread_mutex_lock(Worker->Lock);
+        }
+        Priority_Queue_Push(Worker->Queue, Item.Priority, Item.Value, 0, ReleaseNothing);
+        if ( NULL != Worker->Lock ) {
+            pthread_mutex_unlock(Worker->Lock);
+        }
+    }
+
+    return NULL;
+}
+
+/*
+    Kind 0 selects Priority_Queue_Create() and 1 a typed int Queue, each behind a global
+    mutex, while 2 selects Priority_Queue_CreateConcurrent().
+*/
+static double RunHold(int Kind, int Threads, long ItemCount, long Ops) {
+
+    Priority_Queue_t *Queue   = NULL;
+    pthread_t *       Handles = NULL;
+    Bench_Worker_t *  Workers = NULL;
+    pthread_mutex_t   Lock;
+    struct timespec   Start, End;
+    unsigned long     Seed = 88172645UL;
+    long              i    = 0;
+    int               t    = 0;
+
+    switch ( Kind ) {
+        case 1: Queue = Priority_Queue_CreateTyped(Priority_Int, false); break;
+        case 2: Queue = Priority_Queue_CreateConcurrent(false, 4 * (size_t)Threads); break;
+        default: Queue = Priority_Queue_Create(false); break;
+    }
+    Handles = (pthread_t *)calloc((size_t)Threads, sizeof(pthread_t));
+    Workers = (Bench_Worker_t *)calloc((size_t)Threads, sizeof(Bench_Worker_t));
+    if ( (NULL == Queue) || (NULL == Handles) || (NULL == Workers) ) {
+        Priority_Queue_Release(Queue);
+        free(Handles);
+        free(Workers);
+        return 0.0;
+    }
+    pthread_mutex_init(&Lock, NULL);
+
+    /* The Values are never dereferenced, so each item simply carries a non-NULL marker. */
+    for ( i = 0; i < ItemCount; i++ ) {
+        Priority_Queue_Push(Queue, (int)(NextRandom(&Seed) & 0xFFFFFF), &Lock, 0,
+                            ReleaseNothing);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for ( t = 0; t < Threads; t++ ) {
+        Workers[t].Queue = Queue;
+        Workers[t].Lock  = (2 == Kind) ? NULL : &Lock;
+        Workers[t].Seed  = 2463534242UL + (unsigned long)t * 7919UL;
+        Workers[t].Ops   = Ops;
+        pthread_create(&Handles[t], NULL, HoldWorker, &Workers[t]);
+    }
+    for ( t = 0; t < Threads; t++ ) {
+        pthread_join(Handles[t], NULL);
+        if ( 0 != Workers[t].Empty ) {
+            fprintf(stderr, "Warning: worker %d found the Queue empty %ld times.\n", t,
+                    Workers[t].Empty);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    pthread_mutex_destroy(&Lock);
+    Priority_Queue_Release(Queue);
+    free(Handles);
+    free(Workers);
+
+    return ((double)Threads * (double)Ops) / ElapsedSeconds(&Start, &End) / 1e6;
+}
+
+int main(int argc, char **argv) {
+
+    int  MaxThreads = 32, Threads = 0;
+    long ItemCount = 1L << 16, Ops = 1L << 16;
+
+    MaxThreads = (int)BenchArgument(argc, argv, 1, MaxThreads);
+    ItemCount  = BenchArgument(argc, argv, 2, ItemCount);
+    Ops        = BenchArgument(argc, argv, 3, Ops);
+
+    if ( (MaxThreads < 1) || (ItemCount < 1) || (Ops < 0) ) {
+        return BenchFailed();
+    }
+
+    printf("Priority_Queue_t Pop + Push throughput, %ld items, %ld ops per thread (Mops/s)\n",
+           ItemCount, Ops);
+    printf("%-8s %16s %16s %16s\n", "Threads", "Mutex Create", "Mutex Typed", "Concurrent");
+    for ( Threads = 1; Threads <= MaxThreads; Threads *= 2 ) {
+        printf("%-8d %16.2f %16.2f %16.2f\n", Threads, RunHold(0, Threads, ItemCount, Ops),
+               RunHold(1, Threads, ItemCount, Ops), RunHold(2, Threads, ItemCount, Ops));
+    }
+
+    return 0;
+}
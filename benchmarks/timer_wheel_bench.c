@@ -0,0 +1,181 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+    Timeout churn benchmark for the TimerWheel_t.
+
+    A server is modelled which starts a request on every step, arming a timeout for it,
+    and finishes each request a fixed number of steps later, cancelling its timeout if it
+    has not yet fired. The clock ticks once every 16 steps, firing whichever timeouts
+    have expired. About three in four timeouts are cancelled, and the rest fire.
+
+    Each run holds a steady number of Pending timeouts, and is reported as the mean cost of
+    one step. The TimerWheel_t is compared against a Priority_Queue_t using handles, which
+    is the closest alternative within this library.
+
+    Usage: timer_wheel_bench [MaxPendingCount]
+*/
+
+#include "bench_common.h"
+
+#include <stdint.h>
+
+#define LIBCONTAINER_ENABLE_PRIORITY_QUEUE
+#define LIBCONTAINER_ENABLE_TIMER_WHEEL
+#include "../include/libcontainer.h"
+
+static int CountFired(void *Value, void *Args) {
+
+    (void)Value;
+    (*(long *)Args)++;
+    return 0;
+}
+
+/*
+    Each timeout is due between 1 and 5 times Count / 32 ticks after it is armed, while its
+    request finishes Count steps, or Count / 16 ticks, later.
+*/
+static long Delay(unsigned long *Seed, long Count) {
+
+    long Unit = (Count / 32 > 0) ? Count / 32 : 1;
+
+    return Unit + (long)(NextRandom(Seed) % (unsigned long)(4 * Unit));
+}
+
+static double RunWheel(long Count, long Steps, long *Fired) {
+
+    TimerWheel_t *       Wheel    = NULL;
+    TimerWheel_Timer_t **Timers   = NULL;
+    uint64_t *           Expiries = NULL;
+    struct timespec      Start, End;
+    unsigned long        Seed = 2463534242UL;
+    long                 i = 0, Slot = 0;
+
+    Wheel    = TimerWheel_Create(0);
+    Timers   = (TimerWheel_Timer_t **)calloc((size_t)Count, sizeof(TimerWheel_Timer_t *));
+    Expiries = (uint64_t *)calloc((size_t)Count, sizeof(uint64_t));
+    if ( (NULL == Wheel) || (NULL == Timers) || (NULL == Expiries) ) {
+        TimerWheel_Release(Wheel);
+        free(Timers);
+        free(Expiries);
+        return 0.0;
+    }
+
+    *Fired = 0;
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for ( i = 0; i < Steps; i++ ) {
+        Slot = i % Count;
+        if ( (NULL != Timers[Slot]) && (Expiries[Slot] > TimerWheel_Now(Wheel)) ) {
+            TimerWheel_Cancel(Wheel, Timers[Slot]);
+        }
+
+        Expiries[Slot] = TimerWheel_Now(Wheel) + (uint64_t)Delay(&Seed, Count);
+        Timers[Slot]   = TimerWheel_Schedule(Wheel, Expiries[Slot], NULL, 0, NULL);
+
+        if ( 15 == (i % 16) ) {
+            TimerWheel_Advance(Wheel, TimerWheel_Now(Wheel) + 1, CountFired, Fired);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    TimerWheel_Release(Wheel);
+    free(Timers);
+    free(Expiries);
+
+    return ElapsedSeconds(&Start, &End) * 1e9 / (double)Steps;
+}
+
+static double RunQueue(long Count, long Steps, long *Fired) {
+
+    Priority_Queue_t *        Queue    = NULL;
+    Priority_Queue_Handle_t **Handles  = NULL;
+    long *                    Expiries = NULL;
+    struct timespec           Start, End;
+    unsigned long             Seed = 2463534242UL;
+    long                      i = 0, Slot = 0, Now = 0;
+
+    Queue    = Priority_Queue_Create(false);
+    Handles  = (Priority_Queue_Handle_t **)calloc((size_t)Count,
+                                                  sizeof(Priority_Queue_Handle_t *));
+    Expiries = (long *)calloc((size_t)Count, sizeof(long));
+    if ( (NULL == Queue) || (NULL == Handles) || (NULL == Expiries) ) {
+        Priority_Queue_Release(Queue);
+        free(Handles);
+        free(Expiries);
+        return 0.0;
+    }
+
+    *Fired = 0;
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for ( i = 0; i < Steps; i++ ) {
+        Slot = i % Count;
+        if ( (NULL != Handles[Slot]) && (Expiries[Slot] > Now) ) {
+            Priority_Queue_RemoveHandle(Queue, Handles[Slot]);
+        }
+
+        Expiries[Slot] = Now + Delay(&Seed, Count);
+        Handles[Slot]  = Priority_Queue_PushHandle(Queue, (int)Expiries[Slot], NULL, 0, NULL);
+
+        if ( 15 == (i % 16) ) {
+            Now++;
+            while ( (!Priority_Queue_IsEmpty(Queue)) &&
+                    (Priority_Queue_Peek(Queue).Priority <= Now) ) {
+                Priority_Queue_Pop(Queue);
+                (*Fired)++;
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    Priority_Queue_Release(Queue);
+    free(Handles);
+    free(Expiries);
+
+    return ElapsedSeconds(&Start, &End) * 1e9 / (double)Steps;
+}
+
+int main(int argc, char **argv) {
+
+    long   MaxCount = 1000000L, Count = 0, Steps = 0, WheelFired = 0, QueueFired = 0;
+    double WheelCost = 0, QueueCost = 0;
+
+    MaxCount = BenchArgument(argc, argv, 1, MaxCount);
+
+    if ( MaxCount < 1 ) {
+        return BenchFailed();
+    }
+
+    printf("Timeout churn, arm + finish of one request per step (ns/step)\n");
+    printf("%-12s %12s %12s %12s\n", "Pending", "TimerWheel", "Queue", "Fired");
+    for ( Count = 1000; Count <= MaxCount; Count *= 10 ) {
+        Steps     = 8 * Count;
+        WheelCost = RunWheel(Count, Steps, &WheelFired);
+        QueueCost = RunQueue(Count, Steps, &QueueFired);
+        printf("%-12ld %12.1f %12.1f %11.1f%%%s\n", Count, WheelCost, QueueCost,
+               100.0 * (double)WheelFired / (double)Steps,
+               (WheelFired == QueueFired) ? "" : " (mismatch)");
+    }
+
+    return 0;
+}
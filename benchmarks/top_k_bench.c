@@ -0,0 +1,131 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+    Top-K selection benchmark for Array_TopK() and Hashmap_TopKByValue().
+
+    The K largest of a large set of random integers are selected, comparing a full
+    Array_Sort() of a copy of the Array against Array_TopK(), and a full
+    Hashmap_KeysSorted() against Hashmap_TopKByValue(). Each is reported as the
+    total time to produce the result.
+
+    Usage: top_k_bench [ItemCount]
+*/
+
+#include "bench_common.h"
+
+#define LIBCONTAINER_ENABLE_ARRAY
+#define LIBCONTAINER_ENABLE_HASHMAP
+#include "../include/libcontainer.h"
+
+static double RunArraySort(Array_t *Array) {
+
+    Array_t *       Copy = NULL;
+    struct timespec Start, End;
+    size_t          i = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    Copy = Array_Create(Array_Length(Array), sizeof(int));
+    for ( i = 0; i < Array_Length(Array); i++ ) {
+        Array_Append(Copy, Array_GetElement(Array, i));
+    }
+    Array_Sort(Copy, CompareFunc_Int_Descending);
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    Array_Release(Copy);
+
+    return ElapsedSeconds(&Start, &End) * 1e3;
+}
+
+static double RunArrayTopK(Array_t *Array, size_t K) {
+
+    Array_t *       Top = NULL;
+    struct timespec Start, End;
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    Top = Array_TopK(Array, K, CompareFunc_Int_Descending);
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    Array_Release(Top);
+
+    return ElapsedSeconds(&Start, &End) * 1e3;
+}
+
+static double RunHashmap(Hashmap_t *Map, size_t K) {
+
+    Array_t *       Result = NULL;
+    struct timespec Start, End;
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    if ( 0 == K ) {
+        Result = Hashmap_KeysSorted(Map, CompareFunc_Int_Descending);
+    } else {
+        Result = Hashmap_TopKByValue(Map, K, CompareFunc_Int_Descending);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    Array_Release(Result);
+
+    return ElapsedSeconds(&Start, &End) * 1e3;
+}
+
+int main(int argc, char **argv) {
+
+    Array_t *     Array = NULL;
+    Hashmap_t *   Map   = NULL;
+    long          Count = 1000000L, i = 0;
+    size_t        K     = 0;
+    unsigned long Seed  = 2463534242UL;
+    int           Key = 0, Value = 0;
+
+    Count = BenchArgument(argc, argv, 1, Count);
+
+    Array = Array_Create((size_t)(Count > 0 ? Count : 1), sizeof(int));
+    Map   = Hashmap_Create(HashFunc_Int, sizeof(int), NULL);
+    if ( (NULL == Array) || (NULL == Map) || (Count < 1) ) {
+        Array_Release(Array);
+        Hashmap_Release(Map);
+        return BenchFailed();
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        Value = (int)(NextRandom(&Seed) & 0x7FFFFFFF);
+        Array_Append(Array, &Value);
+        Key   = (int)i;
+        Hashmap_Insert(Map, &Key, &Value, sizeof(int), sizeof(int), NULL);
+    }
+
+    printf("Top-K of %ld random integers, total time (ms)\n", Count);
+    printf("%-12s %12s %12s %14s %14s\n", "K", "Array_Sort", "Array_TopK", "KeysSorted",
+           "TopKByValue");
+    for ( K = 10; K <= 10000; K *= 10 ) {
+        printf("%-12lu %12.1f %12.1f %14.1f %14.1f\n", (unsigned long)K, RunArraySort(Array),
+               RunArrayTopK(Array, K), RunHashmap(Map, 0), RunHashmap(Map, K));
+    }
+
+    Array_Release(Array);
+    Hashmap_Release(Map);
+
+    return 0;
+}
@@ -40,6 +40,7 @@ extern "C" {
 #include <sys/types.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 /* ++++++++++ Cross-Container Macro Enabling ++++++++++ */
 /*
@@ -54,12 +55,15 @@ extern "C" {
 #define LIBCONTAINER_ENABLE_LIST
 #define LIBCONTAINER_ENABLE_HASHMAP
 #define LIBCONTAINER_ENABLE_BINARY_TREE
+#define LIBCONTAINER_ENABLE_BTREE
 #define LIBCONTAINER_ENABLE_SET
 #define LIBCONTAINER_ENABLE_STACK
 #define LIBCONTAINER_ENABLE_QUEUE
 #define LIBCONTAINER_ENABLE_STRING
 #define LIBCONTAINER_ENABLE_BINARY_HEAP
 #define LIBCONTAINER_ENABLE_PRIORITY_QUEUE
+#define LIBCONTAINER_ENABLE_TIMER_WHEEL
+#define LIBCONTAINER_ENABLE_TOP_K
 #endif
 
 /*
@@ -70,6 +74,30 @@ extern "C" {
 #define LIBCONTAINER_ENABLE_ARRAY
 #endif
 
+/*
+    The BTree_t container shares the Binary_Tree_KeyValuePair_t and
+    Binary_Tree_DuplicatePolicy_t types of the Binary_Tree_t container.
+*/
+#ifdef LIBCONTAINER_ENABLE_BTREE
+#define LIBCONTAINER_ENABLE_BINARY_TREE
+#endif
+
+/*
+    The TopK_t container returns its items as Binary_Heap_KeyValuePair_t, as
+    they are held within a Binary_Heap_t.
+*/
+#ifdef LIBCONTAINER_ENABLE_TOP_K
+#define LIBCONTAINER_ENABLE_BINARY_HEAP
+#endif
+
+/*
+    The Binary_Heap_t container requires the Array_t container for the
+    Binary_Heap_FromArray() function.
+*/
+#ifdef LIBCONTAINER_ENABLE_BINARY_HEAP
+#define LIBCONTAINER_ENABLE_ARRAY
+#endif
+
 /* ---------- Cross-Container Macro Enabling ---------- */
 
 /* ++++++++++ Exported Library Macros ++++++++++ */
@@ -143,6 +171,21 @@ extern "C" {
 #define BINARY_TREE_FOREACH(List, KeyValuePair, Direction) for ((KeyValuePair) = Binary_Tree_Next((Tree), (Direction)); (NULL != (KeyValuePair).Key); (KeyValuePair) = Binary_Tree_Next((Tree), (Direction)))
 #endif
 
+#ifdef LIBCONTAINER_ENABLE_BTREE
+
+/*
+    BTREE_FOREACH
+
+    This macro expands to a simple for-each loop over a BTree_t container,
+    visiting each Key-Value pair in sorted order.
+
+    Inputs:
+    Tree        -   The BTree_t to iterate over.
+    KeyValuePair-   The local Binary_Tree_KeyValuePair_t to hold each next item from the Tree.
+*/
+#define BTREE_FOREACH(Tree, KeyValuePair) for ((KeyValuePair) = BTree_Next(Tree); (NULL != (KeyValuePair).Key); (KeyValuePair) = BTree_Next(Tree))
+#endif
+
 #ifdef LIBCONTAINER_ENABLE_SET
 
 /*
@@ -347,6 +390,23 @@ typedef struct Hashmap_KeyValuePair_t {
     void* Value;
 } Hashmap_KeyValuePair_t;
 
+/*
+    Hashmap_Frozen_t
+
+    A Hashmap_Frozen_t is an immutable snapshot of a Hashmap_t, built by Hashmap_Freeze().
+    The entire table is a single contiguous buffer, indexed by a minimal perfect hash of the
+    Keys, so every lookup inspects exactly one slot. The buffer holds no pointers, so it can
+    be saved to disk and memory-mapped directly on the next start, with no rebuilding.
+
+    This struct is opaque to ensure all accesses are performed
+    through the functions provided in this library to ensure
+    safe access and operation.
+
+    See the functions prefixed with "Hashmap_Frozen" for the available operations
+    on frozen Hashmaps.
+*/
+typedef struct Hashmap_Frozen_t Hashmap_Frozen_t;
+
 /* ---------- Public Hashmap_t Typedefs ---------- */
 #endif
 
@@ -376,6 +436,33 @@ typedef struct Hashmap_KeyValuePair_t {
 */
 typedef struct Binary_Tree_t Binary_Tree_t;
 
+/*
+    Binary_Tree_Snapshot_t
+
+    A Binary_Tree_Snapshot_t is an immutable view of a Binary_Tree_t, exactly as it
+    was when the Snapshot was taken. The Snapshot shares its Nodes with the Tree, and
+    the Tree copies only the Nodes along the path of each later modification, so a
+    Snapshot is O(1) to take, and costs the Tree O(log n) extra allocations per
+    modification while it is held.
+
+    This struct is opaque, see the functions prefixed with "Binary_Tree_Snapshot"
+    for the available operations.
+*/
+typedef struct Binary_Tree_Snapshot_t Binary_Tree_Snapshot_t;
+
+/*
+    Binary_Tree_Frozen_t
+
+    A Binary_Tree_Frozen_t is a read-only copy of a Binary_Tree_t of fixed-size Keys,
+    laid out for searching rather than modification. The Keys are held in a single
+    contiguous array in Eytzinger (breadth-first) order, so a search walks down a
+    complete binary tree by index arithmetic alone, without chasing Node pointers.
+
+    This struct is opaque, see the functions prefixed with "Binary_Tree_Frozen"
+    for the available operations.
+*/
+typedef struct Binary_Tree_Frozen_t Binary_Tree_Frozen_t;
+
 /*
     Binary_Tree_Direction_t
 
@@ -438,6 +525,33 @@ typedef struct Binary_Tree_KeyValuePair_t {
 /* --------- Public Binary_Tree_t Typedefs --------- */
 #endif
 
+#ifdef LIBCONTAINER_ENABLE_BTREE
+/* +++++++++ Public BTree_t Typedefs +++++++++ */
+
+/*
+    BTree_t
+
+    A BTree_t is an ordered Key-Value container, implemented as a B+tree. Each
+    Node of the tree holds many Keys in a single contiguous allocation sized to
+    a small number of cache lines, so a lookup touches far fewer cache lines
+    than in a Binary_Tree_t. All items are held in the leaves, which are linked
+    together in sorted order for fast in-order iteration.
+
+    Keys of a fixed size are copied inline into the Nodes, while a BTree_t
+    created with a KeySize of 0 holds a pointer to each Key instead.
+
+    This struct is opaque to ensure all accesses are performed
+    through the functions provided in this library to ensure
+    safe access and operation.
+
+    See the functions prefixed with "BTree_" for the available operations
+    on this container.
+*/
+typedef struct BTree_t BTree_t;
+
+/* --------- Public BTree_t Typedefs --------- */
+#endif
+
 #ifdef LIBCONTAINER_ENABLE_BINARY_HEAP
 /* ++++++++++ Public Binary_Heap_t Typedefs ++++++++++ */
 
@@ -479,6 +593,15 @@ typedef struct Binary_Heap_KeyValuePair_t {
 */
 typedef struct Binary_Heap_t Binary_Heap_t;
 
+/*
+    Binary_Heap_Handle_t
+
+    This opaque type refers to a single item within a Binary_Heap_t, as returned by
+    Binary_Heap_PushHandle(). A Handle remains valid for as long as its item stays
+    within the Heap, however the item moves as other items are added or removed.
+*/
+typedef struct Binary_Heap_Handle_t Binary_Heap_Handle_t;
+
 /* ---------- Public Binary_Heap_t Typedefs ---------- */
 #endif
 
@@ -591,6 +714,19 @@ typedef struct Priority_Queue_Item_t {
 
 } Priority_Queue_Item_t;
 
+/*
+    Priority_Queue_Priority_t
+
+    This enum defines the native types of Priority a Priority_Queue_t created with
+    Priority_Queue_CreateTyped() can hold. The Priorities of such a Queue are stored
+    inline with each item, and compared directly rather than through a CompareFunc_t.
+*/
+typedef enum Priority_Queue_Priority_t {
+    Priority_Int,
+    Priority_Int64,
+    Priority_Double
+} Priority_Queue_Priority_t;
+
 /*
     Priority_Queue_t
 
@@ -618,6 +754,15 @@ typedef struct Priority_Queue_Item_t {
 */
 typedef struct Priority_Queue_t Priority_Queue_t;
 
+/*
+    Priority_Queue_Handle_t
+
+    This opaque type refers to a single item within a Priority_Queue_t, as returned by
+    Priority_Queue_PushHandle(). A Handle remains valid for as long as its item stays
+    within the Queue.
+*/
+typedef struct Priority_Queue_Handle_t Priority_Queue_Handle_t;
+
 /* ---------- Public Priority_Queue_t Typedefs ---------- */
 #endif
 
@@ -643,6 +788,67 @@ typedef struct String_t String_t;
 /* ---------- Public String_t Typedefs ---------- */
 #endif
 
+#ifdef LIBCONTAINER_ENABLE_TIMER_WHEEL
+/* ++++++++++ Public TimerWheel_t Typedefs ++++++++++ */
+
+/*
+    TimerWheel_t
+
+    This container holds a set of timers, each of which carries a Value and expires at
+    a given tick of a caller-defined clock. It is intended for large numbers of timeouts,
+    most of which are cancelled before they ever expire, such as per-connection or
+    per-request deadlines.
+
+    Timers are kept in a hierarchical timing wheel, so scheduling and cancelling a timer
+    are both O(1), and advancing the clock only touches the timers which are due, plus
+    a bounded number of moves of each timer between the levels of the wheel.
+
+    This struct is opaque to ensure all accesses are performed
+    through the functions provided in this library to ensure
+    safe access and operation.
+
+    See the functions prefixed with "TimerWheel_" for the available operations
+    on this container.
+*/
+typedef struct TimerWheel_t TimerWheel_t;
+
+/*
+    TimerWheel_Timer_t
+
+    This opaque type refers to a single timer within a TimerWheel_t, as returned by
+    TimerWheel_Schedule(). A Timer remains valid until it either expires or is cancelled.
+*/
+typedef struct TimerWheel_Timer_t TimerWheel_Timer_t;
+
+/* ---------- Public TimerWheel_t Typedefs ---------- */
+#endif
+
+#ifdef LIBCONTAINER_ENABLE_TOP_K
+/* ++++++++++ Public TopK_t Typedefs ++++++++++ */
+
+/*
+    TopK_t
+
+    This container accumulates a stream of items, keeping only the K items which come
+    first in the order defined by its CompareFunc_t, which are the same K items which
+    Array_Sort() would place first. Each item offered costs O(log K) time at most, and
+    the container never holds more than K items.
+
+    The items are held within a Binary_Heap_t of at most K items, with the last of
+    the items kept at its root, so most items offered are rejected by a single comparison.
+
+    This struct is opaque to ensure all accesses are performed
+    through the functions provided in this library to ensure
+    safe access and operation.
+
+    See the functions prefixed with "TopK_" for the available operations
+    on this container.
+*/
+typedef struct TopK_t TopK_t;
+
+/* ---------- Public TopK_t Typedefs ---------- */
+#endif
+
 /* ++++++++++ General Public Library Typedefs ++++++++++ */
 
 /*
@@ -1298,6 +1504,32 @@ int Array_DoCallbackArg(Array_t* Array, CallbackArgFunc_t* Callback, void* Args)
 */
 int Array_Sort(Array_t* Array, CompareFunc_t* CompareFunc);
 
+/*
+    Array_TopK
+
+    This function returns the first K elements of the Array in the order defined
+    by the CompareFunc, which are the same elements Array_Sort() would place first,
+    without sorting or copying the full Array. This takes O(n log K) time, and the
+    memory used beyond the result is proportional to K rather than to the Array.
+
+    Inputs:
+    Array       -   Pointer to the Array_t to operate on. This is not modified.
+    K           -   The number of elements to return. This must be non-zero.
+    CompareFunc -   Pointer to the function to use to compare two elements of the array.
+                        Use a descending comparison to select the K largest elements.
+
+    Outputs:
+    Array_t*    -   Pointer to a new Array_t holding the min(K, Length) first elements,
+                        in order, on success, or NULL on failure.
+
+    Note:
+    For an Array from Array_Create(), the returned Array holds copies of the elements.
+    For an Array from Array_RefCreate(), it holds pointers to the original elements,
+    and does not release them. Either way, the caller must release the returned
+    Array_t with Array_Release().
+*/
+Array_t* Array_TopK(Array_t* Array, size_t K, CompareFunc_t* CompareFunc);
+
 /*
     Array_Release
 
@@ -1800,6 +2032,36 @@ HashFunc_t HashFunc_String;
 */
 Hashmap_t* Hashmap_Create(HashFunc_t* HashFunc, size_t KeySize, ReleaseFunc_t* KeyReleaseFunc);
 
+/*
+    Hashmap_CreateConcurrent
+
+    This function will create and prepare a Hashmap_t which is safe to use from many threads
+    at once. The Map is split into a number of independent shards, each guarded by its own
+    reader-writer lock. A Key always maps to the same shard, so Hashmap_Retrieve() and
+    Hashmap_KeyExists() only ever wait on a writer to that same shard, and writers to
+    different shards never contend with each other.
+
+    The returned Map is used through exactly the same Hashmap_* functions as any other.
+
+    Inputs:
+    HashFunc        -   Pointer to the function to use to convert the given Key type to a Hash value.
+                            See Hashmap_Create() for more information.
+    KeySize         -   The size (in bytes) of the Key type for this Hashmap_t.
+    KeyReleaseFunc  -   Pointer to the function to use to release any resources held by the Key types.
+    ShardCount      -   The number of shards to split the Map into. This is rounded up to a power
+                            of two, and 0 selects LIBCONTAINER_HASHMAP_CONCURRENT_SHARDS.
+
+    Outputs:
+    Hashmap_t*  -   A fully prepared and ready-to-use concurrent Hashmap_t on success, or NULL on failure.
+
+    Note:
+    Only the individual operations are atomic. A pointer returned by Hashmap_Retrieve() refers to
+    memory owned by the Map, and is only valid until another thread Removes or overwrites that Key.
+    Iteration (Hashmap_Next(), Hashmap_DoCallback(), ...), Hashmap_Clear() and Hashmap_Release()
+    must not run concurrently with any other operation on the same Map.
+*/
+Hashmap_t* Hashmap_CreateConcurrent(HashFunc_t* HashFunc, size_t KeySize, ReleaseFunc_t* KeyReleaseFunc, size_t ShardCount);
+
 /*
     Hashmap_Length
 
@@ -1919,6 +2181,31 @@ Array_t* Hashmap_Keys(Hashmap_t* Map);
 */
 Array_t* Hashmap_KeysSorted(Hashmap_t* Map, CompareFunc_t* CompareFunc);
 
+/*
+    Hashmap_TopKByValue
+
+    This function returns the K items of the Hashmap whose Values come first in the
+    order defined by the CompareFunc, without collecting or sorting the full set of
+    Keys. This takes O(n log K) time, and the memory used is proportional to K.
+
+    Inputs:
+    Map         -   Pointer to the Hashmap_t to operate on.
+    K           -   The number of items to return. This must be non-zero.
+    CompareFunc -   Pointer to the comparison function to use to order the Values.
+                        Use a descending comparison to select the K largest Values.
+
+    Outputs:
+    Array_t*    -   Pointer to an Array_t of Hashmap_KeyValuePair_t, holding the
+                        min(K, Length) selected items in order on success, or NULL on failure.
+
+    Note:
+    As with Hashmap_Keys(), the returned pairs point to the original items. If the
+    original items are manipulated or deleted, this returned Array_t has no knowledge
+    of this. It is the responsibility of the caller to release the returned
+    Array_t with Array_Release().
+*/
+Array_t* Hashmap_TopKByValue(Hashmap_t* Map, size_t K, CompareFunc_t* CompareFunc);
+
 /*
     Hashmap_Pop
 
@@ -2085,6 +2372,52 @@ int Hashmap_DoCallback(Hashmap_t* Map, CallbackFunc_t* Callback);
 
 int Hashmap_DoCallbackArg(Hashmap_t* Map, CallbackArgFunc_t* Callback, void* Args);
 
+/*
+    Hashmap_Scan
+
+    This function performs one step of an incremental walk over the Hashmap, calling
+    the given Callback on a small batch of items and returning a cursor to resume from.
+    The cursor holds all of the state of the walk, so the Hashmap may be freely modified,
+    and even resized, between calls. Every item present for the whole duration of the
+    walk is visited at least once.
+
+    Inputs:
+    Map         -   Pointer to the Hashmap_t to operate on.
+    Cursor      -   The cursor returned by the previous call, or 0 to begin a new walk.
+    Count       -   The number of items to attempt to visit before returning. This is a hint,
+                        as whole buckets are always visited at once.
+    Callback    -   Pointer to the Callback function to call for each item of the hashmap.
+
+    Outputs:
+    size_t  -   The cursor to pass to the next call, or 0 once the walk is complete.
+
+    Note:
+    As with Hashmap_DoCallback(), the *Value* pointer provided to the callback
+    is a pointer to a Hashmap_KeyValuePair_t. The Callback must not modify the Hashmap.
+    Items inserted or removed during the walk may or may not be visited, and an
+    item may be visited more than once if the Hashmap is resized between calls.
+*/
+size_t Hashmap_Scan(Hashmap_t* Map, size_t Cursor, size_t Count, CallbackFunc_t* Callback);
+
+/*
+    Hashmap_ScanArg
+
+    This function is equivalent to Hashmap_Scan(), with the addition of passing
+    the given Args to every call of the Callback function.
+
+    Inputs:
+    Map         -   Pointer to the Hashmap_t to operate on.
+    Cursor      -   The cursor returned by the previous call, or 0 to begin a new walk.
+    Count       -   The number of items to attempt to visit before returning.
+    Callback    -   Pointer to the Callback function to call for each item of the hashmap.
+    Args        -   Pointer to some additional argument(s), values, resources, etc. to pass
+                        in to the Callback function along with the item value.
+
+    Outputs:
+    size_t  -   The cursor to pass to the next call, or 0 once the walk is complete.
+*/
+size_t Hashmap_ScanArg(Hashmap_t* Map, size_t Cursor, size_t Count, CallbackArgFunc_t* Callback, void* Args);
+
 /*
     Hashmap_Clear
 
@@ -2099,6 +2432,22 @@ int Hashmap_DoCallbackArg(Hashmap_t* Map, CallbackArgFunc_t* Callback, void* Arg
 */
 int Hashmap_Clear(Hashmap_t* Map);
 
+/*
+    Hashmap_Compact
+
+    This function will release as much of the memory held by the Hashmap as possible,
+    without removing any items. The Hashmap already halves its internal table as
+    items are removed, so this is only needed to reclaim memory immediately after
+    a large number of removals, such as after a transient spike in size.
+
+    Inputs:
+    Map     -   Pointer to the Hashmap to operate on.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure.
+*/
+int Hashmap_Compact(Hashmap_t* Map);
+
 /*
     Hashmap_Release
 
@@ -2116,6 +2465,129 @@ int Hashmap_Clear(Hashmap_t* Map);
 */
 void Hashmap_Release(Hashmap_t* Map);
 
+/*
+    Hashmap_Freeze
+
+    This function will build a read-only, perfect-hashed copy of the given Hashmap.
+    The copy holds every Key and Value in a single contiguous buffer, with no
+    per-entry allocations, and finds any Key with a single probe. The original
+    Hashmap is not modified, and may be released independently of the copy.
+
+    Inputs:
+    Map     -   Pointer to the Hashmap_t to freeze.
+
+    Outputs:
+    Hashmap_Frozen_t*   -   Pointer to the frozen copy of the Hashmap, or NULL on failure.
+
+    Note:
+    Only Keys and Values which are owned by the Hashmap (inserted with a non-zero size)
+    can be frozen, as reference-type items cannot be copied. As the frozen Hashmap
+    does not use the HashFunc_t of the original, variable-sized Keys are compared by
+    their bytes, ignoring any trailing NUL terminator.
+*/
+Hashmap_Frozen_t* Hashmap_Freeze(Hashmap_t* Map);
+
+/*
+    Hashmap_FrozenLength
+
+    This function will return the number of items held within a frozen Hashmap.
+
+    Inputs:
+    Frozen  -   Pointer to the frozen Hashmap to query the length of.
+
+    Outputs:
+    size_t  -   The count of items contained within the frozen Hashmap.
+*/
+size_t Hashmap_FrozenLength(Hashmap_Frozen_t* Frozen);
+
+/*
+    Hashmap_FrozenKeyExists
+
+    This function will check the frozen Hashmap for the given Key.
+
+    Inputs:
+    Frozen  -   Pointer to the frozen Hashmap to operate on.
+    Key     -   Pointer to the Key Value to use.
+    KeySize -   Size of the Key value, as measured in bytes. See Hashmap_FrozenRetrieve().
+
+    Outputs:
+    bool    -   Returns true if the key exists within the frozen Hashmap, false otherwise.
+*/
+bool Hashmap_FrozenKeyExists(Hashmap_Frozen_t* Frozen, const void* Key, size_t KeySize);
+
+/*
+    Hashmap_FrozenRetrieve
+
+    This function will return a pointer to the value corresponding to the given Key
+    in the frozen Hashmap, if it exists.
+
+    Inputs:
+    Frozen  -   Pointer to the frozen Hashmap to operate on.
+    Key     -   Pointer to the Key Value to use.
+    KeySize -   Size of the Key value, as measured in bytes. This may be 0 for fixed-size
+                    Keys, in which case the size of the original Hashmap Keys is used,
+                    or for string Keys, in which case strlen() is used.
+
+    Outputs:
+    void*   -   Pointer to the value corresponding to the given Key, or NULL if the Key is
+                    not within the frozen Hashmap.
+
+    Note:
+    The returned value must be treated as read-only, as it may refer to a read-only
+    memory mapping. Values are aligned to 8 bytes. As the frozen Hashmap is never
+    modified, this may safely be called from any number of threads at once.
+*/
+void* Hashmap_FrozenRetrieve(Hashmap_Frozen_t* Frozen, const void* Key, size_t KeySize);
+
+/*
+    Hashmap_FrozenSave
+
+    This function will write the buffer of a frozen Hashmap to the given file,
+    such that it can later be re-opened with Hashmap_FrozenOpenMapped().
+
+    Inputs:
+    Frozen  -   Pointer to the frozen Hashmap to save.
+    Path    -   Path of the file to create or overwrite.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure.
+
+    Note:
+    The file is written in the native byte order, and will be rejected if opened
+    on a machine of the opposite endianness.
+*/
+int Hashmap_FrozenSave(Hashmap_Frozen_t* Frozen, const char* Path);
+
+/*
+    Hashmap_FrozenOpenMapped
+
+    This function will memory-map a file previously written by Hashmap_FrozenSave(),
+    returning a frozen Hashmap which reads directly from the mapping. Only the header
+    is checked on opening, so this takes the same time regardless of the size of the
+    Hashmap, and pages are only read from disk as lookups touch them.
+
+    Inputs:
+    Path    -   Path of the file to open.
+
+    Outputs:
+    Hashmap_Frozen_t*   -   Pointer to the frozen Hashmap, or NULL on failure.
+*/
+Hashmap_Frozen_t* Hashmap_FrozenOpenMapped(const char* Path);
+
+/*
+    Hashmap_FrozenRelease
+
+    This function will release a frozen Hashmap, either freeing or un-mapping
+    the buffer holding it.
+
+    Inputs:
+    Frozen  -   Pointer to the frozen Hashmap to release.
+
+    Outputs:
+    None, the frozen Hashmap and its buffer are released.
+*/
+void Hashmap_FrozenRelease(Hashmap_Frozen_t* Frozen);
+
 /* ---------- Public Hashmap_t Functions ---------- */
 #endif
 
@@ -2142,6 +2614,32 @@ void Hashmap_Release(Hashmap_t* Map);
 */
 Binary_Tree_t* Binary_Tree_Create(CompareFunc_t* KeyCompareFunc, size_t KeySize, ReleaseFunc_t* KeyReleaseFunc, Binary_Tree_DuplicatePolicy_t Policy);
 
+/*
+    Binary_Tree_BuildFromSorted
+
+    This function will create a new Binary_Tree_t, bulk-loaded from an array of Keys which
+    are already in strictly ascending order. The tree is built directly in its final,
+    perfectly balanced shape in O(n) time, with no searching and no rotations.
+
+    Inputs:
+    KeyCompareFunc      -   Pointer to the function to use to compare keys. Leave NULL to default to memcmp().
+    KeySize             -   The size of each Key, measured in bytes. Must be non-zero.
+    KeyReleaseFunc      -   Pointer to the function to use to release a Key. Leave NULL to default to free().
+    Policy              -   The policy for how to handle duplicated Keys on later insertions.
+    Keys                -   Pointer to the contiguous array of Count Keys, in strictly ascending order.
+    Values              -   Pointer to the array of Count Values, parallel to Keys. Leave NULL to
+                                insert only the Keys.
+    ValueSize           -   The size of each Value, measured in bytes. If 0, Values is treated as
+                                an array of Count pointers, which are held as Reference-Types.
+    ValueReleaseFunc    -   Pointer to the function to use to release a Value. Leave NULL to default to free().
+    Count               -   The number of Keys (and Values) to load.
+
+    Outputs:
+    Binary_Tree_t*  -   Pointer to the fully constructed and loaded Binary Tree, or NULL on
+                            failure, including if the Keys are not strictly ascending.
+*/
+Binary_Tree_t* Binary_Tree_BuildFromSorted(CompareFunc_t* KeyCompareFunc, size_t KeySize, ReleaseFunc_t* KeyReleaseFunc, Binary_Tree_DuplicatePolicy_t Policy, void* Keys, void* Values, size_t ValueSize, ReleaseFunc_t* ValueReleaseFunc, size_t Count);
+
 /*
     Binary_Tree_Length
 
@@ -2181,18 +2679,65 @@ size_t Binary_Tree_Length(Binary_Tree_t* Tree);
 int Binary_Tree_Insert(Binary_Tree_t* Tree, void* Key, size_t KeySize, void* Value, size_t ValueSize, ReleaseFunc_t* ValueReleaseFunc);
 
 /*
-    Binary_Tree_KeyExists
+    Binary_Tree_Upsert
 
-    This function will check if the given Key exists within the Tree.
-    If this returns true, and no *_Remove() or *_Pop() are performed,
-    the next *_Get() or *_Pop() will guarantee a non-NULL return value.
+    This function adds a new Key/Value pair to the Tree, or replaces the Value of the
+    existing item with this Key in place, regardless of the Duplicate Policy of the Tree.
 
     Inputs:
-    Tree    -   Pointer to the Tree to operate on.
-    Key     -   Pointer to the Key value to insert.
-    KeySize -   The size of the Key value to be inserted.
-
-    Outputs:
+    Tree                -   Pointer to the Tree to operate on.
+    Key                 -   Pointer to the Key value to insert.
+    KeySize             -   The size of the Key value to be inserted.
+    Value               -   Pointer to the Value to insert.
+    ValueSize           -   The size of the Value to be inserted.
+    ValueReleaseFunc    -   Pointer to the function to call to release the resources associated
+                                with the Value.
+
+    Outputs:
+    int     -   Returns 0 on success, positive on error.
+
+    Note:
+    The Tree is only descended once, and a new Node is only allocated if the Key is new.
+*/
+int Binary_Tree_Upsert(Binary_Tree_t* Tree, void* Key, size_t KeySize, void* Value, size_t ValueSize, ReleaseFunc_t* ValueReleaseFunc);
+
+/*
+    Binary_Tree_GetOrInsert
+
+    This function returns the Value associated with the given Key. If the Key does not
+    exist in the Tree, the given Key/Value pair is inserted first.
+
+    Inputs:
+    Tree                -   Pointer to the Tree to operate on.
+    Key                 -   Pointer to the Key value to search for or insert.
+    KeySize             -   The size of the Key value.
+    Value               -   Pointer to the Value to insert if the Key is not found.
+    ValueSize           -   The size of the Value to be inserted.
+    ValueReleaseFunc    -   Pointer to the function to call to release the resources associated
+                                with the Value.
+
+    Outputs:
+    void*   -   Pointer to the Value held by the Tree for this Key, which may be modified
+                    in place. Returns NULL on error, or if the held Value is NULL.
+
+    Note:
+    If the Key already exists, the provided Value is not used and remains owned by the caller.
+*/
+void* Binary_Tree_GetOrInsert(Binary_Tree_t* Tree, void* Key, size_t KeySize, void* Value, size_t ValueSize, ReleaseFunc_t* ValueReleaseFunc);
+
+/*
+    Binary_Tree_KeyExists
+
+    This function will check if the given Key exists within the Tree.
+    If this returns true, and no *_Remove() or *_Pop() are performed,
+    the next *_Get() or *_Pop() will guarantee a non-NULL return value.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to operate on.
+    Key     -   Pointer to the Key value to insert.
+    KeySize -   The size of the Key value to be inserted.
+
+    Outputs:
     bool    -   Returns true if the Key exists within the tree, false if it does not.
 */
 bool Binary_Tree_KeyExists(Binary_Tree_t* Tree, void* Key, size_t KeySize);
@@ -2286,6 +2831,127 @@ int Binary_Tree_DoCallback(Binary_Tree_t* Tree, Binary_Tree_Direction_t Directio
 */
 int Binary_Tree_DoCallbackArg(Binary_Tree_t* Tree, Binary_Tree_Direction_t Direction, CallbackArgFunc_t* Callback, void* Args);
 
+/*
+    Binary_Tree_LowerBound
+
+    This function seeks to the item with the smallest Key which is not less than
+    the given Key, in O(log n) time.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to search.
+    Key     -   Pointer to the Key value to seek to. This need not exist in the Tree.
+    KeySize -   The size of the Key value.
+
+    Outputs:
+    Binary_Tree_KeyValuePair_t  -   The Key-Value pair of the item found, or a pair of
+                                        NULL pointers if every Key is less than the given Key.
+
+    Note:
+    This is the ceiling of the given Key, the counterpart of Binary_Tree_Floor().
+*/
+Binary_Tree_KeyValuePair_t Binary_Tree_LowerBound(Binary_Tree_t* Tree, void* Key, size_t KeySize);
+
+/*
+    Binary_Tree_UpperBound
+
+    This function seeks to the item with the smallest Key which is strictly greater
+    than the given Key, in O(log n) time.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to search.
+    Key     -   Pointer to the Key value to seek to. This need not exist in the Tree.
+    KeySize -   The size of the Key value.
+
+    Outputs:
+    Binary_Tree_KeyValuePair_t  -   The Key-Value pair of the item found, or a pair of
+                                        NULL pointers if no Key is greater than the given Key.
+*/
+Binary_Tree_KeyValuePair_t Binary_Tree_UpperBound(Binary_Tree_t* Tree, void* Key, size_t KeySize);
+
+/*
+    Binary_Tree_Floor
+
+    This function seeks to the item with the largest Key which is not greater than
+    the given Key, in O(log n) time.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to search.
+    Key     -   Pointer to the Key value to seek to. This need not exist in the Tree.
+    KeySize -   The size of the Key value.
+
+    Outputs:
+    Binary_Tree_KeyValuePair_t  -   The Key-Value pair of the item found, or a pair of
+                                        NULL pointers if every Key is greater than the given Key.
+*/
+Binary_Tree_KeyValuePair_t Binary_Tree_Floor(Binary_Tree_t* Tree, void* Key, size_t KeySize);
+
+/*
+    Binary_Tree_RangeCallback
+
+    This function calls the given Callback function on each item with a Key in the
+    half-open range [ Lo, Hi ), in ascending Key order. The first item is found with
+    a single O(log n) seek, and the range is then walked by in-order successors, for
+    a total cost of O(log n + k) for k items in the range.
+
+    Inputs:
+    Tree        -   Pointer to the Tree to operate on.
+    Lo          -   Pointer to the inclusive lower bound of the range, or NULL to start
+                        from the smallest Key in the Tree.
+    LoSize      -   The size of the Lo Key value.
+    Hi          -   Pointer to the exclusive upper bound of the range, or NULL to continue
+                        to the largest Key in the Tree.
+    HiSize      -   The size of the Hi Key value.
+    Callback    -   Pointer to the Callback function to call for each item in the range.
+    Args        -   Optional additional arguments to pass to the Callback
+                        function along with the Key-Value pair.
+
+    Outputs:
+    int     -   Returns 0 on success, negative if iteration over the Binary_Tree_t could not happen,
+                    and positive to indicate the number of Callback functions which returned non-zero.
+
+    Note:
+    The "Value*" provided to the Callback function consists of a
+        void*[2] = { Key, Value }
+    A pointer to the Key, and the pointer to the Value of each item.
+
+    The Callback must not insert or remove items from the Tree.
+*/
+int Binary_Tree_RangeCallback(Binary_Tree_t* Tree, void* Lo, size_t LoSize, void* Hi, size_t HiSize, CallbackArgFunc_t* Callback, void* Args);
+
+/*
+    Binary_Tree_Rank
+
+    This function returns the number of items in the Tree with a Key strictly less
+    than the given Key, in O(log n) time. For a Key present in the Tree, this is its
+    0-based position in ascending Key order.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to search.
+    Key     -   Pointer to the Key value to rank. This need not exist in the Tree.
+    KeySize -   The size of the Key value.
+
+    Outputs:
+    size_t  -   The number of Keys less than the given Key, or 0 on error.
+*/
+size_t Binary_Tree_Rank(Binary_Tree_t* Tree, void* Key, size_t KeySize);
+
+/*
+    Binary_Tree_Select
+
+    This function returns the item at the given 0-based position in ascending Key
+    order, in O(log n) time. This is the inverse of Binary_Tree_Rank(), and allows
+    medians and percentiles to be read directly, e.g. Index = Binary_Tree_Length(Tree) / 2.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to search.
+    Index   -   The 0-based position of the item to return.
+
+    Outputs:
+    Binary_Tree_KeyValuePair_t  -   The Key-Value pair of the item found, or a pair of
+                                        NULL pointers if Index is out of range.
+*/
+Binary_Tree_KeyValuePair_t Binary_Tree_Select(Binary_Tree_t* Tree, size_t Index);
+
 /*
     Binary_Tree_Remove
 
@@ -2390,9 +3056,456 @@ int Binary_Tree_Clear(Binary_Tree_t* Tree);
 */
 void Binary_Tree_Release(Binary_Tree_t* Tree);
 
+/*
+    Binary_Tree_Snapshot
+
+    This function takes a Snapshot of the current contents of the Tree. Later
+    modifications of the Tree are not visible through the Snapshot.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to take a Snapshot of.
+
+    Outputs:
+    Binary_Tree_Snapshot_t* -   Pointer to the new Snapshot, or NULL on failure.
+
+    Note:
+    Reading a Snapshot never modifies anything it shares with the Tree, so any number
+    of threads may read Snapshots without locking, concurrently with one thread
+    modifying the Tree. Taking and releasing Snapshots must be serialized with the
+    modifications of the Tree, as these adjust the reference counts of shared Nodes.
+
+    The Keys and Values themselves are shared, not copied. Replace a Value with
+    Binary_Tree_Upsert(), rather than modifying it in place, for the change to stay
+    out of the Snapshots holding it. Popping a Reference-Type item still held by a
+    Snapshot fails, while an owned item is popped as a copy.
+*/
+Binary_Tree_Snapshot_t* Binary_Tree_Snapshot(Binary_Tree_t* Tree);
+
+/*
+    Binary_Tree_Snapshot_Length
+
+    This function returns the number of items held by the Snapshot.
+
+    Inputs:
+    Snapshot    -   Pointer to the Snapshot to operate on.
+
+    Outputs:
+    size_t  -   The number of items in the Tree when the Snapshot was taken.
+*/
+size_t Binary_Tree_Snapshot_Length(Binary_Tree_Snapshot_t* Snapshot);
+
+/*
+    Binary_Tree_Snapshot_KeyExists
+
+    This function checks whether the given Key was in the Tree when the Snapshot was taken.
+
+    Inputs:
+    Snapshot    -   Pointer to the Snapshot to operate on.
+    Key         -   Pointer to the Key to search for.
+    KeySize     -   The size of the Key, or 0 to use the KeySize of the Tree.
+
+    Outputs:
+    bool    -   Returns true if the Key exists in the Snapshot, false otherwise.
+*/
+bool Binary_Tree_Snapshot_KeyExists(Binary_Tree_Snapshot_t* Snapshot, void* Key, size_t KeySize);
+
+/*
+    Binary_Tree_Snapshot_Get
+
+    This function returns the Value associated with the given Key in the Snapshot.
+
+    Inputs:
+    Snapshot    -   Pointer to the Snapshot to operate on.
+    Key         -   Pointer to the Key to search for.
+    KeySize     -   The size of the Key, or 0 to use the KeySize of the Tree.
+
+    Outputs:
+    void*   -   Pointer to the Value associated with the Key, or NULL on failure.
+                    This Value is shared with the Tree, and must not be modified.
+*/
+void* Binary_Tree_Snapshot_Get(Binary_Tree_Snapshot_t* Snapshot, void* Key, size_t KeySize);
+
+/*
+    Binary_Tree_Snapshot_DoCallbackArg
+
+    This function traverses the Snapshot in-order, calling the given Callback function
+    on each of the items.
+
+    Inputs:
+    Snapshot    -   Pointer to the Snapshot to operate on.
+    Callback    -   Pointer to the Callback function to call for each item.
+    Args        -   Optional additional arguments to pass to the Callback
+                        function along with the Key-Value pair.
+
+    Outputs:
+    int     -   Returns 0 on success, negative if iteration over the Snapshot could not happen,
+                    and positive to indicate the number of Callback functions which returned non-zero.
+
+    Note:
+    The "Value*" provided to the Callback function is a pointer to a
+    Binary_Tree_KeyValuePair_t, as with Binary_Tree_DoCallbackArg().
+*/
+int Binary_Tree_Snapshot_DoCallbackArg(Binary_Tree_Snapshot_t* Snapshot, CallbackArgFunc_t* Callback, void* Args);
+
+/*
+    Binary_Tree_Snapshot_Release
+
+    This function releases a Snapshot, along with every Node, Key and Value which
+    is no longer held by the Tree or any other Snapshot.
+
+    Inputs:
+    Snapshot    -   Pointer to the Snapshot to release.
+
+    Outputs:
+    None, the Snapshot is released.
+
+    Note:
+    A Snapshot may be released before or after the Tree it was taken from.
+*/
+void Binary_Tree_Snapshot_Release(Binary_Tree_Snapshot_t* Snapshot);
+
+/*
+    Binary_Tree_Freeze
+
+    This function creates a Frozen copy of the current contents of the Tree, for
+    read-heavy workloads. The Tree itself is left unchanged, and may continue to be
+    modified or released without affecting the Frozen copy.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to freeze. This must hold fixed-size Keys.
+
+    Outputs:
+    Binary_Tree_Frozen_t*   -   Pointer to the Frozen copy, or NULL on failure.
+
+    Note:
+    The Keys are copied, while the Values are shared with the Tree through a Snapshot,
+    see Binary_Tree_Snapshot().
+*/
+Binary_Tree_Frozen_t* Binary_Tree_Freeze(Binary_Tree_t* Tree);
+
+/*
+    Binary_Tree_FrozenLength
+
+    This function returns the number of items held by the Frozen tree.
+
+    Inputs:
+    Frozen  -   Pointer to the Frozen tree to operate on.
+
+    Outputs:
+    size_t  -   The number of items in the Tree when it was frozen.
+*/
+size_t Binary_Tree_FrozenLength(Binary_Tree_Frozen_t* Frozen);
+
+/*
+    Binary_Tree_FrozenKeyExists
+
+    This function checks whether the given Key is held by the Frozen tree.
+
+    Inputs:
+    Frozen  -   Pointer to the Frozen tree to search.
+    Key     -   Pointer to the Key to search for.
+    KeySize -   The size of the Key, or 0 to use the KeySize of the Tree.
+
+    Outputs:
+    bool    -   Returns true if the Key exists, false otherwise.
+*/
+bool Binary_Tree_FrozenKeyExists(Binary_Tree_Frozen_t* Frozen, void* Key, size_t KeySize);
+
+/*
+    Binary_Tree_FrozenGet
+
+    This function returns the Value associated with the given Key in the Frozen tree.
+
+    Inputs:
+    Frozen  -   Pointer to the Frozen tree to search.
+    Key     -   Pointer to the Key to search for.
+    KeySize -   The size of the Key, or 0 to use the KeySize of the Tree.
+
+    Outputs:
+    void*   -   Pointer to the Value associated with the Key, or NULL on failure.
+*/
+void* Binary_Tree_FrozenGet(Binary_Tree_Frozen_t* Frozen, void* Key, size_t KeySize);
+
+/*
+    Binary_Tree_FrozenLowerBound
+
+    This function seeks to the item with the smallest Key which is not less than
+    the given Key, in O(log n) time.
+
+    Inputs:
+    Frozen  -   Pointer to the Frozen tree to search.
+    Key     -   Pointer to the Key value to seek to. This need not exist in the Frozen tree.
+    KeySize -   The size of the Key, or 0 to use the KeySize of the Tree.
+
+    Outputs:
+    Binary_Tree_KeyValuePair_t  -   The Key-Value pair of the item found, or a pair of
+                                        NULL pointers if every Key is less than the given Key.
+*/
+Binary_Tree_KeyValuePair_t Binary_Tree_FrozenLowerBound(Binary_Tree_Frozen_t* Frozen, void* Key, size_t KeySize);
+
+/*
+    Binary_Tree_FrozenUpperBound
+
+    This function seeks to the item with the smallest Key which is greater than
+    the given Key, in O(log n) time.
+
+    Inputs:
+    Frozen  -   Pointer to the Frozen tree to search.
+    Key     -   Pointer to the Key value to seek to. This need not exist in the Frozen tree.
+    KeySize -   The size of the Key, or 0 to use the KeySize of the Tree.
+
+    Outputs:
+    Binary_Tree_KeyValuePair_t  -   The Key-Value pair of the item found, or a pair of
+                                        NULL pointers if no Key is greater than the given Key.
+*/
+Binary_Tree_KeyValuePair_t Binary_Tree_FrozenUpperBound(Binary_Tree_Frozen_t* Frozen, void* Key, size_t KeySize);
+
+/*
+    Binary_Tree_FrozenRangeCallback
+
+    This function calls the given Callback function on each item with a Key in the
+    half-open range [ Lo, Hi ), in ascending Key order, in O(log n + k) time for k
+    items in the range.
+
+    Inputs:
+    Frozen      -   Pointer to the Frozen tree to operate on.
+    Lo          -   Pointer to the inclusive lower bound of the range, or NULL to start
+                        from the smallest Key.
+    LoSize      -   The size of the Lo Key value.
+    Hi          -   Pointer to the exclusive upper bound of the range, or NULL to continue
+                        to the largest Key.
+    HiSize      -   The size of the Hi Key value.
+    Callback    -   Pointer to the Callback function to call for each item in the range.
+    Args        -   Optional additional arguments to pass to the Callback
+                        function along with the Key-Value pair.
+
+    Outputs:
+    int     -   Returns 0 on success, negative if iteration over the Frozen tree could not happen,
+                    and positive to indicate the number of Callback functions which returned non-zero.
+
+    Note:
+    The "Value*" provided to the Callback function is a pointer to a
+    Binary_Tree_KeyValuePair_t, as with Binary_Tree_RangeCallback().
+*/
+int Binary_Tree_FrozenRangeCallback(Binary_Tree_Frozen_t* Frozen, void* Lo, size_t LoSize, void* Hi, size_t HiSize, CallbackArgFunc_t* Callback, void* Args);
+
+/*
+    Binary_Tree_FrozenRelease
+
+    This function releases the Frozen tree, along with any Values it alone still holds.
+
+    Inputs:
+    Frozen  -   Pointer to the Frozen tree to release.
+
+    Outputs:
+    None, the Frozen tree is released.
+*/
+void Binary_Tree_FrozenRelease(Binary_Tree_Frozen_t* Frozen);
+
 /* --------- Public Binary_Tree_t Functions --------- */
 #endif
 
+#ifdef LIBCONTAINER_ENABLE_BTREE
+/* +++++++++ Public BTree_t Functions +++++++++ */
+
+/*
+    BTree_Create
+
+    This function will create and initialize a new BTree_t, ready to be used.
+
+    Inputs:
+    KeyCompareFunc  -   Pointer to the function to use to compare Keys, defining the
+                            ordering of the Tree. If NULL, this defaults to memcmp().
+    KeySize         -   The size of the Keys. If non-zero, Keys are copied inline into
+                            the Nodes of the Tree. If 0, the size is given on each insertion,
+                            and the Nodes hold a pointer to each Key.
+    KeyReleaseFunc  -   Pointer to the function to call to release a Key not held inline.
+                            If NULL, this defaults to free().
+    Policy          -   How to handle an insertion of a Key which already exists.
+
+    Outputs:
+    BTree_t*    -   Pointer to a fully initialized BTree_t on success, NULL on failure.
+
+    Note:
+    Keys held inline (a non-zero KeySize) never have the KeyReleaseFunc called on them.
+*/
+BTree_t* BTree_Create(CompareFunc_t* KeyCompareFunc, size_t KeySize, ReleaseFunc_t* KeyReleaseFunc, Binary_Tree_DuplicatePolicy_t Policy);
+
+/*
+    BTree_Length
+
+    This function returns the number of items held within the Tree.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to return the length of.
+
+    Outputs:
+    size_t  -   The number of items contained in the Tree. 0 if a NULL tree is provided.
+*/
+size_t BTree_Length(BTree_t* Tree);
+
+/*
+    BTree_Insert
+
+    This function adds a new Key/Value pair to the Tree. If the Key already exists,
+    the behaviour follows the Duplicate Policy of the Tree.
+
+    Inputs:
+    Tree                -   Pointer to the Tree to operate on.
+    Key                 -   Pointer to the Key value to insert.
+    KeySize             -   The size of the Key value to be inserted. Ignored if the Tree
+                                was created with a non-zero KeySize.
+    Value               -   Pointer to the Value to insert.
+    ValueSize           -   The size of the Value to be inserted. If 0, the Tree takes
+                                ownership of the Value pointer itself.
+    ValueReleaseFunc    -   Pointer to the function to call to release the resources associated
+                                with the Value.
+
+    Outputs:
+    int     -   Returns 0 on success, positive on error. If the Duplicate Policy is set to "Policy_Error",
+                    returns negative if the item already exists.
+*/
+int BTree_Insert(BTree_t* Tree, void* Key, size_t KeySize, void* Value, size_t ValueSize, ReleaseFunc_t* ValueReleaseFunc);
+
+/*
+    BTree_KeyExists
+
+    This function will check if the given Key exists within the Tree.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to operate on.
+    Key     -   Pointer to the Key value to search for.
+    KeySize -   The size of the Key value.
+
+    Outputs:
+    bool    -   Returns true if the Key exists within the tree, false if it does not.
+*/
+bool BTree_KeyExists(BTree_t* Tree, void* Key, size_t KeySize);
+
+/*
+    BTree_Get
+
+    This function returns a pointer to the value associated with the given Key,
+    if it exists within the Tree.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to operate on.
+    Key     -   Pointer to the Key value to search for.
+    KeySize -   The size of the Key value.
+
+    Outputs:
+    void*   -   Pointer to the Value associated with the Key, or NULL if it does not exist.
+*/
+void* BTree_Get(BTree_t* Tree, void* Key, size_t KeySize);
+
+/*
+    BTree_Remove
+
+    This function will remove the item associated with the given Key from the Tree,
+    if it exists. If the key does not exist, this does nothing.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to operate on.
+    Key     -   Pointer to the Key value to remove.
+    KeySize -   The size of the Key value.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure.
+*/
+int BTree_Remove(BTree_t* Tree, void* Key, size_t KeySize);
+
+/*
+    BTree_Next
+
+    This function allows for single-step iteration over the Tree, in ascending order
+    of the Keys. Once the end of the Tree is reached, a pair of NULL pointers is
+    returned and the next call starts over from the beginning.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to iterate over.
+
+    Outputs:
+    Binary_Tree_KeyValuePair_t  -   The Key and Value of the next item of the Tree. Both are
+                                        NULL once iteration has finished.
+
+    Note:
+    Any insertion or removal on the Tree resets the iteration. A Key held inline
+    is returned as a pointer into the Tree itself, and is only valid until the
+    next modification of the Tree.
+*/
+Binary_Tree_KeyValuePair_t BTree_Next(BTree_t* Tree);
+
+/*
+    BTree_DoCallback
+
+    This function calls the given Callback function on each of the items of the
+    Tree, in ascending order of the Keys.
+
+    Inputs:
+    Tree        -   Pointer to the Tree to operate on.
+    Callback    -   Pointer to the Callback function to call for each item in the Tree.
+
+    Outputs:
+    int     -   Returns 0 on success, negative if iteration over the BTree_t could not happen,
+                    and positive to indicate the number of Callback functions which returned non-zero.
+
+    Note:
+    The "Value*" provided to the Callback function is a pointer to a Binary_Tree_KeyValuePair_t.
+*/
+int BTree_DoCallback(BTree_t* Tree, CallbackFunc_t* Callback);
+
+/*
+    BTree_DoCallbackArg
+
+    This function calls the given Callback function on each of the items of the
+    Tree, in ascending order of the Keys, along with the additional Args.
+
+    Inputs:
+    Tree        -   Pointer to the Tree to operate on.
+    Callback    -   Pointer to the Callback function to call for each item in the Tree.
+    Args        -   Optional additional arguments to pass to the Callback
+                        function along with the Key-Value pair.
+
+    Outputs:
+    int     -   Returns 0 on success, negative if iteration over the BTree_t could not happen,
+                    and positive to indicate the number of Callback functions which returned non-zero.
+
+    Note:
+    The "Value*" provided to the Callback function is a pointer to a Binary_Tree_KeyValuePair_t.
+*/
+int BTree_DoCallbackArg(BTree_t* Tree, CallbackArgFunc_t* Callback, void* Args);
+
+/*
+    BTree_Clear
+
+    This function removes all items from the Tree, leaving it empty but
+    still valid for use.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to operate on.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure.
+*/
+int BTree_Clear(BTree_t* Tree);
+
+/*
+    BTree_Release
+
+    This function fully releases the Tree and all of the items it holds. Once
+    passed to this function, the Tree is no longer valid for use.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to release.
+
+    Outputs:
+    None, the Tree and all held contents are released.
+*/
+void BTree_Release(BTree_t* Tree);
+
+/* --------- Public BTree_t Functions --------- */
+#endif
+
 #ifdef LIBCONTAINER_ENABLE_BINARY_HEAP
 /* ++++++++++ Public Binary_Heap_t Functions ++++++++++ */
 
@@ -2412,6 +3525,80 @@ void Binary_Tree_Release(Binary_Tree_t* Tree);
 */
 Binary_Heap_t* Binary_Heap_Create(CompareFunc_t* KeyCompareFunc, ReleaseFunc_t* KeyReleaseFunc);
 
+/*
+    Binary_Heap_CreateInline
+
+    This function creates and initializes a new Binary_Heap_t which stores every
+    Key inline, alongside its Value pointer, in one contiguous array of Slots. Each
+    item has Arity children rather than two, so the Heap is shallower and all of
+    the children compared at each step of a Pop sit next to each other in memory.
+
+    Inputs:
+    KeyCompareFunc  -   Pointer to the function to use to compare two Key values within the Heap.
+    KeySize         -   The size of every Key (in bytes). This must be non-zero.
+    Arity           -   The number of children of each item, a power of two from 2 to 16.
+                            Leave as 0 to use the default of LIBCONTAINER_BINARY_HEAP_INLINE_ARITY.
+
+    Outputs:
+    Binary_Heap_t*  -   Returns a pointer to an initialized and ready-to-use
+                            Binary_Heap_t on success, or NULL on failure.
+
+    Note:
+    Every Key pushed onto this Heap must be exactly KeySize bytes, and is copied by
+    value, so no KeyReleaseFunc is needed. The Key returned by Binary_Heap_Pop() points
+    into the Heap itself and must NOT be freed; it remains valid until the next
+    Pop or Remove. Values are owned exactly as with Binary_Heap_Create().
+*/
+Binary_Heap_t* Binary_Heap_CreateInline(CompareFunc_t* KeyCompareFunc, size_t KeySize, size_t Arity);
+
+/*
+    Binary_Heap_CreateMeldable
+
+    This function creates and initializes a new Binary_Heap_t which is held as a
+    pairing heap, rather than within an array. Push and Binary_Heap_Merge() are O(1),
+    while Pop is O(log n) amortized. This suits Heaps which are regularly merged
+    together, at the cost of a slightly slower Pop than Binary_Heap_Create().
+
+    Inputs:
+    KeyCompareFunc  -   Pointer to the function to use to compare two Key values within the Heap.
+    KeyReleaseFunc  -   Pointer to the function to use to release the resources associated with a Key
+                            within the Heap.
+
+    Outputs:
+    Binary_Heap_t*  -   Returns a pointer to an initialized and ready-to-use
+                            Binary_Heap_t on success, or NULL on failure.
+
+    Note:
+    Keys and Values are owned exactly as with Binary_Heap_Create(), and Handles
+    are available in the same way.
+*/
+Binary_Heap_t* Binary_Heap_CreateMeldable(CompareFunc_t* KeyCompareFunc, ReleaseFunc_t* KeyReleaseFunc);
+
+/*
+    Binary_Heap_CreateMinMax
+
+    This function creates and initializes a new Binary_Heap_t which is held as a
+    min-max heap, giving access to both ends of the ordering. The highest item is
+    available from Binary_Heap_PeekMax() and Binary_Heap_PopMax(), and the lowest
+    from Binary_Heap_PeekMin() and Binary_Heap_PopMin(). Peeking at either end is
+    O(1), and Push and Pop at either end are O(log n).
+
+    Inputs:
+    KeyCompareFunc  -   Pointer to the function to use to compare two Key values within the Heap.
+    KeyReleaseFunc  -   Pointer to the function to use to release the resources associated with a Key
+                            within the Heap.
+
+    Outputs:
+    Binary_Heap_t*  -   Returns a pointer to an initialized and ready-to-use
+                            Binary_Heap_t on success, or NULL on failure.
+
+    Note:
+    Keys and Values are owned exactly as with Binary_Heap_Create(), and every other
+    Binary_Heap_t function works as normal, with Peek and Pop serving the highest item.
+    Handles are not available.
+*/
+Binary_Heap_t* Binary_Heap_CreateMinMax(CompareFunc_t* KeyCompareFunc, ReleaseFunc_t* KeyReleaseFunc);
+
 /*
     Binary_Heap_Length
 
@@ -2424,49 +3611,124 @@ Binary_Heap_t* Binary_Heap_Create(CompareFunc_t* KeyCompareFunc, ReleaseFunc_t*
     Outputs:
     size_t  -   Count of the items within the Heap. 0 if Heap is NULL.
 */
-size_t Binary_Heap_Length(Binary_Heap_t* Heap);
+size_t Binary_Heap_Length(Binary_Heap_t* Heap);
+
+/*
+    Binary_Heap_IsEmpty
+
+    This function allows for simply inspection of whether or not the
+    Heap contains items or not.
+
+    Inputs:
+    Heap    -   Pointer to the Binary_Heap_t to operate on.
+
+    Outputs:
+    bool    -   Returns true if Heap is NULL, or it contains 0 items.
+*/
+bool Binary_Heap_IsEmpty(Binary_Heap_t* Heap);
+
+/*
+    Binary_Heap_Peek
+
+    This function inspects the Root of the Heap, returning a Binary_Heap_KeyValuePair_t
+    containing pointers t the Root Key-Value pair. This does NOT remove the item
+    from the Heap, and does NOT transfer ownership to the caller.
+
+    Inputs:
+    Heap    -   Pointer to the Binary_Heap_t to operate on.
+
+    Outputs:
+    Binary_Heap_KeyValuePair_t  -   Struct containing the Key* and Value* pointers
+                                        for the requested item within the Heap.
+
+    Note:
+    This function does NOT transfer ownership of the returned items to the caller.
+    This simply lets the caller inspect the root of the Heap in order to make
+    a decision about whether or not to pop the value or remove it later.
+*/
+Binary_Heap_KeyValuePair_t Binary_Heap_Peek(Binary_Heap_t* Heap);
+
+/*
+    Binary_Heap_Pop
+
+    This function removes the Root of the Heap, returning the Key-Value
+    pair to the caller and transferring ownership of the resources.
+    This also removes the item from the Heap.
+
+    Inputs:
+    Heap    -   Pointer to the Binary_Heap_t to operate on.
+
+    Outputs:
+    Binary_Heap_KeyValuePair_t  -   Struct containing the Key* and Value* pointers
+                                        for the popped item from the Heap.
+
+    Note:
+    For a Heap created with Binary_Heap_CreateInline(), only the Value is transferred.
+    The Key is held by the Heap until the next Pop or Remove.
+*/
+Binary_Heap_KeyValuePair_t Binary_Heap_Pop(Binary_Heap_t* Heap);
+
+/*
+    Binary_Heap_PeekMax
+
+    This function inspects the highest item of the Heap, the one which would be
+    returned by Binary_Heap_Pop(). This is identical to Binary_Heap_Peek(), and is
+    provided to pair with Binary_Heap_PeekMin().
+
+    Inputs:
+    Heap    -   Pointer to the Binary_Heap_t to operate on.
+
+    Outputs:
+    Binary_Heap_KeyValuePair_t  -   Struct containing the Key* and Value* pointers
+                                        for the highest item within the Heap.
+
+    Note:
+    This function does NOT transfer ownership of the returned items to the caller.
+*/
+Binary_Heap_KeyValuePair_t Binary_Heap_PeekMax(Binary_Heap_t* Heap);
 
 /*
-    Binary_Heap_IsEmpty
+    Binary_Heap_PeekMin
 
-    This function allows for simply inspection of whether or not the
-    Heap contains items or not.
+    This function inspects the lowest item of the Heap, the one which would be
+    returned last by Binary_Heap_Pop(), in O(1).
 
     Inputs:
     Heap    -   Pointer to the Binary_Heap_t to operate on.
 
     Outputs:
-    bool    -   Returns true if Heap is NULL, or it contains 0 items.
+    Binary_Heap_KeyValuePair_t  -   Struct containing the Key* and Value* pointers
+                                        for the lowest item within the Heap.
+
+    Note:
+    This function does NOT transfer ownership of the returned items to the caller.
+    This is only available for a Heap created with Binary_Heap_CreateMinMax(), and
+    returns a pair of NULL pointers for any other Heap.
 */
-bool Binary_Heap_IsEmpty(Binary_Heap_t* Heap);
+Binary_Heap_KeyValuePair_t Binary_Heap_PeekMin(Binary_Heap_t* Heap);
 
 /*
-    Binary_Heap_Peek
+    Binary_Heap_PopMax
 
-    This function inspects the Root of the Heap, returning a Binary_Heap_KeyValuePair_t
-    containing pointers t the Root Key-Value pair. This does NOT remove the item
-    from the Heap, and does NOT transfer ownership to the caller.
+    This function removes the highest item of the Heap, returning the Key-Value
+    pair to the caller and transferring ownership of the resources. This is
+    identical to Binary_Heap_Pop(), and is provided to pair with Binary_Heap_PopMin().
 
     Inputs:
     Heap    -   Pointer to the Binary_Heap_t to operate on.
 
     Outputs:
     Binary_Heap_KeyValuePair_t  -   Struct containing the Key* and Value* pointers
-                                        for the requested item within the Heap.
-
-    Note:
-    This function does NOT transfer ownership of the returned items to the caller.
-    This simply lets the caller inspect the root of the Heap in order to make
-    a decision about whether or not to pop the value or remove it later.
+                                        for the popped item from the Heap.
 */
-Binary_Heap_KeyValuePair_t Binary_Heap_Peek(Binary_Heap_t* Heap);
+Binary_Heap_KeyValuePair_t Binary_Heap_PopMax(Binary_Heap_t* Heap);
 
 /*
-    Binary_Heap_Pop
+    Binary_Heap_PopMin
 
-    This function removes the Root of the Heap, returning the Key-Value
-    pair to the caller and transferring ownership of the resources.
-    This also removes the item from the Heap.
+    This function removes the lowest item of the Heap, returning the Key-Value
+    pair to the caller and transferring ownership of the resources, exactly as
+    Binary_Heap_Pop() does for the highest item.
 
     Inputs:
     Heap    -   Pointer to the Binary_Heap_t to operate on.
@@ -2474,8 +3736,12 @@ Binary_Heap_KeyValuePair_t Binary_Heap_Peek(Binary_Heap_t* Heap);
     Outputs:
     Binary_Heap_KeyValuePair_t  -   Struct containing the Key* and Value* pointers
                                         for the popped item from the Heap.
+
+    Note:
+    This is only available for a Heap created with Binary_Heap_CreateMinMax(), and
+    returns a pair of NULL pointers for any other Heap, leaving it unchanged.
 */
-Binary_Heap_KeyValuePair_t Binary_Heap_Pop(Binary_Heap_t* Heap);
+Binary_Heap_KeyValuePair_t Binary_Heap_PopMin(Binary_Heap_t* Heap);
 
 /*
     Binary_Heap_Remove
@@ -2510,11 +3776,140 @@ int Binary_Heap_Remove(Binary_Heap_t* Heap);
 */
 int Binary_Heap_Push(Binary_Heap_t* Heap, void* Key, size_t KeySize, void* Value, size_t ValueSize, ReleaseFunc_t* ValueReleaseFunc);
 
+/*
+    Binary_Heap_PushHandle
+
+    This function adds a new Key-Value pair to the Heap exactly as Binary_Heap_Push()
+    does, returning a Handle which can later be used to change the Key of the item
+    or to remove it from anywhere in the Heap.
+
+    Inputs:
+    Heap                -   Pointer to the Binary_Heap_t to operate on.
+    Key                 -   Pointer to the Key of the Key-Value pair to add.
+    KeySize             -   Size of the Key (in bytes). 0 for a Reference-Type.
+    Value               -   Pointer to the Value of the Key-Value pair to add.
+    ValueSize           -   Size of the Value (in bytes). 0 for a Reference-Type.
+    ValueReleaseFunc    -   Pointer to the function to call to release the resources
+                                associated with the Value. Leave NULL to default to free().
+
+    Outputs:
+    Binary_Heap_Handle_t*   -   Pointer to the Handle of the new item on success, or NULL on failure.
+
+    Note:
+    Handles are only available for a Heap created with Binary_Heap_Create() or
+    Binary_Heap_CreateMeldable(), as each of their items keeps a fixed address.
+    The Handle must not be used once the item has left the Heap, by Pop, Remove,
+    Clear or otherwise.
+*/
+Binary_Heap_Handle_t* Binary_Heap_PushHandle(Binary_Heap_t* Heap, void* Key, size_t KeySize, void* Value, size_t ValueSize, ReleaseFunc_t* ValueReleaseFunc);
+
+/*
+    Binary_Heap_UpdateKey
+
+    This function replaces the Key of the item referred to by Handle, moving the
+    item up or down the Heap to its new place in O(log n).
+
+    Inputs:
+    Heap    -   Pointer to the Binary_Heap_t to operate on.
+    Handle  -   Pointer to the Handle of the item to update.
+    Key     -   Pointer to the new Key of the item.
+    KeySize -   Size of the new Key (in bytes). 0 for a Reference-Type.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure.
+*/
+int Binary_Heap_UpdateKey(Binary_Heap_t* Heap, Binary_Heap_Handle_t* Handle, void* Key, size_t KeySize);
+
+/*
+    Binary_Heap_RemoveHandle
+
+    This function removes and releases the item referred to by Handle, from
+    anywhere within the Heap, in O(log n).
+
+    Inputs:
+    Heap    -   Pointer to the Binary_Heap_t to operate on.
+    Handle  -   Pointer to the Handle of the item to remove.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure.
+*/
+int Binary_Heap_RemoveHandle(Binary_Heap_t* Heap, Binary_Heap_Handle_t* Handle);
+
+/*
+    Binary_Heap_PushN
+
+    This function adds Count Key-Value pairs to the Heap at once. When the batch is
+    at least as large as the Heap already is, the whole Heap is rebuilt bottom-up in
+    O(n) rather than paying O(log n) for each item pushed.
+
+    Inputs:
+    Heap                -   Pointer to the Binary_Heap_t to operate on.
+    Keys                -   Pointer to Count Keys, stored back to back.
+    KeySize             -   Size of each Key (in bytes). This must be non-zero.
+    Values              -   Pointer to Count Values, stored back to back. If ValueSize is 0,
+                                this is instead an array of Count pointers, each held by
+                                reference. May be NULL if ValueSize is 0, giving NULL Values.
+    ValueSize           -   Size of each Value (in bytes). 0 for Reference-Types.
+    Count               -   The number of Key-Value pairs to add.
+    ValueReleaseFunc    -   Pointer to the function to call to release the resources
+                                associated with each Value. Leave NULL to default to free().
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure. On failure, the Heap is unchanged.
+*/
+int Binary_Heap_PushN(Binary_Heap_t* Heap, void* Keys, size_t KeySize, void* Values, size_t ValueSize, size_t Count, ReleaseFunc_t* ValueReleaseFunc);
+
+/*
+    Binary_Heap_FromArray
+
+    This function creates a new Binary_Heap_t holding a copy of every element of the
+    Keys Array_t, built bottom-up in O(n) with Binary_Heap_PushN().
+
+    Inputs:
+    KeyCompareFunc      -   Pointer to the function to use to compare two Key values within the Heap.
+    Keys                -   Pointer to the Array_t of Keys. This must hold its elements by value.
+    Values              -   Pointer to the Array_t of Values, holding one element by value for
+                                each of the Keys, or NULL for NULL Values.
+    ValueReleaseFunc    -   Pointer to the function to call to release the resources
+                                associated with each Value. Leave NULL to default to free().
+
+    Outputs:
+    Binary_Heap_t*  -   Returns a pointer to the new Binary_Heap_t on success, or NULL on failure.
+
+    Note:
+    Neither Array_t is modified, and both remain owned by the caller.
+*/
+Binary_Heap_t* Binary_Heap_FromArray(CompareFunc_t* KeyCompareFunc, Array_t* Keys, Array_t* Values, ReleaseFunc_t* ValueReleaseFunc);
+
+/*
+    Binary_Heap_Merge
+
+    This function moves every item of Src into Dst, leaving Src empty but still
+    usable. The items themselves are moved, so no Key or Value is copied, and any
+    Handles to them remain valid, now referring to items of Dst.
+
+    Inputs:
+    Dst     -   Pointer to the Binary_Heap_t to merge the items into.
+    Src     -   Pointer to the Binary_Heap_t to take the items from.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure. On failure, neither Heap is changed.
+
+    Note:
+    Both Heaps must have been created with the same KeyCompareFunc, and by the same
+    function, one of Binary_Heap_Create(), Binary_Heap_CreateMeldable() or
+    Binary_Heap_CreateMinMax(). Merging two meldable Heaps is O(1), while merging two
+    Heaps of either other kind costs O(n) to rebuild Dst. Heaps from
+    Binary_Heap_CreateInline() cannot be merged.
+*/
+int Binary_Heap_Merge(Binary_Heap_t* Dst, Binary_Heap_t* Src);
+
 /*
     Binary_Heap_Next
 
     This function provides an iterator interface over the Heap.
-    This iterator provides level-order iteration over the Heap.
+    This iterator provides level-order iteration over the Heap, or
+    pre-order iteration for a Heap from Binary_Heap_CreateMeldable().
     This is resumable, as long as there are no intervening
     Push(), Pop(), or Remove() calls between pause and resumption.
 
@@ -2636,6 +4031,50 @@ void Binary_Heap_Release(Binary_Heap_t* Heap);
 */
 Set_t* Set_Create(CompareFunc_t* CompareFunc, size_t ValueSize, ReleaseFunc_t* ReleaseFunc);
 
+/*
+    Set_CreateBTree
+
+    This function will create and initialize a new Set_t, backed by a B+tree
+    rather than a binary tree. This is much more cache-friendly for large Sets,
+    speeding up both lookups and in-order iteration.
+
+    Inputs:
+    CompareFunc -   Pointer to the function to use to compare different values within
+                        the Set_t. If NULL, this will default to memcmp().
+    ValueSize   -   The size of the values to be added to the Set_t. If non-zero, the
+                        values are copied inline into the B+tree. Pass 0 if the values
+                        are pointer-types.
+    ReleaseFunc -   Pointer to the function to call to release a pointer-type Value
+                        from the Set_t. If NULL, this will default to free().
+
+    Outputs:
+    Set_t*  -   Pointer to a created and initialized Set_t on success, NULL on failure.
+
+    Note:
+    The returned Set_t is used through exactly the same Set_ functions as any other.
+    Values held inline (a non-zero ValueSize) never have the ReleaseFunc called on them.
+*/
+Set_t* Set_CreateBTree(CompareFunc_t* CompareFunc, size_t ValueSize, ReleaseFunc_t* ReleaseFunc);
+
+/*
+    Set_BuildFromSorted
+
+    This function will create a new Set_t, bulk-loaded from an array of Values which
+    are already in strictly ascending order, in O(n) time. See Binary_Tree_BuildFromSorted().
+
+    Inputs:
+    CompareFunc -   Pointer to the function to use to compare Values.
+    ValueSize   -   The size of each Value, measured in bytes. Must be non-zero.
+    ReleaseFunc -   Pointer to the function to use to release a Value.
+    Values      -   Pointer to the contiguous array of Count Values, in strictly ascending order.
+    Count       -   The number of Values to load.
+
+    Outputs:
+    Set_t*  -   Pointer to the fully constructed and loaded Set, or NULL on failure,
+                    including if the Values are not strictly ascending.
+*/
+Set_t* Set_BuildFromSorted(CompareFunc_t* CompareFunc, size_t ValueSize, ReleaseFunc_t* ReleaseFunc, void* Values, size_t Count);
+
 /*
     Set_Length
 
@@ -3168,58 +4607,285 @@ void Queue_Release(Queue_t* Queue);
                         or false if the lowest priority values should be returned first.
 
     Outputs:
-    Priority_Queue_t*   -   Pointer to a created and initialized Priority_Queue_t
-                                on success, or NULL on failure.
+    Priority_Queue_t*   -   Pointer to a created and initialized Priority_Queue_t
+                                on success, or NULL on failure.
+*/
+Priority_Queue_t* Priority_Queue_Create(bool Ascending);
+
+/*
+    Priority_Queue_CreateTyped
+
+    This function creates and initializes a new Priority_Queue_t for Priorities of
+    the given native Type. Each item and its Priority are stored together in a single
+    contiguous array, and Priorities are compared directly, so no memory is allocated
+    per item for the Priority and no comparison goes through a function pointer.
+
+    Inputs:
+    Type        -   The type of the Priorities this Queue will hold.
+    Ascending   -   Set true if the highest priority values should be returned first,
+                        or false if the lowest priority values should be returned first.
+
+    Outputs:
+    Priority_Queue_t*   -   Pointer to a created and initialized Priority_Queue_t
+                                on success, or NULL on failure.
+
+    Note:
+    All of the Priority_Queue_ functions may be used with this Queue, except for the
+    Handle functions. Priorities given or returned as an int are converted to and
+    from the Type of the Queue, see Priority_Queue_PushTyped() and Priority_Queue_PopTyped()
+    to work with int64_t or double Priorities directly.
+*/
+Priority_Queue_t* Priority_Queue_CreateTyped(Priority_Queue_Priority_t Type, bool Ascending);
+
+/*
+    Priority_Queue_CreateMeldable
+
+    This function creates and initializes a new Priority_Queue_t held within a
+    meldable Binary_Heap_t, see Binary_Heap_CreateMeldable(). Two such Queues can be
+    joined with Priority_Queue_Merge() in O(1), regardless of how many items they hold.
+
+    Inputs:
+    Ascending   -   Set true if the highest priority values should be returned first,
+                        or false if the lowest priority values should be returned first.
+
+    Outputs:
+    Priority_Queue_t*   -   Pointer to a created and initialized Priority_Queue_t
+                                on success, or NULL on failure.
+
+    Note:
+    All of the Priority_Queue_ functions may be used with this Queue, including the
+    Handle functions.
+*/
+Priority_Queue_t* Priority_Queue_CreateMeldable(bool Ascending);
+
+/*
+    Priority_Queue_CreateDoubleEnded
+
+    This function creates and initializes a new Priority_Queue_t held within a
+    min-max Binary_Heap_t, see Binary_Heap_CreateMinMax(). Items can be taken from
+    the front of the Queue with Priority_Queue_Pop() as normal, and also from the
+    back with Priority_Queue_PopBack(), both in O(log n).
+
+    Inputs:
+    Ascending   -   Set true if the highest priority values should be returned first,
+                        or false if the lowest priority values should be returned first.
+
+    Outputs:
+    Priority_Queue_t*   -   Pointer to a created and initialized Priority_Queue_t
+                                on success, or NULL on failure.
+
+    Note:
+    All of the Priority_Queue_ functions may be used with this Queue, except for the
+    Handle functions.
+*/
+Priority_Queue_t* Priority_Queue_CreateDoubleEnded(bool Ascending);
+
+/*
+    Priority_Queue_CreateConcurrent
+
+    This function creates and initializes a new Priority_Queue_t which is safe to use
+    from many threads at once. The items are spread over a number of independent heaps,
+    each guarded by its own lock. A Push adds to one heap chosen at random, and a Pop
+    takes the better front item of two heaps chosen at random, so threads rarely
+    contend for the same lock.
+
+    The returned Queue is used through the same Priority_Queue_* functions as any other.
+
+    Inputs:
+    Ascending   -   Set true if the highest priority values should be returned first,
+                        or false if the lowest priority values should be returned first.
+    HeapCount   -   The number of heaps to spread the items over. Two to four per thread
+                        using the Queue works well, and 0 selects
+                        LIBCONTAINER_PRIORITY_QUEUE_CONCURRENT_HEAPS.
+
+    Outputs:
+    Priority_Queue_t*   -   Pointer to a created and initialized Priority_Queue_t
+                                on success, or NULL on failure.
+
+    Note:
+    The ordering is relaxed. Each Pop returns an item close to the front of the Queue,
+    typically within a few times HeapCount of it, but not necessarily the very front.
+    Priority_Queue_Pop() only returns an empty Item once every heap has been seen empty.
+    Only the individual operations are atomic, and a Value from Priority_Queue_Peek() is
+    only valid until another thread Pops it. Iteration, Priority_Queue_Clear() and
+    Priority_Queue_Release() must not run concurrently with any other operation on the
+    same Queue. The Handle functions, Priority_Queue_Merge() and Priority_Queue_PopBack()
+    are not available.
+*/
+Priority_Queue_t* Priority_Queue_CreateConcurrent(bool Ascending, size_t HeapCount);
+
+/*
+    Priority_Queue_CreateMonotone
+
+    This function creates and initializes a new Priority_Queue_t for monotone
+    Priorities of the given native Type, such as timestamps or path distances,
+    where nothing is ever pushed with a lower Priority than the last item taken
+    from the front. The lowest Priority is returned first.
+
+    The Queue is a radix heap. Push is O(1), and Pop is amortized O(log C), where C
+    is the number of distinct values the Type can represent. Each item is moved
+    between buckets at most 64 times over its life in the Queue, and never compared
+    against more than the other items in its bucket.
+
+    Inputs:
+    Type    -   The type of the Priorities this Queue will hold.
+
+    Outputs:
+    Priority_Queue_t*   -   Pointer to a created and initialized Priority_Queue_t
+                                on success, or NULL on failure.
+
+    Note:
+    Pushing an item with a Priority lower than that of the last item Peeked or
+    Popped fails, leaving the Queue unchanged. Clearing the Queue lifts this limit.
+    As with Priority_Queue_CreateTyped(), the Handle functions are not available.
+*/
+Priority_Queue_t* Priority_Queue_CreateMonotone(Priority_Queue_Priority_t Type);
+
+/*
+    Priority_Queue_Length
+
+    This function returns the "Length" or the number of items contained within the
+    Priority_Queue_t.
+
+    Inputs:
+    Queue   -   Pointer to the Priority_Queue_t to operate on.
+
+    Outputs:
+    size_t  -   Returns the count of items within the Queue. Also returns 0
+                    if the given Queue is NULL.
+*/
+size_t Priority_Queue_Length(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_IsEmpty
+
+    This function simply returns a boolean equivalent to (0 == Priority_Queue_Length(Queue)),
+    making for a more visually explicit emptiness check.
+
+    Inputs:
+    Queue   -   Pointer to the Priority_Queue_t to operate on.
+
+    Outputs:
+    bool    -   True if the Queue contains 0 items or is NULL, false otherwise.
+*/
+bool Priority_Queue_IsEmpty(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_Push
+
+    This function adds a new item to the Queue, with the specified priority.
+
+    Inputs:
+    Queue       -   Pointer to the Priority_Queue_t to operate on.
+    Priority    -   The Priority to assign to this entry.
+    Value       -   Pointer to the raw item to add to the Queue.
+    ValueSize   -   The size of the item (in bytes) to add to the Queue.
+    ReleaseFunc -   Pointer to the function to call to release any resources
+                        associated with the Value pointer. Leave NULL to
+                        default to free().
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure.
+*/
+int Priority_Queue_Push(Priority_Queue_t* Queue, int Priority, void* Value, size_t ValueSize, ReleaseFunc_t* ReleaseFunc);
+
+/*
+    Priority_Queue_PushN
+
+    This function adds Count items to the Queue at once, building the Queue
+    bottom-up in O(n) when it is loaded from empty.
+
+    Inputs:
+    Queue       -   Pointer to the Priority_Queue_t to operate on.
+    Priorities  -   Pointer to the Count Priorities to assign, one for each item.
+    Values      -   Pointer to Count items, stored back to back. If ValueSize is 0,
+                        this is instead an array of Count pointers, each held by reference.
+    ValueSize   -   The size of each item (in bytes) to add to the Queue.
+    Count       -   The number of items to add.
+    ReleaseFunc -   Pointer to the function to call to release any resources
+                        associated with each Value. Leave NULL to
+                        default to free().
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure. On failure, the Queue is unchanged.
+*/
+int Priority_Queue_PushN(Priority_Queue_t* Queue, int* Priorities, void* Values, size_t ValueSize, size_t Count, ReleaseFunc_t* ReleaseFunc);
+
+/*
+    Priority_Queue_PushHandle
+
+    This function adds a new item to the Queue exactly as Priority_Queue_Push() does,
+    returning a Handle which can later be used to re-prioritize or remove the item.
+
+    Inputs:
+    Queue       -   Pointer to the Priority_Queue_t to operate on.
+    Priority    -   The Priority to assign to this entry.
+    Value       -   Pointer to the raw item to add to the Queue.
+    ValueSize   -   The size of the item (in bytes) to add to the Queue.
+    ReleaseFunc -   Pointer to the function to call to release any resources
+                        associated with the Value pointer. Leave NULL to
+                        default to free().
+
+    Outputs:
+    Priority_Queue_Handle_t*    -   Pointer to the Handle of the new item on success, or NULL on failure.
+
+    Note:
+    The Handle must not be used once the item has left the Queue, by Pop, Remove,
+    Clear or otherwise.
 */
-Priority_Queue_t* Priority_Queue_Create(bool Ascending);
+Priority_Queue_Handle_t* Priority_Queue_PushHandle(Priority_Queue_t* Queue, int Priority, void* Value, size_t ValueSize, ReleaseFunc_t* ReleaseFunc);
 
 /*
-    Priority_Queue_Length
+    Priority_Queue_UpdatePriority
 
-    This function returns the "Length" or the number of items contained within the
-    Priority_Queue_t.
+    This function changes the Priority of the item referred to by Handle, in O(log n).
 
     Inputs:
-    Queue   -   Pointer to the Priority_Queue_t to operate on.
+    Queue       -   Pointer to the Priority_Queue_t to operate on.
+    Handle      -   Pointer to the Handle of the item to update.
+    Priority    -   The new Priority to assign to the item.
 
     Outputs:
-    size_t  -   Returns the count of items within the Queue. Also returns 0
-                    if the given Queue is NULL.
+    int     -   Returns 0 on success, non-zero on failure.
 */
-size_t Priority_Queue_Length(Priority_Queue_t* Queue);
+int Priority_Queue_UpdatePriority(Priority_Queue_t* Queue, Priority_Queue_Handle_t* Handle, int Priority);
 
 /*
-    Priority_Queue_IsEmpty
+    Priority_Queue_RemoveHandle
 
-    This function simply returns a boolean equivalent to (0 == Priority_Queue_Length(Queue)),
-    making for a more visually explicit emptiness check.
+    This function removes and releases the item referred to by Handle, from anywhere
+    within the Queue, in O(log n).
 
     Inputs:
     Queue   -   Pointer to the Priority_Queue_t to operate on.
+    Handle  -   Pointer to the Handle of the item to remove.
 
     Outputs:
-    bool    -   True if the Queue contains 0 items or is NULL, false otherwise.
+    int     -   Returns 0 on success, non-zero on failure.
 */
-bool Priority_Queue_IsEmpty(Priority_Queue_t* Queue);
+int Priority_Queue_RemoveHandle(Priority_Queue_t* Queue, Priority_Queue_Handle_t* Handle);
 
 /*
-    Priority_Queue_Push
+    Priority_Queue_Merge
 
-    This function adds a new item to the Queue, with the specified priority.
+    This function moves every item of Src into Dst, leaving Src empty but still
+    usable. The items themselves are moved, so no Value is copied, and any Handles
+    to them remain valid, now referring to items of Dst.
 
     Inputs:
-    Queue       -   Pointer to the Priority_Queue_t to operate on.
-    Priority    -   The Priority to assign to this entry.
-    Value       -   Pointer to the raw item to add to the Queue.
-    ValueSize   -   The size of the item (in bytes) to add to the Queue.
-    ReleaseFunc -   Pointer to the function to call to release any resources
-                        associated with the Value pointer. Leave NULL to
-                        default to free().
+    Dst     -   Pointer to the Priority_Queue_t to merge the items into.
+    Src     -   Pointer to the Priority_Queue_t to take the items from.
 
     Outputs:
-    int     -   Returns 0 on success, non-zero on failure.
+    int     -   Returns 0 on success, non-zero on failure. On failure, neither Queue is changed.
+
+    Note:
+    Both Queues must have been created by the same function, with the same Type and
+    order. Merging two Queues from Priority_Queue_CreateMeldable() is O(1), while other
+    Queues are rebuilt in O(n). Queues from Priority_Queue_CreateMonotone() cannot
+    be merged.
 */
-int Priority_Queue_Push(Priority_Queue_t* Queue, int Priority, void* Value, size_t ValueSize, ReleaseFunc_t* ReleaseFunc);
+int Priority_Queue_Merge(Priority_Queue_t* Dst, Priority_Queue_t* Src);
 
 /*
     Priority_Queue_Peek
@@ -3263,6 +4929,103 @@ Priority_Queue_Item_t Priority_Queue_Peek(Priority_Queue_t* Queue);
 */
 Priority_Queue_Item_t Priority_Queue_Pop(Priority_Queue_t* Queue);
 
+/*
+    Priority_Queue_PeekBack
+
+    This function returns the back-most item from the Queue, the one which would be
+    returned last by Priority_Queue_Pop(), without removing it from the Queue.
+    Ownership of the returned value is NOT transferred to the caller.
+
+    Inputs:
+    Queue   -   Pointer to the Priority_Queue_t to operate on.
+
+    Outputs:
+    Priority_Queue_Item_t   -   Record-type containing the item at the back
+                                    of the Queue, as well as the Priority value
+                                    it was registered with.
+
+    Note:
+    This is only available for a Queue created with Priority_Queue_CreateDoubleEnded().
+*/
+Priority_Queue_Item_t Priority_Queue_PeekBack(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_PopBack
+
+    This function returns the item from the back of the Queue, removing it
+    from the Queue and transferring ownership of the resources to the caller.
+
+    Inputs:
+    Queue   -   Pointer to the Priority_Queue_t to operate on.
+
+    Outputs:
+    Priority_Queue_Item_t   -   Record-type containing the item at the back
+                                    of the Queue, as well as the Priority value
+                                    it was registered with.
+
+    Note:
+    This is only available for a Queue created with Priority_Queue_CreateDoubleEnded().
+    Ownership of the Value pointer within the Priority_Queue_Item_t is transferred
+    to the caller, and must be handled accordingly so as to not leak resources.
+*/
+Priority_Queue_Item_t Priority_Queue_PopBack(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_PushTyped
+
+    This function adds a new item to the Queue, with a Priority of the native
+    type of the Queue.
+
+    Inputs:
+    Queue       -   Pointer to the Priority_Queue_t to operate on.
+    Priority    -   Pointer to the Priority to assign to this entry. This must point to an
+                        int, int64_t or double, matching the Type the Queue was created with.
+                        A Queue from Priority_Queue_Create() takes an int.
+    Value       -   Pointer to the raw item to add to the Queue.
+    ValueSize   -   The size of the item (in bytes) to add to the Queue.
+    ReleaseFunc -   Pointer to the function to call to release any resources
+                        associated with the Value pointer. Leave NULL to
+                        default to free().
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure.
+*/
+int Priority_Queue_PushTyped(Priority_Queue_t* Queue, void* Priority, void* Value, size_t ValueSize, ReleaseFunc_t* ReleaseFunc);
+
+/*
+    Priority_Queue_PeekTyped
+
+    This function returns the Value at the front of the Queue without removing it,
+    writing out its Priority in the native type of the Queue.
+
+    Inputs:
+    Queue       -   Pointer to the Priority_Queue_t to operate on.
+    Priority    -   Pointer to the int, int64_t or double to write the Priority of the front
+                        item into, matching the Type of the Queue. May be NULL.
+
+    Outputs:
+    void*   -   The Value at the front of the Queue, or NULL if the Queue is empty.
+                    Ownership of the Value is NOT transferred to the caller.
+*/
+void* Priority_Queue_PeekTyped(Priority_Queue_t* Queue, void* Priority);
+
+/*
+    Priority_Queue_PopTyped
+
+    This function removes the item at the front of the Queue, writing out its Priority
+    in the native type of the Queue and returning its Value.
+
+    Inputs:
+    Queue       -   Pointer to the Priority_Queue_t to operate on.
+    Priority    -   Pointer to the int, int64_t or double to write the Priority of the front
+                        item into, matching the Type of the Queue. May be NULL.
+
+    Outputs:
+    void*   -   The Value which was at the front of the Queue, or NULL if the Queue is empty.
+                    Ownership of the Value is transferred to the caller.
+*/
+void* Priority_Queue_PopTyped(Priority_Queue_t* Queue, void* Priority);
+
 /*
     Priority_Queue_Remove
 
@@ -3713,6 +5476,303 @@ void String_Release(String_t* String);
 /* ---------- Public String_t Functions ---------- */
 #endif
 
+#ifdef LIBCONTAINER_ENABLE_TIMER_WHEEL
+/* ++++++++++ Public TimerWheel_t Functions ++++++++++ */
+
+/*
+    TimerWheel_Create
+
+    This function creates and initializes a new TimerWheel_t, with its clock
+    starting at the given tick.
+
+    Inputs:
+    Now     -   The current tick of the clock the Wheel will be driven by. The unit
+                    of a tick is entirely up to the caller.
+
+    Outputs:
+    TimerWheel_t*   -   Pointer to a created and initialized TimerWheel_t on success,
+                            or NULL on failure.
+*/
+TimerWheel_t* TimerWheel_Create(uint64_t Now);
+
+/*
+    TimerWheel_Length
+
+    This function returns the number of timers currently scheduled within the Wheel.
+
+    Inputs:
+    Wheel   -   Pointer to the TimerWheel_t to operate on.
+
+    Outputs:
+    size_t  -   Returns the count of timers within the Wheel. Also returns 0
+                    if the given Wheel is NULL.
+*/
+size_t TimerWheel_Length(TimerWheel_t* Wheel);
+
+/*
+    TimerWheel_IsEmpty
+
+    This function simply returns a boolean equivalent to (0 == TimerWheel_Length(Wheel)),
+    making for a more visually explicit emptiness check.
+
+    Inputs:
+    Wheel   -   Pointer to the TimerWheel_t to operate on.
+
+    Outputs:
+    bool    -   Returns true if the Wheel holds no timers, or if it is NULL.
+*/
+bool TimerWheel_IsEmpty(TimerWheel_t* Wheel);
+
+/*
+    TimerWheel_Now
+
+    This function returns the current tick of the Wheel, as given to TimerWheel_Create()
+    or the last call to TimerWheel_Advance().
+
+    Inputs:
+    Wheel   -   Pointer to the TimerWheel_t to operate on.
+
+    Outputs:
+    uint64_t    -   The current tick of the Wheel, or 0 if the Wheel is NULL.
+*/
+uint64_t TimerWheel_Now(TimerWheel_t* Wheel);
+
+/*
+    TimerWheel_Schedule
+
+    This function schedules a new timer carrying the given Value, to expire at
+    the given tick. This operation is O(1).
+
+    Inputs:
+    Wheel       -   Pointer to the TimerWheel_t to operate on.
+    Expiry      -   The tick at which the timer expires. A timer scheduled at or before
+                        the current tick of the Wheel expires on the next call to
+                        TimerWheel_Advance().
+    Value       -   Pointer to the Value to carry, or NULL if the timer carries nothing.
+    ValueSize   -   The size of the Value, in bytes. If this is 0, the Value is
+                        held by reference, otherwise a copy of the Value is made.
+    ReleaseFunc -   The function to release the Value with, if it is held by reference.
+                        If this is NULL, free() is used.
+
+    Outputs:
+    TimerWheel_Timer_t*     -   The handle of the new timer on success, or NULL on failure.
+*/
+TimerWheel_Timer_t* TimerWheel_Schedule(TimerWheel_t* Wheel, uint64_t Expiry, void* Value, size_t ValueSize, ReleaseFunc_t* ReleaseFunc);
+
+/*
+    TimerWheel_Cancel
+
+    This function removes a pending timer from the Wheel without firing it, releasing
+    the Value it carries. This operation is O(1).
+
+    Inputs:
+    Wheel   -   Pointer to the TimerWheel_t to operate on.
+    Timer   -   The handle of the timer to cancel, as returned by TimerWheel_Schedule().
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure.
+
+    Note:
+    The handle is no longer valid after this call. A timer may not be cancelled from
+    within its own callback, as it has already left the Wheel by then.
+*/
+int TimerWheel_Cancel(TimerWheel_t* Wheel, TimerWheel_Timer_t* Timer);
+
+/*
+    TimerWheel_Advance
+
+    This function moves the clock of the Wheel forward to the given tick, firing
+    every timer which expires at or before it. Each timer fires by calling the
+    Callback with its Value and the given Args, after which the timer is removed
+    and its Value released.
+
+    Timers fire in order of their Expiry, with timers sharing an Expiry firing in no
+    particular order. The Callback may freely schedule and cancel other timers,
+    and any newly scheduled timers which are already due also fire before this
+    call returns.
+
+    Inputs:
+    Wheel       -   Pointer to the TimerWheel_t to operate on.
+    Now         -   The tick to advance the Wheel to. If this is not after the
+                        current tick, only timers which are already due are fired.
+    Callback    -   The function to call for each expiring timer, or NULL to simply
+                        release the expiring timers.
+    Args        -   The additional argument to pass to each call of the Callback.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero if the Wheel is NULL, or if any Callback
+                    returned non-zero. Every due timer is fired regardless.
+*/
+int TimerWheel_Advance(TimerWheel_t* Wheel, uint64_t Now, CallbackArgFunc_t* Callback, void* Args);
+
+/*
+    TimerWheel_Clear
+
+    This function cancels every timer within the Wheel, releasing their Values,
+    while leaving the Wheel and its current tick intact.
+
+    Inputs:
+    Wheel   -   Pointer to the TimerWheel_t to operate on.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure.
+*/
+int TimerWheel_Clear(TimerWheel_t* Wheel);
+
+/*
+    TimerWheel_Release
+
+    This function cancels every timer within the Wheel and releases the Wheel
+    itself. Following a call to this function, the Wheel is no longer valid for use.
+
+    Inputs:
+    Wheel   -   Pointer to the TimerWheel_t to operate on.
+
+    Outputs:
+    None, the Wheel and all resources held by its timers are fully released.
+*/
+void TimerWheel_Release(TimerWheel_t* Wheel);
+
+/* ---------- Public TimerWheel_t Functions ---------- */
+#endif
+
+#ifdef LIBCONTAINER_ENABLE_TOP_K
+/* ++++++++++ Public TopK_t Functions ++++++++++ */
+
+/*
+    TopK_Create
+
+    This function creates and initializes a new TopK_t, ready to keep the first
+    K of the items offered to it.
+
+    Inputs:
+    K           -   The number of items to keep. This must be non-zero.
+    CompareFunc -   Pointer to the function to use to compare two Keys. The items kept
+                        are those which come first in the order this defines, so use
+                        a descending comparison to keep the K largest items.
+    KeySize     -   The size of every Key (in bytes), in which case each Key kept is
+                        copied into the TopK_t. Leave as 0 to instead hold each Key
+                        by reference, which must then outlive the TopK_t.
+
+    Outputs:
+    TopK_t*     -   Pointer to a created and initialized TopK_t on success, or NULL on failure.
+
+    Note:
+    A TopK_t never owns or releases the Value offered alongside each Key. These are
+    simply carried through, to identify where each Key came from.
+*/
+TopK_t* TopK_Create(size_t K, CompareFunc_t* CompareFunc, size_t KeySize);
+
+/*
+    TopK_Length
+
+    This function returns the number of items currently kept, which is never more than K.
+
+    Inputs:
+    TopK    -   Pointer to the TopK_t to operate on.
+
+    Outputs:
+    size_t  -   The number of items kept, or 0 if TopK is NULL.
+*/
+size_t TopK_Length(TopK_t* TopK);
+
+/*
+    TopK_IsEmpty
+
+    This function simply returns a boolean equivalent to (0 == TopK_Length(TopK)),
+    making for a more visually explicit emptiness check.
+
+    Inputs:
+    TopK    -   Pointer to the TopK_t to operate on.
+
+    Outputs:
+    bool    -   Returns true if no items are kept, or if TopK is NULL.
+*/
+bool TopK_IsEmpty(TopK_t* TopK);
+
+/*
+    TopK_Push
+
+    This function offers a new item to the TopK_t. The item is kept if fewer than K
+    items are held, or if it comes before the last of them, which is then dropped.
+    Items which compare equal to the last one kept are not kept, so the earliest of
+    any equal items are preferred.
+
+    Inputs:
+    TopK    -   Pointer to the TopK_t to operate on.
+    Key     -   Pointer to the Key to order the item by.
+    Value   -   An optional pointer to carry along with the Key, which is never released.
+
+    Outputs:
+    int     -   Returns 0 on success, whether or not the item is kept, or non-zero on failure.
+*/
+int TopK_Push(TopK_t* TopK, void* Key, void* Value);
+
+/*
+    TopK_Peek
+
+    This function returns the last of the items kept, which is the item any newly
+    offered item must come before in order to be kept, once K items are held.
+
+    Inputs:
+    TopK    -   Pointer to the TopK_t to operate on.
+
+    Outputs:
+    Binary_Heap_KeyValuePair_t  -   The Key and Value of the last item kept, or
+                                        NULL pointers if the TopK_t is empty.
+*/
+Binary_Heap_KeyValuePair_t TopK_Peek(TopK_t* TopK);
+
+/*
+    TopK_Pop
+
+    This function removes and returns the last of the items kept. Popping until the
+    TopK_t is empty therefore returns the items kept in the reverse of their order.
+
+    Inputs:
+    TopK    -   Pointer to the TopK_t to operate on.
+
+    Outputs:
+    Binary_Heap_KeyValuePair_t  -   The Key and Value of the removed item, or
+                                        NULL pointers if the TopK_t is empty.
+
+    Note:
+    If the TopK_t copies its Keys, the returned Key points into the TopK_t, and
+    remains valid only until the next Pop. Neither pointer is to be released.
+*/
+Binary_Heap_KeyValuePair_t TopK_Pop(TopK_t* TopK);
+
+/*
+    TopK_Clear
+
+    This function removes every item kept, while leaving the TopK_t ready for
+    a fresh stream of items.
+
+    Inputs:
+    TopK    -   Pointer to the TopK_t to operate on.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure.
+*/
+int TopK_Clear(TopK_t* TopK);
+
+/*
+    TopK_Release
+
+    This function releases the TopK_t. Following a call to this function,
+    the TopK_t is no longer valid for use.
+
+    Inputs:
+    TopK    -   Pointer to the TopK_t to operate on.
+
+    Outputs:
+    None, the TopK_t is fully released.
+*/
+void TopK_Release(TopK_t* TopK);
+
+/* ---------- Public TopK_t Functions ---------- */
+#endif
+
 /* ---------- Exported Library Functions ---------- */
 
 #ifdef __cplusplus
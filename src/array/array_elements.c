@@ -128,7 +128,7 @@ int Array_RemoveN(Array_t *Array, size_t Index, size_t Count) {
     */
     if ( 0 == Array->ElementSize ) {
         for ( ReleaseIndex = 0; ReleaseIndex < Count; ReleaseIndex++ ) {
-            Array->ReleaseFunc(Array->Contents.ContentRefs[Index]);
+            Array->ReleaseFunc(Array->Contents.ContentRefs[Index + ReleaseIndex]);
         }
 
         memmove(&(Array->Contents.ContentRefs[Index]),
@@ -88,6 +88,60 @@ int Array_Grow(Array_t *Array, size_t AdditionalCapacity) {
     return 0;
 }
 
+int Array_Shrink(Array_t *Array, size_t MinimumCapacity) {
+
+    size_t   NewCap = 0, ElementSize = sizeof(void *);
+    uint8_t *Temp   = NULL;
+
+    if ( NULL == Array ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error, NULL Array_t* provided.");
+#endif
+        return 1;
+    }
+
+    if ( NULL == Array->Contents.ContentBytes ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error, Array_t* in invalid state with NULL Contents pointer.");
+#endif
+        return 1;
+    }
+
+    if ( 0 != Array->ElementSize ) {
+        ElementSize = Array->ElementSize;
+    }
+
+    NewCap = Array->Length;
+    if ( NewCap < MinimumCapacity ) {
+        NewCap = MinimumCapacity;
+    }
+
+    /* Explicitly assert non-zero capacity. */
+    if ( 0 == NewCap ) {
+        NewCap = 1;
+    }
+
+    if ( Array->Capacity <= NewCap ) {
+        return 0;
+    }
+
+    Temp = (uint8_t *)realloc(Array->Contents.ContentBytes, NewCap * ElementSize);
+    if ( NULL == Temp ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Failed to reallocate and shrink Array_t Contents");
+#endif
+        return 1;
+    }
+
+    Array->Contents.ContentBytes = Temp;
+    Array->Capacity              = NewCap;
+#ifdef DEBUG
+    DEBUG_PRINTF("Successfully decreased Array_t capacity to [ %lu ]",
+                 (unsigned long)Array->Capacity);
+#endif
+    return 0;
+}
+
 size_t Array_Length(Array_t *Array) {
 
     if ( NULL == Array ) {
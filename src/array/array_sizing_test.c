@@ -55,3 +55,48 @@ int Test_Array_Grow(void) {
     Array_Release(Array);
     TEST_SUCCESSFUL;
 }
+
+int Test_Array_Shrink(void) {
+
+    Array_t *Array = NULL;
+    int      i = 0, Count = 100;
+
+    Array = Array_Create(1024, sizeof(int));
+    if ( NULL == Array ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Array_t.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        if ( 0 != Array_Append(Array, &i) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Array_Append().");
+            Array_Release(Array);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( 0 != Array_Shrink(Array, 0) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to perform Array_Shrink().");
+        Array_Release(Array);
+        TEST_FAILURE;
+    }
+
+    if ( Array->Capacity != (size_t)Count ) {
+        TEST_PRINTF("Test Failure - Actual Array_t Capacity (%lu) is not equal to the "
+                    "Array_t Length (%d).",
+                    (unsigned long)Array->Capacity, Count);
+        Array_Release(Array);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        if ( i != *(int *)Array_GetElement(Array, (size_t)i) ) {
+            TEST_PRINTF("Test Failure - Element [ %d ] changed by Array_Shrink().", i);
+            Array_Release(Array);
+            TEST_FAILURE;
+        }
+    }
+
+    Array_Release(Array);
+    TEST_SUCCESSFUL;
+}
@@ -25,9 +25,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#define LIBCONTAINER_ENABLE_TOP_K
+
 #include "../logging/logging.h"
 #include "include/array.h"
 
+#include "../heap/top-k/include/top_k.h"
+
 int Array_Sort(Array_t *Array, CompareFunc_t *CompareFunc) {
 
     if ( NULL == Array ) {
@@ -49,8 +53,83 @@ int Array_Sort(Array_t *Array, CompareFunc_t *CompareFunc) {
     return Array_doQuickSort(Array, CompareFunc, 0, (ssize_t)Array_Length(Array) - 1);
 }
 
+Array_t *Array_TopK(Array_t *Array, size_t K, CompareFunc_t *CompareFunc) {
+
+    TopK_t *                   TopK    = NULL;
+    Array_t *                  Results = NULL;
+    Binary_Heap_KeyValuePair_t Item    = {NULL, NULL};
+    size_t                     Index   = 0;
+
+    if ( (NULL == Array) || (NULL == CompareFunc) || (0 == K) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Array* or CompareFunc*, or a K of 0 provided.");
+#endif
+        return NULL;
+    }
+
+    /* Copied elements are held inline in the TopK_t, referenced ones by pointer. */
+    TopK = TopK_Create(K, CompareFunc, Array->ElementSize);
+    if ( 0 == Array->ElementSize ) {
+        Results = Array_RefCreate(K, NULL);
+    } else {
+        Results = Array_Create(K, Array->ElementSize);
+    }
+    if ( (NULL == TopK) || (NULL == Results) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to prepare TopK_t or result Array_t.");
+#endif
+        TopK_Release(TopK);
+        Array_Release(Results);
+        return NULL;
+    }
+    /* The result of a reference Array only borrows the elements of the original, and a
+       copying Array has no use for a ReleaseFunc. */
+    Results->ReleaseFunc = NULL;
+
+    for ( Index = 0; Index < Array->Length; Index++ ) {
+        if ( 0 != TopK_Push(TopK, Array_GetElement(Array, Index), NULL) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to offer element to TopK_t.");
+#endif
+            TopK_Release(TopK);
+            Array_Release(Results);
+            return NULL;
+        }
+    }
+
+    /*
+        The TopK_t gives back the last element first, so the result is reversed once full.
+        A reference Array is appended to with a pointer to the element pointer.
+    */
+    for ( Item = TopK_Pop(TopK); NULL != Item.Key; Item = TopK_Pop(TopK) ) {
+        if ( 0 != Array_Append(Results, (0 == Array->ElementSize) ? &Item.Key : Item.Key) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to append element to result Array_t.");
+#endif
+            TopK_Release(TopK);
+            Array_Release(Results);
+            return NULL;
+        }
+    }
+    Array_reverse(Results);
+
+    TopK_Release(TopK);
+    return Results;
+}
+
 /* ++++++++++ Private Functions ++++++++++ */
 
+void Array_reverse(Array_t *Array) {
+
+    size_t Index = 0;
+
+    for ( Index = 0; Index < Array->Length / 2; Index++ ) {
+        Array_swapItems(Array, Index, Array->Length - 1 - Index);
+    }
+
+    return;
+}
+
 void Array_swapItems(Array_t *Array, size_t IndexA, size_t IndexB) {
 
     uint8_t *ItemA = NULL, *ItemB = NULL;
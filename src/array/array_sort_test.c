@@ -48,6 +48,8 @@ int Test_array_sort(void) {
 
     FailedTests += Test_Array_Sort_Int();
     FailedTests += Test_Array_Sort_Double();
+    FailedTests += Test_Array_TopK();
+    FailedTests += Test_Array_TopK_Reference();
 
     return FailedTests;
 }
@@ -147,3 +149,118 @@ int Test_Array_Sort_Double(void) {
     Array_Release(Array);
     TEST_SUCCESSFUL;
 }
+
+int Test_Array_TopK(void) {
+
+    Array_t *Array = NULL, *Sorted = NULL, *Top = NULL;
+    size_t   Ks[] = {1, 10, 500, 1000}, i = 0, j = 0;
+    int      Value = 0;
+
+    Array  = Array_Create(0, sizeof(int));
+    Sorted = Array_Create(0, sizeof(int));
+    if ( (NULL == Array) || (NULL == Sorted) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Array_t for testing.");
+        Array_Release(Array);
+        Array_Release(Sorted);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 500; i++ ) {
+        Value = rand() % 1000;
+        if ( (0 != Array_Append(Array, &Value)) || (0 != Array_Append(Sorted, &Value)) ) {
+            TEST_PRINTF("Test Failure - Failed to append value [ %d ] to Array.", Value);
+            Array_Release(Array);
+            Array_Release(Sorted);
+            TEST_FAILURE;
+        }
+    }
+    Array_Sort(Sorted, CompareFunc_Int_Descending);
+
+    if ( NULL != (Top = Array_TopK(Array, 0, CompareFunc_Int_Descending)) ) {
+        TEST_PRINTF("%s", "Test Failure - TopK() accepted a K of 0.");
+        Array_Release(Top);
+        Array_Release(Array);
+        Array_Release(Sorted);
+        TEST_FAILURE;
+    }
+
+    /* The result must match the front of a full Sort(), even once K exceeds the Length. */
+    for ( i = 0; i < sizeof(Ks) / sizeof(Ks[0]); i++ ) {
+        Top = Array_TopK(Array, Ks[i], CompareFunc_Int_Descending);
+        if ( (NULL == Top) || (Array_Length(Top) != ((Ks[i] < 500) ? Ks[i] : 500)) ) {
+            TEST_PRINTF("Test Failure - Failed to select top (%lu) of Array.",
+                        (unsigned long)Ks[i]);
+            Array_Release(Top);
+            Array_Release(Array);
+            Array_Release(Sorted);
+            TEST_FAILURE;
+        }
+
+        for ( j = 0; j < Array_Length(Top); j++ ) {
+            if ( *(int *)Array_GetElement(Top, j) != *(int *)Array_GetElement(Sorted, j) ) {
+                TEST_PRINTF("Test Failure - Element (%lu) of top (%lu) is out of order.",
+                            (unsigned long)j, (unsigned long)Ks[i]);
+                Array_Release(Top);
+                Array_Release(Array);
+                Array_Release(Sorted);
+                TEST_FAILURE;
+            }
+        }
+        Array_Release(Top);
+    }
+
+    Array_Release(Array);
+    Array_Release(Sorted);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Array_TopK_Reference(void) {
+
+    Array_t *Array = NULL, *Top = NULL;
+    size_t   i     = 0;
+    int *    Value = NULL;
+
+    Array = Array_RefCreate(0, free);
+    if ( NULL == Array ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Array_t for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 200; i++ ) {
+        Value = (int *)malloc(sizeof(int));
+        if ( NULL != Value ) {
+            *Value = (int)((i * 37) % 200);
+        }
+        if ( (NULL == Value) || (0 != Array_Append(Array, &Value)) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to append value to Array.");
+            free(Value);
+            Array_Release(Array);
+            TEST_FAILURE;
+        }
+    }
+
+    /* The result borrows the original elements, so both Arrays may be released. */
+    Top = Array_TopK(Array, 5, CompareFunc_Int_Ascending);
+    if ( (NULL == Top) || (5 != Array_Length(Top)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to select top 5 of reference Array.");
+        Array_Release(Top);
+        Array_Release(Array);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 5; i++ ) {
+        Value = (int *)Array_GetElement(Top, i);
+        if ( (NULL == Value) || ((int)i != *Value) ||
+             (Value != Array_GetElement(Array, (i * 173) % 200)) ) {
+            TEST_PRINTF("Test Failure - Element (%lu) of reference top 5 is wrong.",
+                        (unsigned long)i);
+            Array_Release(Top);
+            Array_Release(Array);
+            TEST_FAILURE;
+        }
+    }
+
+    Array_Release(Top);
+    Array_Release(Array);
+    TEST_SUCCESSFUL;
+}
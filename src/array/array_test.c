@@ -34,6 +34,7 @@ int Test_array(void) {
 
     /* Test the resizing or reallocation functions. */
     FailedTests += Test_Array_Grow();
+    FailedTests += Test_Array_Shrink();
 
     /* Test the insert/delete functions. */
     FailedTests += Test_Array_InsertN();
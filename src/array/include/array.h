@@ -116,6 +116,21 @@ struct Array_t {
 */
 int Array_Grow(Array_t* Array, size_t AdditionalCapacity);
 
+/*
+    Array_Shrink
+
+    This function will shrink the memory held by the array, down to the smallest
+    capacity which holds both the current contents and MinimumCapacity elements.
+
+    Inputs:
+    Array           -   Pointer to the array to shrink.
+    MinimumCapacity -   The number of elements the array should still be able to hold.
+
+    Outputs:
+    int -   Returns 0 on success, non-zero on failure. On failure, the array is unchanged.
+*/
+int Array_Shrink(Array_t* Array, size_t MinimumCapacity);
+
 /*
     Array_Capacity
 
@@ -35,6 +35,7 @@ extern "C" {
 /* ++++++++++ Private Functions ++++++++++ */
 
 void Array_swapItems(Array_t* Array, size_t IndexA, size_t IndexB);
+void Array_reverse(Array_t* Array);
 ssize_t Array_doPartition(Array_t* Array, CompareFunc_t* CompareFunc, ssize_t Lower, ssize_t Upper);
 int Array_doQuickSort(Array_t* Array, CompareFunc_t* CompareFunc, ssize_t Lower, ssize_t Upper);
 
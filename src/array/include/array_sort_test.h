@@ -39,6 +39,8 @@ int Test_array_sort(void);
 
 int Test_Array_Sort_Int(void);
 int Test_Array_Sort_Double(void);
+int Test_Array_TopK(void);
+int Test_Array_TopK_Reference(void);
 
 #ifdef __cplusplus
 }
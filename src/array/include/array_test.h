@@ -40,6 +40,7 @@ int Test_Array_RefCreate(void);
 int Test_Array_Clear(void);
 
 int Test_Array_Grow(void);
+int Test_Array_Shrink(void);
 int Test_Array_Resize(void);
 
 int Test_Array_Prepend(void);
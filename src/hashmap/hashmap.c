@@ -33,9 +33,7 @@
 
 Hashmap_t *Hashmap_Create(HashFunc_t *HashFunc, size_t KeySize, ReleaseFunc_t *KeyReleaseFunc) {
 
-    Hashmap_t *Map         = NULL;
-    List_t *   NewList     = NULL;
-    size_t     BucketIndex = 0;
+    Hashmap_t *Map = NULL;
 
     if ( NULL == HashFunc ) {
 #ifdef DEBUG
@@ -66,28 +64,11 @@ Hashmap_t *Hashmap_Create(HashFunc_t *HashFunc, size_t KeySize, ReleaseFunc_t *K
         return NULL;
     }
 
-    Map->Buckets =
-        Array_RefCreate(LIBCONTAINER_HASHMAP_DEFAULT_CAPACITY, (ReleaseFunc_t *)List_Release);
-    if ( NULL == Map->Buckets ) {
-#ifdef DEBUG
-        DEBUG_PRINTF("%s", "Error: Failed to create Array_t of Buckets.");
-#endif
-        Hashmap_Release(Map);
-        return NULL;
-    }
-
-    for ( BucketIndex = 0; BucketIndex < LIBCONTAINER_HASHMAP_DEFAULT_CAPACITY; BucketIndex++ ) {
-        NewList = List_Create();
-        if ( 0 != Array_Append(Map->Buckets, &NewList) ) {
-#ifdef DEBUG
-            DEBUG_PRINTF("Error: Failed to initialize Map bucket [ %lu ].",
-                         (unsigned long)BucketIndex);
-#endif
-            Hashmap_Release(Map);
-            return NULL;
-        }
-    }
-
+    /*
+        A new Hashmap holds its items in the Small array, and only allocates
+        its Buckets once it grows past LIBCONTAINER_HASHMAP_SMALL_CAPACITY items.
+    */
+    Map->Buckets        = NULL;
     Map->HashFunc       = HashFunc;
     Map->KeyReleaseFunc = KeyReleaseFunc;
     Map->ItemCount      = 0;
@@ -114,6 +95,10 @@ int Hashmap_Insert(Hashmap_t *Map, void *Key, void *Value, size_t KeySize, size_
 
     Iterator_Invalidate(&(Map->Iterator));
 
+    if ( NULL != Map->Shards ) {
+        return Hashmap_concurrentInsert(Map, Key, Value, KeySize, ValueSize, ValueReleaseFunc);
+    }
+
     if ( (NULL == Key) || (NULL == Value) ) {
 #ifdef DEBUG
         DEBUG_PRINTF("%s", "Error: NULL Key* or Value* provided.");
@@ -164,7 +149,6 @@ int Hashmap_Insert(Hashmap_t *Map, void *Key, void *Value, size_t KeySize, size_
 void *Hashmap_Retrieve(Hashmap_t *Map, const void *Key, size_t KeySize) {
 
     unsigned int HashValue = 0;
-    List_t *     Bucket    = NULL;
 
     if ( NULL == Map ) {
 #ifdef DEBUG
@@ -173,6 +157,10 @@ void *Hashmap_Retrieve(Hashmap_t *Map, const void *Key, size_t KeySize) {
         return NULL;
     }
 
+    if ( NULL != Map->Shards ) {
+        return Hashmap_concurrentRetrieve(Map, Key, KeySize);
+    }
+
     if ( (0 != Map->KeySize) && (0 == KeySize) ) {
         KeySize = Map->KeySize;
     }
@@ -184,12 +172,7 @@ void *Hashmap_Retrieve(Hashmap_t *Map, const void *Key, size_t KeySize) {
         return NULL;
     }
 
-    Bucket = Hashmap_getBucket(Map, Key, KeySize, &HashValue);
-    if ( NULL == Bucket ) {
-        return NULL;
-    }
-
-    return Hashmap_findInBucket(Bucket, Key, KeySize, HashValue);
+    return Hashmap_findValue(Map, Key, KeySize, &HashValue);
 }
 
 size_t Hashmap_Length(Hashmap_t *Map) {
@@ -201,6 +184,10 @@ size_t Hashmap_Length(Hashmap_t *Map) {
         return 0;
     }
 
+    if ( NULL != Map->Shards ) {
+        return Hashmap_concurrentLength(Map);
+    }
+
     return Map->ItemCount;
 }
 
@@ -214,6 +201,7 @@ int Hashmap_Remove(Hashmap_t *Map, const void *Key, size_t KeySize) {
     List_t *         Bucket    = NULL;
     List_Node_t *    Node      = NULL;
     Hashmap_Entry_t *Entry     = NULL;
+    size_t           Index     = 0;
 
     if ( NULL == Map ) {
 #ifdef DEBUG
@@ -224,6 +212,10 @@ int Hashmap_Remove(Hashmap_t *Map, const void *Key, size_t KeySize) {
 
     Iterator_Invalidate(&(Map->Iterator));
 
+    if ( NULL != Map->Shards ) {
+        return Hashmap_concurrentRemove(Map, Key, KeySize);
+    }
+
     if ( 0 == Hashmap_Length(Map) ) {
 #ifdef DEBUG
         DEBUG_PRINTF("%s", "Note: Hashmap has no elements, nothing to remove.");
@@ -235,6 +227,21 @@ int Hashmap_Remove(Hashmap_t *Map, const void *Key, size_t KeySize) {
         KeySize = Map->KeySize;
     }
 
+    if ( NULL == Map->Buckets ) {
+        Index = Hashmap_smallFind(Map, Key, KeySize, &HashValue);
+        if ( Index == Map->ItemCount ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to find requested item in Hashmap.");
+#endif
+            return 1;
+        }
+        Hashmap_Entry_Release(Hashmap_smallTake(Map, Index));
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Successfully removed item from Hashmap.");
+#endif
+        return 0;
+    }
+
     Bucket = Hashmap_getBucket(Map, Key, KeySize, &HashValue);
     if ( NULL == Bucket ) {
 #ifdef DEBUG
@@ -250,6 +257,7 @@ int Hashmap_Remove(Hashmap_t *Map, const void *Key, size_t KeySize) {
             if ( 0 == memcmp(Key, Entry->Key, KeySize) ) {
                 List_removeNode(Bucket, Node);
                 Map->ItemCount -= 1;
+                Hashmap_shrink(Map);
 #ifdef DEBUG
                 DEBUG_PRINTF("%s", "Successfully removed item from Hashmap.");
 #endif
@@ -272,6 +280,7 @@ void *Hashmap_Pop(Hashmap_t *Map, const void *Key, size_t KeySize) {
     Hashmap_Entry_t *Entry     = NULL;
     unsigned int     HashValue = 0;
     void *           Value     = NULL;
+    size_t           Index     = 0;
 
     if ( NULL == Map ) {
 #ifdef DEBUG
@@ -282,6 +291,10 @@ void *Hashmap_Pop(Hashmap_t *Map, const void *Key, size_t KeySize) {
 
     Iterator_Invalidate(&(Map->Iterator));
 
+    if ( NULL != Map->Shards ) {
+        return Hashmap_concurrentPop(Map, Key, KeySize);
+    }
+
     if ( NULL == Key ) {
 #ifdef DEBUG
         DEBUG_PRINTF("%s", "Error: NULL Key* provided.");
@@ -293,6 +306,18 @@ void *Hashmap_Pop(Hashmap_t *Map, const void *Key, size_t KeySize) {
         KeySize = Map->KeySize;
     }
 
+    if ( NULL == Map->Buckets ) {
+        Index = Hashmap_smallFind(Map, Key, KeySize, &HashValue);
+        if ( Index == Map->ItemCount ) {
+            return NULL;
+        }
+        Entry                   = Hashmap_smallTake(Map, Index);
+        Entry->ValueReleaseFunc = NULL;
+        Value                   = Entry->Value.ValueRaw;
+        Hashmap_Entry_Release(Entry);
+        return Value;
+    }
+
     Bucket = Hashmap_getBucket(Map, Key, KeySize, &HashValue);
     if ( NULL == Bucket ) {
 #ifdef DEBUG
@@ -310,9 +335,11 @@ void *Hashmap_Pop(Hashmap_t *Map, const void *Key, size_t KeySize) {
                 Value                   = Entry->Value.ValueRaw;
                 List_removeNode(Bucket, Node);
                 Map->ItemCount -= 1;
+                Hashmap_shrink(Map);
                 return Value;
             }
         }
+        Node = Node->Next;
     }
 
     return NULL;
@@ -329,16 +356,64 @@ int Hashmap_Clear(Hashmap_t *Map) {
 
     Iterator_Invalidate(&(Map->Iterator));
 
-    if ( 0 != Array_DoCallback(Map->Buckets, (CallbackFunc_t *)List_Clear) ) {
+    if ( NULL != Map->Shards ) {
+        return Hashmap_concurrentClear(Map);
+    }
+
+    /* Releasing the Buckets releases every entry, and returns the Hashmap to the Small array. */
+    if ( NULL != Map->Buckets ) {
+        Array_Release(Map->Buckets);
+        Map->Buckets   = NULL;
+        Map->ItemCount = 0;
+    }
+
+    Hashmap_smallClear(Map);
 #ifdef DEBUG
-        DEBUG_PRINTF("%s", "Error: Failed to clear all buckets within Hashmap.");
+    DEBUG_PRINTF("%s", "Successfully cleared Hashmap_t of all contents.");
+#endif
+    return 0;
+}
+
+int Hashmap_Compact(Hashmap_t *Map) {
+
+    size_t BucketCount = 0;
+
+    if ( NULL == Map ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Map* provided.");
 #endif
         return 1;
     }
 
-    Map->ItemCount = 0;
+    Iterator_Invalidate(&(Map->Iterator));
+
+    if ( NULL != Map->Shards ) {
+        return Hashmap_concurrentCompact(Map);
+    }
+
+    if ( NULL == Map->Buckets ) {
+        return 0;
+    }
+
+    if ( Map->ItemCount <= LIBCONTAINER_HASHMAP_SMALL_CAPACITY ) {
+        Hashmap_demote(Map);
+        return 0;
+    }
+
+    /*
+        Find the fewest Buckets which hold the current items at no more than half of
+        the maximum Load Factor, leaving room to grow before the next rehash.
+    */
+    BucketCount = Hashmap_minimumBuckets();
+    while ( (double)Map->ItemCount > ((double)BucketCount * LIBCONTAINER_HASHMAP_LOAD_FACTOR / 2) ) {
+        BucketCount <<= 1;
+    }
+
+    Hashmap_resize(Map, BucketCount);
+
 #ifdef DEBUG
-    DEBUG_PRINTF("%s", "Successfully cleared Hashmap_t of all contents.");
+    DEBUG_PRINTF("Successfully compacted Hashmap_t to (%lu) Buckets.",
+                 (unsigned long)Array_Length(Map->Buckets));
 #endif
     return 0;
 }
@@ -352,8 +427,14 @@ void Hashmap_Release(Hashmap_t *Map) {
         return;
     }
 
+    if ( NULL != Map->Shards ) {
+        Hashmap_concurrentRelease(Map);
+    }
+
     if ( NULL != Map->Buckets ) {
         Array_Release(Map->Buckets);
+    } else {
+        Hashmap_smallClear(Map);
     }
 
     Iterator_Invalidate(&(Map->Iterator));
@@ -382,20 +463,54 @@ List_t *Hashmap_getBucket(Hashmap_t *Map, const void *Key, size_t KeySize,
 #endif
     }
 
-    BucketIndex = (size_t)(*HashValue % Array_Length(Map->Buckets));
+    /*
+        The Bucket count is always a power of two, so the low bits of the hash select the Bucket.
+        Hashmap_Scan() relies on this to visit every item regardless of resizing.
+    */
+    BucketIndex = (size_t)(*HashValue) & (Array_Length(Map->Buckets) - 1);
 
     return (List_t *)Array_GetElement(Map->Buckets, BucketIndex);
 }
 
+void *Hashmap_findValue(Hashmap_t *Map, const void *Key, size_t KeySize, unsigned int *HashValue) {
+
+    List_t *Bucket = NULL;
+    size_t  Index  = 0;
+
+    if ( NULL == Map->Buckets ) {
+        Index = Hashmap_smallFind(Map, Key, KeySize, HashValue);
+        if ( Index == Map->ItemCount ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to find requested item in Hashmap.");
+#endif
+            return NULL;
+        }
+        return Map->Small[Index]->Value.ValueRaw;
+    }
+
+    Bucket = Hashmap_getBucket(Map, Key, KeySize, HashValue);
+    if ( NULL == Bucket ) {
+        return NULL;
+    }
+
+    return Hashmap_findInBucket(Bucket, Key, KeySize, *HashValue);
+}
+
 void *Hashmap_findInBucket(List_t *Bucket, const void *Key, size_t KeySize,
                            unsigned int HashValue) {
 
     Hashmap_Entry_t *Entry = NULL;
-
-    while ( NULL != (Entry = (Hashmap_Entry_t *)List_Next(Bucket)) ) {
+    List_Node_t *    Node  = NULL;
+
+    /*
+        Walk the nodes directly rather than through List_Next(), as a lookup must not
+        touch the Iterator of the Bucket. This keeps lookups free of side-effects, allowing
+        any number of readers to search the same Bucket simultaneously.
+    */
+    for ( Node = Bucket->Head; NULL != Node; Node = Node->Next ) {
+        Entry = (Hashmap_Entry_t *)Node->Contents.ContentRaw;
         if ( Entry->HashValue == HashValue ) {
             if ( 0 == memcmp(Key, Entry->Key, KeySize) ) {
-                Iterator_Invalidate(&(Bucket->Iterator));
 #ifdef DEBUG
                 DEBUG_PRINTF("%s", "Successfully found and returned requested item from Hashmap.");
 #endif
@@ -404,7 +519,6 @@ void *Hashmap_findInBucket(List_t *Bucket, const void *Key, size_t KeySize,
         }
     }
 
-    Iterator_Invalidate(&(Bucket->Iterator));
 #ifdef DEBUG
     DEBUG_PRINTF("%s", "Error: Failed to find requested item in Hashmap.");
 #endif
@@ -422,6 +536,21 @@ int Hashmap_insertEntry(Hashmap_t *Map, Hashmap_Entry_t *Entry, bool AttemptReha
         return 1;
     }
 
+    if ( NULL == Map->Buckets ) {
+        if ( Map->ItemCount < LIBCONTAINER_HASHMAP_SMALL_CAPACITY ) {
+            Hashmap_smallInsert(Map, Entry);
+            return 0;
+        }
+
+        if ( 0 != Hashmap_promote(Map) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to allocate Buckets for Hashmap_t.");
+#endif
+            Hashmap_Entry_Release(Entry);
+            return 1;
+        }
+    }
+
     Bucket = Hashmap_getBucket(Map, (const void *)Entry->Key, Entry->KeySize, &Entry->HashValue);
     if ( NULL == Bucket ) {
 #ifdef DEBUG
@@ -471,13 +600,13 @@ void Hashmap_rehash(Hashmap_t *Map) {
         return;
     }
 
-    if ( ARRAY_DOUBLING_THRESHOLD >= OriginalBucketCount ) {
-        NewBucketCount = OriginalBucketCount;
-    } else {
-        NewBucketCount = ARRAY_DOUBLING_THRESHOLD;
-    }
+    /*
+        Always double the Bucket count, keeping it a power of two. Each item of Bucket i
+        then either stays in Bucket i, or moves to Bucket i + OriginalBucketCount.
+    */
+    NewBucketCount = OriginalBucketCount;
 
-    if ( 0 != Array_Grow(Map->Buckets, NewBucketCount - 1) ) {
+    if ( 0 != Array_Grow(Map->Buckets, NewBucketCount) ) {
 #ifdef DEBUG
         DEBUG_PRINTF("%s", "Warning: Failed to grow internal Buckets array, aborting rehash.");
 #endif
@@ -486,10 +615,12 @@ void Hashmap_rehash(Hashmap_t *Map) {
 
     for ( i = 0; i < NewBucketCount; i++ ) {
         Bucket = List_Create();
-        if ( 0 != Array_Append(Map->Buckets, &Bucket) ) {
+        if ( (NULL == Bucket) || (0 != Array_Append(Map->Buckets, &Bucket)) ) {
 #ifdef DEBUG
             DEBUG_PRINTF("%s", "Error: Failed to add new Bucket to expand Hashmap_t.");
 #endif
+            List_Release(Bucket);
+            Array_RemoveN(Map->Buckets, OriginalBucketCount, i);
             return;
         }
     }
@@ -514,4 +645,101 @@ void Hashmap_rehash(Hashmap_t *Map) {
     return;
 }
 
+void Hashmap_shrink(Hashmap_t *Map) {
+
+    double LoadFactor  = 0;
+    size_t BucketCount = 0;
+
+    if ( Map->ItemCount <= (LIBCONTAINER_HASHMAP_SMALL_CAPACITY / 2) ) {
+        Hashmap_demote(Map);
+        return;
+    }
+
+    BucketCount = Array_Length(Map->Buckets);
+    if ( BucketCount <= Hashmap_minimumBuckets() ) {
+        return;
+    }
+
+    LoadFactor = ((double)(Map->ItemCount) / (double)(BucketCount));
+    if ( LoadFactor >= LIBCONTAINER_HASHMAP_SHRINK_FACTOR ) {
+        return;
+    }
+
+    Hashmap_resize(Map, BucketCount / 2);
+
+    return;
+}
+
+void Hashmap_resize(Hashmap_t *Map, size_t BucketCount) {
+
+    size_t Half = 0, BucketIndex = 0;
+
+    /*
+        The Bucket count is a power of two, so halving it only drops the highest bit
+        of each Bucket index. Every item of Bucket i + Half therefore belongs in Bucket i,
+        and the Buckets can be merged directly without recomputing any hashes.
+    */
+    while ( Array_Length(Map->Buckets) > BucketCount ) {
+        Half = Array_Length(Map->Buckets) / 2;
+
+        for ( BucketIndex = 0; BucketIndex < Half; BucketIndex++ ) {
+            Hashmap_mergeBuckets((List_t *)Array_GetElement(Map->Buckets, BucketIndex),
+                                 (List_t *)Array_GetElement(Map->Buckets, BucketIndex + Half));
+        }
+
+        if ( 0 != Array_RemoveN(Map->Buckets, Half, Half) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to remove merged Buckets from Hashmap_t.");
+#endif
+            return;
+        }
+    }
+
+    if ( 0 != Array_Shrink(Map->Buckets, 0) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Warning: Failed to release unused memory of Buckets array.");
+#endif
+    }
+
+    return;
+}
+
+void Hashmap_mergeBuckets(List_t *Destination, List_t *Source) {
+
+    if ( NULL == Source->Head ) {
+        return;
+    }
+
+    Iterator_Invalidate(&(Destination->Iterator));
+    Iterator_Invalidate(&(Source->Iterator));
+
+    if ( NULL == Destination->Head ) {
+        Destination->Head = Source->Head;
+    } else {
+        Destination->Tail->Next = Source->Head;
+        Source->Head->Previous  = Destination->Tail;
+    }
+
+    Destination->Tail = Source->Tail;
+    Destination->Length += Source->Length;
+
+    Source->Head   = NULL;
+    Source->Tail   = NULL;
+    Source->Length = 0;
+
+    return;
+}
+
+size_t Hashmap_minimumBuckets(void) {
+
+    size_t BucketCount = 1;
+
+    /* The Bucket count must always be a power of two, see Hashmap_getBucket(). */
+    while ( BucketCount < LIBCONTAINER_HASHMAP_DEFAULT_CAPACITY ) {
+        BucketCount <<= 1;
+    }
+
+    return BucketCount;
+}
+
 /* ---------- Private Functions ---------- */
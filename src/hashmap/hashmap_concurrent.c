@@ -0,0 +1,439 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+    The reader-writer locks used to guard each shard are only declared by the
+    system headers when POSIX features are requested, which the strict ANSI
+    builds of this library otherwise disable.
+*/
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "include/hashmap.h"
+
+#include "../array/include/array.h"
+#include "../list/include/list.h"
+#include "../logging/logging.h"
+
+struct Hashmap_Shard_t {
+
+    /*
+        Lock guards every access to the Map of this shard. Readers take this in shared mode,
+        and are therefore only ever blocked by a writer operating on this same shard.
+    */
+    pthread_rwlock_t Lock;
+
+    /*
+        Map is the regular, single-threaded, Hashmap holding the entries of this shard.
+    */
+    Hashmap_t *Map;
+};
+
+Hashmap_t *Hashmap_CreateConcurrent(HashFunc_t *HashFunc, size_t KeySize,
+                                    ReleaseFunc_t *KeyReleaseFunc, size_t ShardCount) {
+
+    Hashmap_t *Map        = NULL;
+    size_t     ShardIndex = 0;
+    size_t     Count      = 1;
+
+    if ( 0 == ShardCount ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Note: No ShardCount provided, defaulting to (%lu).",
+                     (unsigned long)LIBCONTAINER_HASHMAP_CONCURRENT_SHARDS);
+#endif
+        ShardCount = LIBCONTAINER_HASHMAP_CONCURRENT_SHARDS;
+    }
+
+    while ( Count < ShardCount ) {
+        Count <<= 1;
+    }
+
+    Map = (Hashmap_t *)calloc(1, sizeof(Hashmap_t));
+    if ( NULL == Map ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Hashmap.");
+#endif
+        return NULL;
+    }
+
+    Map->Shards = (Hashmap_Shard_t *)calloc(Count, sizeof(Hashmap_Shard_t));
+    if ( NULL == Map->Shards ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Hashmap shards.");
+#endif
+        free(Map);
+        return NULL;
+    }
+
+    for ( ShardIndex = 0; ShardIndex < Count; ShardIndex++ ) {
+        Map->Shards[ShardIndex].Map = Hashmap_Create(HashFunc, KeySize, KeyReleaseFunc);
+        if ( NULL == Map->Shards[ShardIndex].Map ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("Error: Failed to create Hashmap for shard [ %lu ].",
+                         (unsigned long)ShardIndex);
+#endif
+            Hashmap_Release(Map);
+            return NULL;
+        }
+
+        if ( 0 != pthread_rwlock_init(&(Map->Shards[ShardIndex].Lock), NULL) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("Error: Failed to initialize lock for shard [ %lu ].",
+                         (unsigned long)ShardIndex);
+#endif
+            Hashmap_Release(Map->Shards[ShardIndex].Map);
+            Hashmap_Release(Map);
+            return NULL;
+        }
+
+        /* Only count the shard once it is fully initialized, so a failure releases exactly
+         * the shards which were prepared. */
+        Map->ShardCount += 1;
+    }
+
+    /* Every shard resolves the same defaults, so take the effective settings from the first. */
+    Map->HashFunc       = Map->Shards[0].Map->HashFunc;
+    Map->KeySize        = Map->Shards[0].Map->KeySize;
+    Map->KeyReleaseFunc = Map->Shards[0].Map->KeyReleaseFunc;
+
+#ifdef DEBUG
+    DEBUG_PRINTF("Successfully created and initialized concurrent Hashmap_t with (%lu) shards.",
+                 (unsigned long)Map->ShardCount);
+#endif
+    return Map;
+}
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+Hashmap_Shard_t *Hashmap_concurrentShard(Hashmap_t *Map, const void *Key, size_t KeySize,
+                                         unsigned int *HashValue) {
+
+    unsigned long Mixed = 0;
+
+    *HashValue = Map->HashFunc(Key, KeySize);
+
+    /* Fibonacci hashing, keeping only the low 32 bits regardless of the width of long. */
+    Mixed = ((unsigned long)(*HashValue) * 2654435769UL) & 0xFFFFFFFFUL;
+
+    return &(Map->Shards[(size_t)(Mixed >> 16) & (Map->ShardCount - 1)]);
+}
+
+int Hashmap_concurrentInsert(Hashmap_t *Map, void *Key, void *Value, size_t KeySize,
+                             size_t ValueSize, ReleaseFunc_t *ValueReleaseFunc) {
+
+    Hashmap_Shard_t *Shard     = NULL;
+    unsigned int     HashValue = 0;
+    int              Result    = 0;
+
+    if ( (NULL == Key) || (NULL == Value) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Key* or Value* provided.");
+#endif
+        return 1;
+    }
+
+    if ( 0 != Map->KeySize ) {
+        if ( (0 != KeySize) && (KeySize != Map->KeySize) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("Error: Unexpected KeySize. Expected (%lu), got (%lu).",
+                         (unsigned long)Map->KeySize, (unsigned long)KeySize);
+#endif
+            return 1;
+        }
+        KeySize = Map->KeySize;
+    }
+
+    Shard = Hashmap_concurrentShard(Map, Key, KeySize, &HashValue);
+
+    if ( 0 != pthread_rwlock_wrlock(&(Shard->Lock)) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to acquire exclusive lock on Hashmap shard.");
+#endif
+        return 1;
+    }
+
+    Result = Hashmap_Insert(Shard->Map, Key, Value, KeySize, ValueSize, ValueReleaseFunc);
+
+    pthread_rwlock_unlock(&(Shard->Lock));
+
+    return Result;
+}
+
+void *Hashmap_concurrentRetrieve(Hashmap_t *Map, const void *Key, size_t KeySize) {
+
+    Hashmap_Shard_t *Shard     = NULL;
+    void *           Value     = NULL;
+    unsigned int     HashValue = 0;
+
+    if ( NULL == Key ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Key* provided.");
+#endif
+        return NULL;
+    }
+
+    if ( (0 != Map->KeySize) && (0 == KeySize) ) {
+        KeySize = Map->KeySize;
+    }
+
+    Shard = Hashmap_concurrentShard(Map, Key, KeySize, &HashValue);
+
+    if ( 0 != pthread_rwlock_rdlock(&(Shard->Lock)) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to acquire shared lock on Hashmap shard.");
+#endif
+        return NULL;
+    }
+
+    /* Re-use the hash value computed to select the shard, rather than hashing the Key twice. */
+    Value = Hashmap_findValue(Shard->Map, Key, KeySize, &HashValue);
+
+    pthread_rwlock_unlock(&(Shard->Lock));
+
+    return Value;
+}
+
+int Hashmap_concurrentRemove(Hashmap_t *Map, const void *Key, size_t KeySize) {
+
+    Hashmap_Shard_t *Shard     = NULL;
+    unsigned int     HashValue = 0;
+    int              Result    = 0;
+
+    if ( NULL == Key ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Key* provided.");
+#endif
+        return 1;
+    }
+
+    if ( (0 != Map->KeySize) && (0 == KeySize) ) {
+        KeySize = Map->KeySize;
+    }
+
+    Shard = Hashmap_concurrentShard(Map, Key, KeySize, &HashValue);
+
+    if ( 0 != pthread_rwlock_wrlock(&(Shard->Lock)) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to acquire exclusive lock on Hashmap shard.");
+#endif
+        return 1;
+    }
+
+    Result = Hashmap_Remove(Shard->Map, Key, KeySize);
+
+    pthread_rwlock_unlock(&(Shard->Lock));
+
+    return Result;
+}
+
+void *Hashmap_concurrentPop(Hashmap_t *Map, const void *Key, size_t KeySize) {
+
+    Hashmap_Shard_t *Shard     = NULL;
+    unsigned int     HashValue = 0;
+    void *           Value     = NULL;
+
+    if ( NULL == Key ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Key* provided.");
+#endif
+        return NULL;
+    }
+
+    if ( (0 != Map->KeySize) && (0 == KeySize) ) {
+        KeySize = Map->KeySize;
+    }
+
+    Shard = Hashmap_concurrentShard(Map, Key, KeySize, &HashValue);
+
+    if ( 0 != pthread_rwlock_wrlock(&(Shard->Lock)) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to acquire exclusive lock on Hashmap shard.");
+#endif
+        return NULL;
+    }
+
+    Value = Hashmap_Pop(Shard->Map, Key, KeySize);
+
+    pthread_rwlock_unlock(&(Shard->Lock));
+
+    return Value;
+}
+
+size_t Hashmap_concurrentLength(Hashmap_t *Map) {
+
+    size_t ShardIndex = 0;
+    size_t Length     = 0;
+
+    for ( ShardIndex = 0; ShardIndex < Map->ShardCount; ShardIndex++ ) {
+        if ( 0 != pthread_rwlock_rdlock(&(Map->Shards[ShardIndex].Lock)) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("Error: Failed to acquire shared lock on shard [ %lu ].",
+                         (unsigned long)ShardIndex);
+#endif
+            continue;
+        }
+        Length += Hashmap_Length(Map->Shards[ShardIndex].Map);
+        pthread_rwlock_unlock(&(Map->Shards[ShardIndex].Lock));
+    }
+
+    return Length;
+}
+
+int Hashmap_concurrentEntries(Hashmap_t *Map, Array_t *Entries) {
+
+    size_t ShardIndex = 0;
+    int    Result     = 0;
+
+    for ( ShardIndex = 0; ShardIndex < Map->ShardCount; ShardIndex++ ) {
+        if ( 0 != pthread_rwlock_rdlock(&(Map->Shards[ShardIndex].Lock)) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("Error: Failed to acquire shared lock on shard [ %lu ].",
+                         (unsigned long)ShardIndex);
+#endif
+            return 1;
+        }
+        Result = Hashmap_appendEntries(Map->Shards[ShardIndex].Map, Entries);
+        pthread_rwlock_unlock(&(Map->Shards[ShardIndex].Lock));
+
+        if ( 0 != Result ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("Error: Failed to collect entries of shard [ %lu ].",
+                         (unsigned long)ShardIndex);
+#endif
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+size_t Hashmap_concurrentScan(Hashmap_t *Map, size_t Cursor, size_t Count, CallbackFunc_t *Callback,
+                              CallbackArgFunc_t *CallbackArg, void *Args) {
+
+    size_t ShardIndex = 0, ShardBits = 0, Inner = 0, Reported = 0, Empty = 0;
+
+    /*
+        The low bits of the cursor select the shard, and the remaining bits hold the
+        bucket cursor within that shard. Shards are scanned one after another, as each
+        one resizes independently of the others.
+    */
+    while ( ((size_t)1 << ShardBits) < Map->ShardCount ) {
+        ShardBits += 1;
+    }
+
+    ShardIndex = Cursor & (Map->ShardCount - 1);
+    Inner      = Cursor >> ShardBits;
+
+    while ( ShardIndex < Map->ShardCount ) {
+        if ( 0 != pthread_rwlock_rdlock(&(Map->Shards[ShardIndex].Lock)) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("Error: Failed to acquire shared lock on shard [ %lu ].",
+                         (unsigned long)ShardIndex);
+#endif
+            return (Inner << ShardBits) | ShardIndex;
+        }
+        Inner = Hashmap_scanBuckets(Map->Shards[ShardIndex].Map, Inner, Count, &Reported, &Empty,
+                                    Callback, CallbackArg, Args);
+        pthread_rwlock_unlock(&(Map->Shards[ShardIndex].Lock));
+
+        if ( 0 == Inner ) {
+            ShardIndex += 1;
+        }
+
+        if ( Hashmap_scanExhausted(Count, Reported, Empty) ) {
+            break;
+        }
+    }
+
+    if ( ShardIndex >= Map->ShardCount ) {
+        return 0;
+    }
+
+    return (Inner << ShardBits) | ShardIndex;
+}
+
+int Hashmap_concurrentClear(Hashmap_t *Map) {
+
+    size_t ShardIndex = 0;
+    int    Result     = 0;
+
+    for ( ShardIndex = 0; ShardIndex < Map->ShardCount; ShardIndex++ ) {
+        if ( 0 != pthread_rwlock_wrlock(&(Map->Shards[ShardIndex].Lock)) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("Error: Failed to acquire exclusive lock on shard [ %lu ].",
+                         (unsigned long)ShardIndex);
+#endif
+            Result = 1;
+            continue;
+        }
+        Result |= Hashmap_Clear(Map->Shards[ShardIndex].Map);
+        pthread_rwlock_unlock(&(Map->Shards[ShardIndex].Lock));
+    }
+
+    return Result;
+}
+
+int Hashmap_concurrentCompact(Hashmap_t *Map) {
+
+    size_t ShardIndex = 0;
+    int    Result     = 0;
+
+    for ( ShardIndex = 0; ShardIndex < Map->ShardCount; ShardIndex++ ) {
+        if ( 0 != pthread_rwlock_wrlock(&(Map->Shards[ShardIndex].Lock)) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("Error: Failed to acquire exclusive lock on shard [ %lu ].",
+                         (unsigned long)ShardIndex);
+#endif
+            Result = 1;
+            continue;
+        }
+        Result |= Hashmap_Compact(Map->Shards[ShardIndex].Map);
+        pthread_rwlock_unlock(&(Map->Shards[ShardIndex].Lock));
+    }
+
+    return Result;
+}
+
+void Hashmap_concurrentRelease(Hashmap_t *Map) {
+
+    size_t ShardIndex = 0;
+
+    for ( ShardIndex = 0; ShardIndex < Map->ShardCount; ShardIndex++ ) {
+        Hashmap_Release(Map->Shards[ShardIndex].Map);
+        pthread_rwlock_destroy(&(Map->Shards[ShardIndex].Lock));
+    }
+
+    free(Map->Shards);
+    Map->Shards     = NULL;
+    Map->ShardCount = 0;
+
+    return;
+}
+
+/* ---------- Private Functions ---------- */
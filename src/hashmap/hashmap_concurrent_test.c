@@ -0,0 +1,440 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../logging/logging.h"
+#include "include/hashmap.h"
+
+#define CONCURRENT_TEST_THREADS 4
+#define CONCURRENT_TEST_KEYS    1024
+
+typedef struct Hashmap_Concurrent_TestArgs_t {
+    Hashmap_t *Map;
+    int        First;
+    int        Count;
+    int        Failures;
+} Hashmap_Concurrent_TestArgs_t;
+
+static void *ConcurrentInsertWorker(void *Args) {
+
+    Hashmap_Concurrent_TestArgs_t *Context = (Hashmap_Concurrent_TestArgs_t *)Args;
+    int                            Key = 0, Value = 0;
+
+    for ( Key = Context->First; Key < Context->First + Context->Count; Key++ ) {
+        Value = Key * 2;
+        if ( 0 != Hashmap_Insert(Context->Map, &Key, &Value, sizeof(Key), sizeof(Value), NULL) ) {
+            Context->Failures += 1;
+        }
+    }
+
+    return NULL;
+}
+
+static void *ConcurrentReadWorker(void *Args) {
+
+    Hashmap_Concurrent_TestArgs_t *Context = (Hashmap_Concurrent_TestArgs_t *)Args;
+    int                            Key = 0, Round = 0, *Value = NULL;
+
+    /* Only the even Keys are read, as these are never removed while the readers run. */
+    for ( Round = 0; Round < 8; Round++ ) {
+        for ( Key = 0; Key < Context->Count; Key += 2 ) {
+            Value = (int *)Hashmap_Retrieve(Context->Map, &Key, 0);
+            if ( (NULL == Value) || ((Key * 2) != *Value) ) {
+                Context->Failures += 1;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static void *ConcurrentRemoveWorker(void *Args) {
+
+    Hashmap_Concurrent_TestArgs_t *Context = (Hashmap_Concurrent_TestArgs_t *)Args;
+    int                            Key     = 0;
+
+    for ( Key = 1; Key < Context->Count; Key += 2 ) {
+        if ( 0 != Hashmap_Remove(Context->Map, &Key, 0) ) {
+            Context->Failures += 1;
+        }
+    }
+
+    return NULL;
+}
+
+int Test_hashmap_concurrent(void) {
+
+    int FailedTests = 0;
+
+    FailedTests += Test_Hashmap_CreateConcurrent();
+    FailedTests += Test_Hashmap_Concurrent_Insert();
+    FailedTests += Test_Hashmap_Concurrent_Remove();
+    FailedTests += Test_Hashmap_Concurrent_Iterate();
+    FailedTests += Test_Hashmap_Concurrent_IterateModified();
+    FailedTests += Test_Hashmap_Concurrent_Threaded();
+
+    return FailedTests;
+}
+
+int Test_Hashmap_CreateConcurrent(void) {
+
+    Hashmap_t *Map = NULL;
+
+    Map = Hashmap_CreateConcurrent(HashFunc_Int, 0, NULL, 0);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create concurrent Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    if ( LIBCONTAINER_HASHMAP_CONCURRENT_SHARDS != Map->ShardCount ) {
+        TEST_PRINTF("Test Failure - Shard count (%lu) not equal to default (%d).",
+                    (unsigned long)Map->ShardCount, LIBCONTAINER_HASHMAP_CONCURRENT_SHARDS);
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+    Hashmap_Release(Map);
+
+    Map = Hashmap_CreateConcurrent(HashFunc_Int, 0, NULL, 5);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create concurrent Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    if ( 8 != Map->ShardCount ) {
+        TEST_PRINTF("Test Failure - Shard count (%lu) not rounded up to (%d).",
+                    (unsigned long)Map->ShardCount, 8);
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    Hashmap_Release(Map);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_Concurrent_Insert(void) {
+
+    Hashmap_t *Map          = NULL;
+    char       KeyValue[16] = {0x00};
+    int        Value = 0, *Retrieved = NULL, Count = 512, i = 0;
+
+    Map = Hashmap_CreateConcurrent(NULL, 0, NULL, 4);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create concurrent Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        snprintf(KeyValue, sizeof(KeyValue), "Key %d", i);
+        Value = i;
+        if ( 0 != Hashmap_Insert(Map, KeyValue, &Value, strlen(KeyValue) + 1, sizeof(Value), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( (size_t)Count != Hashmap_Length(Map) ) {
+        TEST_PRINTF("Test Failure - Hashmap Length (%lu) not equal to expected value (%d).",
+                    (unsigned long)Hashmap_Length(Map), Count);
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        snprintf(KeyValue, sizeof(KeyValue), "Key %d", i);
+        Retrieved = (int *)Hashmap_Retrieve(Map, KeyValue, 0);
+        if ( (NULL == Retrieved) || (i != *Retrieved) ) {
+            TEST_PRINTF("Test Failure - Failed to retrieve value for Key [ %s ].", KeyValue);
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    Hashmap_Release(Map);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_Concurrent_Remove(void) {
+
+    Hashmap_t *Map   = NULL;
+    int        Key   = 0, Value = 0, *Popped = NULL;
+    int        Count = 256;
+
+    Map = Hashmap_CreateConcurrent(HashFunc_Int, 0, NULL, 0);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create concurrent Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        Value = Key;
+        if ( 0 != Hashmap_Insert(Map, &Key, &Value, 0, sizeof(Value), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( Key = 0; Key < Count; Key += 2 ) {
+        if ( 0 != Hashmap_Remove(Map, &Key, 0) ) {
+            TEST_PRINTF("Test Failure - Failed to remove Key [ %d ].", Key);
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    Key    = 1;
+    Popped = (int *)Hashmap_Pop(Map, &Key, 0);
+    if ( (NULL == Popped) || (1 != *Popped) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to Pop Key [ 1 ].");
+        free(Popped);
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+    free(Popped);
+
+    if ( (size_t)(Count / 2 - 1) != Hashmap_Length(Map) ) {
+        TEST_PRINTF("Test Failure - Hashmap Length (%lu) not equal to expected value (%d).",
+                    (unsigned long)Hashmap_Length(Map), Count / 2 - 1);
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        if ( Hashmap_KeyExists(Map, &Key, 0) != ((1 == (Key % 2)) && (1 != Key)) ) {
+            TEST_PRINTF("Test Failure - Unexpected presence of Key [ %d ].", Key);
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( 0 != Hashmap_Clear(Map) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to Clear concurrent Hashmap_t.");
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    if ( 0 != Hashmap_Length(Map) ) {
+        TEST_PRINTF("Test Failure - Hashmap Length (%lu) not zero after Clear.",
+                    (unsigned long)Hashmap_Length(Map));
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    Hashmap_Release(Map);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_Concurrent_Iterate(void) {
+
+    Hashmap_t *            Map          = NULL;
+    Array_t *              Keys         = NULL;
+    Hashmap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    int                    Key = 0, Value = 0, Count = 300, Visited = 0;
+
+    Map = Hashmap_CreateConcurrent(HashFunc_Int, 0, NULL, 16);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create concurrent Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        Value = -Key;
+        if ( 0 != Hashmap_Insert(Map, &Key, &Value, 0, sizeof(Value), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    Keys = Hashmap_Keys(Map);
+    if ( (NULL == Keys) || ((size_t)Count != Array_Length(Keys)) ) {
+        TEST_PRINTF("%s", "Test Failure - Keys array does not hold every Key of all shards.");
+        Array_Release(Keys);
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+    Array_Release(Keys);
+
+    HASHMAP_FOREACH(Map, KeyValuePair) {
+        if ( *(int *)KeyValuePair.Key != -*(int *)KeyValuePair.Value ) {
+            TEST_PRINTF("Test Failure - Mismatched pair (%d, %d) during iteration.",
+                        *(int *)KeyValuePair.Key, *(int *)KeyValuePair.Value);
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+        Visited++;
+    }
+
+    if ( Count != Visited ) {
+        TEST_PRINTF("Test Failure - Iteration visited (%d) of (%d) items.", Visited, Count);
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    Hashmap_Release(Map);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_Concurrent_IterateModified(void) {
+
+    Hashmap_t *            Map          = NULL;
+    Hashmap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    int                    Key = 0, Value = 0, Count = 100, Visited = 0;
+
+    Map = Hashmap_CreateConcurrent(HashFunc_Int, 0, NULL, 4);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create concurrent Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        Value = -Key;
+        if ( 0 != Hashmap_Insert(Map, &Key, &Value, 0, sizeof(Value), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    HASHMAP_FOREACH(Map, KeyValuePair) {
+        Visited++;
+    }
+
+    /* Every Key the first walk saw is released, so the next walk must not reuse them. */
+    for ( Key = 0; Key < Count; Key++ ) {
+        if ( 0 != Hashmap_Remove(Map, &Key, 0) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Remove operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( Key = Count; Key < (2 * Count); Key++ ) {
+        Value = -Key;
+        if ( 0 != Hashmap_Insert(Map, &Key, &Value, 0, sizeof(Value), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    HASHMAP_FOREACH(Map, KeyValuePair) {
+        if ( (*(int *)KeyValuePair.Key < Count) ||
+             (*(int *)KeyValuePair.Key != -*(int *)KeyValuePair.Value) ) {
+            TEST_PRINTF("Test Failure - Stale pair (%d, %d) after modification.",
+                        *(int *)KeyValuePair.Key, *(int *)KeyValuePair.Value);
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+        Visited++;
+    }
+
+    if ( (2 * Count) != Visited ) {
+        TEST_PRINTF("Test Failure - Iteration visited (%d) of (%d) items.", Visited, 2 * Count);
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    Hashmap_Release(Map);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_Concurrent_Threaded(void) {
+
+    Hashmap_t *                   Map = NULL;
+    pthread_t                     Threads[CONCURRENT_TEST_THREADS + 1];
+    Hashmap_Concurrent_TestArgs_t Args[CONCURRENT_TEST_THREADS + 1];
+    int                           i = 0, Failures = 0, Key = 0;
+
+    Map = Hashmap_CreateConcurrent(HashFunc_Int, 0, NULL, 0);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create concurrent Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    /* Each writer inserts a disjoint range of Keys at the same time. */
+    for ( i = 0; i < CONCURRENT_TEST_THREADS; i++ ) {
+        Args[i].Map      = Map;
+        Args[i].First    = i * (CONCURRENT_TEST_KEYS / CONCURRENT_TEST_THREADS);
+        Args[i].Count    = CONCURRENT_TEST_KEYS / CONCURRENT_TEST_THREADS;
+        Args[i].Failures = 0;
+        pthread_create(&Threads[i], NULL, ConcurrentInsertWorker, &Args[i]);
+    }
+
+    for ( i = 0; i < CONCURRENT_TEST_THREADS; i++ ) {
+        pthread_join(Threads[i], NULL);
+        Failures += Args[i].Failures;
+    }
+
+    if ( (0 != Failures) || (CONCURRENT_TEST_KEYS != Hashmap_Length(Map)) ) {
+        TEST_PRINTF("Test Failure - Concurrent insertion failed (%d) times, Length (%lu).", Failures,
+                    (unsigned long)Hashmap_Length(Map));
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    /* Readers of the even Keys run alongside a writer removing all of the odd Keys. */
+    for ( i = 0; i <= CONCURRENT_TEST_THREADS; i++ ) {
+        Args[i].Map      = Map;
+        Args[i].First    = 0;
+        Args[i].Count    = CONCURRENT_TEST_KEYS;
+        Args[i].Failures = 0;
+        if ( i == CONCURRENT_TEST_THREADS ) {
+            pthread_create(&Threads[i], NULL, ConcurrentRemoveWorker, &Args[i]);
+        } else {
+            pthread_create(&Threads[i], NULL, ConcurrentReadWorker, &Args[i]);
+        }
+    }
+
+    for ( i = 0; i <= CONCURRENT_TEST_THREADS; i++ ) {
+        pthread_join(Threads[i], NULL);
+        Failures += Args[i].Failures;
+    }
+
+    if ( 0 != Failures ) {
+        TEST_PRINTF("Test Failure - Concurrent readers and writer failed (%d) times.", Failures);
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < CONCURRENT_TEST_KEYS; Key++ ) {
+        if ( Hashmap_KeyExists(Map, &Key, 0) != (0 == (Key % 2)) ) {
+            TEST_PRINTF("Test Failure - Unexpected presence of Key [ %d ].", Key);
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    Hashmap_Release(Map);
+    TEST_SUCCESSFUL;
+}
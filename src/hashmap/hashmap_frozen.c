@@ -0,0 +1,651 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+    Memory-mapping the saved buffer requires the POSIX file and mapping interfaces, which
+    the strict ANSI builds of this library otherwise disable.
+*/
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "include/hashmap.h"
+
+#include "../array/include/array.h"
+#include "../logging/logging.h"
+
+/*
+    HASHMAP_FROZEN_ALIGN
+
+    Round the given size up to the next multiple of HASHMAP_FROZEN_ALIGNMENT.
+*/
+#define HASHMAP_FROZEN_ALIGN(Size)                                                                 \
+    (((Size) + (HASHMAP_FROZEN_ALIGNMENT - 1)) & ~((size_t)HASHMAP_FROZEN_ALIGNMENT - 1))
+
+/*
+    HASHMAP_FROZEN_MAX_ATTEMPTS
+
+    The number of different Salt values to try before giving up on building a perfect hash.
+    A single attempt almost always succeeds, further attempts exist only to recover from a
+    pair of Keys which happen to share both hashes.
+*/
+#define HASHMAP_FROZEN_MAX_ATTEMPTS 16
+
+Hashmap_Frozen_t *Hashmap_Freeze(Hashmap_t *Map) {
+
+    Hashmap_Frozen_t *       Frozen    = NULL;
+    Hashmap_Frozen_Header_t *Header    = NULL;
+    Hashmap_Frozen_Slot_t *  Slots     = NULL;
+    Hashmap_Entry_t *        Entry     = NULL;
+    Array_t *                Entries   = NULL;
+    uint32_t *               Primary   = NULL, *Secondary = NULL, *Seeds = NULL, *SlotOf = NULL;
+    uint32_t *               EntryOf   = NULL;
+    uint32_t                 Count     = 0, BucketCount = 0, Salt = 0, i = 0;
+    size_t                   KeySize   = 0, DataSize = 0, TotalSize = 0, Offset = 0;
+    size_t                   SeedsSize = 0, SlotsSize = 0;
+    int                      Placed    = 1;
+
+    if ( NULL == Map ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Map* provided.");
+#endif
+        return NULL;
+    }
+
+    Entries = Array_RefCreate(Hashmap_Length(Map), NULL);
+    if ( NULL == Entries ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to create Array_t to collect Hashmap entries.");
+#endif
+        return NULL;
+    }
+    /* The entries remain owned by the Hashmap. */
+    Entries->ReleaseFunc = NULL;
+
+    if ( 0 != Hashmap_appendEntries(Map, Entries) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to collect the entries of the Hashmap.");
+#endif
+        Array_Release(Entries);
+        return NULL;
+    }
+
+    if ( Array_Length(Entries) > 0xFFFFFFFFUL ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Hashmap holds too many entries to be frozen.");
+#endif
+        Array_Release(Entries);
+        return NULL;
+    }
+
+    Count       = (uint32_t)Array_Length(Entries);
+    BucketCount = (Count / HASHMAP_FROZEN_BUCKET_SIZE) + 1;
+    KeySize     = Map->KeySize;
+
+    /* Only Keys and Values owned by the Hashmap can be copied into the frozen buffer. */
+    for ( i = 0; i < Count; i++ ) {
+        Entry = (Hashmap_Entry_t *)Array_GetElement(Entries, i);
+        if ( (0 == Entry->KeySize) || (0 == Entry->ValueSize) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Reference-type Keys or Values cannot be frozen.");
+#endif
+            Array_Release(Entries);
+            return NULL;
+        }
+        if ( (0 != KeySize) && (Entry->KeySize != KeySize) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Hashmap entry has unexpected KeySize.");
+#endif
+            Array_Release(Entries);
+            return NULL;
+        }
+        DataSize += HASHMAP_FROZEN_ALIGN(Entry->KeySize) + HASHMAP_FROZEN_ALIGN(Entry->ValueSize);
+    }
+
+    SeedsSize = HASHMAP_FROZEN_ALIGN(BucketCount * sizeof(uint32_t));
+    SlotsSize = (size_t)Count * sizeof(Hashmap_Frozen_Slot_t);
+    TotalSize = HASHMAP_FROZEN_ALIGN(sizeof(Hashmap_Frozen_Header_t)) + SeedsSize + SlotsSize +
+                DataSize;
+    if ( TotalSize > 0xFFFFFFFFUL ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Hashmap contents are too large to be frozen.");
+#endif
+        Array_Release(Entries);
+        return NULL;
+    }
+
+    Primary   = (uint32_t *)calloc((size_t)Count + 1, sizeof(uint32_t));
+    Secondary = (uint32_t *)calloc((size_t)Count + 1, sizeof(uint32_t));
+    SlotOf    = (uint32_t *)calloc((size_t)Count + 1, sizeof(uint32_t));
+    EntryOf   = (uint32_t *)calloc((size_t)Count + 1, sizeof(uint32_t));
+    Frozen    = (Hashmap_Frozen_t *)calloc(1, sizeof(Hashmap_Frozen_t));
+    if ( (NULL == Primary) || (NULL == Secondary) || (NULL == SlotOf) || (NULL == EntryOf) ||
+         (NULL == Frozen) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory to freeze Hashmap.");
+#endif
+        free(Primary);
+        free(Secondary);
+        free(SlotOf);
+        free(EntryOf);
+        Hashmap_FrozenRelease(Frozen);
+        Array_Release(Entries);
+        return NULL;
+    }
+
+    Frozen->Size   = TotalSize;
+    Frozen->Buffer = (uint8_t *)calloc(TotalSize, sizeof(uint8_t));
+    if ( NULL == Frozen->Buffer ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for frozen Hashmap buffer.");
+#endif
+        free(Primary);
+        free(Secondary);
+        free(SlotOf);
+        free(EntryOf);
+        Hashmap_FrozenRelease(Frozen);
+        Array_Release(Entries);
+        return NULL;
+    }
+
+    Header = (Hashmap_Frozen_Header_t *)(void *)Frozen->Buffer;
+    Header->SeedsOffset = (uint32_t)HASHMAP_FROZEN_ALIGN(sizeof(Hashmap_Frozen_Header_t));
+    Header->SlotsOffset = Header->SeedsOffset + (uint32_t)SeedsSize;
+    Header->DataOffset  = Header->SlotsOffset + (uint32_t)SlotsSize;
+    Seeds               = (uint32_t *)(void *)(Frozen->Buffer + Header->SeedsOffset);
+    Slots               = (Hashmap_Frozen_Slot_t *)(void *)(Frozen->Buffer + Header->SlotsOffset);
+
+    for ( Salt = 0; (0 != Placed) && (Salt < HASHMAP_FROZEN_MAX_ATTEMPTS); Salt++ ) {
+        for ( i = 0; i < Count; i++ ) {
+            Entry = (Hashmap_Entry_t *)Array_GetElement(Entries, i);
+            Hashmap_frozenHash(Entry->Key,
+                               Hashmap_frozenKeyLength(Entry->Key, Entry->KeySize, (0 != KeySize)),
+                               Salt, &(Primary[i]), &(Secondary[i]));
+        }
+        Placed = Hashmap_frozenPlace(Primary, Secondary, Count, BucketCount, Seeds, SlotOf);
+    }
+
+    if ( 0 != Placed ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to find a perfect hash for the Keys of the Hashmap.");
+#endif
+        free(Primary);
+        free(Secondary);
+        free(SlotOf);
+        free(EntryOf);
+        Hashmap_FrozenRelease(Frozen);
+        Array_Release(Entries);
+        return NULL;
+    }
+
+    Header->Magic       = (uint32_t)HASHMAP_FROZEN_MAGIC;
+    Header->Version     = HASHMAP_FROZEN_VERSION;
+    Header->TotalSize   = (uint32_t)TotalSize;
+    Header->Salt        = Salt - 1;
+    Header->KeySize     = (uint32_t)KeySize;
+    Header->ItemCount   = Count;
+    Header->BucketCount = BucketCount;
+
+    /* Lay the data out in Slot order, so neighbouring Slots refer to neighbouring memory. */
+    for ( i = 0; i < Count; i++ ) {
+        EntryOf[SlotOf[i]] = i;
+    }
+
+    Offset = Header->DataOffset;
+    for ( i = 0; i < Count; i++ ) {
+        Entry = (Hashmap_Entry_t *)Array_GetElement(Entries, EntryOf[i]);
+
+        Slots[i].Hash      = Secondary[EntryOf[i]];
+        Slots[i].KeyOffset = (uint32_t)Offset;
+        Slots[i].KeySize   = (uint32_t)Entry->KeySize;
+        Slots[i].ValueSize = (uint32_t)Entry->ValueSize;
+
+        memcpy(Frozen->Buffer + Offset, Entry->Key, Entry->KeySize);
+        Offset += HASHMAP_FROZEN_ALIGN(Entry->KeySize);
+        memcpy(Frozen->Buffer + Offset, Entry->Value.ValueBytes, Entry->ValueSize);
+        Offset += HASHMAP_FROZEN_ALIGN(Entry->ValueSize);
+    }
+
+    free(Primary);
+    free(Secondary);
+    free(SlotOf);
+    free(EntryOf);
+    Array_Release(Entries);
+
+#ifdef DEBUG
+    DEBUG_PRINTF("Successfully froze Hashmap of (%lu) entries into (%lu) bytes.", (unsigned long)Count,
+                 (unsigned long)TotalSize);
+#endif
+    return Frozen;
+}
+
+void *Hashmap_FrozenRetrieve(Hashmap_Frozen_t *Frozen, const void *Key, size_t KeySize) {
+
+    const Hashmap_Frozen_Header_t *Header = NULL;
+    const Hashmap_Frozen_Slot_t *  Slot   = NULL;
+    const uint32_t *               Seeds  = NULL;
+    uint32_t                       Primary = 0, Secondary = 0;
+    size_t                         Length = 0;
+    bool                           FixedSize = false;
+
+    if ( (NULL == Frozen) || (NULL == Key) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Frozen* or Key* provided.");
+#endif
+        return NULL;
+    }
+
+    Header = (const Hashmap_Frozen_Header_t *)(const void *)Frozen->Buffer;
+    if ( 0 == Header->ItemCount ) {
+        return NULL;
+    }
+
+    FixedSize = (0 != Header->KeySize);
+    if ( FixedSize ) {
+        if ( (0 != KeySize) && (KeySize != Header->KeySize) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("Error: Unexpected KeySize. Expected (%lu), got (%lu).",
+                         (unsigned long)Header->KeySize, (unsigned long)KeySize);
+#endif
+            return NULL;
+        }
+        KeySize = Header->KeySize;
+    } else if ( 0 == KeySize ) {
+        KeySize = strlen((const char *)Key);
+    }
+
+    Length = Hashmap_frozenKeyLength((const uint8_t *)Key, KeySize, FixedSize);
+    Hashmap_frozenHash((const uint8_t *)Key, Length, Header->Salt, &Primary, &Secondary);
+
+    Seeds = (const uint32_t *)(const void *)(Frozen->Buffer + Header->SeedsOffset);
+    Slot  = (const Hashmap_Frozen_Slot_t *)(const void *)(Frozen->Buffer + Header->SlotsOffset);
+    Slot += Hashmap_frozenSlot(Secondary, Seeds[Primary % Header->BucketCount], Header->ItemCount);
+
+    if ( Slot->Hash != Secondary ) {
+        return NULL;
+    }
+
+    /* The Slot contents are not validated when a buffer is opened, so check them here. */
+    if ( ((size_t)Slot->KeyOffset + HASHMAP_FROZEN_ALIGN((size_t)Slot->KeySize) +
+          (size_t)Slot->ValueSize) > Frozen->Size ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Frozen Hashmap Slot refers outside of the buffer.");
+#endif
+        return NULL;
+    }
+
+    if ( Length != Hashmap_frozenKeyLength(Frozen->Buffer + Slot->KeyOffset, Slot->KeySize,
+                                           FixedSize) ) {
+        return NULL;
+    }
+
+    if ( 0 != memcmp(Frozen->Buffer + Slot->KeyOffset, Key, Length) ) {
+        return NULL;
+    }
+
+    return Frozen->Buffer + Slot->KeyOffset + HASHMAP_FROZEN_ALIGN((size_t)Slot->KeySize);
+}
+
+bool Hashmap_FrozenKeyExists(Hashmap_Frozen_t *Frozen, const void *Key, size_t KeySize) {
+    return (NULL != Hashmap_FrozenRetrieve(Frozen, Key, KeySize));
+}
+
+size_t Hashmap_FrozenLength(Hashmap_Frozen_t *Frozen) {
+
+    if ( NULL == Frozen ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Warning: NULL Frozen* provided, no length to report.");
+#endif
+        return 0;
+    }
+
+    return ((const Hashmap_Frozen_Header_t *)(const void *)Frozen->Buffer)->ItemCount;
+}
+
+int Hashmap_FrozenSave(Hashmap_Frozen_t *Frozen, const char *Path) {
+
+    FILE *File = NULL;
+
+    if ( (NULL == Frozen) || (NULL == Path) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Frozen* or Path* provided.");
+#endif
+        return 1;
+    }
+
+    File = fopen(Path, "wb");
+    if ( NULL == File ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Error: Failed to open file [ %s ] for writing.", Path);
+#endif
+        return 1;
+    }
+
+    if ( Frozen->Size != fwrite(Frozen->Buffer, sizeof(uint8_t), Frozen->Size, File) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Error: Failed to write frozen Hashmap to file [ %s ].", Path);
+#endif
+        fclose(File);
+        return 1;
+    }
+
+    if ( 0 != fclose(File) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Error: Failed to close file [ %s ].", Path);
+#endif
+        return 1;
+    }
+
+    return 0;
+}
+
+Hashmap_Frozen_t *Hashmap_FrozenOpenMapped(const char *Path) {
+
+    Hashmap_Frozen_t *Frozen     = NULL;
+    void *            Mapping    = NULL;
+    struct stat       FileStatus;
+    int               Descriptor = -1;
+
+    if ( NULL == Path ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Path* provided.");
+#endif
+        return NULL;
+    }
+
+    Descriptor = open(Path, O_RDONLY);
+    if ( Descriptor < 0 ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Error: Failed to open file [ %s ].", Path);
+#endif
+        return NULL;
+    }
+
+    if ( (0 != fstat(Descriptor, &FileStatus)) || (FileStatus.st_size <= 0) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Error: Failed to determine size of file [ %s ].", Path);
+#endif
+        close(Descriptor);
+        return NULL;
+    }
+
+    Mapping = mmap(NULL, (size_t)FileStatus.st_size, PROT_READ, MAP_PRIVATE, Descriptor, 0);
+    close(Descriptor);
+    if ( MAP_FAILED == Mapping ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Error: Failed to map file [ %s ].", Path);
+#endif
+        return NULL;
+    }
+
+    if ( 0 != Hashmap_frozenValidate((const uint8_t *)Mapping, (size_t)FileStatus.st_size) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Error: File [ %s ] does not hold a valid frozen Hashmap.", Path);
+#endif
+        munmap(Mapping, (size_t)FileStatus.st_size);
+        return NULL;
+    }
+
+    Frozen = (Hashmap_Frozen_t *)calloc(1, sizeof(Hashmap_Frozen_t));
+    if ( NULL == Frozen ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Hashmap_Frozen_t.");
+#endif
+        munmap(Mapping, (size_t)FileStatus.st_size);
+        return NULL;
+    }
+
+    Frozen->Buffer = (uint8_t *)Mapping;
+    Frozen->Size   = (size_t)FileStatus.st_size;
+    Frozen->Mapped = true;
+
+    return Frozen;
+}
+
+void Hashmap_FrozenRelease(Hashmap_Frozen_t *Frozen) {
+
+    if ( NULL == Frozen ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Warning, NULL Frozen* provided, nothing to release.");
+#endif
+        return;
+    }
+
+    if ( NULL != Frozen->Buffer ) {
+        if ( Frozen->Mapped ) {
+            munmap(Frozen->Buffer, Frozen->Size);
+        } else {
+            free(Frozen->Buffer);
+        }
+    }
+
+    ZERO_CONTAINER(Frozen, Hashmap_Frozen_t);
+    free(Frozen);
+
+    return;
+}
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+uint32_t Hashmap_frozenMix(uint32_t Value) {
+
+    Value ^= Value >> 16;
+    Value = (uint32_t)(Value * 0x85EBCA6BUL);
+    Value ^= Value >> 13;
+    Value = (uint32_t)(Value * 0xC2B2AE35UL);
+    Value ^= Value >> 16;
+
+    return Value;
+}
+
+void Hashmap_frozenHash(const uint8_t *Key, size_t KeySize, uint32_t Salt, uint32_t *Primary,
+                        uint32_t *Secondary) {
+
+    uint32_t First  = (uint32_t)(0x811C9DC5UL ^ Salt);
+    uint32_t Second = Hashmap_frozenMix((uint32_t)(Salt + 0x9E3779B9UL));
+    size_t   Index  = 0;
+
+    for ( Index = 0; Index < KeySize; Index++ ) {
+        First  = (uint32_t)((First ^ (uint32_t)Key[Index]) * 0x01000193UL);
+        Second = (uint32_t)((Second + (uint32_t)Key[Index]) * 0xCC9E2D51UL);
+        Second = (uint32_t)((Second << 15) | (Second >> 17));
+    }
+
+    *Primary   = Hashmap_frozenMix(First ^ (uint32_t)KeySize);
+    *Secondary = Hashmap_frozenMix(Second ^ (uint32_t)KeySize ^ *Primary);
+
+    return;
+}
+
+uint32_t Hashmap_frozenSlot(uint32_t Secondary, uint32_t Seed, uint32_t SlotCount) {
+    return Hashmap_frozenMix((uint32_t)(Secondary + Seed * 0x9E3779B9UL)) % SlotCount;
+}
+
+size_t Hashmap_frozenKeyLength(const uint8_t *Key, size_t KeySize, bool FixedSize) {
+
+    if ( (!FixedSize) && (KeySize > 0) && (0x00 == Key[KeySize - 1]) ) {
+        return KeySize - 1;
+    }
+
+    return KeySize;
+}
+
+int Hashmap_frozenPlace(const uint32_t *Primary, const uint32_t *Secondary, uint32_t Count,
+                        uint32_t BucketCount, uint32_t *Seeds, uint32_t *SlotOf) {
+
+    uint32_t *    BucketStart = NULL, *Members = NULL, *Order = NULL, *SizeStart = NULL;
+    uint8_t *     Occupied    = NULL;
+    uint32_t      i = 0, j = 0, Bucket = 0, Size = 0, MaxSize = 0, Slot = 0;
+    unsigned long Seed = 0, SeedLimit = 0;
+    int           Result = 0;
+
+    BucketStart = (uint32_t *)calloc((size_t)BucketCount + 1, sizeof(uint32_t));
+    Members     = (uint32_t *)calloc((size_t)Count + 1, sizeof(uint32_t));
+    Order       = (uint32_t *)calloc((size_t)BucketCount, sizeof(uint32_t));
+    SizeStart   = (uint32_t *)calloc((size_t)Count + 2, sizeof(uint32_t));
+    Occupied    = (uint8_t *)calloc((size_t)Count + 1, sizeof(uint8_t));
+    if ( (NULL == BucketStart) || (NULL == Members) || (NULL == Order) || (NULL == SizeStart) ||
+         (NULL == Occupied) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory to place frozen Hashmap entries.");
+#endif
+        free(BucketStart);
+        free(Members);
+        free(Order);
+        free(SizeStart);
+        free(Occupied);
+        return 1;
+    }
+
+    /* Group the Keys by bucket, with a counting sort. */
+    for ( i = 0; i < Count; i++ ) {
+        BucketStart[(Primary[i] % BucketCount) + 1] += 1;
+    }
+    for ( Bucket = 0; Bucket < BucketCount; Bucket++ ) {
+        Size = BucketStart[Bucket + 1];
+        if ( Size > MaxSize ) {
+            MaxSize = Size;
+        }
+        BucketStart[Bucket + 1] += BucketStart[Bucket];
+    }
+    for ( i = 0; i < Count; i++ ) {
+        Bucket                       = Primary[i] % BucketCount;
+        Members[BucketStart[Bucket]] = i;
+        BucketStart[Bucket] += 1;
+    }
+    /* Each start was advanced to the end of its bucket, which is the start of the next. */
+    for ( Bucket = BucketCount; Bucket > 0; Bucket-- ) {
+        BucketStart[Bucket] = BucketStart[Bucket - 1];
+    }
+    BucketStart[0] = 0;
+
+    /* Order the buckets by decreasing size, again with a counting sort. */
+    for ( Bucket = 0; Bucket < BucketCount; Bucket++ ) {
+        SizeStart[MaxSize - (BucketStart[Bucket + 1] - BucketStart[Bucket]) + 1] += 1;
+    }
+    for ( Size = 0; Size < MaxSize; Size++ ) {
+        SizeStart[Size + 1] += SizeStart[Size];
+    }
+    for ( Bucket = 0; Bucket < BucketCount; Bucket++ ) {
+        Size                   = MaxSize - (BucketStart[Bucket + 1] - BucketStart[Bucket]);
+        Order[SizeStart[Size]] = Bucket;
+        SizeStart[Size] += 1;
+    }
+
+    /*
+        The last few single-Key buckets must each find one of very few free Slots, taking
+        on the order of Count attempts. Allow comfortably more than that before failing.
+    */
+    SeedLimit = 64UL * (unsigned long)Count + 1024UL;
+
+    for ( i = 0; (i < BucketCount) && (0 == Result); i++ ) {
+        Bucket = Order[i];
+        Size   = BucketStart[Bucket + 1] - BucketStart[Bucket];
+
+        for ( Seed = 0; (Size > 0) && (Seed < SeedLimit); Seed++ ) {
+            for ( j = 0; j < Size; j++ ) {
+                Slot = Hashmap_frozenSlot(Secondary[Members[BucketStart[Bucket] + j]],
+                                          (uint32_t)Seed, Count);
+                if ( 0 != Occupied[Slot] ) {
+                    break;
+                }
+                Occupied[Slot]                           = 1;
+                SlotOf[Members[BucketStart[Bucket] + j]] = Slot;
+            }
+
+            if ( j == Size ) {
+                break;
+            }
+
+            /* Release the Slots claimed by this failed attempt. */
+            while ( j > 0 ) {
+                j -= 1;
+                Occupied[SlotOf[Members[BucketStart[Bucket] + j]]] = 0;
+            }
+        }
+
+        if ( Seed == SeedLimit ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("Note: No displacement found for bucket [ %lu ], retrying with new salt.",
+                         (unsigned long)Bucket);
+#endif
+            Result = 1;
+        }
+        Seeds[Bucket] = (uint32_t)Seed;
+    }
+
+    free(BucketStart);
+    free(Members);
+    free(Order);
+    free(SizeStart);
+    free(Occupied);
+
+    return Result;
+}
+
+int Hashmap_frozenValidate(const uint8_t *Buffer, size_t Size) {
+
+    const Hashmap_Frozen_Header_t *Header = (const Hashmap_Frozen_Header_t *)(const void *)Buffer;
+
+    if ( Size < sizeof(Hashmap_Frozen_Header_t) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Buffer is too small to hold a frozen Hashmap.");
+#endif
+        return 1;
+    }
+
+    if ( (HASHMAP_FROZEN_MAGIC != Header->Magic) || (HASHMAP_FROZEN_VERSION != Header->Version) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Buffer does not begin with a known frozen Hashmap header.");
+#endif
+        return 1;
+    }
+
+    if ( (Header->TotalSize != Size) || (0 == Header->BucketCount) ||
+         (0 != (Header->SeedsOffset % HASHMAP_FROZEN_ALIGNMENT)) ||
+         (0 != (Header->SlotsOffset % HASHMAP_FROZEN_ALIGNMENT)) ||
+         (Header->SeedsOffset < sizeof(Hashmap_Frozen_Header_t)) ||
+         (((size_t)Header->SeedsOffset + (size_t)Header->BucketCount * sizeof(uint32_t)) >
+          Header->SlotsOffset) ||
+         (((size_t)Header->SlotsOffset +
+           (size_t)Header->ItemCount * sizeof(Hashmap_Frozen_Slot_t)) > Header->DataOffset) ||
+         (Header->DataOffset > Size) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Frozen Hashmap header describes an inconsistent layout.");
+#endif
+        return 1;
+    }
+
+    return 0;
+}
+
+/* ---------- Private Functions ---------- */
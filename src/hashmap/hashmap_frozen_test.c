@@ -0,0 +1,339 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../logging/logging.h"
+#include "include/hashmap.h"
+
+#define FROZEN_TEST_FILE "hashmap_frozen_test.bin"
+
+int Test_hashmap_frozen(void) {
+
+    int FailedTests = 0;
+
+    FailedTests += Test_Hashmap_Freeze_IntKey();
+    FailedTests += Test_Hashmap_Freeze_StringKey();
+    FailedTests += Test_Hashmap_Freeze_Empty();
+    FailedTests += Test_Hashmap_Freeze_ReferenceValue();
+    FailedTests += Test_Hashmap_Freeze_Concurrent();
+    FailedTests += Test_Hashmap_FrozenSave_OpenMapped();
+
+    return FailedTests;
+}
+
+int Test_Hashmap_Freeze_IntKey(void) {
+
+    Hashmap_t *       Map    = NULL;
+    Hashmap_Frozen_t *Frozen = NULL;
+    int               Key = 0, Count = 5000;
+    double            Value = 0.0, *Retrieved = NULL;
+
+    Map = Hashmap_Create(HashFunc_Int, 0, NULL);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        Value = Key * 0.5;
+        if ( 0 != Hashmap_Insert(Map, &Key, &Value, 0, sizeof(Value), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    Frozen = Hashmap_Freeze(Map);
+    Hashmap_Release(Map);
+    if ( NULL == Frozen ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to freeze Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    if ( (size_t)Count != Hashmap_FrozenLength(Frozen) ) {
+        TEST_PRINTF("Test Failure - Frozen Length (%lu) not equal to expected value (%d).",
+                    (unsigned long)Hashmap_FrozenLength(Frozen), Count);
+        Hashmap_FrozenRelease(Frozen);
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        Retrieved = (double *)Hashmap_FrozenRetrieve(Frozen, &Key, 0);
+        if ( (NULL == Retrieved) || ((Key * 0.5) != *Retrieved) ) {
+            TEST_PRINTF("Test Failure - Failed to retrieve value for Key [ %d ].", Key);
+            Hashmap_FrozenRelease(Frozen);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( Key = Count; Key < 2 * Count; Key++ ) {
+        if ( Hashmap_FrozenKeyExists(Frozen, &Key, 0) ) {
+            TEST_PRINTF("Test Failure - Absent Key [ %d ] reported as present.", Key);
+            Hashmap_FrozenRelease(Frozen);
+            TEST_FAILURE;
+        }
+    }
+
+    Hashmap_FrozenRelease(Frozen);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_Freeze_StringKey(void) {
+
+    Hashmap_t *       Map          = NULL;
+    Hashmap_Frozen_t *Frozen       = NULL;
+    char              KeyValue[32] = {0x00};
+    int               Value = 0, *Retrieved = NULL, Count = 1000, i = 0;
+
+    Map = Hashmap_Create(NULL, 0, NULL);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    /* Insert half of the Keys with their NUL terminator, and half without. */
+    for ( i = 0; i < Count; i++ ) {
+        snprintf(KeyValue, sizeof(KeyValue), "Frozen Key %d", i);
+        Value = i;
+        if ( 0 != Hashmap_Insert(Map, KeyValue, &Value, strlen(KeyValue) + (size_t)(i % 2),
+                                 sizeof(Value), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    Frozen = Hashmap_Freeze(Map);
+    Hashmap_Release(Map);
+    if ( NULL == Frozen ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to freeze Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        snprintf(KeyValue, sizeof(KeyValue), "Frozen Key %d", i);
+
+        Retrieved = (int *)Hashmap_FrozenRetrieve(Frozen, KeyValue, 0);
+        if ( (NULL == Retrieved) || (i != *Retrieved) ) {
+            TEST_PRINTF("Test Failure - Failed to retrieve value for Key [ %s ].", KeyValue);
+            Hashmap_FrozenRelease(Frozen);
+            TEST_FAILURE;
+        }
+
+        Retrieved = (int *)Hashmap_FrozenRetrieve(Frozen, KeyValue, strlen(KeyValue) + 1);
+        if ( (NULL == Retrieved) || (i != *Retrieved) ) {
+            TEST_PRINTF("Test Failure - Failed to retrieve value for terminated Key [ %s ].",
+                        KeyValue);
+            Hashmap_FrozenRelease(Frozen);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( Hashmap_FrozenKeyExists(Frozen, "Frozen Key", 0) ||
+         Hashmap_FrozenKeyExists(Frozen, "Frozen Key 10000", 0) ) {
+        TEST_PRINTF("%s", "Test Failure - Absent Key reported as present.");
+        Hashmap_FrozenRelease(Frozen);
+        TEST_FAILURE;
+    }
+
+    Hashmap_FrozenRelease(Frozen);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_Freeze_Empty(void) {
+
+    Hashmap_t *       Map    = NULL;
+    Hashmap_Frozen_t *Frozen = NULL;
+    int               Key    = 0;
+
+    Map = Hashmap_Create(HashFunc_Int, 0, NULL);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    Frozen = Hashmap_Freeze(Map);
+    Hashmap_Release(Map);
+    if ( NULL == Frozen ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to freeze empty Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    if ( (0 != Hashmap_FrozenLength(Frozen)) || (Hashmap_FrozenKeyExists(Frozen, &Key, 0)) ) {
+        TEST_PRINTF("%s", "Test Failure - Empty frozen Hashmap reports contents.");
+        Hashmap_FrozenRelease(Frozen);
+        TEST_FAILURE;
+    }
+
+    Hashmap_FrozenRelease(Frozen);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_Freeze_ReferenceValue(void) {
+
+    Hashmap_t *       Map    = NULL;
+    Hashmap_Frozen_t *Frozen = NULL;
+    int               Key    = 1;
+    int *             Value  = NULL;
+
+    Map = Hashmap_Create(HashFunc_Int, 0, NULL);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    Value = (int *)calloc(1, sizeof(int));
+    if ( 0 != Hashmap_Insert(Map, &Key, Value, 0, 0, free) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+        free(Value);
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    Frozen = Hashmap_Freeze(Map);
+    Hashmap_Release(Map);
+    if ( NULL != Frozen ) {
+        TEST_PRINTF("%s", "Test Failure - Hashmap holding a reference-type Value was frozen.");
+        Hashmap_FrozenRelease(Frozen);
+        TEST_FAILURE;
+    }
+
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_Freeze_Concurrent(void) {
+
+    Hashmap_t *       Map    = NULL;
+    Hashmap_Frozen_t *Frozen = NULL;
+    int               Key = 0, Value = 0, *Retrieved = NULL, Count = 2000;
+
+    Map = Hashmap_CreateConcurrent(HashFunc_Int, 0, NULL, 8);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create concurrent Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        Value = Key + 1;
+        if ( 0 != Hashmap_Insert(Map, &Key, &Value, 0, sizeof(Value), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    Frozen = Hashmap_Freeze(Map);
+    Hashmap_Release(Map);
+    if ( NULL == Frozen ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to freeze concurrent Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        Retrieved = (int *)Hashmap_FrozenRetrieve(Frozen, &Key, sizeof(Key));
+        if ( (NULL == Retrieved) || ((Key + 1) != *Retrieved) ) {
+            TEST_PRINTF("Test Failure - Failed to retrieve value for Key [ %d ].", Key);
+            Hashmap_FrozenRelease(Frozen);
+            TEST_FAILURE;
+        }
+    }
+
+    Hashmap_FrozenRelease(Frozen);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_FrozenSave_OpenMapped(void) {
+
+    Hashmap_t *       Map    = NULL;
+    Hashmap_Frozen_t *Frozen = NULL, *Mapped = NULL;
+    char              KeyValue[32] = {0x00};
+    int               Value = 0, *Retrieved = NULL, Count = 750, i = 0;
+
+    Map = Hashmap_Create(NULL, 0, NULL);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        snprintf(KeyValue, sizeof(KeyValue), "Mapped %d", i);
+        Value = -i;
+        if ( 0 != Hashmap_Insert(Map, KeyValue, &Value, strlen(KeyValue) + 1, sizeof(Value),
+                                 NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    Frozen = Hashmap_Freeze(Map);
+    Hashmap_Release(Map);
+    if ( NULL == Frozen ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to freeze Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    if ( 0 != Hashmap_FrozenSave(Frozen, FROZEN_TEST_FILE) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to save frozen Hashmap.");
+        Hashmap_FrozenRelease(Frozen);
+        TEST_FAILURE;
+    }
+    Hashmap_FrozenRelease(Frozen);
+
+    Mapped = Hashmap_FrozenOpenMapped(FROZEN_TEST_FILE);
+    remove(FROZEN_TEST_FILE);
+    if ( NULL == Mapped ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to open mapped frozen Hashmap.");
+        TEST_FAILURE;
+    }
+
+    if ( (size_t)Count != Hashmap_FrozenLength(Mapped) ) {
+        TEST_PRINTF("Test Failure - Mapped Length (%lu) not equal to expected value (%d).",
+                    (unsigned long)Hashmap_FrozenLength(Mapped), Count);
+        Hashmap_FrozenRelease(Mapped);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        snprintf(KeyValue, sizeof(KeyValue), "Mapped %d", i);
+        Retrieved = (int *)Hashmap_FrozenRetrieve(Mapped, KeyValue, 0);
+        if ( (NULL == Retrieved) || (-i != *Retrieved) ) {
+            TEST_PRINTF("Test Failure - Failed to retrieve mapped value for Key [ %s ].", KeyValue);
+            Hashmap_FrozenRelease(Mapped);
+            TEST_FAILURE;
+        }
+    }
+
+    Hashmap_FrozenRelease(Mapped);
+
+    if ( NULL != Hashmap_FrozenOpenMapped(FROZEN_TEST_FILE) ) {
+        TEST_PRINTF("%s", "Test Failure - Opened a frozen Hashmap from a missing file.");
+        TEST_FAILURE;
+    }
+
+    TEST_SUCCESSFUL;
+}
@@ -25,10 +25,13 @@
 #include <stdbool.h>
 #include <stdlib.h>
 
+#define LIBCONTAINER_ENABLE_TOP_K
+
 #include "../logging/logging.h"
 #include "include/hashmap.h"
 
 #include "../array/include/array.h"
+#include "../heap/top-k/include/top_k.h"
 #include "../list/include/list.h"
 
 int Iterator_Initialize_Hashmap(Hashmap_t *Map, CompareFunc_t *CompareFunc) {
@@ -273,11 +276,9 @@ Hashmap_KeyValuePair_t Hashmap_SortedPrevious(Hashmap_t *Map, CompareFunc_t *Com
 
 Array_t *Hashmap_Keys(Hashmap_t *Map) {
 
-    Array_t *        Keys         = NULL;
-    List_t *         Bucket       = NULL;
-    List_Node_t *    BucketItem   = NULL;
-    size_t           BucketIndex  = 0;
-    Hashmap_Entry_t *CurrentEntry = NULL;
+    Array_t *        Keys     = NULL;
+    Hashmap_Entry_t *Entry    = NULL;
+    size_t           KeyIndex = 0;
 
     if ( NULL == Map ) {
 #ifdef DEBUG
@@ -297,26 +298,18 @@ Array_t *Hashmap_Keys(Hashmap_t *Map) {
      * the Hashmap. */
     Keys->ReleaseFunc = NULL;
 
-    for ( BucketIndex = 0; BucketIndex < Array_Length(Map->Buckets); BucketIndex++ ) {
-        Bucket = (List_t *)Array_GetElement(Map->Buckets, BucketIndex);
-        if ( NULL == Bucket ) {
+    if ( 0 != Hashmap_appendEntries(Map, Keys) ) {
 #ifdef DEBUG
-            DEBUG_PRINTF("%s", "Error: Failed to get Bucket of items to build Keys Array.");
+        DEBUG_PRINTF("%s", "Error: Failed to collect the entries of the Hashmap.");
 #endif
-            Array_Release(Keys);
-            return NULL;
-        }
+        Array_Release(Keys);
+        return NULL;
+    }
 
-        for ( BucketItem = Bucket->Head; NULL != BucketItem; BucketItem = BucketItem->Next ) {
-            CurrentEntry = (Hashmap_Entry_t *)BucketItem->Contents.ContentRaw;
-            if ( 0 != Array_Append(Keys, &(CurrentEntry->Key)) ) {
-#ifdef DEBUG
-                DEBUG_PRINTF("%s", "Error: Failed to add Key value to Keys array to be returned.");
-#endif
-                Array_Release(Keys);
-                return NULL;
-            }
-        }
+    /* Swap each of the collected entries for its Key, in place. */
+    for ( KeyIndex = 0; KeyIndex < Array_Length(Keys); KeyIndex++ ) {
+        Entry = (Hashmap_Entry_t *)Keys->Contents.ContentRefs[KeyIndex];
+        Keys->Contents.ContentRefs[KeyIndex] = Entry->Key;
     }
 
     return Keys;
@@ -333,3 +326,135 @@ Array_t *Hashmap_KeysSorted(Hashmap_t *Map, CompareFunc_t *CompareFunc) {
 
     return Keys;
 }
+
+Array_t *Hashmap_TopKByValue(Hashmap_t *Map, size_t K, CompareFunc_t *CompareFunc) {
+
+    Hashmap_TopK_Scan_t        Scan    = {NULL, false};
+    Array_t *                  Results = NULL;
+    Binary_Heap_KeyValuePair_t Item    = {NULL, NULL};
+    Hashmap_KeyValuePair_t     Pair    = {NULL, NULL};
+    size_t                     Cursor = 0, Index = 0;
+
+    if ( NULL == Map ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Map* provided.");
+#endif
+        return NULL;
+    }
+
+    Scan.TopK = TopK_Create(K, CompareFunc, 0);
+    Results   = Array_Create(K, sizeof(Hashmap_KeyValuePair_t));
+    if ( (NULL == Scan.TopK) || (NULL == Results) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to prepare TopK_t or result Array_t.");
+#endif
+        TopK_Release(Scan.TopK);
+        Array_Release(Results);
+        return NULL;
+    }
+
+    /* Scan the Map in place, rather than collecting every Key as Hashmap_Keys() does. */
+    do {
+        Cursor = Hashmap_ScanArg(Map, Cursor, LIBCONTAINER_ARRAY_DEFAULT_CAPACITY,
+                                 Hashmap_topKVisit, &Scan);
+    } while ( (0 != Cursor) && (!Scan.Failed) );
+
+    if ( Scan.Failed ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to offer item to TopK_t.");
+#endif
+        TopK_Release(Scan.TopK);
+        Array_Release(Results);
+        return NULL;
+    }
+
+    /* The TopK_t gives back the last item first, so the Results are filled from the back. */
+    Index = TopK_Length(Scan.TopK);
+    while ( Array_Length(Results) < Index ) {
+        if ( 0 != Array_Append(Results, &Pair) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to append item to result Array_t.");
+#endif
+            TopK_Release(Scan.TopK);
+            Array_Release(Results);
+            return NULL;
+        }
+    }
+
+    for ( Item = TopK_Pop(Scan.TopK); NULL != Item.Key; Item = TopK_Pop(Scan.TopK) ) {
+        Pair.Key   = Item.Value;
+        Pair.Value = Item.Key;
+        Array_Replace(Results, &Pair, --Index);
+    }
+
+    TopK_Release(Scan.TopK);
+    return Results;
+}
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+int Hashmap_topKVisit(void *Item, void *Args) {
+
+    Hashmap_KeyValuePair_t *Pair = (Hashmap_KeyValuePair_t *)Item;
+    Hashmap_TopK_Scan_t *   Scan = (Hashmap_TopK_Scan_t *)Args;
+
+    if ( (Scan->Failed) || (0 != TopK_Push(Scan->TopK, Pair->Value, Pair->Key)) ) {
+        Scan->Failed = true;
+        return 1;
+    }
+
+    return 0;
+}
+
+int Hashmap_appendEntries(Hashmap_t *Map, Array_t *Entries) {
+
+    List_t *     Bucket      = NULL;
+    List_Node_t *BucketItem  = NULL;
+    size_t       BucketIndex = 0, Index = 0;
+
+    if ( (NULL == Map) || (NULL == Entries) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Map* or Entries* provided.");
+#endif
+        return 1;
+    }
+
+    if ( NULL != Map->Shards ) {
+        return Hashmap_concurrentEntries(Map, Entries);
+    }
+
+    if ( NULL == Map->Buckets ) {
+        for ( Index = 0; Index < Map->ItemCount; Index++ ) {
+            if ( 0 != Array_Append(Entries, &(Map->Small[Index])) ) {
+#ifdef DEBUG
+                DEBUG_PRINTF("%s", "Error: Failed to add Hashmap_Entry_t to the Entries array.");
+#endif
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    for ( BucketIndex = 0; BucketIndex < Array_Length(Map->Buckets); BucketIndex++ ) {
+        Bucket = (List_t *)Array_GetElement(Map->Buckets, BucketIndex);
+        if ( NULL == Bucket ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to get Bucket of items to collect entries from.");
+#endif
+            return 1;
+        }
+
+        for ( BucketItem = Bucket->Head; NULL != BucketItem; BucketItem = BucketItem->Next ) {
+            if ( 0 != Array_Append(Entries, &(BucketItem->Contents.ContentRaw)) ) {
+#ifdef DEBUG
+                DEBUG_PRINTF("%s", "Error: Failed to add Hashmap_Entry_t to the Entries array.");
+#endif
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/* ---------- Private Functions ---------- */
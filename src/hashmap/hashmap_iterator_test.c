@@ -34,6 +34,7 @@ int Test_hashmap_iterator(void) {
 
     FailedTests += Test_Hashmap_Keys_DoubleKey();
     FailedTests += Test_Hashmap_Keys_StringKey();
+    FailedTests += Test_Hashmap_TopKByValue();
 
     return FailedTests;
 }
@@ -167,3 +168,65 @@ int Test_Hashmap_Keys_StringKey(void) {
     Array_Release(Keys);
     TEST_SUCCESSFUL;
 }
+
+int Test_Hashmap_TopKByValue(void) {
+
+    Hashmap_t *             Maps[2] = {NULL, NULL};
+    Array_t *               Top     = NULL;
+    Hashmap_KeyValuePair_t *Pair    = NULL;
+    int                     Key = 0, Value = 0, i = 0, m = 0;
+    size_t                  Index = 0;
+
+    /* Both a plain and a concurrent Hashmap, as the latter is scanned shard by shard. */
+    Maps[0] = Hashmap_Create(HashFunc_Int, sizeof(int), NULL);
+    Maps[1] = Hashmap_CreateConcurrent(HashFunc_Int, sizeof(int), NULL, 4);
+
+    for ( m = 0; m < 2; m++ ) {
+        if ( NULL == Maps[m] ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to create Hashmap_t.");
+            Hashmap_Release(Maps[0]);
+            Hashmap_Release(Maps[1]);
+            TEST_FAILURE;
+        }
+
+        for ( Key = 0; Key < 1000; Key++ ) {
+            Value = (Key * 7919) % 1000;
+            if ( 0 != Hashmap_Insert(Maps[m], &Key, &Value, 0, sizeof(Value), NULL) ) {
+                TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+                Hashmap_Release(Maps[0]);
+                Hashmap_Release(Maps[1]);
+                TEST_FAILURE;
+            }
+        }
+
+        /* The largest Values come first, each paired with the Key it was inserted under. */
+        Top = Hashmap_TopKByValue(Maps[m], 8, CompareFunc_Int_Descending);
+        if ( (NULL == Top) || (8 != Array_Length(Top)) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to select top 8 Values of Hashmap.");
+            Array_Release(Top);
+            Hashmap_Release(Maps[0]);
+            Hashmap_Release(Maps[1]);
+            TEST_FAILURE;
+        }
+
+        for ( Index = 0; Index < 8; Index++ ) {
+            Pair = (Hashmap_KeyValuePair_t *)Array_GetElement(Top, Index);
+            i    = *(int *)Pair->Key;
+            if ( (999 - (int)Index != *(int *)Pair->Value) ||
+                 ((i * 7919) % 1000 != 999 - (int)Index) ||
+                 (Hashmap_Retrieve(Maps[m], &i, 0) != Pair->Value) ) {
+                TEST_PRINTF("Test Failure - Item (%lu) of top Values is wrong.",
+                            (unsigned long)Index);
+                Array_Release(Top);
+                Hashmap_Release(Maps[0]);
+                Hashmap_Release(Maps[1]);
+                TEST_FAILURE;
+            }
+        }
+        Array_Release(Top);
+    }
+
+    Hashmap_Release(Maps[0]);
+    Hashmap_Release(Maps[1]);
+    TEST_SUCCESSFUL;
+}
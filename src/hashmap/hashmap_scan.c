@@ -0,0 +1,177 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <limits.h>
+#include <stdlib.h>
+
+#include "../logging/logging.h"
+#include "include/hashmap.h"
+
+#include "../array/include/array.h"
+#include "../list/include/list.h"
+
+size_t Hashmap_Scan(Hashmap_t *Map, size_t Cursor, size_t Count, CallbackFunc_t *Callback) {
+
+    if ( NULL == Callback ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Callback* provided, nothing to call.");
+#endif
+        return 0;
+    }
+
+    return Hashmap_scan(Map, Cursor, Count, Callback, NULL, NULL);
+}
+
+size_t Hashmap_ScanArg(Hashmap_t *Map, size_t Cursor, size_t Count, CallbackArgFunc_t *Callback,
+                       void *Args) {
+
+    if ( NULL == Callback ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Callback* provided, nothing to call.");
+#endif
+        return 0;
+    }
+
+    return Hashmap_scan(Map, Cursor, Count, NULL, Callback, Args);
+}
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+size_t Hashmap_scan(Hashmap_t *Map, size_t Cursor, size_t Count, CallbackFunc_t *Callback,
+                    CallbackArgFunc_t *CallbackArg, void *Args) {
+
+    size_t Reported = 0, Empty = 0;
+
+    if ( NULL == Map ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Map* provided.");
+#endif
+        return 0;
+    }
+
+    if ( 0 == Count ) {
+        Count = 1;
+    }
+
+    if ( NULL != Map->Shards ) {
+        return Hashmap_concurrentScan(Map, Cursor, Count, Callback, CallbackArg, Args);
+    }
+
+    return Hashmap_scanBuckets(Map, Cursor, Count, &Reported, &Empty, Callback, CallbackArg, Args);
+}
+
+size_t Hashmap_scanBuckets(Hashmap_t *Map, size_t Cursor, size_t Count, size_t *Reported,
+                           size_t *Empty, CallbackFunc_t *Callback, CallbackArgFunc_t *CallbackArg,
+                           void *Args) {
+
+    List_t *     Bucket = NULL;
+    List_Node_t *Node   = NULL;
+    size_t       Mask = 0, Index = 0;
+
+    /*
+        A Hashmap holding its items in the Small array is visited in a single step. If the
+        Hashmap shrank into the Small array part-way through a scan, this may revisit items,
+        but never misses any.
+    */
+    if ( NULL == Map->Buckets ) {
+        for ( Index = 0; Index < Map->ItemCount; Index++ ) {
+            Hashmap_scanEntry(Map->Small[Index], Callback, CallbackArg, Args);
+            *Reported += 1;
+        }
+        return 0;
+    }
+
+    /*
+        The bucket count is always a power of two, and an Entry lives in the bucket
+        selected by the low bits of its hash. Incrementing the cursor from its most
+        significant bit downwards visits the buckets such that every bucket which
+        shares its low bits with an already visited bucket of a smaller table is
+        itself already visited. This makes the scan complete for every item present
+        for the whole duration, even if the table is doubled or halved between calls.
+    */
+    Mask = Array_Length(Map->Buckets) - 1;
+
+    do {
+        Bucket = (List_t *)Array_GetElement(Map->Buckets, Cursor & Mask);
+
+        if ( NULL == Bucket->Head ) {
+            *Empty += 1;
+        }
+
+        for ( Node = Bucket->Head; NULL != Node; Node = Node->Next ) {
+            Hashmap_scanEntry((Hashmap_Entry_t *)Node->Contents.ContentRaw, Callback, CallbackArg,
+                              Args);
+            *Reported += 1;
+        }
+
+        Cursor |= ~Mask;
+        Cursor = Hashmap_scanReverse(Cursor);
+        Cursor += 1;
+        Cursor = Hashmap_scanReverse(Cursor);
+    } while ( (0 != Cursor) && (!Hashmap_scanExhausted(Count, *Reported, *Empty)) );
+
+    return Cursor;
+}
+
+void Hashmap_scanEntry(Hashmap_Entry_t *Entry, CallbackFunc_t *Callback,
+                       CallbackArgFunc_t *CallbackArg, void *Args) {
+
+    Hashmap_KeyValuePair_t KeyValue;
+    int                    Result = 0;
+
+    KeyValue.Key   = Entry->Key;
+    KeyValue.Value = Entry->Value.ValueRaw;
+
+    if ( NULL != Callback ) {
+        Result = Callback(&KeyValue);
+    } else {
+        Result = CallbackArg(&KeyValue, Args);
+    }
+
+    if ( 0 != Result ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Warning: Callback function returned non-zero.");
+#endif
+    }
+
+    return;
+}
+
+bool Hashmap_scanExhausted(size_t Count, size_t Reported, size_t Empty) {
+    return ((Reported >= Count) || ((Empty / HASHMAP_SCAN_EMPTY_VISITS) >= Count));
+}
+
+size_t Hashmap_scanReverse(size_t Value) {
+
+    size_t Reversed = 0, Bit = 0;
+
+    for ( Bit = 0; Bit < (sizeof(size_t) * CHAR_BIT); Bit++ ) {
+        Reversed = (Reversed << 1) | (Value & 1);
+        Value >>= 1;
+    }
+
+    return Reversed;
+}
+
+/* ---------- Private Functions ---------- */
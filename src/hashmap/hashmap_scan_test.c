@@ -0,0 +1,242 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+
+#include "../logging/logging.h"
+#include "include/hashmap.h"
+
+#define SCAN_TEST_ITEMS 2000
+
+static int ScanCount = 0;
+
+static int TestCallbackFunc_CountItem(void *Value) {
+
+    (void)Value;
+    ScanCount += 1;
+
+    return 0;
+}
+
+static int TestCallbackArgFunc_MarkItem(void *Value, void *Args) {
+
+    Hashmap_KeyValuePair_t *KeyValue = (Hashmap_KeyValuePair_t *)Value;
+    int *                   Seen     = (int *)Args;
+
+    Seen[*(int *)(KeyValue->Key)] += 1;
+
+    return 0;
+}
+
+int Test_hashmap_scan(void) {
+
+    int FailedTests = 0;
+
+    FailedTests += Test_Hashmap_Scan_Complete();
+    FailedTests += Test_Hashmap_Scan_Rehash();
+    FailedTests += Test_Hashmap_Scan_Empty();
+    FailedTests += Test_Hashmap_Scan_Concurrent();
+
+    return FailedTests;
+}
+
+int Test_Hashmap_Scan_Complete(void) {
+
+    Hashmap_t *Map    = NULL;
+    size_t     Cursor = 0;
+    int        Key = 0, Calls = 0;
+    int        Seen[SCAN_TEST_ITEMS] = {0};
+
+    Map = Hashmap_Create(HashFunc_Int, 0, NULL);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < SCAN_TEST_ITEMS; Key++ ) {
+        if ( 0 != Hashmap_Insert(Map, &Key, &Key, 0, sizeof(Key), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    do {
+        Cursor = Hashmap_ScanArg(Map, Cursor, 16, TestCallbackArgFunc_MarkItem, Seen);
+        Calls += 1;
+    } while ( 0 != Cursor );
+
+    for ( Key = 0; Key < SCAN_TEST_ITEMS; Key++ ) {
+        if ( 1 != Seen[Key] ) {
+            TEST_PRINTF("Test Failure - Key [ %d ] visited (%d) times, expected exactly once.", Key,
+                        Seen[Key]);
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( Calls < 2 ) {
+        TEST_PRINTF("%s", "Test Failure - Scan did not split the walk into multiple steps.");
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    ScanCount = 0;
+    Cursor    = 0;
+    do {
+        Cursor = Hashmap_Scan(Map, Cursor, 100, TestCallbackFunc_CountItem);
+    } while ( 0 != Cursor );
+
+    if ( SCAN_TEST_ITEMS != ScanCount ) {
+        TEST_PRINTF("Test Failure - Scan visited (%d) items, expected (%d).", ScanCount,
+                    SCAN_TEST_ITEMS);
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    Hashmap_Release(Map);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_Scan_Rehash(void) {
+
+    Hashmap_t *Map    = NULL;
+    size_t     Cursor = 0;
+    int        Key = 0, Initial = 100, Step = 0;
+    int        Seen[SCAN_TEST_ITEMS] = {0};
+
+    Map = Hashmap_Create(HashFunc_Int, 0, NULL);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Initial; Key++ ) {
+        if ( 0 != Hashmap_Insert(Map, &Key, &Key, 0, sizeof(Key), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    /* Grow the Hashmap several times over while the scan is in progress. */
+    do {
+        Cursor = Hashmap_ScanArg(Map, Cursor, 4, TestCallbackArgFunc_MarkItem, Seen);
+        for ( Step = 0; (Step < 100) && (Key < SCAN_TEST_ITEMS); Step++, Key++ ) {
+            if ( 0 != Hashmap_Insert(Map, &Key, &Key, 0, sizeof(Key), NULL) ) {
+                TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+                Hashmap_Release(Map);
+                TEST_FAILURE;
+            }
+        }
+    } while ( 0 != Cursor );
+
+    for ( Key = 0; Key < Initial; Key++ ) {
+        if ( 0 == Seen[Key] ) {
+            TEST_PRINTF("Test Failure - Key [ %d ] present for the whole scan was not visited.",
+                        Key);
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    Hashmap_Release(Map);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_Scan_Empty(void) {
+
+    Hashmap_t *Map    = NULL;
+    size_t     Cursor = 0;
+
+    Map = Hashmap_Create(HashFunc_Int, 0, NULL);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    ScanCount = 0;
+    do {
+        Cursor = Hashmap_Scan(Map, Cursor, 1, TestCallbackFunc_CountItem);
+    } while ( 0 != Cursor );
+
+    if ( 0 != ScanCount ) {
+        TEST_PRINTF("Test Failure - Scan of empty Hashmap visited (%d) items.", ScanCount);
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    if ( 0 != Hashmap_Scan(NULL, 0, 1, TestCallbackFunc_CountItem) ) {
+        TEST_PRINTF("%s", "Test Failure - Scan of NULL Hashmap did not complete immediately.");
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    Hashmap_Release(Map);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_Scan_Concurrent(void) {
+
+    Hashmap_t *Map    = NULL;
+    size_t     Cursor = 0;
+    int        Key = 0, Removed = 0;
+    int        Seen[SCAN_TEST_ITEMS] = {0};
+
+    Map = Hashmap_CreateConcurrent(HashFunc_Int, 0, NULL, 8);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create concurrent Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < SCAN_TEST_ITEMS; Key++ ) {
+        if ( 0 != Hashmap_Insert(Map, &Key, &Key, 0, sizeof(Key), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    /* Remove the odd Keys in between the steps of the scan. */
+    do {
+        Cursor = Hashmap_ScanArg(Map, Cursor, 32, TestCallbackArgFunc_MarkItem, Seen);
+        if ( Removed < SCAN_TEST_ITEMS ) {
+            Key = Removed + 1;
+            Hashmap_Remove(Map, &Key, 0);
+            Removed += 2;
+        }
+    } while ( 0 != Cursor );
+
+    for ( Key = 0; Key < SCAN_TEST_ITEMS; Key += 2 ) {
+        if ( 1 != Seen[Key] ) {
+            TEST_PRINTF("Test Failure - Key [ %d ] visited (%d) times, expected exactly once.", Key,
+                        Seen[Key]);
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    Hashmap_Release(Map);
+    TEST_SUCCESSFUL;
+}
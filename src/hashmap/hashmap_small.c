@@ -0,0 +1,172 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "include/hashmap.h"
+
+#include "../array/include/array.h"
+#include "../list/include/list.h"
+#include "../logging/logging.h"
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+size_t Hashmap_smallFind(Hashmap_t *Map, const void *Key, size_t KeySize, unsigned int *HashValue) {
+
+    Hashmap_Entry_t *Entry = NULL;
+    size_t           Index = 0;
+
+    if ( 0 == *HashValue ) {
+        *HashValue = Map->HashFunc(Key, KeySize);
+    }
+
+    /* Matching follows exactly the same rules as Hashmap_findInBucket(). */
+    for ( Index = 0; Index < Map->ItemCount; Index++ ) {
+        Entry = Map->Small[Index];
+        if ( Entry->HashValue == *HashValue ) {
+            if ( 0 == memcmp(Key, Entry->Key, KeySize) ) {
+                return Index;
+            }
+        }
+    }
+
+    return Map->ItemCount;
+}
+
+void Hashmap_smallInsert(Hashmap_t *Map, Hashmap_Entry_t *Entry) {
+
+    if ( 0 == Entry->HashValue ) {
+        Entry->HashValue = Map->HashFunc((const void *)Entry->Key, Entry->KeySize);
+    }
+
+    Map->Small[Map->ItemCount] = Entry;
+    Map->ItemCount += 1;
+
+    return;
+}
+
+Hashmap_Entry_t *Hashmap_smallTake(Hashmap_t *Map, size_t Index) {
+
+    Hashmap_Entry_t *Entry = Map->Small[Index];
+
+    Map->ItemCount -= 1;
+    Map->Small[Index]          = Map->Small[Map->ItemCount];
+    Map->Small[Map->ItemCount] = NULL;
+
+    return Entry;
+}
+
+void Hashmap_smallClear(Hashmap_t *Map) {
+
+    size_t Index = 0;
+
+    for ( Index = 0; Index < Map->ItemCount; Index++ ) {
+        Hashmap_Entry_Release(Map->Small[Index]);
+        Map->Small[Index] = NULL;
+    }
+
+    Map->ItemCount = 0;
+
+    return;
+}
+
+int Hashmap_promote(Hashmap_t *Map) {
+
+    Array_t *Buckets     = NULL;
+    List_t * Bucket      = NULL;
+    size_t   BucketIndex = 0, BucketCount = 0, Index = 0, ItemCount = 0;
+
+    BucketCount = Hashmap_minimumBuckets();
+
+    Buckets = Array_RefCreate(BucketCount, (ReleaseFunc_t *)List_Release);
+    if ( NULL == Buckets ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to create Array_t of Buckets.");
+#endif
+        return 1;
+    }
+
+    for ( BucketIndex = 0; BucketIndex < BucketCount; BucketIndex++ ) {
+        Bucket = List_Create();
+        if ( (NULL == Bucket) || (0 != Array_Append(Buckets, &Bucket)) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("Error: Failed to initialize Map bucket [ %lu ].",
+                         (unsigned long)BucketIndex);
+#endif
+            List_Release(Bucket);
+            Array_Release(Buckets);
+            return 1;
+        }
+    }
+
+    ItemCount      = Map->ItemCount;
+    Map->Buckets   = Buckets;
+    Map->ItemCount = 0;
+
+    for ( Index = 0; Index < ItemCount; Index++ ) {
+        if ( 0 != Hashmap_insertEntry(Map, Map->Small[Index], false) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to move item into Buckets of Hashmap_t, dropping item.");
+#endif
+        }
+        Map->Small[Index] = NULL;
+    }
+
+#ifdef DEBUG
+    DEBUG_PRINTF("Successfully promoted Hashmap_t to (%lu) Buckets.", (unsigned long)BucketCount);
+#endif
+    return 0;
+}
+
+void Hashmap_demote(Hashmap_t *Map) {
+
+    List_t *         Bucket      = NULL;
+    Hashmap_Entry_t *Entry       = NULL;
+    size_t           BucketIndex = 0;
+
+    if ( Map->ItemCount > LIBCONTAINER_HASHMAP_SMALL_CAPACITY ) {
+        return;
+    }
+
+    Map->ItemCount = 0;
+
+    for ( BucketIndex = 0; BucketIndex < Array_Length(Map->Buckets); BucketIndex++ ) {
+        Bucket = (List_t *)Array_GetElement(Map->Buckets, BucketIndex);
+        while ( 0 != List_Length(Bucket) ) {
+            Entry = (Hashmap_Entry_t *)List_PopFront(Bucket);
+            Hashmap_smallInsert(Map, Entry);
+        }
+    }
+
+    Array_Release(Map->Buckets);
+    Map->Buckets = NULL;
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully demoted Hashmap_t to a flat array of items.");
+#endif
+    return;
+}
+
+/* ---------- Private Functions ---------- */
@@ -0,0 +1,219 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../logging/logging.h"
+#include "include/hashmap.h"
+
+int Test_hashmap_small(void) {
+
+    int FailedTests = 0;
+
+    FailedTests += Test_Hashmap_Small_Create();
+    FailedTests += Test_Hashmap_Small_Operations();
+    FailedTests += Test_Hashmap_Small_Promote();
+    FailedTests += Test_Hashmap_Small_Demote();
+
+    return FailedTests;
+}
+
+int Test_Hashmap_Small_Create(void) {
+
+    Hashmap_t *Map = NULL;
+
+    Map = Hashmap_Create(HashFunc_Int, 0, NULL);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    if ( NULL != Map->Buckets ) {
+        TEST_PRINTF("%s", "Test Failure - New Hashmap allocated Buckets before holding any items.");
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    Hashmap_Release(Map);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_Small_Operations(void) {
+
+    Hashmap_t *Map      = NULL;
+    char       Keys[][16] = {"Host", "Accept", "Content-Type", "Content-Length"};
+    int        Value = 0, Count = 4, i = 0;
+    int *      Popped = NULL;
+
+    Map = Hashmap_Create(NULL, 0, NULL);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        Value = i;
+        if ( 0 != Hashmap_Insert(Map, Keys[i], &Value, strlen(Keys[i]), sizeof(Value),
+                                 NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    /* Overwriting an existing Key must not add a second item. */
+    Value = 100;
+    if ( (0 != Hashmap_Insert(Map, Keys[0], &Value, strlen(Keys[0]), sizeof(Value), NULL)) ||
+         ((size_t)Count != Hashmap_Length(Map)) ||
+         (100 != *(int *)Hashmap_Retrieve(Map, Keys[0], strlen(Keys[0]))) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to overwrite item of small Hashmap.");
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    if ( (0 != Hashmap_Remove(Map, Keys[1], strlen(Keys[1]))) ||
+         (Hashmap_KeyExists(Map, Keys[1], strlen(Keys[1]))) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to remove item from small Hashmap.");
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    Popped = (int *)Hashmap_Pop(Map, Keys[2], strlen(Keys[2]));
+    if ( (NULL == Popped) || (2 != *Popped) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to pop item from small Hashmap.");
+        free(Popped);
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+    free(Popped);
+
+    if ( (2 != Hashmap_Length(Map)) ||
+         (3 != *(int *)Hashmap_Retrieve(Map, Keys[3], strlen(Keys[3]))) ) {
+        TEST_PRINTF("%s", "Test Failure - Small Hashmap contents incorrect after removals.");
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    Hashmap_Release(Map);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_Small_Promote(void) {
+
+    Hashmap_t *Map = NULL;
+    int        Key = 0;
+
+    Map = Hashmap_Create(HashFunc_Int, 0, NULL);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < LIBCONTAINER_HASHMAP_SMALL_CAPACITY; Key++ ) {
+        if ( 0 != Hashmap_Insert(Map, &Key, &Key, 0, sizeof(Key), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( NULL != Map->Buckets ) {
+        TEST_PRINTF("%s", "Test Failure - Hashmap allocated Buckets before exceeding small capacity.");
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    if ( 0 != Hashmap_Insert(Map, &Key, &Key, 0, sizeof(Key), NULL) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    if ( NULL == Map->Buckets ) {
+        TEST_PRINTF("%s", "Test Failure - Hashmap did not allocate Buckets past small capacity.");
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key <= LIBCONTAINER_HASHMAP_SMALL_CAPACITY; Key++ ) {
+        if ( (NULL == Hashmap_Retrieve(Map, &Key, 0)) ||
+             (Key != *(int *)Hashmap_Retrieve(Map, &Key, 0)) ) {
+            TEST_PRINTF("Test Failure - Key [ %d ] lost while allocating Buckets.", Key);
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    Hashmap_Release(Map);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_Small_Demote(void) {
+
+    Hashmap_t *Map = NULL;
+    int        Key = 0, Count = 1000, Remaining = LIBCONTAINER_HASHMAP_SMALL_CAPACITY / 2;
+
+    Map = Hashmap_Create(HashFunc_Int, 0, NULL);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        if ( 0 != Hashmap_Insert(Map, &Key, &Key, 0, sizeof(Key), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( Key = Remaining; Key < Count; Key++ ) {
+        Hashmap_Remove(Map, &Key, 0);
+    }
+
+    if ( NULL != Map->Buckets ) {
+        TEST_PRINTF("%s", "Test Failure - Hashmap kept its Buckets after shrinking to small size.");
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Remaining; Key++ ) {
+        if ( (NULL == Hashmap_Retrieve(Map, &Key, 0)) ||
+             (Key != *(int *)Hashmap_Retrieve(Map, &Key, 0)) ) {
+            TEST_PRINTF("Test Failure - Key [ %d ] lost while releasing Buckets.", Key);
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( (0 != Hashmap_Clear(Map)) || (0 != Hashmap_Length(Map)) || (NULL != Map->Buckets) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to clear small Hashmap.");
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    Hashmap_Release(Map);
+    TEST_SUCCESSFUL;
+}
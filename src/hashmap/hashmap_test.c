@@ -29,6 +29,8 @@
 #include "../logging/logging.h"
 #include "include/hashmap.h"
 
+#include "../array/include/array.h"
+
 /*
     Temporary function for visualizing the distribution properties of the hash function used.
 
@@ -59,10 +61,21 @@ int Test_hashmap(void) {
     FailedTests += Test_Hashmap_DoubleKey();
     FailedTests += Test_Hashmap_StringKey();
 
+    FailedTests += Test_Hashmap_Shrink();
+    FailedTests += Test_Hashmap_Compact();
+
     FailedTests += Test_hashmap_callbacks();
 
     FailedTests += Test_hashmap_iterator();
 
+    FailedTests += Test_hashmap_concurrent();
+
+    FailedTests += Test_hashmap_frozen();
+
+    FailedTests += Test_hashmap_scan();
+
+    FailedTests += Test_hashmap_small();
+
     return FailedTests;
 }
 
@@ -716,3 +729,121 @@ int Test_Hashmap_Clear_StringKey(void) {
     Hashmap_Release(Map);
     TEST_SUCCESSFUL;
 }
+
+int Test_Hashmap_Shrink(void) {
+
+    Hashmap_t *Map = NULL;
+    int        Key = 0, Count = 100000, Remaining = 10;
+    size_t     PeakBuckets = 0;
+
+    Map = Hashmap_Create(HashFunc_Int, 0, NULL);
+    if ( NULL == Map ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Hashmap_t.");
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        if ( 0 != Hashmap_Insert(Map, &Key, &Key, 0, sizeof(Key), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    PeakBuckets = Array_Length(Map->Buckets);
+
+    for ( Key = Remaining; Key < Count; Key++ ) {
+        if ( 0 != Hashmap_Remove(Map, &Key, 0) ) {
+            TEST_PRINTF("Test Failure - Failed to remove Key [ %d ].", Key);
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( Array_Length(Map->Buckets) >= (PeakBuckets / 16) ) {
+        TEST_PRINTF("Test Failure - Hashmap still holds (%lu) of (%lu) Buckets after removals.",
+                    (unsigned long)Array_Length(Map->Buckets), (unsigned long)PeakBuckets);
+        Hashmap_Release(Map);
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Remaining; Key++ ) {
+        if ( (NULL == Hashmap_Retrieve(Map, &Key, 0)) ||
+             (Key != *(int *)Hashmap_Retrieve(Map, &Key, 0)) ) {
+            TEST_PRINTF("Test Failure - Key [ %d ] lost while shrinking Hashmap.", Key);
+            Hashmap_Release(Map);
+            TEST_FAILURE;
+        }
+    }
+
+    Hashmap_Release(Map);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Hashmap_Compact(void) {
+
+    Hashmap_t *Map = NULL, *Concurrent = NULL;
+    int        Key = 0, Count = 20000;
+
+    Map        = Hashmap_Create(HashFunc_Int, 0, NULL);
+    Concurrent = Hashmap_CreateConcurrent(HashFunc_Int, 0, NULL, 4);
+    if ( (NULL == Map) || (NULL == Concurrent) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Hashmap_t.");
+        Hashmap_Release(Map);
+        Hashmap_Release(Concurrent);
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        if ( (0 != Hashmap_Insert(Map, &Key, &Key, 0, sizeof(Key), NULL)) ||
+             (0 != Hashmap_Insert(Concurrent, &Key, &Key, 0, sizeof(Key), NULL)) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to perform Insert operation.");
+            Hashmap_Release(Map);
+            Hashmap_Release(Concurrent);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( Key = Count / 8; Key < Count; Key++ ) {
+        Hashmap_Remove(Map, &Key, 0);
+        Hashmap_Remove(Concurrent, &Key, 0);
+    }
+
+    if ( (0 != Hashmap_Compact(Map)) || (0 != Hashmap_Compact(Concurrent)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to compact Hashmap_t.");
+        Hashmap_Release(Map);
+        Hashmap_Release(Concurrent);
+        TEST_FAILURE;
+    }
+
+    if ( ((double)Hashmap_Length(Map) / (double)Array_Length(Map->Buckets)) <
+         (LIBCONTAINER_HASHMAP_LOAD_FACTOR / 4) ) {
+        TEST_PRINTF("Test Failure - Compacted Hashmap still holds (%lu) Buckets for (%lu) items.",
+                    (unsigned long)Array_Length(Map->Buckets),
+                    (unsigned long)Hashmap_Length(Map));
+        Hashmap_Release(Map);
+        Hashmap_Release(Concurrent);
+        TEST_FAILURE;
+    }
+
+    if ( Map->Buckets->Capacity != Array_Length(Map->Buckets) ) {
+        TEST_PRINTF("%s", "Test Failure - Compacted Hashmap did not release unused Bucket memory.");
+        Hashmap_Release(Map);
+        Hashmap_Release(Concurrent);
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Count / 8; Key++ ) {
+        if ( (NULL == Hashmap_Retrieve(Map, &Key, 0)) ||
+             (NULL == Hashmap_Retrieve(Concurrent, &Key, 0)) ) {
+            TEST_PRINTF("Test Failure - Key [ %d ] lost while compacting Hashmap.", Key);
+            Hashmap_Release(Map);
+            Hashmap_Release(Concurrent);
+            TEST_FAILURE;
+        }
+    }
+
+    Hashmap_Release(Map);
+    Hashmap_Release(Concurrent);
+    TEST_SUCCESSFUL;
+}
@@ -39,6 +39,10 @@ extern "C" {
 #include "hashmap_entry.h"
 #include "hashmap_callbacks.h"
 #include "hashmap_iterator.h"
+#include "hashmap_concurrent.h"
+#include "hashmap_frozen.h"
+#include "hashmap_scan.h"
+#include "hashmap_small.h"
 
 #include "../../../include/libcontainer.h"
 #include "../../iterator/include/iterator.h"
@@ -70,6 +74,21 @@ extern "C" {
 #define LIBCONTAINER_HASHMAP_DEFAULT_CAPACITY 16
 #endif
 
+#ifndef LIBCONTAINER_HASHMAP_SHRINK_FACTOR
+/*
+    LIBCONTAINER_HASHMAP_SHRINK_FACTOR
+
+    This macro defines the minimum Load Factor ( # Items / # Buckets )
+    allowed in a Hashmap before the Buckets are halved after a removal.
+    This must be well below LIBCONTAINER_HASHMAP_LOAD_FACTOR / 2, so a Hashmap
+    does not alternate between growing and shrinking as items come and go.
+
+    This is tunable during build-time be re-defining this macro
+    with the desired floating point value.
+*/
+#define LIBCONTAINER_HASHMAP_SHRINK_FACTOR 0.5
+#endif
+
 struct Hashmap_t {
 
     /*
@@ -82,10 +101,17 @@ struct Hashmap_t {
     /*
         Buckets is the Array of "buckets", holding the values which hash and reduce to the same
         index. Currently, this is implemented as an array of linked lists, but may change to a
-        more efficient structure in the future.
+        more efficient structure in the future. This is NULL while the Hashmap is small enough
+        to hold its entries in the Small array instead.
     */
     Array_t* Buckets;
 
+    /*
+        Small holds the entries of a Hashmap with no Buckets, searched linearly. The first
+        ItemCount elements are in use, in no particular order.
+    */
+    Hashmap_Entry_t* Small[LIBCONTAINER_HASHMAP_SMALL_CAPACITY];
+
     /*
         Iterator contains the necessary functionality to safely and consistently iterate
         over the contents of the Hashmap.
@@ -112,6 +138,19 @@ struct Hashmap_t {
         held by the key.
     */
     ReleaseFunc_t* KeyReleaseFunc;
+
+    /*
+        Shards holds the independently locked sub-maps of a Hashmap created with
+        Hashmap_CreateConcurrent(). This is NULL for a regular Hashmap, in which case the
+        Buckets are used directly. When this is non-NULL, the Buckets are unused and every
+        operation is forwarded to the shard the Key hashes to.
+    */
+    Hashmap_Shard_t* Shards;
+
+    /*
+        ShardCount is the number of elements of the Shards array. This is always a power of two.
+    */
+    size_t ShardCount;
 };
 
 /* ++++++++++ Private Functions ++++++++++ */
@@ -133,6 +172,66 @@ struct Hashmap_t {
 */
 void Hashmap_rehash(Hashmap_t* Map);
 
+/*
+    Hashmap_shrink
+
+    This function is the counterpart of Hashmap_rehash(), halving the number of Buckets
+    of the Hashmap when the actual Load Factor falls below the shrinking threshold.
+    The Buckets never shrink below the default capacity of a new Hashmap.
+
+    Inputs:
+    Map     -   Pointer to the Hashmap to consider shrinking.
+
+    Outputs:
+    None, the map is shrunk if necessary.
+*/
+void Hashmap_shrink(Hashmap_t* Map);
+
+/*
+    Hashmap_resize
+
+    This function halves the number of Buckets of the Hashmap until there are no
+    more than BucketCount, merging each upper Bucket into its lower counterpart,
+    and then returns the unused memory of the Buckets array.
+
+    Inputs:
+    Map         -   Pointer to the Hashmap to shrink.
+    BucketCount -   The number of Buckets to shrink to. This must be a power of two.
+
+    Outputs:
+    None, the map is shrunk to the requested number of Buckets.
+*/
+void Hashmap_resize(Hashmap_t* Map, size_t BucketCount);
+
+/*
+    Hashmap_mergeBuckets
+
+    This function moves every entry of the Source Bucket onto the end of the
+    Destination Bucket, without allocating, leaving the Source Bucket empty.
+
+    Inputs:
+    Destination -   Pointer to the Bucket to receive the entries.
+    Source      -   Pointer to the Bucket to take the entries from.
+
+    Outputs:
+    None, the Buckets are merged.
+*/
+void Hashmap_mergeBuckets(List_t* Destination, List_t* Source);
+
+/*
+    Hashmap_minimumBuckets
+
+    This function returns the smallest number of Buckets a Hashmap may hold. This
+    is the default capacity, rounded up to a power of two.
+
+    Inputs:
+    None
+
+    Outputs:
+    size_t  -   The minimum Bucket count of a Hashmap.
+*/
+size_t Hashmap_minimumBuckets(void);
+
 /*
     Hashmap_getBucket
 
@@ -151,6 +250,26 @@ void Hashmap_rehash(Hashmap_t* Map);
 */
 List_t* Hashmap_getBucket(Hashmap_t* Map, const void* Key, size_t KeySize, unsigned int* HashValue);
 
+/*
+    Hashmap_findValue
+
+    This function will return the Value associated with the given Key, searching
+    either the Buckets or the Small array of the Hashmap as appropriate. If HashValue
+    points to a non-zero value, this is assumed to be a previously cached and valid
+    HashValue, and will skip recomputing it.
+
+    Inputs:
+    Map         -   Pointer to the Hashmap_t to search.
+    Key         -   Pointer to the Key Value to use.
+    KeySize     -   Size of the Key value, as measured in bytes.
+    HashValue   -   Pointer to either the pre-computed Hash value, or an out
+                        parameter to write the newly computed hash value.
+
+    Outputs:
+    void*   -   Pointer to the value associated with the given Key, or NULL if it is not in the Hashmap.
+*/
+void *Hashmap_findValue(Hashmap_t *Map, const void *Key, size_t KeySize, unsigned int *HashValue);
+
 /*
     Hashmap_findInBucket
 
@@ -0,0 +1,252 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef LIBCONTAINER_HASHMAP_CONCURRENT_H
+#define LIBCONTAINER_HASHMAP_CONCURRENT_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "../../../include/libcontainer.h"
+
+#ifndef LIBCONTAINER_HASHMAP_CONCURRENT_SHARDS
+/*
+    LIBCONTAINER_HASHMAP_CONCURRENT_SHARDS
+
+    This macro defines the number of independently locked shards a concurrent
+    Hashmap is split into when no explicit shard count is requested. Each shard
+    is a full Hashmap_t guarded by its own reader-writer lock, so this bounds the
+    number of writers which can make progress simultaneously.
+
+    This is tunable during build-time be re-defining this macro
+    with the desired integer value. It is rounded up to a power of two.
+*/
+#define LIBCONTAINER_HASHMAP_CONCURRENT_SHARDS 64
+#endif
+
+/*
+    Hashmap_Shard_t
+
+    A single shard of a concurrent Hashmap. This is only ever defined within
+    the translation unit providing the concurrent operations, as it requires
+    the platform threading headers.
+*/
+typedef struct Hashmap_Shard_t Hashmap_Shard_t;
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+/*
+    Hashmap_concurrentShard
+
+    This function selects the shard of a concurrent Hashmap responsible for the
+    given Key. The raw hash value is re-mixed before being reduced, so that the
+    bits selecting the shard are independent of those selecting the bucket within it.
+
+    Inputs:
+    Map         -   Pointer to the concurrent Hashmap_t to operate on.
+    Key         -   Pointer to the Key Value to use.
+    KeySize     -   Size of the Key value, as measured in bytes.
+    HashValue   -   Out parameter to write the computed hash value of the Key.
+
+    Outputs:
+    Hashmap_Shard_t*    -   Pointer to the shard which owns the given Key.
+*/
+Hashmap_Shard_t *Hashmap_concurrentShard(Hashmap_t *Map, const void *Key, size_t KeySize,
+                                         unsigned int *HashValue);
+
+/*
+    Hashmap_concurrentInsert
+
+    This function is the concurrent counterpart to Hashmap_Insert(), locking
+    only the shard the Key hashes to for the duration of the insertion.
+
+    Inputs:
+    Map                 -   Pointer to the concurrent Hashmap_t to operate on.
+    Key                 -   Pointer to the Key Value to use.
+    Value               -   Pointer to the Value associated with the Key to add.
+    KeySize             -   Size of the Key value, as measured in bytes.
+    ValueSize           -   Size of the Value, as measured in bytes.
+    ValueReleaseFunc    -   Pointer to the function to call to release the Value.
+
+    Outputs:
+    int     -   Returns 0 on success, nonzero on failure.
+*/
+int Hashmap_concurrentInsert(Hashmap_t *Map, void *Key, void *Value, size_t KeySize,
+                             size_t ValueSize, ReleaseFunc_t *ValueReleaseFunc);
+
+/*
+    Hashmap_concurrentRetrieve
+
+    This function is the concurrent counterpart to Hashmap_Retrieve(), holding
+    the shard lock in shared mode so any number of readers may proceed at once.
+
+    Inputs:
+    Map     -   Pointer to the concurrent Hashmap_t to operate on.
+    Key     -   Pointer to the Key Value to use.
+    KeySize -   Size of the Key value, as measured in bytes.
+
+    Outputs:
+    void*   -   Pointer to the value associated with the Key, or NULL if not present.
+*/
+void *Hashmap_concurrentRetrieve(Hashmap_t *Map, const void *Key, size_t KeySize);
+
+/*
+    Hashmap_concurrentRemove
+
+    This function is the concurrent counterpart to Hashmap_Remove().
+
+    Inputs:
+    Map     -   Pointer to the concurrent Hashmap_t to operate on.
+    Key     -   Pointer to the Key Value to use.
+    KeySize -   Size of the Key value, as measured in bytes.
+
+    Outputs:
+    int     -   Returns 0 on success, nonzero on failure.
+*/
+int Hashmap_concurrentRemove(Hashmap_t *Map, const void *Key, size_t KeySize);
+
+/*
+    Hashmap_concurrentPop
+
+    This function is the concurrent counterpart to Hashmap_Pop().
+
+    Inputs:
+    Map     -   Pointer to the concurrent Hashmap_t to operate on.
+    Key     -   Pointer to the Key Value to use.
+    KeySize -   Size of the Key value, as measured in bytes.
+
+    Outputs:
+    void*   -   Pointer to the value removed from the Hashmap, or NULL on failure.
+*/
+void *Hashmap_concurrentPop(Hashmap_t *Map, const void *Key, size_t KeySize);
+
+/*
+    Hashmap_concurrentLength
+
+    This function sums the lengths of each of the shards of a concurrent Hashmap.
+    As each shard is only locked while it is being counted, the result is only
+    exact when no writers are active.
+
+    Inputs:
+    Map     -   Pointer to the concurrent Hashmap_t to query.
+
+    Outputs:
+    size_t  -   The count of items contained within the Hashmap_t.
+*/
+size_t Hashmap_concurrentLength(Hashmap_t *Map);
+
+/*
+    Hashmap_concurrentEntries
+
+    This function appends the entries of every shard of a concurrent Hashmap into
+    the given Array_t.
+
+    Inputs:
+    Map     -   Pointer to the concurrent Hashmap_t to operate on.
+    Entries -   Pointer to the Array_t to append the entries to.
+
+    Outputs:
+    int     -   Returns 0 on success, nonzero on failure.
+*/
+int Hashmap_concurrentEntries(Hashmap_t *Map, Array_t *Entries);
+
+/*
+    Hashmap_concurrentScan
+
+    This function performs one step of Hashmap_Scan() over a concurrent Hashmap.
+    Each shard is only read-locked while its own buckets are being visited.
+
+    Inputs:
+    Map         -   Pointer to the concurrent Hashmap_t to scan.
+    Cursor      -   The cursor returned by the previous call, or 0 to begin a scan.
+    Count       -   The number of items to attempt to report before returning.
+    Callback    -   Pointer to the Callback function to call for each item, or NULL.
+    CallbackArg -   Pointer to the Callback function taking Args to call for each item, or NULL.
+    Args        -   Pointer to the additional arguments to pass to CallbackArg.
+
+    Outputs:
+    size_t  -   The cursor to resume the scan from, or 0 once the scan is complete.
+*/
+size_t Hashmap_concurrentScan(Hashmap_t *Map, size_t Cursor, size_t Count, CallbackFunc_t *Callback,
+                              CallbackArgFunc_t *CallbackArg, void *Args);
+
+/*
+    Hashmap_concurrentClear
+
+    This function is the concurrent counterpart to Hashmap_Clear(), clearing
+    each shard in turn under its exclusive lock.
+
+    Inputs:
+    Map     -   Pointer to the concurrent Hashmap_t to clear.
+
+    Outputs:
+    int     -   Returns 0 on success, nonzero on failure.
+*/
+int Hashmap_concurrentClear(Hashmap_t *Map);
+
+/*
+    Hashmap_concurrentCompact
+
+    This function is the concurrent counterpart to Hashmap_Compact(), compacting
+    each shard in turn under its exclusive lock.
+
+    Inputs:
+    Map     -   Pointer to the concurrent Hashmap_t to compact.
+
+    Outputs:
+    int     -   Returns 0 on success, nonzero on failure.
+*/
+int Hashmap_concurrentCompact(Hashmap_t *Map);
+
+/*
+    Hashmap_concurrentRelease
+
+    This function releases every shard of a concurrent Hashmap, along with the
+    shard locks. This must not be called while any other thread is using the Map.
+
+    Inputs:
+    Map     -   Pointer to the concurrent Hashmap_t to release the shards of.
+
+    Outputs:
+    None, the shards and locks are released. The Map itself is left to the caller.
+*/
+void Hashmap_concurrentRelease(Hashmap_t *Map);
+
+/* ---------- Private Functions ---------- */
+
+#if defined(TESTING) || defined(DEBUGGER)
+
+#include "hashmap_concurrent_test.h"
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,263 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef LIBCONTAINER_HASHMAP_FROZEN_H
+#define LIBCONTAINER_HASHMAP_FROZEN_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "../../../include/libcontainer.h"
+
+/*
+    HASHMAP_FROZEN_MAGIC
+
+    The first 4 bytes of every frozen Hashmap buffer, identifying the contents. This is
+    written in native byte order, so a buffer saved on a machine of the opposite
+    endianness is rejected rather than misread.
+*/
+#define HASHMAP_FROZEN_MAGIC 0x5A46434CUL
+
+/*
+    HASHMAP_FROZEN_VERSION
+
+    The layout version of the frozen Hashmap buffer. This must be incremented whenever
+    the layout of any of the structures below changes.
+*/
+#define HASHMAP_FROZEN_VERSION 1
+
+/*
+    HASHMAP_FROZEN_BUCKET_SIZE
+
+    The average number of keys sharing a single displacement seed. Larger values
+    shrink the seed table, at the cost of a longer search while freezing.
+*/
+#define HASHMAP_FROZEN_BUCKET_SIZE 4
+
+/*
+    HASHMAP_FROZEN_ALIGNMENT
+
+    The alignment, in bytes, of every section and every Key and Value held in the
+    frozen Hashmap buffer.
+*/
+#define HASHMAP_FROZEN_ALIGNMENT 8
+
+/*
+    Hashmap_Frozen_Header_t
+
+    The header at the very start of a frozen Hashmap buffer. All offsets are measured in
+    bytes from the start of the buffer, so the buffer can be used directly from any address
+    it is loaded or mapped at.
+*/
+typedef struct Hashmap_Frozen_Header_t {
+
+    /* Magic and Version identify the buffer as a frozen Hashmap of this exact layout. */
+    uint32_t Magic;
+    uint32_t Version;
+
+    /* TotalSize is the size of the entire buffer, including this header. */
+    uint32_t TotalSize;
+
+    /* Salt is mixed into the hash of every Key, and is changed if a given Salt fails to
+     * produce a perfect hash for the set of Keys. */
+    uint32_t Salt;
+
+    /* KeySize is the size of every Key, or 0 if the Keys are of variable size (strings). */
+    uint32_t KeySize;
+
+    /* ItemCount is the number of entries, which is also the number of Slots. */
+    uint32_t ItemCount;
+
+    /* BucketCount is the number of displacement seeds. */
+    uint32_t BucketCount;
+
+    /* SeedsOffset is the offset of the array of BucketCount uint32_t displacement seeds. */
+    uint32_t SeedsOffset;
+
+    /* SlotsOffset is the offset of the array of ItemCount Hashmap_Frozen_Slot_t. */
+    uint32_t SlotsOffset;
+
+    /* DataOffset is the offset of the Key and Value bytes referred to by the Slots. */
+    uint32_t DataOffset;
+
+} Hashmap_Frozen_Header_t;
+
+/*
+    Hashmap_Frozen_Slot_t
+
+    A single entry of the frozen Hashmap. Each Key hashes to exactly one Slot.
+*/
+typedef struct Hashmap_Frozen_Slot_t {
+
+    /* Hash is the secondary hash of the Key held in this Slot, allowing a lookup of an
+     * absent Key to almost always be rejected without reading the Key bytes. */
+    uint32_t Hash;
+
+    /* KeyOffset is the offset of the Key bytes. The Value follows the Key, at the next
+     * HASHMAP_FROZEN_ALIGNMENT boundary. */
+    uint32_t KeyOffset;
+
+    /* KeySize and ValueSize are the sizes, in bytes, of the Key and Value. */
+    uint32_t KeySize;
+    uint32_t ValueSize;
+
+} Hashmap_Frozen_Slot_t;
+
+struct Hashmap_Frozen_t {
+
+    /* Buffer is the single contiguous block holding the entire frozen Hashmap. */
+    uint8_t* Buffer;
+
+    /* Size is the number of bytes in the Buffer. */
+    size_t Size;
+
+    /* Mapped indicates whether the Buffer is a memory-mapped file, rather than heap memory. */
+    bool Mapped;
+};
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+/*
+    Hashmap_frozenHash
+
+    This function computes the pair of hashes used to locate a Key in a frozen Hashmap.
+    The first selects the displacement seed, and the second is displaced by that seed to
+    select the Slot. This is independent of the HashFunc_t of the original Hashmap, so a
+    frozen buffer can be used by any process.
+
+    Inputs:
+    Key         -   Pointer to the bytes of the Key.
+    KeySize     -   The number of bytes of the Key to hash.
+    Salt        -   The salt to mix into the hash.
+    Primary     -   Out parameter for the hash selecting the seed.
+    Secondary   -   Out parameter for the hash selecting the Slot.
+
+    Outputs:
+    None, the hashes are written to the out parameters.
+*/
+void Hashmap_frozenHash(const uint8_t* Key, size_t KeySize, uint32_t Salt, uint32_t* Primary, uint32_t* Secondary);
+
+/*
+    Hashmap_frozenMix
+
+    This function is the finalizer of the MurmurHash3 family, scrambling the bits of the
+    given value such that every input bit affects every output bit.
+
+    Inputs:
+    Value   -   The value to mix.
+
+    Outputs:
+    uint32_t    -   The mixed value.
+*/
+uint32_t Hashmap_frozenMix(uint32_t Value);
+
+/*
+    Hashmap_frozenPlace
+
+    This function searches for the displacement seed of every bucket, such that every Key
+    is assigned a distinct Slot. Buckets are placed largest first, as these are the hardest
+    to fit once the table begins to fill.
+
+    Inputs:
+    Primary     -   The primary hash of each Key.
+    Secondary   -   The secondary hash of each Key.
+    Count       -   The number of Keys, which is also the number of Slots.
+    BucketCount -   The number of buckets, and therefore seeds.
+    Seeds       -   Out parameter, the array of BucketCount seeds to write.
+    SlotOf      -   Out parameter, the array of Count Slot indices assigned to each Key.
+
+    Outputs:
+    int     -   Returns 0 on success, nonzero if a seed could not be found for some bucket
+                    or memory could not be allocated.
+*/
+int Hashmap_frozenPlace(const uint32_t* Primary, const uint32_t* Secondary, uint32_t Count, uint32_t BucketCount, uint32_t* Seeds, uint32_t* SlotOf);
+
+/*
+    Hashmap_frozenSlot
+
+    This function displaces a secondary hash by the given seed, returning the
+    index of the Slot it selects.
+
+    Inputs:
+    Secondary   -   The secondary hash of the Key.
+    Seed        -   The displacement seed of the bucket of the Key.
+    SlotCount   -   The number of Slots in the frozen Hashmap.
+
+    Outputs:
+    uint32_t    -   The index of the Slot for the Key.
+*/
+uint32_t Hashmap_frozenSlot(uint32_t Secondary, uint32_t Seed, uint32_t SlotCount);
+
+/*
+    Hashmap_frozenKeyLength
+
+    This function returns the number of significant bytes of a Key. Variable-sized
+    Keys are compared without any trailing NUL terminator, so a string Key matches
+    regardless of whether the terminator was counted when it was inserted.
+
+    Inputs:
+    Key         -   Pointer to the bytes of the Key.
+    KeySize     -   The size of the Key, as measured in bytes.
+    FixedSize   -   Whether all Keys of the Hashmap are of the same size.
+
+    Outputs:
+    size_t  -   The number of significant bytes of the Key.
+*/
+size_t Hashmap_frozenKeyLength(const uint8_t* Key, size_t KeySize, bool FixedSize);
+
+/*
+    Hashmap_frozenValidate
+
+    This function checks that a buffer holds a well-formed frozen Hashmap, such that
+    no lookup can read outside of it.
+
+    Inputs:
+    Buffer  -   Pointer to the start of the buffer.
+    Size    -   The number of bytes in the buffer.
+
+    Outputs:
+    int     -   Returns 0 if the buffer is valid, nonzero otherwise.
+*/
+int Hashmap_frozenValidate(const uint8_t* Buffer, size_t Size);
+
+/* ---------- Private Functions ---------- */
+
+#if defined(TESTING) || defined(DEBUGGER)
+
+#include "hashmap_frozen_test.h"
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
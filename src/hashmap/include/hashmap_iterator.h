@@ -36,6 +36,27 @@ extern "C" {
 #define LIBCONTAINER_ENABLE_HASHMAP
 #include "../../../include/libcontainer.h"
 
+/*
+    Hashmap_TopK_Scan_t
+
+    This is the argument Hashmap_TopKByValue() hands to Hashmap_topKVisit(), as
+    the scan itself disregards the value returned by each Callback.
+*/
+typedef struct Hashmap_TopK_Scan_t {
+
+    /*
+        TopK is the TopK_t every item of the Hashmap is offered to. It is named by its
+        tag, as this header does not enable the TopK_t typedefs.
+    */
+    struct TopK_t* TopK;
+
+    /*
+        Failed is set once any item could not be offered to the TopK_t.
+    */
+    bool Failed;
+
+} Hashmap_TopK_Scan_t;
+
 /*
     Iterator_Initialize_Hashmap
 
@@ -53,6 +74,38 @@ extern "C" {
 */
 int Iterator_Initialize_Hashmap(Hashmap_t *Map, CompareFunc_t* CompareFunc);
 
+/*
+    Hashmap_appendEntries
+
+    This function appends a reference to every Hashmap_Entry_t contained within
+    the given Hashmap onto the end of the Entries array. For a concurrent Hashmap,
+    the entries of every shard are collected.
+
+    Inputs:
+    Map     -   Pointer to the Hashmap to read the entries from.
+    Entries -   Pointer to the (Reference-type) Array_t to append the entries to.
+
+    Outputs:
+    int     -   Returns 0 on success, nonzero on failure.
+*/
+int Hashmap_appendEntries(Hashmap_t *Map, Array_t *Entries);
+
+/*
+    Hashmap_topKVisit
+
+    This function is the Callback used by Hashmap_TopKByValue() to offer each item
+    of the Hashmap to a TopK_t, ordered by its Value and carrying its Key.
+
+    Inputs:
+    Item    -   Pointer to the Hashmap_KeyValuePair_t of the item.
+    Args    -   Pointer to the Hashmap_TopK_Scan_t holding the TopK_t to offer the item to.
+
+    Outputs:
+    int     -   Returns 0 on success, nonzero on failure, which is also recorded
+                    in the Hashmap_TopK_Scan_t.
+*/
+int Hashmap_topKVisit(void *Item, void *Args);
+
 #if defined(TESTING) || defined(DEBUGGER)
 
 #include "hashmap_iterator_test.h"
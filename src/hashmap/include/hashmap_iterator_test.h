@@ -39,6 +39,7 @@ int Test_hashmap_iterator(void);
 
 int Test_Hashmap_Keys_DoubleKey(void);
 int Test_Hashmap_Keys_StringKey(void);
+int Test_Hashmap_TopKByValue(void);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,153 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef LIBCONTAINER_HASHMAP_SCAN_H
+#define LIBCONTAINER_HASHMAP_SCAN_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+
+#include "hashmap_entry.h"
+
+#include "../../../include/libcontainer.h"
+
+/*
+    HASHMAP_SCAN_EMPTY_VISITS
+
+    This macro defines how many empty buckets a single call to Hashmap_Scan() may visit
+    for each item it was asked to report, before returning early. This bounds the work
+    performed by a single call on a sparsely populated Hashmap.
+*/
+#define HASHMAP_SCAN_EMPTY_VISITS 10
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+/*
+    Hashmap_scan
+
+    This function is the shared implementation of Hashmap_Scan() and Hashmap_ScanArg().
+    Exactly one of Callback or CallbackArg is expected to be non-NULL.
+
+    Inputs:
+    Map         -   Pointer to the Hashmap_t to scan.
+    Cursor      -   The cursor returned by the previous call, or 0 to begin a scan.
+    Count       -   The number of items to attempt to report before returning.
+    Callback    -   Pointer to the Callback function to call for each item, or NULL.
+    CallbackArg -   Pointer to the Callback function taking Args to call for each item, or NULL.
+    Args        -   Pointer to the additional arguments to pass to CallbackArg.
+
+    Outputs:
+    size_t  -   The cursor to resume the scan from, or 0 once the scan is complete.
+*/
+size_t Hashmap_scan(Hashmap_t *Map, size_t Cursor, size_t Count, CallbackFunc_t *Callback,
+                    CallbackArgFunc_t *CallbackArg, void *Args);
+
+/*
+    Hashmap_scanBuckets
+
+    This function visits the buckets of a single, non-sharded, Hashmap in reverse-binary
+    order starting from Cursor, until either the scan completes or the budget for
+    this call is exhausted.
+
+    Inputs:
+    Map         -   Pointer to the Hashmap_t to scan.
+    Cursor      -   The bucket cursor to resume the scan from.
+    Count       -   The number of items to attempt to report before returning.
+    Reported    -   Pointer to the running count of items reported during this call.
+    Empty       -   Pointer to the running count of empty buckets visited during this call.
+    Callback    -   Pointer to the Callback function to call for each item, or NULL.
+    CallbackArg -   Pointer to the Callback function taking Args to call for each item, or NULL.
+    Args        -   Pointer to the additional arguments to pass to CallbackArg.
+
+    Outputs:
+    size_t  -   The bucket cursor to resume the scan from, or 0 once every bucket has been visited.
+*/
+size_t Hashmap_scanBuckets(Hashmap_t *Map, size_t Cursor, size_t Count, size_t *Reported,
+                           size_t *Empty, CallbackFunc_t *Callback, CallbackArgFunc_t *CallbackArg,
+                           void *Args);
+
+/*
+    Hashmap_scanEntry
+
+    This function calls whichever of Callback or CallbackArg is non-NULL on a single Entry.
+
+    Inputs:
+    Entry       -   Pointer to the Entry to report.
+    Callback    -   Pointer to the Callback function to call, or NULL.
+    CallbackArg -   Pointer to the Callback function taking Args to call, or NULL.
+    Args        -   Pointer to the additional arguments to pass to CallbackArg.
+
+    Outputs:
+    None, the Callback is called.
+*/
+void Hashmap_scanEntry(Hashmap_Entry_t *Entry, CallbackFunc_t *Callback,
+                       CallbackArgFunc_t *CallbackArg, void *Args);
+
+/*
+    Hashmap_scanExhausted
+
+    This function reports whether the budget of a single call to Hashmap_Scan() has been used up.
+
+    Inputs:
+    Count       -   The number of items the call was asked to report.
+    Reported    -   The count of items reported so far during this call.
+    Empty       -   The count of empty buckets visited so far during this call.
+
+    Outputs:
+    bool    -   Returns true if the call should return to the caller, false to keep scanning.
+*/
+bool Hashmap_scanExhausted(size_t Count, size_t Reported, size_t Empty);
+
+/*
+    Hashmap_scanReverse
+
+    This function reverses the order of the bits of the given value.
+
+    Inputs:
+    Value   -   The value to reverse.
+
+    Outputs:
+    size_t  -   The value with its bits in reverse order.
+*/
+size_t Hashmap_scanReverse(size_t Value);
+
+/* ---------- Private Functions ---------- */
+
+#if defined(TESTING) || defined(DEBUGGER)
+
+#include "hashmap_scan_test.h"
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,160 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef LIBCONTAINER_HASHMAP_SMALL_H
+#define LIBCONTAINER_HASHMAP_SMALL_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+
+#include "hashmap_entry.h"
+
+#include "../../../include/libcontainer.h"
+
+#ifndef LIBCONTAINER_HASHMAP_SMALL_CAPACITY
+/*
+    LIBCONTAINER_HASHMAP_SMALL_CAPACITY
+
+    This macro defines the number of items a Hashmap holds in a flat array, searched
+    linearly, before switching over to the full table of Buckets. Small Hashmaps
+    never allocate any Buckets at all, making them much cheaper to create and hold.
+    A Hashmap switches back to the flat array once it shrinks to half of this size.
+
+    This is tunable during build-time be re-defining this macro
+    with the desired integer value. This must be at least 1.
+*/
+#define LIBCONTAINER_HASHMAP_SMALL_CAPACITY 8
+#endif
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+/*
+    Hashmap_smallFind
+
+    This function searches the flat array of a small Hashmap for the given Key.
+    If HashValue points to a non-zero value, this is assumed to be a previously cached
+    and valid HashValue, and will skip recomputing it.
+
+    Inputs:
+    Map         -   Pointer to the small Hashmap_t to search.
+    Key         -   Pointer to the Key Value to use.
+    KeySize     -   Size of the Key value, as measured in bytes.
+    HashValue   -   Pointer to either the pre-computed Hash value, or an out
+                        parameter to write the newly computed hash value.
+
+    Outputs:
+    size_t  -   The index of the Entry holding the Key, or the Length of the Hashmap if it is not present.
+*/
+size_t Hashmap_smallFind(Hashmap_t *Map, const void *Key, size_t KeySize, unsigned int *HashValue);
+
+/*
+    Hashmap_smallInsert
+
+    This function adds an Entry to the flat array of a small Hashmap, which
+    must have room for at least one more item.
+
+    Inputs:
+    Map     -   Pointer to the small Hashmap_t to insert into.
+    Entry   -   Pointer to the Entry to insert.
+
+    Outputs:
+    None, the Entry is owned by the Hashmap.
+*/
+void Hashmap_smallInsert(Hashmap_t *Map, Hashmap_Entry_t *Entry);
+
+/*
+    Hashmap_smallTake
+
+    This function removes the Entry at the given index from the flat array of a small Hashmap,
+    without releasing it. The last Entry of the array is moved into the vacated position.
+
+    Inputs:
+    Map     -   Pointer to the small Hashmap_t to remove from.
+    Index   -   The index of the Entry to remove, as returned by Hashmap_smallFind().
+
+    Outputs:
+    Hashmap_Entry_t*    -   Pointer to the removed Entry, now owned by the caller.
+*/
+Hashmap_Entry_t *Hashmap_smallTake(Hashmap_t *Map, size_t Index);
+
+/*
+    Hashmap_smallClear
+
+    This function releases every Entry held in the flat array of a small Hashmap.
+
+    Inputs:
+    Map     -   Pointer to the small Hashmap_t to clear.
+
+    Outputs:
+    None, the Hashmap is emptied.
+*/
+void Hashmap_smallClear(Hashmap_t *Map);
+
+/*
+    Hashmap_promote
+
+    This function switches a small Hashmap over to a full table of Buckets,
+    moving every Entry out of the flat array.
+
+    Inputs:
+    Map     -   Pointer to the small Hashmap_t to promote.
+
+    Outputs:
+    int     -   Returns 0 on success, nonzero on failure. On failure, the Hashmap is unchanged.
+*/
+int Hashmap_promote(Hashmap_t *Map);
+
+/*
+    Hashmap_demote
+
+    This function switches a Hashmap with no more than LIBCONTAINER_HASHMAP_SMALL_CAPACITY
+    items back to the flat array, releasing the table of Buckets.
+
+    Inputs:
+    Map     -   Pointer to the Hashmap_t to demote.
+
+    Outputs:
+    None, the Hashmap is switched to the flat array.
+*/
+void Hashmap_demote(Hashmap_t *Map);
+
+/* ---------- Private Functions ---------- */
+
+#if defined(TESTING) || defined(DEBUGGER)
+
+#include "hashmap_small_test.h"
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -58,6 +58,9 @@ int Test_Hashmap_Remove_StringKey(void);
 int Test_Hashmap_Pop_StringKey(void);
 int Test_Hashmap_Clear_StringKey(void);
 
+int Test_Hashmap_Shrink(void);
+int Test_Hashmap_Compact(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -64,6 +64,17 @@ Binary_Heap_t *Binary_Heap_Create(CompareFunc_t *KeyCompareFunc, ReleaseFunc_t *
         return NULL;
     }
 
+    Heap->NodePool = Pool_Create(sizeof(Binary_Heap_Node_t));
+    if ( NULL == Heap->NodePool ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to create Node Pool_t for Binary_Heap_t.");
+#endif
+        Array_Release(Heap->Items);
+        free(Heap);
+        return NULL;
+    }
+
+    Heap->Mode           = Binary_Heap_Mode_Nodes;
     Heap->KeyCompareFunc = KeyCompareFunc;
     Heap->KeyReleaseFunc = KeyReleaseFunc;
 
@@ -82,6 +93,12 @@ size_t Binary_Heap_Length(Binary_Heap_t *Heap) {
         return 0;
     }
 
+    if ( Binary_Heap_Mode_Inline == Heap->Mode ) {
+        return Heap->SlotCount;
+    } else if ( Binary_Heap_Mode_Pairing == Heap->Mode ) {
+        return Heap->Count;
+    }
+
     return Array_Length(Heap->Items);
 }
 
@@ -108,6 +125,16 @@ Binary_Heap_KeyValuePair_t Binary_Heap_Peek(Binary_Heap_t *Heap) {
         return KeyValuePair;
     }
 
+    if ( Binary_Heap_Mode_Inline == Heap->Mode ) {
+        KeyValuePair.Key   = BINARY_HEAP_SLOT_KEY(Heap->Slots);
+        KeyValuePair.Value = BINARY_HEAP_SLOT(Heap, 0)->Value;
+        return KeyValuePair;
+    } else if ( Binary_Heap_Mode_Pairing == Heap->Mode ) {
+        KeyValuePair.Key   = Heap->Root->Node.Key;
+        KeyValuePair.Value = Heap->Root->Node.Value;
+        return KeyValuePair;
+    }
+
     Node = Array_GetElement(Heap->Items, 0);
     if ( NULL == Node ) {
 #ifdef DEBUG
@@ -129,6 +156,7 @@ Binary_Heap_KeyValuePair_t Binary_Heap_Pop(Binary_Heap_t *Heap) {
 
     Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
     Binary_Heap_Node_t *       Node         = NULL;
+    Binary_Heap_Slot_t *       Slot         = NULL;
 
     if ( NULL == Heap ) {
 #ifdef DEBUG
@@ -144,18 +172,36 @@ Binary_Heap_KeyValuePair_t Binary_Heap_Pop(Binary_Heap_t *Heap) {
         return KeyValuePair;
     }
 
-    Array_swapItems(Heap->Items, 0, Array_Length(Heap->Items) - 1);
+    if ( Binary_Heap_Mode_Inline == Heap->Mode ) {
+        Binary_Heap_invalidate(Heap);
+        Slot               = Binary_Heap_inlinePop(Heap);
+        KeyValuePair.Key   = BINARY_HEAP_SLOT_KEY(Slot);
+        KeyValuePair.Value = Slot->Value;
+        return KeyValuePair;
+    } else if ( Binary_Heap_Mode_Pairing == Heap->Mode ) {
+        Binary_Heap_invalidate(Heap);
+        Node = &(Heap->Root->Node);
+        Binary_Heap_pairingDetach(Heap, Heap->Root);
+        KeyValuePair.Key       = Node->Key;
+        KeyValuePair.Value     = Node->Value;
+        Node->KeyReleaseFunc   = NULL;
+        Node->ValueReleaseFunc = NULL;
+        Binary_Heap_Node_Release(Node);
+        return KeyValuePair;
+    }
+
+    Binary_Heap_swapNodes(Heap, 0, Array_Length(Heap->Items) - 1);
     Node = Array_PopElement(Heap->Items, Array_Length(Heap->Items) - 1);
     if ( NULL == Node ) {
         /* We have to swap the items back, so we don't leave the heap in an invalid state. */
-        Array_swapItems(Heap->Items, 0, Array_Length(Heap->Items) - 1);
+        Binary_Heap_swapNodes(Heap, 0, Array_Length(Heap->Items) - 1);
 #ifdef DEBUG
         DEBUG_PRINTF("%s", "Error: Failed to remove item from Binary_Heap_t.");
 #endif
         return KeyValuePair;
     }
 
-    Iterator_Invalidate(&(Heap->Items->Iterator));
+    Binary_Heap_invalidate(Heap);
 
     KeyValuePair.Key   = Node->Key;
     KeyValuePair.Value = Node->Value;
@@ -165,7 +211,7 @@ Binary_Heap_KeyValuePair_t Binary_Heap_Pop(Binary_Heap_t *Heap) {
 
     Binary_Heap_Node_Release(Node);
 
-    if ( 0 != Binary_Heap_siftDown(Heap) ) {
+    if ( 0 != Binary_Heap_siftDown(Heap, 0) ) {
 #ifdef DEBUG
         DEBUG_PRINTF("%s", "Error: Error occurred during Sift-Down process.");
 #endif
@@ -181,6 +227,7 @@ Binary_Heap_KeyValuePair_t Binary_Heap_Pop(Binary_Heap_t *Heap) {
 int Binary_Heap_Remove(Binary_Heap_t *Heap) {
 
     Binary_Heap_Node_t *Node = NULL;
+    Binary_Heap_Slot_t *Slot = NULL;
 
     if ( NULL == Heap ) {
 #ifdef DEBUG
@@ -196,22 +243,37 @@ int Binary_Heap_Remove(Binary_Heap_t *Heap) {
         return 0;
     }
 
-    Array_swapItems(Heap->Items, 0, Array_Length(Heap->Items) - 1);
+    if ( Binary_Heap_Mode_Inline == Heap->Mode ) {
+        Binary_Heap_invalidate(Heap);
+        Slot = Binary_Heap_inlinePop(Heap);
+        if ( (NULL != Slot->Value) && (NULL != Slot->ValueReleaseFunc) ) {
+            Slot->ValueReleaseFunc(Slot->Value);
+        }
+        return 0;
+    } else if ( Binary_Heap_Mode_Pairing == Heap->Mode ) {
+        Binary_Heap_invalidate(Heap);
+        Node = &(Heap->Root->Node);
+        Binary_Heap_pairingDetach(Heap, Heap->Root);
+        Binary_Heap_Node_Release(Node);
+        return 0;
+    }
+
+    Binary_Heap_swapNodes(Heap, 0, Array_Length(Heap->Items) - 1);
     Node = Array_PopElement(Heap->Items, Array_Length(Heap->Items) - 1);
     if ( NULL == Node ) {
         /* We have to swap the items back, so we don't leave the heap in an invalid state. */
-        Array_swapItems(Heap->Items, 0, Array_Length(Heap->Items) - 1);
+        Binary_Heap_swapNodes(Heap, 0, Array_Length(Heap->Items) - 1);
 #ifdef DEBUG
         DEBUG_PRINTF("%s", "Error: Failed to remove item from Binary_Heap_t.");
 #endif
         return 1;
     }
 
-    Iterator_Invalidate(&(Heap->Items->Iterator));
+    Binary_Heap_invalidate(Heap);
 
     Binary_Heap_Node_Release(Node);
 
-    if ( 0 != Binary_Heap_siftDown(Heap) ) {
+    if ( 0 != Binary_Heap_siftDown(Heap, 0) ) {
 #ifdef DEBUG
         DEBUG_PRINTF("%s", "Error: Error occurred during Sift-Down process.");
 #endif
@@ -227,37 +289,301 @@ int Binary_Heap_Remove(Binary_Heap_t *Heap) {
 int Binary_Heap_Push(Binary_Heap_t *Heap, void *Key, size_t KeySize, void *Value, size_t ValueSize,
                      ReleaseFunc_t *ValueReleaseFunc) {
 
-    Binary_Heap_Node_t *NewNode = NULL;
+    if ( NULL == Heap ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Heap* provided.");
+#endif
+        return 1;
+    }
+
+    if ( Binary_Heap_Mode_Inline == Heap->Mode ) {
+        Binary_Heap_invalidate(Heap);
+        return Binary_Heap_inlinePush(Heap, Key, KeySize, Value, ValueSize, ValueReleaseFunc);
+    } else if ( Binary_Heap_Mode_Pairing == Heap->Mode ) {
+        Binary_Heap_invalidate(Heap);
+        if ( NULL == Binary_Heap_pairingPush(Heap, Key, KeySize, Value, ValueSize,
+                                             ValueReleaseFunc) ) {
+            return 1;
+        }
+        return 0;
+    }
+
+    if ( NULL == Binary_Heap_pushNode(Heap, Key, KeySize, Value, ValueSize, ValueReleaseFunc) ) {
+        return 1;
+    }
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully added item to Binary_Heap_t.");
+#endif
+    return 0;
+}
+
+Binary_Heap_Handle_t *Binary_Heap_PushHandle(Binary_Heap_t *Heap, void *Key, size_t KeySize,
+                                             void *Value, size_t ValueSize,
+                                             ReleaseFunc_t *ValueReleaseFunc) {
 
     if ( NULL == Heap ) {
 #ifdef DEBUG
         DEBUG_PRINTF("%s", "Error: NULL Heap* provided.");
+#endif
+        return NULL;
+    }
+
+    if ( (Binary_Heap_Mode_Inline == Heap->Mode) || (Binary_Heap_Mode_MinMax == Heap->Mode) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Handles are only available for node-based Binary_Heap_t.");
+#endif
+        return NULL;
+    } else if ( Binary_Heap_Mode_Pairing == Heap->Mode ) {
+        Binary_Heap_invalidate(Heap);
+        return (Binary_Heap_Handle_t *)Binary_Heap_pairingPush(Heap, Key, KeySize, Value,
+                                                                ValueSize, ValueReleaseFunc);
+    }
+
+    return (Binary_Heap_Handle_t *)Binary_Heap_pushNode(Heap, Key, KeySize, Value, ValueSize,
+                                                         ValueReleaseFunc);
+}
+
+int Binary_Heap_UpdateKey(Binary_Heap_t *Heap, Binary_Heap_Handle_t *Handle, void *Key,
+                          size_t KeySize) {
+
+    Binary_Heap_Node_t *       Node    = (Binary_Heap_Node_t *)Handle;
+    Binary_Heap_PairingNode_t *Pairing = (Binary_Heap_PairingNode_t *)Handle;
+
+    if ( 0 != Binary_Heap_checkHandle(Heap, Handle) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Invalid Heap* or Handle* provided.");
+#endif
+        return 1;
+    }
+
+    if ( 0 != Binary_Heap_Node_UpdateKey(Node, Key, KeySize) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to update Key of Binary_Heap_t item.");
 #endif
         return 1;
     }
 
-    NewNode = Binary_Heap_Node_Create(Key, Value, KeySize, ValueSize, Heap->KeyReleaseFunc,
-                                      ValueReleaseFunc);
+    Binary_Heap_invalidate(Heap);
 
-    if ( 0 != Array_Append(Heap->Items, &NewNode) ) {
+    /* A meldable Heap takes the item out and links it back in under its new Key. */
+    if ( Binary_Heap_Mode_Pairing == Heap->Mode ) {
+        Binary_Heap_pairingDetach(Heap, Pairing);
+        Heap->Root = Binary_Heap_pairingMeld(Heap, Heap->Root, Pairing);
+        Heap->Count++;
+        return 0;
+    }
+
+    return Binary_Heap_restore(Heap, Node->Index);
+}
+
+int Binary_Heap_RemoveHandle(Binary_Heap_t *Heap, Binary_Heap_Handle_t *Handle) {
+
+    Binary_Heap_Node_t *Node  = (Binary_Heap_Node_t *)Handle;
+    size_t              Index = 0;
+
+    if ( 0 != Binary_Heap_checkHandle(Heap, Handle) ) {
 #ifdef DEBUG
-        DEBUG_PRINTF("%s", "Error: Failed to add new item to Binary_Heap_t.");
+        DEBUG_PRINTF("%s", "Error: Invalid Heap* or Handle* provided.");
 #endif
-        Binary_Heap_Node_Release(NewNode);
         return 1;
     }
 
-    Iterator_Invalidate(&(Heap->Items->Iterator));
+    if ( Binary_Heap_Mode_Pairing == Heap->Mode ) {
+        Binary_Heap_invalidate(Heap);
+        Binary_Heap_pairingDetach(Heap, (Binary_Heap_PairingNode_t *)Handle);
+        Binary_Heap_Node_Release(Node);
+        return 0;
+    }
 
-    if ( 0 != Binary_Heap_siftUp(Heap) ) {
+    /* The last item is moved into the gap, and may need to travel either way from there. */
+    Index = Node->Index;
+    Binary_Heap_swapNodes(Heap, Index, Array_Length(Heap->Items) - 1);
+    Array_PopElement(Heap->Items, Array_Length(Heap->Items) - 1);
+    Binary_Heap_Node_Release(Node);
+
+    Binary_Heap_invalidate(Heap);
+
+    if ( Index == Array_Length(Heap->Items) ) {
+        return 0;
+    }
+
+    return Binary_Heap_restore(Heap, Index);
+}
+
+int Binary_Heap_PushN(Binary_Heap_t *Heap, void *Keys, size_t KeySize, void *Values,
+                      size_t ValueSize, size_t Count, ReleaseFunc_t *ValueReleaseFunc) {
+
+    int RetVal = 0;
+
+    if ( NULL == Heap ) {
 #ifdef DEBUG
-        DEBUG_PRINTF("%s", "Error: Error occurred during Sift-Up process.");
+        DEBUG_PRINTF("%s", "Error: NULL Heap* provided.");
 #endif
         return 1;
     }
 
+    if ( 0 == Count ) {
 #ifdef DEBUG
-    DEBUG_PRINTF("%s", "Successfully added item to Binary_Heap_t.");
+        DEBUG_PRINTF("%s", "Note: No items provided, nothing to push.");
+#endif
+        return 0;
+    }
+
+    if ( (NULL == Keys) || (0 == KeySize) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Binary_Heap_PushN() requires a buffer of non-zero sized Keys.");
+#endif
+        return 1;
+    }
+
+    if ( (NULL == Values) && (0 != ValueSize) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Values* provided with a non-zero ValueSize.");
+#endif
+        return 1;
+    }
+
+    Binary_Heap_invalidate(Heap);
+
+    if ( Binary_Heap_Mode_Inline == Heap->Mode ) {
+        RetVal = Binary_Heap_inlinePushN(Heap, (uint8_t *)Keys, KeySize, (uint8_t *)Values,
+                                         ValueSize, Count, ValueReleaseFunc);
+    } else if ( Binary_Heap_Mode_Pairing == Heap->Mode ) {
+        RetVal = Binary_Heap_pairingPushN(Heap, (uint8_t *)Keys, KeySize, (uint8_t *)Values,
+                                          ValueSize, Count, ValueReleaseFunc);
+    } else {
+        RetVal = Binary_Heap_pushNodes(Heap, (uint8_t *)Keys, KeySize, (uint8_t *)Values,
+                                       ValueSize, Count, ValueReleaseFunc);
+    }
+
+    if ( 0 != RetVal ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to add items to Binary_Heap_t.");
+#endif
+        return RetVal;
+    }
+
+#ifdef DEBUG
+    DEBUG_PRINTF("Successfully added (%lu) items to Binary_Heap_t.", (unsigned long)Count);
+#endif
+    return 0;
+}
+
+Binary_Heap_t *Binary_Heap_FromArray(CompareFunc_t *KeyCompareFunc, Array_t *Keys, Array_t *Values,
+                                     ReleaseFunc_t *ValueReleaseFunc) {
+
+    Binary_Heap_t *Heap = NULL;
+
+    if ( (NULL == Keys) || (0 == Keys->ElementSize) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Keys must be a non-NULL Array_t holding its elements by value.");
+#endif
+        return NULL;
+    }
+
+    if ( (NULL != Values) && ((0 == Values->ElementSize) || (Values->Length != Keys->Length)) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Values must hold one element by value for each of the Keys.");
+#endif
+        return NULL;
+    }
+
+    Heap = Binary_Heap_Create(KeyCompareFunc, NULL);
+    if ( NULL == Heap ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to create Binary_Heap_t.");
+#endif
+        return NULL;
+    }
+
+    if ( 0 != Binary_Heap_PushN(Heap, Keys->Contents.ContentBytes, Keys->ElementSize,
+                                (NULL == Values) ? NULL : Values->Contents.ContentBytes,
+                                (NULL == Values) ? 0 : Values->ElementSize, Keys->Length,
+                                ValueReleaseFunc) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to build Binary_Heap_t from Array_t contents.");
+#endif
+        Binary_Heap_Release(Heap);
+        return NULL;
+    }
+
+    return Heap;
+}
+
+int Binary_Heap_Merge(Binary_Heap_t *Dst, Binary_Heap_t *Src) {
+
+    Pool_t *NewPool = NULL;
+
+    if ( (NULL == Dst) || (NULL == Src) || (Dst == Src) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Two distinct, non-NULL Heap* must be provided.");
+#endif
+        return 1;
+    }
+
+    if ( (Dst->Mode != Src->Mode) || (Binary_Heap_Mode_Inline == Dst->Mode) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s",
+                     "Error: Only two Binary_Heap_t of the same node-based mode can be merged.");
+#endif
+        return 1;
+    }
+
+    if ( Dst->KeyCompareFunc != Src->KeyCompareFunc ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Binary_Heap_t with different KeyCompareFuncs cannot be merged.");
+#endif
+        return 1;
+    }
+
+    if ( Binary_Heap_IsEmpty(Src) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: Src Binary_Heap_t is empty, nothing to merge.");
+#endif
+        return 0;
+    }
+
+    if ( Binary_Heap_Mode_Pairing == Src->Mode ) {
+        NewPool = Pool_Create(sizeof(Binary_Heap_PairingNode_t));
+    } else {
+        NewPool = Pool_Create(sizeof(Binary_Heap_Node_t));
+    }
+    if ( NULL == NewPool ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to create replacement Node Pool_t for Src.");
+#endif
+        return 1;
+    }
+
+    /* Reserve everything which could fail up front, so a failure leaves both Heaps untouched. */
+    if ( ((Binary_Heap_Mode_Pairing != Dst->Mode) &&
+          (0 != Array_Grow(Dst->Items, Array_Length(Src->Items)))) ||
+         (0 != Binary_Heap_adoptPools(Dst, Src, NewPool)) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to make room in Dst for the items of Src.");
+#endif
+        Pool_Release(NewPool);
+        return 1;
+    }
+
+    Binary_Heap_invalidate(Dst);
+    Binary_Heap_invalidate(Src);
+
+    if ( Binary_Heap_Mode_Pairing == Dst->Mode ) {
+        Dst->Root = Binary_Heap_pairingMeld(Dst, Dst->Root, Src->Root);
+        Dst->Count += Src->Count;
+        Src->Root  = NULL;
+        Src->Count = 0;
+    } else if ( 0 != Binary_Heap_mergeNodes(Dst, Src) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to restore Heap property after merging Nodes.");
+#endif
+        return 1;
+    }
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully merged Src into Dst Binary_Heap_t.");
 #endif
     return 0;
 }
@@ -266,6 +592,8 @@ Binary_Heap_KeyValuePair_t Binary_Heap_Next(Binary_Heap_t *Heap) {
 
     Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
     Binary_Heap_Node_t *       Node         = NULL;
+    Binary_Heap_Slot_t *       Slot         = NULL;
+    Binary_Heap_PairingNode_t *Pairing      = NULL;
 
     if ( NULL == Heap ) {
 #ifdef DEBUG
@@ -274,6 +602,22 @@ Binary_Heap_KeyValuePair_t Binary_Heap_Next(Binary_Heap_t *Heap) {
         return KeyValuePair;
     }
 
+    if ( Binary_Heap_Mode_Inline == Heap->Mode ) {
+        Slot = Binary_Heap_inlineNext(Heap);
+        if ( NULL != Slot ) {
+            KeyValuePair.Key   = BINARY_HEAP_SLOT_KEY(Slot);
+            KeyValuePair.Value = Slot->Value;
+        }
+        return KeyValuePair;
+    } else if ( Binary_Heap_Mode_Pairing == Heap->Mode ) {
+        Pairing = Binary_Heap_pairingNext(Heap);
+        if ( NULL != Pairing ) {
+            KeyValuePair.Key   = Pairing->Node.Key;
+            KeyValuePair.Value = Pairing->Node.Value;
+        }
+        return KeyValuePair;
+    }
+
     Node = Array_Next(Heap->Items);
     if ( NULL == Node ) {
         if ( NULL == Heap->Items->Iterator ) {
@@ -325,7 +669,7 @@ int Binary_Heap_DoCallback(Binary_Heap_t *Heap, CallbackFunc_t *Callback) {
         }
     }
 
-    Iterator_Invalidate(&(Heap->Items->Iterator));
+    Binary_Heap_invalidate(Heap);
 
 #ifdef DEBUG
     DEBUG_PRINTF("%s", "Finished performing Callback on Binary_Heap_t items.");
@@ -361,7 +705,7 @@ int Binary_Heap_DoCallbackArg(Binary_Heap_t *Heap, CallbackArgFunc_t *Callback,
         }
     }
 
-    Iterator_Invalidate(&(Heap->Items->Iterator));
+    Binary_Heap_invalidate(Heap);
 
 #ifdef DEBUG
     DEBUG_PRINTF("%s", "Finished performing Callback on Binary_Heap_t items.");
@@ -378,7 +722,32 @@ int Binary_Heap_Clear(Binary_Heap_t *Heap) {
         return 1;
     }
 
+    if ( Binary_Heap_Mode_Inline == Heap->Mode ) {
+        Binary_Heap_inlineClear(Heap);
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Successfully cleared all contents from Binary_Heap_t.");
+#endif
+        return 0;
+    } else if ( Binary_Heap_Mode_Pairing == Heap->Mode ) {
+        Binary_Heap_pairingRelease(Heap->Root, false);
+        Heap->Root   = NULL;
+        Heap->Cursor = NULL;
+        Heap->Count  = 0;
+        Pool_Reset(Heap->NodePool);
+        Array_Clear(Heap->Pools);
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Successfully cleared all contents from Binary_Heap_t.");
+#endif
+        return 0;
+    }
+
     if ( 0 == Array_Clear(Heap->Items) ) {
+        /*
+            With every Node back in its Pool, the slabs can all be dropped at once,
+            along with any Pools taken over from merged Heaps, which are now unused.
+        */
+        Pool_Reset(Heap->NodePool);
+        Array_Clear(Heap->Pools);
 #ifdef DEBUG
         DEBUG_PRINTF("%s", "Successfully cleared all contents from Binary_Heap_t.");
 #endif
@@ -400,7 +769,22 @@ void Binary_Heap_Release(Binary_Heap_t *Heap) {
         return;
     }
 
-    Array_Release(Heap->Items);
+    if ( Binary_Heap_Mode_Inline == Heap->Mode ) {
+        Binary_Heap_inlineClear(Heap);
+        free(Heap->Slots);
+        free(Heap->Scratch);
+    } else if ( Binary_Heap_Mode_Pairing == Heap->Mode ) {
+        Binary_Heap_pairingRelease(Heap->Root, false);
+        Pool_Release(Heap->NodePool);
+    } else {
+        Array_Release(Heap->Items);
+        Pool_Release(Heap->NodePool);
+    }
+
+    /* Every Node has been returned by now, so the Pools taken over can be released. */
+    if ( NULL != Heap->Pools ) {
+        Array_Release(Heap->Pools);
+    }
 
     ZERO_CONTAINER(Heap, Binary_Heap_t);
     free(Heap);
@@ -413,10 +797,111 @@ void Binary_Heap_Release(Binary_Heap_t *Heap) {
 
 /* ++++++++++ Private Binary_Heap_t Functions ++++++++++ */
 
-int Binary_Heap_siftUp(Binary_Heap_t *Heap) {
+Binary_Heap_Node_t *Binary_Heap_pushNode(Binary_Heap_t *Heap, void *Key, size_t KeySize,
+                                         void *Value, size_t ValueSize,
+                                         ReleaseFunc_t *ValueReleaseFunc) {
+
+    Binary_Heap_Node_t *NewNode = NULL;
+
+    NewNode = Binary_Heap_Node_Create(Heap->NodePool, Key, Value, KeySize, ValueSize,
+                                      Heap->KeyReleaseFunc, ValueReleaseFunc);
+    if ( NULL == NewNode ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to create new Binary_Heap_Node_t.");
+#endif
+        return NULL;
+    }
+
+    NewNode->Index = Array_Length(Heap->Items);
+    if ( 0 != Array_Append(Heap->Items, &NewNode) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to add new item to Binary_Heap_t.");
+#endif
+        Binary_Heap_Node_Release(NewNode);
+        return NULL;
+    }
+
+    Binary_Heap_invalidate(Heap);
+
+    if ( 0 != Binary_Heap_siftUp(Heap, NewNode->Index) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Error occurred during Sift-Up process.");
+#endif
+        return NULL;
+    }
+
+    return NewNode;
+}
+
+void Binary_Heap_swapNodes(Binary_Heap_t *Heap, size_t A, size_t B) {
+
+    Array_swapItems(Heap->Items, A, B);
+
+    ((Binary_Heap_Node_t *)Heap->Items->Contents.ContentRefs[A])->Index = A;
+    ((Binary_Heap_Node_t *)Heap->Items->Contents.ContentRefs[B])->Index = B;
+
+    return;
+}
+
+int Binary_Heap_checkHandle(Binary_Heap_t *Heap, Binary_Heap_Handle_t *Handle) {
+
+    Binary_Heap_Node_t *Node = (Binary_Heap_Node_t *)Handle;
+
+    if ( (NULL == Heap) || (NULL == Node) ) {
+        return 1;
+    }
+
+    if ( Binary_Heap_Mode_Pairing == Heap->Mode ) {
+        return Binary_Heap_pairingCheckHandle(Heap, (Binary_Heap_PairingNode_t *)Handle);
+    } else if ( Binary_Heap_Mode_Nodes != Heap->Mode ) {
+        return 1;
+    }
+
+    /* A Handle is only valid while its Node still sits where it claims to. */
+    if ( (Node->Index >= Array_Length(Heap->Items)) ||
+         (Node != Heap->Items->Contents.ContentRefs[Node->Index]) ) {
+        return 1;
+    }
+
+    return 0;
+}
+
+int Binary_Heap_restore(Binary_Heap_t *Heap, size_t Index) {
+
+    Binary_Heap_Node_t *Node = Heap->Items->Contents.ContentRefs[Index];
+
+    if ( 0 != Binary_Heap_siftUp(Heap, Index) ) {
+        return 1;
+    }
+
+    if ( Index != Node->Index ) {
+        return 0;
+    }
+
+    return Binary_Heap_siftDown(Heap, Index);
+}
+
+void Binary_Heap_invalidate(Binary_Heap_t *Heap) {
+
+    if ( Binary_Heap_Mode_Inline == Heap->Mode ) {
+        Heap->NextSlot = 0;
+    } else if ( Binary_Heap_Mode_Pairing == Heap->Mode ) {
+        Heap->Cursor = NULL;
+    } else {
+        Iterator_Invalidate(&(Heap->Items->Iterator));
+    }
+
+    return;
+}
+
+int Binary_Heap_siftUp(Binary_Heap_t *Heap, size_t Index) {
 
     Binary_Heap_Node_t *Current = NULL, *Parent = NULL;
-    size_t              MinKeySize = 0, Index = 0;
+    size_t              MinKeySize = 0;
+
+    if ( Binary_Heap_Mode_MinMax == Heap->Mode ) {
+        return Binary_Heap_minMaxSiftUp(Heap, Index);
+    }
 
     if ( Binary_Heap_IsEmpty(Heap) ) {
 #ifdef DEBUG
@@ -425,8 +910,6 @@ int Binary_Heap_siftUp(Binary_Heap_t *Heap) {
         return 0;
     }
 
-    Index = Array_Length(Heap->Items) - 1;
-
     Current = Array_GetElement(Heap->Items, Index);
     if ( NULL == Current ) {
 #ifdef DEBUG
@@ -461,7 +944,7 @@ int Binary_Heap_siftUp(Binary_Heap_t *Heap) {
             ((Current->KeySize > Parent->KeySize) ? (Parent->KeySize) : (Current->KeySize));
 
         if ( Heap->KeyCompareFunc(Current->Key, Parent->Key, MinKeySize) > 0 ) {
-            Array_swapItems(Heap->Items, Index, PARENT_INDEX(Index));
+            Binary_Heap_swapNodes(Heap, Index, PARENT_INDEX(Index));
         } else {
             break;
         }
@@ -472,10 +955,14 @@ int Binary_Heap_siftUp(Binary_Heap_t *Heap) {
     return 0;
 }
 
-int Binary_Heap_siftDown(Binary_Heap_t *Heap) {
+int Binary_Heap_siftDown(Binary_Heap_t *Heap, size_t Index) {
 
     Binary_Heap_Node_t *Current = NULL, *LeftChild = NULL, *RightChild = NULL, *MaxChild = NULL;
-    size_t              Index = 0, ArrayLength = 0, MinKeyLength = 0, ChildIndex = 0;
+    size_t              ArrayLength = 0, MinKeyLength = 0, ChildIndex = 0;
+
+    if ( Binary_Heap_Mode_MinMax == Heap->Mode ) {
+        return Binary_Heap_minMaxSiftDown(Heap, Index);
+    }
 
     ArrayLength = Array_Length(Heap->Items);
 
@@ -539,7 +1026,7 @@ int Binary_Heap_siftDown(Binary_Heap_t *Heap) {
         MinKeyLength =
             ((MaxChild->KeySize > Current->KeySize) ? (Current->KeySize) : (MaxChild->KeySize));
         if ( Heap->KeyCompareFunc(Current->Key, MaxChild->Key, MinKeyLength) < 0 ) {
-            Array_swapItems(Heap->Items, Index, ChildIndex);
+            Binary_Heap_swapNodes(Heap, Index, ChildIndex);
         } else {
             break;
         }
@@ -553,4 +1040,138 @@ int Binary_Heap_siftDown(Binary_Heap_t *Heap) {
     return 0;
 }
 
+int Binary_Heap_pushNodes(Binary_Heap_t *Heap, uint8_t *Keys, size_t KeySize, uint8_t *Values,
+                          size_t ValueSize, size_t Count, ReleaseFunc_t *ValueReleaseFunc) {
+
+    Binary_Heap_Node_t *Node  = NULL;
+    void *              Value = NULL;
+    size_t              Start = 0, Index = 0;
+
+    Start = Array_Length(Heap->Items);
+    if ( 0 != Array_Grow(Heap->Items, Count) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to grow Binary_Heap_t to hold the new items.");
+#endif
+        return 1;
+    }
+
+    for ( Index = 0; Index < Count; Index++ ) {
+        if ( 0 == ValueSize ) {
+            Value = (NULL == Values) ? NULL : ((void **)Values)[Index];
+        } else {
+            Value = Values + (Index * ValueSize);
+        }
+
+        Node = Binary_Heap_Node_Create(Heap->NodePool, Keys + (Index * KeySize), Value, KeySize,
+                                       ValueSize, Heap->KeyReleaseFunc, ValueReleaseFunc);
+        if ( NULL != Node ) {
+            Node->Index = Start + Index;
+            if ( 0 == Array_Append(Heap->Items, &Node) ) {
+                continue;
+            }
+        }
+
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to add new Node to Binary_Heap_t.");
+#endif
+        /* Undo every Node added so far, leaving any Values held by reference to the caller. */
+        if ( NULL != Node ) {
+            Node->ValueReleaseFunc = (0 == ValueSize) ? NULL : Node->ValueReleaseFunc;
+            Binary_Heap_Node_Release(Node);
+        }
+        while ( Array_Length(Heap->Items) > Start ) {
+            Node = Array_PopElement(Heap->Items, Array_Length(Heap->Items) - 1);
+            Node->ValueReleaseFunc = (0 == ValueSize) ? NULL : Node->ValueReleaseFunc;
+            Binary_Heap_Node_Release(Node);
+        }
+        return 1;
+    }
+
+    return Binary_Heap_heapify(Heap, Start);
+}
+
+int Binary_Heap_heapify(Binary_Heap_t *Heap, size_t Start) {
+
+    size_t Index = 0;
+
+    /*
+        A batch at least as large as the Heap already is gets Floyd's bottom-up construction,
+        sifting down every Parent from the last one back to the Root. This costs O(n) in total,
+        as most Nodes sit near the bottom and have only a short way to fall.
+    */
+    if ( (Array_Length(Heap->Items) - Start) >= Start ) {
+        for ( Index = Array_Length(Heap->Items) / 2; Index > 0; Index-- ) {
+            if ( 0 != Binary_Heap_siftDown(Heap, Index - 1) ) {
+                return 1;
+            }
+        }
+    } else {
+        for ( Index = Start; Index < Array_Length(Heap->Items); Index++ ) {
+            if ( 0 != Binary_Heap_siftUp(Heap, Index) ) {
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+int Binary_Heap_adoptPools(Binary_Heap_t *Dst, Binary_Heap_t *Src, Pool_t *NewPool) {
+
+    Pool_t *Pool    = NULL;
+    size_t  Adopted = 1;
+
+    if ( NULL != Src->Pools ) {
+        Adopted += Array_Length(Src->Pools);
+    }
+
+    if ( NULL == Dst->Pools ) {
+        Dst->Pools = Array_RefCreate(Adopted, (ReleaseFunc_t *)Pool_Release);
+        if ( NULL == Dst->Pools ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to create Array_t to hold merged Node Pools.");
+#endif
+            return 1;
+        }
+    }
+
+    if ( 0 != Array_Grow(Dst->Pools, Adopted) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to grow Array_t of merged Node Pools.");
+#endif
+        return 1;
+    }
+
+    /* With room reserved, none of these Appends can fail. */
+    Array_Append(Dst->Pools, &(Src->NodePool));
+    while ( (NULL != Src->Pools) && (0 != Array_Length(Src->Pools)) ) {
+        Pool = Array_PopElement(Src->Pools, Array_Length(Src->Pools) - 1);
+        Array_Append(Dst->Pools, &Pool);
+    }
+
+    Src->NodePool = NewPool;
+
+    return 0;
+}
+
+int Binary_Heap_mergeNodes(Binary_Heap_t *Dst, Binary_Heap_t *Src) {
+
+    Binary_Heap_Node_t *Node  = NULL;
+    size_t              Start = 0, Index = 0;
+
+    Start = Array_Length(Dst->Items);
+    for ( Index = 0; Index < Array_Length(Src->Items); Index++ ) {
+        Node        = Src->Items->Contents.ContentRefs[Index];
+        Node->Index = Start + Index;
+        Array_Append(Dst->Items, &Node);
+    }
+
+    /* The Nodes now belong to Dst, so Src must let go of them without releasing them. */
+    Src->Items->ReleaseFunc = NULL;
+    Array_Clear(Src->Items);
+    Src->Items->ReleaseFunc = (ReleaseFunc_t *)Binary_Heap_Node_Release;
+
+    return Binary_Heap_heapify(Dst, Start);
+}
+
 /* ---------- Private Binary_Heap_t Functions ---------- */
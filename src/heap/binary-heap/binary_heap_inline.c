@@ -0,0 +1,356 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../logging/logging.h"
+#include "include/binary_heap.h"
+
+Binary_Heap_t *Binary_Heap_CreateInline(CompareFunc_t *KeyCompareFunc, size_t KeySize,
+                                        size_t Arity) {
+
+    Binary_Heap_t *Heap       = NULL;
+    size_t         ArityShift = 0;
+
+    if ( 0 == KeySize ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: An inline Binary_Heap_t requires a non-zero KeySize.");
+#endif
+        return NULL;
+    }
+
+    if ( 0 == Arity ) {
+        Arity = LIBCONTAINER_BINARY_HEAP_INLINE_ARITY;
+    }
+
+    for ( ArityShift = 1; ArityShift <= 4; ArityShift++ ) {
+        if ( Arity == ((size_t)1 << ArityShift) ) {
+            break;
+        }
+    }
+    if ( ArityShift > 4 ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Error: Arity (%lu) must be a power of two from 2 to 16.",
+                     (unsigned long)Arity);
+#endif
+        return NULL;
+    }
+
+    if ( NULL == KeyCompareFunc ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: NULL KeyCompareFunc* provided, defaulting to memcmp().");
+#endif
+        KeyCompareFunc = memcmp;
+    }
+
+    Heap = (Binary_Heap_t *)calloc(1, sizeof(Binary_Heap_t));
+    if ( NULL == Heap ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Binary_Heap_t.");
+#endif
+        return NULL;
+    }
+
+    /* Round each Slot up to a whole number of pointers, keeping every Slot aligned. */
+    Heap->SlotSize = sizeof(Binary_Heap_Slot_t) + KeySize;
+    Heap->SlotSize = (Heap->SlotSize + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+
+    Heap->Slots =
+        (uint8_t *)calloc(LIBCONTAINER_BINARY_HEAP_INLINE_CAPACITY, Heap->SlotSize);
+    Heap->Scratch = (uint8_t *)calloc(2, Heap->SlotSize);
+    if ( (NULL == Heap->Slots) || (NULL == Heap->Scratch) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate Slots for inline Binary_Heap_t.");
+#endif
+        free(Heap->Slots);
+        free(Heap->Scratch);
+        free(Heap);
+        return NULL;
+    }
+
+    Heap->Mode           = Binary_Heap_Mode_Inline;
+    Heap->KeyCompareFunc = KeyCompareFunc;
+    Heap->SlotCapacity   = LIBCONTAINER_BINARY_HEAP_INLINE_CAPACITY;
+    Heap->KeySize        = KeySize;
+    Heap->ArityShift     = ArityShift;
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully created and initialized new inline Binary_Heap_t.");
+#endif
+    return Heap;
+}
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+int Binary_Heap_inlinePush(Binary_Heap_t *Heap, void *Key, size_t KeySize, void *Value,
+                           size_t ValueSize, ReleaseFunc_t *ValueReleaseFunc) {
+
+    Binary_Heap_Slot_t *Slot          = NULL;
+    uint8_t *           Slots         = NULL;
+    void *              ValueContents = NULL;
+
+    if ( NULL == Key ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Key* provided.");
+#endif
+        return 1;
+    }
+
+    if ( KeySize != Heap->KeySize ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Error: KeySize (%lu) does not match the KeySize (%lu) of the Heap.",
+                     (unsigned long)KeySize, (unsigned long)Heap->KeySize);
+#endif
+        return 1;
+    }
+
+    if ( Heap->SlotCount == Heap->SlotCapacity ) {
+        Slots = (uint8_t *)realloc(Heap->Slots, 2 * Heap->SlotCapacity * Heap->SlotSize);
+        if ( NULL == Slots ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to grow Slots of inline Binary_Heap_t.");
+#endif
+            return 1;
+        }
+        Heap->Slots = Slots;
+        Heap->SlotCapacity *= 2;
+    }
+
+    if ( 0 == ValueSize ) {
+        ValueContents = Value;
+    } else {
+        ValueContents = calloc(ValueSize, sizeof(uint8_t));
+        if ( NULL == ValueContents ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Value within Slot.");
+#endif
+            return 1;
+        }
+        memcpy(ValueContents, Value, ValueSize);
+    }
+
+    if ( NULL == ValueReleaseFunc ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: NULL ValueReleaseFunc* provided, defaulting to free().");
+#endif
+        ValueReleaseFunc = free;
+    }
+
+    Slot                   = BINARY_HEAP_SLOT(Heap, Heap->SlotCount);
+    Slot->Value            = ValueContents;
+    Slot->ValueReleaseFunc = ValueReleaseFunc;
+    memcpy(BINARY_HEAP_SLOT_KEY(Slot), Key, KeySize);
+
+    Heap->SlotCount++;
+    Binary_Heap_inlineSiftUp(Heap, Heap->SlotCount - 1);
+
+    return 0;
+}
+
+int Binary_Heap_inlinePushN(Binary_Heap_t *Heap, uint8_t *Keys, size_t KeySize, uint8_t *Values,
+                            size_t ValueSize, size_t Count, ReleaseFunc_t *ValueReleaseFunc) {
+
+    Binary_Heap_Slot_t *Slot     = NULL;
+    uint8_t *           Slots    = NULL;
+    size_t              Capacity = 0, Start = Heap->SlotCount, Index = 0;
+
+    if ( KeySize != Heap->KeySize ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Error: KeySize (%lu) does not match the KeySize (%lu) of the Heap.",
+                     (unsigned long)KeySize, (unsigned long)Heap->KeySize);
+#endif
+        return 1;
+    }
+
+    for ( Capacity = Heap->SlotCapacity; Capacity < Start + Count; Capacity *= 2 ) { ; }
+    if ( Capacity != Heap->SlotCapacity ) {
+        Slots = (uint8_t *)realloc(Heap->Slots, Capacity * Heap->SlotSize);
+        if ( NULL == Slots ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to grow Slots of inline Binary_Heap_t.");
+#endif
+            return 1;
+        }
+        Heap->Slots        = Slots;
+        Heap->SlotCapacity = Capacity;
+    }
+
+    if ( NULL == ValueReleaseFunc ) {
+        ValueReleaseFunc = free;
+    }
+
+    for ( Index = 0; Index < Count; Index++ ) {
+        Slot                   = BINARY_HEAP_SLOT(Heap, Start + Index);
+        Slot->ValueReleaseFunc = ValueReleaseFunc;
+        memcpy(BINARY_HEAP_SLOT_KEY(Slot), Keys + (Index * KeySize), KeySize);
+
+        if ( 0 == ValueSize ) {
+            Slot->Value = (NULL == Values) ? NULL : ((void **)Values)[Index];
+            continue;
+        }
+
+        Slot->Value = calloc(ValueSize, sizeof(uint8_t));
+        if ( NULL == Slot->Value ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Value within Slot.");
+#endif
+            while ( Index-- > 0 ) {
+                free(BINARY_HEAP_SLOT(Heap, Start + Index)->Value);
+            }
+            return 1;
+        }
+        memcpy(Slot->Value, Values + (Index * ValueSize), ValueSize);
+    }
+
+    Heap->SlotCount += Count;
+
+    /* As with a node-based Heap, large batches are heapified bottom-up in O(n). */
+    if ( Count >= Start ) {
+        Index = (Heap->SlotCount > 1) ? (((Heap->SlotCount - 2) >> Heap->ArityShift) + 1) : 0;
+        for ( ; Index > 0; Index-- ) {
+            Binary_Heap_inlineSiftDown(Heap, Index - 1);
+        }
+    } else {
+        for ( Index = Start; Index < Heap->SlotCount; Index++ ) {
+            Binary_Heap_inlineSiftUp(Heap, Index);
+        }
+    }
+
+    return 0;
+}
+
+Binary_Heap_Slot_t *Binary_Heap_inlinePop(Binary_Heap_t *Heap) {
+
+    Binary_Heap_Slot_t *Popped = (Binary_Heap_Slot_t *)(Heap->Scratch + Heap->SlotSize);
+
+    if ( 0 == Heap->SlotCount ) {
+        return NULL;
+    }
+
+    memcpy(Popped, Heap->Slots, Heap->SlotSize);
+
+    Heap->SlotCount--;
+    if ( 0 != Heap->SlotCount ) {
+        memcpy(Heap->Slots, BINARY_HEAP_SLOT(Heap, Heap->SlotCount), Heap->SlotSize);
+        Binary_Heap_inlineSiftDown(Heap, 0);
+    }
+
+    return Popped;
+}
+
+Binary_Heap_Slot_t *Binary_Heap_inlineNext(Binary_Heap_t *Heap) {
+
+    if ( Heap->NextSlot >= Heap->SlotCount ) {
+        Heap->NextSlot = 0;
+        return NULL;
+    }
+
+    return BINARY_HEAP_SLOT(Heap, Heap->NextSlot++);
+}
+
+void Binary_Heap_inlineClear(Binary_Heap_t *Heap) {
+
+    Binary_Heap_Slot_t *Slot  = NULL;
+    size_t              Index = 0;
+
+    for ( Index = 0; Index < Heap->SlotCount; Index++ ) {
+        Slot = BINARY_HEAP_SLOT(Heap, Index);
+        if ( (NULL != Slot->Value) && (NULL != Slot->ValueReleaseFunc) ) {
+            Slot->ValueReleaseFunc(Slot->Value);
+        }
+    }
+
+    Heap->SlotCount = 0;
+    Heap->NextSlot  = 0;
+
+    return;
+}
+
+void Binary_Heap_inlineSiftUp(Binary_Heap_t *Heap, size_t Index) {
+
+    uint8_t *Hole   = Heap->Scratch;
+    size_t   Parent = 0;
+
+    memcpy(Hole, BINARY_HEAP_SLOT(Heap, Index), Heap->SlotSize);
+
+    while ( Index > 0 ) {
+        Parent = (Index - 1) >> Heap->ArityShift;
+        if ( Heap->KeyCompareFunc(BINARY_HEAP_SLOT_KEY(Hole),
+                                  BINARY_HEAP_SLOT_KEY(BINARY_HEAP_SLOT(Heap, Parent)),
+                                  Heap->KeySize) <= 0 ) {
+            break;
+        }
+        memcpy(BINARY_HEAP_SLOT(Heap, Index), BINARY_HEAP_SLOT(Heap, Parent), Heap->SlotSize);
+        Index = Parent;
+    }
+
+    memcpy(BINARY_HEAP_SLOT(Heap, Index), Hole, Heap->SlotSize);
+
+    return;
+}
+
+void Binary_Heap_inlineSiftDown(Binary_Heap_t *Heap, size_t Index) {
+
+    uint8_t *Hole  = Heap->Scratch;
+    size_t   Child = 0, Last = 0, Best = 0;
+
+    memcpy(Hole, BINARY_HEAP_SLOT(Heap, Index), Heap->SlotSize);
+
+    for ( ;; ) {
+        Child = (Index << Heap->ArityShift) + 1;
+        if ( Child >= Heap->SlotCount ) {
+            break;
+        }
+
+        Last = Child + ((size_t)1 << Heap->ArityShift);
+        if ( Last > Heap->SlotCount ) {
+            Last = Heap->SlotCount;
+        }
+
+        /* The children of a Slot are contiguous, so scanning them walks a single run of memory. */
+        for ( Best = Child++; Child < Last; Child++ ) {
+            if ( Heap->KeyCompareFunc(BINARY_HEAP_SLOT_KEY(BINARY_HEAP_SLOT(Heap, Child)),
+                                      BINARY_HEAP_SLOT_KEY(BINARY_HEAP_SLOT(Heap, Best)),
+                                      Heap->KeySize) > 0 ) {
+                Best = Child;
+            }
+        }
+
+        if ( Heap->KeyCompareFunc(BINARY_HEAP_SLOT_KEY(Hole),
+                                  BINARY_HEAP_SLOT_KEY(BINARY_HEAP_SLOT(Heap, Best)),
+                                  Heap->KeySize) >= 0 ) {
+            break;
+        }
+
+        memcpy(BINARY_HEAP_SLOT(Heap, Index), BINARY_HEAP_SLOT(Heap, Best), Heap->SlotSize);
+        Index = Best;
+    }
+
+    memcpy(BINARY_HEAP_SLOT(Heap, Index), Hole, Heap->SlotSize);
+
+    return;
+}
+
+/* ---------- Private Functions ---------- */
@@ -0,0 +1,277 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../logging/logging.h"
+#include "include/binary_heap.h"
+
+static int InlineCountCallback(void *KeyValuePair, void *Args) {
+
+    Binary_Heap_KeyValuePair_t *Pair = (Binary_Heap_KeyValuePair_t *)KeyValuePair;
+
+    /* Every Value holds a copy of its own Key. */
+    if ( *(int *)Pair->Key != *(int *)Pair->Value ) {
+        return 1;
+    }
+
+    (*(size_t *)Args)++;
+    return 0;
+}
+
+int Test_binary_heap_inline(void) {
+
+    int FailedTests = 0;
+
+    FailedTests += Test_Binary_Heap_Inline_Create();
+    FailedTests += Test_Binary_Heap_Inline_Order();
+    FailedTests += Test_Binary_Heap_Inline_PushN();
+    FailedTests += Test_Binary_Heap_Inline_Iterate();
+
+    return FailedTests;
+}
+
+int Test_Binary_Heap_Inline_Create(void) {
+
+    Binary_Heap_t *Heap          = NULL;
+    size_t         BadArities[]  = {1, 3, 6, 32};
+    size_t         GoodArities[] = {0, 2, 4, 8, 16};
+    size_t         i             = 0;
+
+    if ( NULL != (Heap = Binary_Heap_CreateInline(CompareFunc_Int_Ascending, 0, 4)) ) {
+        TEST_PRINTF("%s", "Test Failure - Created an inline Binary_Heap_t with a KeySize of 0.");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < sizeof(BadArities) / sizeof(BadArities[0]); i++ ) {
+        Heap = Binary_Heap_CreateInline(CompareFunc_Int_Ascending, sizeof(int), BadArities[i]);
+        if ( NULL != Heap ) {
+            TEST_PRINTF("Test Failure - Created an inline Binary_Heap_t with Arity (%lu).",
+                        (unsigned long)BadArities[i]);
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( i = 0; i < sizeof(GoodArities) / sizeof(GoodArities[0]); i++ ) {
+        Heap = Binary_Heap_CreateInline(CompareFunc_Int_Ascending, sizeof(int), GoodArities[i]);
+        if ( (NULL == Heap) || (!Binary_Heap_IsEmpty(Heap)) ) {
+            TEST_PRINTF("Test Failure - Failed to create inline Binary_Heap_t with Arity (%lu).",
+                        (unsigned long)GoodArities[i]);
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+        Binary_Heap_Release(Heap);
+    }
+
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Heap_Inline_Order(void) {
+
+    Binary_Heap_t *            Heap         = NULL;
+    Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    size_t                     Arities[]    = {2, 4, 8, 16};
+    size_t                     a = 0, Count = 1000;
+    int                        i = 0, Key = 0, Previous = 0;
+    short                      WrongSize = 0;
+
+    for ( a = 0; a < sizeof(Arities) / sizeof(Arities[0]); a++ ) {
+
+        Heap = Binary_Heap_CreateInline(CompareFunc_Int_Ascending, sizeof(int), Arities[a]);
+        if ( NULL == Heap ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to create inline Binary_Heap_t for testing.");
+            TEST_FAILURE;
+        }
+
+        if ( 0 == Binary_Heap_Push(Heap, &WrongSize, sizeof(WrongSize), NULL, 0, NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Pushed a Key of the wrong size onto inline Heap.");
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+
+        /* Plenty of duplicates, and enough items to grow the Slots several times. */
+        for ( i = 0; i < (int)Count; i++ ) {
+            Key = (i * 7919) % 397;
+            if ( 0 != Binary_Heap_Push(Heap, &Key, sizeof(Key), &Key, sizeof(Key), NULL) ) {
+                TEST_PRINTF("Test Failure - Failed to push Key (%d) onto inline Heap.", Key);
+                Binary_Heap_Release(Heap);
+                TEST_FAILURE;
+            }
+        }
+
+        if ( Count != Binary_Heap_Length(Heap) ) {
+            TEST_PRINTF("Test Failure - Inline Heap Length (%lu) not equal to expectation (%lu).",
+                        (unsigned long)Binary_Heap_Length(Heap), (unsigned long)Count);
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+
+        /* Pop half the items, checking each against the last, then Remove the rest. */
+        for ( i = 0; i < (int)Count / 2; i++ ) {
+            if ( *(int *)Binary_Heap_Peek(Heap).Key != *(int *)Binary_Heap_Peek(Heap).Value ) {
+                TEST_PRINTF("%s", "Test Failure - Peeked Key and Value do not match.");
+                Binary_Heap_Release(Heap);
+                TEST_FAILURE;
+            }
+
+            KeyValuePair = Binary_Heap_Pop(Heap);
+            if ( (NULL == KeyValuePair.Key) ||
+                 (*(int *)KeyValuePair.Key != *(int *)KeyValuePair.Value) ) {
+                TEST_PRINTF("%s", "Test Failure - Popped Key and Value do not match.");
+                free(KeyValuePair.Value);
+                Binary_Heap_Release(Heap);
+                TEST_FAILURE;
+            }
+
+            if ( (0 != i) &&
+                 (CompareFunc_Int_Ascending(&Previous, KeyValuePair.Key, sizeof(int)) < 0) ) {
+                TEST_PRINTF("Test Failure - Popped Key (%d) out of order after Key (%d).",
+                            *(int *)KeyValuePair.Key, Previous);
+                free(KeyValuePair.Value);
+                Binary_Heap_Release(Heap);
+                TEST_FAILURE;
+            }
+
+            Previous = *(int *)KeyValuePair.Key;
+            free(KeyValuePair.Value);
+        }
+
+        while ( !Binary_Heap_IsEmpty(Heap) ) {
+            Binary_Heap_Remove(Heap);
+        }
+
+        if ( NULL != Binary_Heap_Pop(Heap).Key ) {
+            TEST_PRINTF("%s", "Test Failure - Popped an item from an empty inline Heap.");
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+
+        Binary_Heap_Release(Heap);
+    }
+
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Heap_Inline_PushN(void) {
+
+    Binary_Heap_t *            Heap         = NULL;
+    Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    size_t                     Arities[]    = {2, 4, 8, 16};
+    size_t                     a            = 0;
+    int                        Keys[300], *Values[300], i = 0, Previous = 0;
+
+    for ( i = 0; i < 300; i++ ) {
+        Keys[i]   = (i * 7919) % 101;
+        Values[i] = &Keys[i];
+    }
+
+    for ( a = 0; a < sizeof(Arities) / sizeof(Arities[0]); a++ ) {
+
+        Heap = Binary_Heap_CreateInline(CompareFunc_Int_Descending, sizeof(int), Arities[a]);
+        if ( NULL == Heap ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to create inline Binary_Heap_t for testing.");
+            TEST_FAILURE;
+        }
+
+        /* A large batch heapified from empty, followed by a small batch sifted up. */
+        if ( (0 != Binary_Heap_PushN(Heap, Keys, sizeof(int), Values, 0, 250, NULL)) ||
+             (0 != Binary_Heap_PushN(Heap, &Keys[250], sizeof(int), &Values[250], 0, 50, NULL)) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to push batches onto inline Heap.");
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+
+        for ( i = 0; i < 300; i++ ) {
+            KeyValuePair = Binary_Heap_Pop(Heap);
+            if ( (NULL == KeyValuePair.Key) ||
+                 (*(int *)KeyValuePair.Key != *(int *)KeyValuePair.Value) ||
+                 ((0 != i) && (*(int *)KeyValuePair.Key < Previous)) ) {
+                TEST_PRINTF("Test Failure - Batched inline Heap popped item (%d) out of order.", i);
+                Binary_Heap_Release(Heap);
+                TEST_FAILURE;
+            }
+            Previous = *(int *)KeyValuePair.Key;
+        }
+
+        Binary_Heap_Release(Heap);
+    }
+
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Heap_Inline_Iterate(void) {
+
+    Binary_Heap_t *            Heap         = NULL;
+    Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    size_t                     Count = 100, Visited = 0;
+    int                        i = 0;
+
+    Heap = Binary_Heap_CreateInline(CompareFunc_Int_Descending, sizeof(int), 0);
+    if ( NULL == Heap ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create inline Binary_Heap_t for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < (int)Count; i++ ) {
+        Binary_Heap_Push(Heap, &i, sizeof(i), &i, sizeof(i), NULL);
+    }
+
+    BINARY_HEAP_FOREACH(Heap, KeyValuePair) { Visited++; }
+
+    if ( Count != Visited ) {
+        TEST_PRINTF("Test Failure - Iteration visited (%lu) of (%lu) items.",
+                    (unsigned long)Visited, (unsigned long)Count);
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    Visited = 0;
+    if ( (0 != Binary_Heap_DoCallbackArg(Heap, InlineCountCallback, &Visited)) ||
+         (Count != Visited) ) {
+        TEST_PRINTF("Test Failure - Callback visited (%lu) of (%lu) items.",
+                    (unsigned long)Visited, (unsigned long)Count);
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    if ( (0 != Binary_Heap_Clear(Heap)) || (!Binary_Heap_IsEmpty(Heap)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to Clear inline Heap.");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    /* The Heap remains usable after a Clear. */
+    if ( (0 != Binary_Heap_Push(Heap, &i, sizeof(i), &i, sizeof(i), NULL)) ||
+         (i != *(int *)Binary_Heap_Peek(Heap).Key) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to reuse inline Heap after Clear.");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    Binary_Heap_Release(Heap);
+    TEST_SUCCESSFUL;
+}
@@ -0,0 +1,293 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../logging/logging.h"
+#include "include/binary_heap.h"
+
+Binary_Heap_t *Binary_Heap_CreateMinMax(CompareFunc_t *KeyCompareFunc,
+                                        ReleaseFunc_t *KeyReleaseFunc) {
+
+    Binary_Heap_t *Heap = NULL;
+
+    Heap = Binary_Heap_Create(KeyCompareFunc, KeyReleaseFunc);
+    if ( NULL == Heap ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to create underlying Binary_Heap_t.");
+#endif
+        return NULL;
+    }
+
+    Heap->Mode = Binary_Heap_Mode_MinMax;
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully created and initialized new min-max Binary_Heap_t.");
+#endif
+    return Heap;
+}
+
+Binary_Heap_KeyValuePair_t Binary_Heap_PeekMax(Binary_Heap_t *Heap) {
+    return Binary_Heap_Peek(Heap);
+}
+
+Binary_Heap_KeyValuePair_t Binary_Heap_PopMax(Binary_Heap_t *Heap) {
+    return Binary_Heap_Pop(Heap);
+}
+
+Binary_Heap_KeyValuePair_t Binary_Heap_PeekMin(Binary_Heap_t *Heap) {
+
+    Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    Binary_Heap_Node_t *       Node         = NULL;
+
+    if ( NULL == Heap ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Heap* provided.");
+#endif
+        return KeyValuePair;
+    }
+
+    if ( Binary_Heap_Mode_MinMax != Heap->Mode ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s",
+                     "Error: The lowest item is only available from a min-max Binary_Heap_t.");
+#endif
+        return KeyValuePair;
+    }
+
+    if ( Binary_Heap_IsEmpty(Heap) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Warning: Binary_Heap_t is empty.");
+#endif
+        return KeyValuePair;
+    }
+
+    Node               = Heap->Items->Contents.ContentRefs[Binary_Heap_minIndex(Heap)];
+    KeyValuePair.Key   = Node->Key;
+    KeyValuePair.Value = Node->Value;
+
+    return KeyValuePair;
+}
+
+Binary_Heap_KeyValuePair_t Binary_Heap_PopMin(Binary_Heap_t *Heap) {
+
+    Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    Binary_Heap_Node_t *       Node         = NULL;
+    size_t                     Index = 0, Last = 0;
+
+    if ( NULL == Heap ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Heap* provided.");
+#endif
+        return KeyValuePair;
+    }
+
+    if ( Binary_Heap_Mode_MinMax != Heap->Mode ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s",
+                     "Error: The lowest item is only available from a min-max Binary_Heap_t.");
+#endif
+        return KeyValuePair;
+    }
+
+    if ( Binary_Heap_IsEmpty(Heap) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Warning: Binary_Heap_t is empty.");
+#endif
+        return KeyValuePair;
+    }
+
+    Index = Binary_Heap_minIndex(Heap);
+    Last  = Array_Length(Heap->Items) - 1;
+
+    Binary_Heap_swapNodes(Heap, Index, Last);
+    Node = Array_PopElement(Heap->Items, Last);
+    if ( NULL == Node ) {
+        /* We have to swap the items back, so we don't leave the heap in an invalid state. */
+        Binary_Heap_swapNodes(Heap, Index, Last);
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to remove item from Binary_Heap_t.");
+#endif
+        return KeyValuePair;
+    }
+
+    Binary_Heap_invalidate(Heap);
+
+    KeyValuePair.Key   = Node->Key;
+    KeyValuePair.Value = Node->Value;
+
+    Node->KeyReleaseFunc   = NULL;
+    Node->ValueReleaseFunc = NULL;
+
+    Binary_Heap_Node_Release(Node);
+
+    /*
+        The last item now fills the gap on a min level. It came from this Heap, so it can
+        never outrank the Root, and only has to be sifted down from here.
+    */
+    if ( (Index < Last) && (0 != Binary_Heap_minMaxSiftDown(Heap, Index)) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Error occurred during Sift-Down process.");
+#endif
+        return KeyValuePair;
+    }
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully removed lowest item from Binary_Heap_t.");
+#endif
+    return KeyValuePair;
+}
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+size_t Binary_Heap_minMaxDepth(size_t Index) {
+
+    size_t Depth = 0;
+
+    for ( Index += 1; Index > 1; Index >>= 1 ) {
+        Depth++;
+    }
+
+    return Depth;
+}
+
+int Binary_Heap_minMaxCompare(Binary_Heap_t *Heap, size_t A, size_t B) {
+
+    Binary_Heap_Node_t *NodeA = Heap->Items->Contents.ContentRefs[A];
+    Binary_Heap_Node_t *NodeB = Heap->Items->Contents.ContentRefs[B];
+    size_t              MinKeySize = 0;
+
+    MinKeySize = ((NodeA->KeySize > NodeB->KeySize) ? (NodeB->KeySize) : (NodeA->KeySize));
+
+    return Heap->KeyCompareFunc(NodeA->Key, NodeB->Key, MinKeySize);
+}
+
+int Binary_Heap_minMaxSiftUp(Binary_Heap_t *Heap, size_t Index) {
+
+    int Direction = 0;
+
+    if ( Index >= Array_Length(Heap->Items) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Sift-Up Index is out of bounds.");
+#endif
+        return 1;
+    }
+
+    if ( 0 == Index ) {
+        return 0;
+    }
+
+    /*
+        Direction is +1 while the Node belongs on the max levels, and -1 while it belongs on
+        the min levels. Comparisons are multiplied through by it, so one loop serves both.
+
+        A Node outranking its parent on a min level, or outranked by its parent on a max level,
+        has landed on the wrong kind of level and swaps with its parent first. From then on it
+        only ever moves two levels at a time, staying on the same kind of level.
+    */
+    Direction = BINARY_HEAP_IS_MAX_LEVEL(Index) ? 1 : -1;
+    if ( (Direction * Binary_Heap_minMaxCompare(Heap, Index, PARENT_INDEX(Index))) < 0 ) {
+        Binary_Heap_swapNodes(Heap, Index, PARENT_INDEX(Index));
+        Index     = PARENT_INDEX(Index);
+        Direction = -Direction;
+    }
+
+    while ( Index > 2 ) {
+        if ( (Direction * Binary_Heap_minMaxCompare(Heap, Index,
+                                                    PARENT_INDEX(PARENT_INDEX(Index)))) <= 0 ) {
+            break;
+        }
+
+        Binary_Heap_swapNodes(Heap, Index, PARENT_INDEX(PARENT_INDEX(Index)));
+        Index = PARENT_INDEX(PARENT_INDEX(Index));
+    }
+
+    return 0;
+}
+
+int Binary_Heap_minMaxSiftDown(Binary_Heap_t *Heap, size_t Index) {
+
+    size_t Length = 0, Best = 0, Candidate = 0, Last = 0;
+    int    Direction = 0;
+
+    Length = Array_Length(Heap->Items);
+    if ( Index >= Length ) {
+        return 0;
+    }
+
+    Direction = BINARY_HEAP_IS_MAX_LEVEL(Index) ? 1 : -1;
+
+    /*
+        The best of the children and grandchildren is the only item which can take this
+        position. If it is a grandchild the Node moves two levels down, and may then
+        have to trade places with its new parent which sits on the other kind of level.
+    */
+    while ( LEFT_CHILD_INDEX(Index) < Length ) {
+
+        Best = LEFT_CHILD_INDEX(Index);
+        if ( (RIGHT_CHILD_INDEX(Index) < Length) &&
+             ((Direction * Binary_Heap_minMaxCompare(Heap, RIGHT_CHILD_INDEX(Index), Best)) > 0) ) {
+            Best = RIGHT_CHILD_INDEX(Index);
+        }
+
+        Last = RIGHT_CHILD_INDEX(RIGHT_CHILD_INDEX(Index));
+        for ( Candidate = LEFT_CHILD_INDEX(LEFT_CHILD_INDEX(Index));
+              (Candidate <= Last) && (Candidate < Length); Candidate++ ) {
+            if ( (Direction * Binary_Heap_minMaxCompare(Heap, Candidate, Best)) > 0 ) {
+                Best = Candidate;
+            }
+        }
+
+        if ( (Direction * Binary_Heap_minMaxCompare(Heap, Best, Index)) <= 0 ) {
+            break;
+        }
+
+        Binary_Heap_swapNodes(Heap, Index, Best);
+        if ( Best <= RIGHT_CHILD_INDEX(Index) ) {
+            break;
+        }
+
+        if ( (Direction * Binary_Heap_minMaxCompare(Heap, Best, PARENT_INDEX(Best))) < 0 ) {
+            Binary_Heap_swapNodes(Heap, Best, PARENT_INDEX(Best));
+        }
+
+        Index = Best;
+    }
+
+    return 0;
+}
+
+size_t Binary_Heap_minIndex(Binary_Heap_t *Heap) {
+
+    size_t Length = Array_Length(Heap->Items);
+
+    if ( Length <= 2 ) {
+        return Length - 1;
+    }
+
+    return (Binary_Heap_minMaxCompare(Heap, 1, 2) <= 0) ? 1 : 2;
+}
+
+/* ---------- Private Functions ---------- */
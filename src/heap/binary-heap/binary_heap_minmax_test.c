@@ -0,0 +1,238 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../logging/logging.h"
+#include "include/binary_heap.h"
+
+static int CompareInts(const void *A, const void *B) {
+    return (*(const int *)A > *(const int *)B) - (*(const int *)A < *(const int *)B);
+}
+
+/*
+    Pops every item of the Heap, alternating between the lowest and the highest, and
+    checks each against Sorted, which must hold the Keys of the Heap in ascending order.
+    Returns 0 if every item matched, or 1 otherwise.
+*/
+static int DrainBothEnds(Binary_Heap_t *Heap, int *Sorted, size_t Count) {
+
+    Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    size_t                     Low = 0, High = Count;
+    int                        Expected = 0, Failed = 0;
+
+    while ( Low < High ) {
+        if ( 0 == ((Low + (Count - High)) % 2) ) {
+            Expected     = Sorted[Low++];
+            KeyValuePair = Binary_Heap_PopMin(Heap);
+        } else {
+            Expected     = Sorted[--High];
+            KeyValuePair = Binary_Heap_PopMax(Heap);
+        }
+        if ( (NULL == KeyValuePair.Key) || (Expected != *(int *)KeyValuePair.Key) ||
+             (Expected != *(int *)KeyValuePair.Value) ) {
+            Failed = 1;
+        }
+        free(KeyValuePair.Key);
+        free(KeyValuePair.Value);
+    }
+
+    return (Failed || !Binary_Heap_IsEmpty(Heap)) ? 1 : 0;
+}
+
+int Test_binary_heap_minmax(void) {
+
+    int FailedTests = 0;
+
+    FailedTests += Test_Binary_Heap_MinMax_Order();
+    FailedTests += Test_Binary_Heap_MinMax_PushN();
+    FailedTests += Test_Binary_Heap_MinMax_Invalid();
+
+    return FailedTests;
+}
+
+int Test_Binary_Heap_MinMax_Order(void) {
+
+    Binary_Heap_t *Heap = NULL;
+    int            Keys[1000], Key = 0, Low = 0, High = 0;
+    size_t         i = 0;
+
+    Heap = Binary_Heap_CreateMinMax(CompareFunc_Int_Ascending, NULL);
+    if ( NULL == Heap ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create min-max Binary_Heap_t for testing.");
+        TEST_FAILURE;
+    }
+
+    /* Plenty of duplicates, checking both ends after every Push. */
+    for ( i = 0; i < 1000; i++ ) {
+        Key     = (int)((i * 7919) % 397) - 200;
+        Keys[i] = Key;
+        Low     = ((0 == i) || (Key < Low)) ? Key : Low;
+        High    = ((0 == i) || (Key > High)) ? Key : High;
+        if ( 0 != Binary_Heap_Push(Heap, &Key, sizeof(Key), &Key, sizeof(Key), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to push Key (%d) onto min-max Heap.", Key);
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+        if ( (Low != *(int *)Binary_Heap_PeekMin(Heap).Key) ||
+             (High != *(int *)Binary_Heap_PeekMax(Heap).Key) ) {
+            TEST_PRINTF("Test Failure - Min-max Heap ends (%d, %d) not equal to expectation "
+                        "(%d, %d).",
+                        *(int *)Binary_Heap_PeekMin(Heap).Key,
+                        *(int *)Binary_Heap_PeekMax(Heap).Key, Low, High);
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+    }
+
+    qsort(Keys, 1000, sizeof(Keys[0]), CompareInts);
+
+    if ( 0 != DrainBothEnds(Heap, Keys, 1000) ) {
+        TEST_PRINTF("%s", "Test Failure - Min-max Heap popped items out of order.");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    if ( (NULL != Binary_Heap_PopMin(Heap).Key) || (NULL != Binary_Heap_PopMax(Heap).Key) ) {
+        TEST_PRINTF("%s", "Test Failure - Popped an item from an empty min-max Heap.");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    Binary_Heap_Release(Heap);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Heap_MinMax_PushN(void) {
+
+    Binary_Heap_t *Heap = NULL, *Src = NULL;
+    int            Keys[600], Sorted[600];
+    size_t         i = 0;
+
+    Heap = Binary_Heap_CreateMinMax(CompareFunc_Int_Ascending, NULL);
+    Src  = Binary_Heap_CreateMinMax(CompareFunc_Int_Ascending, NULL);
+    if ( (NULL == Heap) || (NULL == Src) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create min-max Binary_Heap_t for testing.");
+        Binary_Heap_Release(Heap);
+        Binary_Heap_Release(Src);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 600; i++ ) {
+        Keys[i]   = (int)((i * 104729) % 1009);
+        Sorted[i] = Keys[i];
+    }
+    qsort(Sorted, 600, sizeof(Sorted[0]), CompareInts);
+
+    /*
+        The first batch is built bottom-up, the second is sifted up item by item,
+        and the last arrives through Binary_Heap_Merge() from another min-max Heap.
+    */
+    if ( (0 != Binary_Heap_PushN(Heap, Keys, sizeof(int), Keys, sizeof(int), 400, NULL)) ||
+         (0 != Binary_Heap_PushN(Heap, Keys + 400, sizeof(int), Keys + 400, sizeof(int), 100,
+                                 NULL)) ||
+         (0 != Binary_Heap_PushN(Src, Keys + 500, sizeof(int), Keys + 500, sizeof(int), 100,
+                                 NULL)) ||
+         (0 != Binary_Heap_Merge(Heap, Src)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to add batches of items to min-max Heap.");
+        Binary_Heap_Release(Heap);
+        Binary_Heap_Release(Src);
+        TEST_FAILURE;
+    }
+
+    if ( (600 != Binary_Heap_Length(Heap)) || (!Binary_Heap_IsEmpty(Src)) ) {
+        TEST_PRINTF("Test Failure - Min-max Heap Length (%lu) not equal to expectation (600).",
+                    (unsigned long)Binary_Heap_Length(Heap));
+        Binary_Heap_Release(Heap);
+        Binary_Heap_Release(Src);
+        TEST_FAILURE;
+    }
+
+    if ( 0 != DrainBothEnds(Heap, Sorted, 600) ) {
+        TEST_PRINTF("%s", "Test Failure - Min-max Heap popped batched items out of order.");
+        Binary_Heap_Release(Heap);
+        Binary_Heap_Release(Src);
+        TEST_FAILURE;
+    }
+
+    Binary_Heap_Release(Heap);
+    Binary_Heap_Release(Src);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Heap_MinMax_Invalid(void) {
+
+    Binary_Heap_t *Heap = NULL, *MinMax = NULL;
+    int            Key = 3;
+
+    Heap   = Binary_Heap_Create(CompareFunc_Int_Ascending, NULL);
+    MinMax = Binary_Heap_CreateMinMax(CompareFunc_Int_Ascending, NULL);
+    if ( (NULL == Heap) || (NULL == MinMax) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Binary_Heap_t for testing.");
+        Binary_Heap_Release(Heap);
+        Binary_Heap_Release(MinMax);
+        TEST_FAILURE;
+    }
+
+    if ( (0 != Binary_Heap_Push(Heap, &Key, sizeof(Key), NULL, 0, NULL)) ||
+         (0 != Binary_Heap_Push(MinMax, &Key, sizeof(Key), NULL, 0, NULL)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to push Key onto Binary_Heap_t.");
+        Binary_Heap_Release(Heap);
+        Binary_Heap_Release(MinMax);
+        TEST_FAILURE;
+    }
+
+    /* Only the highest item is available from an ordinary Heap. */
+    if ( (NULL != Binary_Heap_PeekMin(Heap).Key) || (NULL != Binary_Heap_PopMin(Heap).Key) ||
+         (1 != Binary_Heap_Length(Heap)) ||
+         (Binary_Heap_PeekMax(Heap).Key != Binary_Heap_Peek(Heap).Key) ) {
+        TEST_PRINTF("%s", "Test Failure - Lowest item was available from an ordinary Heap.");
+        Binary_Heap_Release(Heap);
+        Binary_Heap_Release(MinMax);
+        TEST_FAILURE;
+    }
+
+    /* With a single item, both ends of a min-max Heap are the Root. */
+    if ( (Binary_Heap_PeekMin(MinMax).Key != Binary_Heap_PeekMax(MinMax).Key) ||
+         (NULL != Binary_Heap_PushHandle(MinMax, &Key, sizeof(Key), NULL, 0, NULL)) ||
+         (1 != Binary_Heap_Length(MinMax)) ) {
+        TEST_PRINTF("%s", "Test Failure - Single item min-max Heap did not behave as expected.");
+        Binary_Heap_Release(Heap);
+        Binary_Heap_Release(MinMax);
+        TEST_FAILURE;
+    }
+
+    /* Merging needs both Heaps to be of the same kind. */
+    if ( (0 == Binary_Heap_Merge(Heap, MinMax)) || (0 == Binary_Heap_Merge(MinMax, Heap)) ) {
+        TEST_PRINTF("%s", "Test Failure - Merged a min-max Heap with an ordinary Heap.");
+        Binary_Heap_Release(Heap);
+        Binary_Heap_Release(MinMax);
+        TEST_FAILURE;
+    }
+
+    Binary_Heap_Release(Heap);
+    Binary_Heap_Release(MinMax);
+    TEST_SUCCESSFUL;
+}
@@ -28,7 +28,7 @@
 #include "../../logging/logging.h"
 #include "include/binary_heap_node.h"
 
-Binary_Heap_Node_t *Binary_Heap_Node_Create(void *Key, void *Value, size_t KeySize,
+Binary_Heap_Node_t *Binary_Heap_Node_Create(Pool_t *Pool, void *Key, void *Value, size_t KeySize,
                                             size_t ValueSize, ReleaseFunc_t *KeyReleaseFunc,
                                             ReleaseFunc_t *ValueReleaseFunc) {
 
@@ -49,7 +49,11 @@ Binary_Heap_Node_t *Binary_Heap_Node_Create(void *Key, void *Value, size_t KeySi
         ValueReleaseFunc = free;
     }
 
-    Node = (Binary_Heap_Node_t *)calloc(1, sizeof(Binary_Heap_Node_t));
+    if ( NULL == Pool ) {
+        Node = (Binary_Heap_Node_t *)calloc(1, sizeof(Binary_Heap_Node_t));
+    } else {
+        Node = (Binary_Heap_Node_t *)Pool_Alloc(Pool);
+    }
     if ( NULL == Node ) {
 #ifdef DEBUG
         DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Binary_Heap_Node_t.");
@@ -66,7 +70,11 @@ Binary_Heap_Node_t *Binary_Heap_Node_Create(void *Key, void *Value, size_t KeySi
             DEBUG_PRINTF("%s",
                          "Error: Failed to allocate memory for Key within Binary_Heap_Node_t.");
 #endif
-            free(Node);
+            if ( NULL == Pool ) {
+                free(Node);
+            } else {
+                Pool_Free(Pool, Node);
+            }
             return NULL;
         }
         memcpy(KeyContents, Key, KeySize);
@@ -81,8 +89,14 @@ Binary_Heap_Node_t *Binary_Heap_Node_Create(void *Key, void *Value, size_t KeySi
             DEBUG_PRINTF("%s",
                          "Error: Failed to allocate memory for Value within Binary_Heap_Node_t.");
 #endif
-            free(Node);
-            free(KeyContents);
+            if ( 0 != KeySize ) {
+                free(KeyContents);
+            }
+            if ( NULL == Pool ) {
+                free(Node);
+            } else {
+                Pool_Free(Pool, Node);
+            }
             return NULL;
         }
         memcpy(ValueContents, Value, ValueSize);
@@ -96,6 +110,8 @@ Binary_Heap_Node_t *Binary_Heap_Node_Create(void *Key, void *Value, size_t KeySi
     Node->ValueSize        = ValueSize;
     Node->ValueReleaseFunc = ValueReleaseFunc;
 
+    Node->Pool = Pool;
+
 #ifdef DEBUG
     DEBUG_PRINTF("%s", "Successfully created and initialized Binary_Heap_Node_t.");
 #endif
@@ -192,6 +208,8 @@ int Binary_Heap_Node_UpdateValue(Binary_Heap_Node_t *Node, void *NewValue, size_
 
 void Binary_Heap_Node_Release(Binary_Heap_Node_t *Node) {
 
+    Pool_t *Pool = NULL;
+
     if ( NULL == Node ) {
 #ifdef DEBUG
         DEBUG_PRINTF("%s", "Note: NULL Node* provided, nothing to release.");
@@ -207,8 +225,13 @@ void Binary_Heap_Node_Release(Binary_Heap_Node_t *Node) {
         Node->ValueReleaseFunc(Node->Value);
     }
 
+    Pool = Node->Pool;
     ZERO_CONTAINER(Node, Binary_Heap_Node_t);
-    free(Node);
+    if ( NULL == Pool ) {
+        free(Node);
+    } else {
+        Pool_Free(Pool, Node);
+    }
 
 #ifdef DEBUG
     DEBUG_PRINTF("%s", "Successfully released Binary_Heap_Node_t.");
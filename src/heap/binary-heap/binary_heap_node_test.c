@@ -45,7 +45,7 @@ int Test_Binary_Heap_Node_Create(void) {
     int                 Key     = 0xBEEF;
     char                Value[] = "Testing Value";
 
-    Node = Binary_Heap_Node_Create(&Key, Value, sizeof(Key), strlen(Value), NULL, NULL);
+    Node = Binary_Heap_Node_Create(NULL, &Key, Value, sizeof(Key), strlen(Value), NULL, NULL);
     if ( NULL == Node ) {
         TEST_PRINTF("%s", "Test Failure - Failed to create Binary_Heap_Node_t for testing.");
         TEST_FAILURE;
@@ -61,7 +61,7 @@ int Test_Binary_Heap_Node_UpdateKey(void) {
     int                 Key = 0xBEEF, NewKey = 0xCAFE;
     char                Value[] = "Testing Value";
 
-    Node = Binary_Heap_Node_Create(&Key, Value, sizeof(Key), strlen(Value), NULL, NULL);
+    Node = Binary_Heap_Node_Create(NULL, &Key, Value, sizeof(Key), strlen(Value), NULL, NULL);
     if ( NULL == Node ) {
         TEST_PRINTF("%s", "Test Failure - Failed to create Binary_Heap_Node_t for testing.");
         TEST_FAILURE;
@@ -83,7 +83,7 @@ int Test_Binary_Heap_Node_UpdateValue(void) {
     int                 Key     = 0xBEEF;
     char                Value[] = "Testing Value", NewValue[] = "Updated Value";
 
-    Node = Binary_Heap_Node_Create(&Key, Value, sizeof(Key), strlen(Value), NULL, NULL);
+    Node = Binary_Heap_Node_Create(NULL, &Key, Value, sizeof(Key), strlen(Value), NULL, NULL);
     if ( NULL == Node ) {
         TEST_PRINTF("%s", "Test Failure - Failed to create Binary_Heap_Node_t for testing.");
         TEST_FAILURE;
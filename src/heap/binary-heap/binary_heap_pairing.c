@@ -0,0 +1,306 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../logging/logging.h"
+#include "include/binary_heap.h"
+
+Binary_Heap_t *Binary_Heap_CreateMeldable(CompareFunc_t *KeyCompareFunc,
+                                          ReleaseFunc_t *KeyReleaseFunc) {
+
+    Binary_Heap_t *Heap = NULL;
+
+    if ( NULL == KeyCompareFunc ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: NULL KeyCompareFunc* provided, defaulting to memcmp().");
+#endif
+        KeyCompareFunc = memcmp;
+    }
+
+    if ( NULL == KeyReleaseFunc ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: NULL KeyReleaseFunc* provided, defaulting to free().");
+#endif
+        KeyReleaseFunc = free;
+    }
+
+    Heap = (Binary_Heap_t *)calloc(1, sizeof(Binary_Heap_t));
+    if ( NULL == Heap ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Binary_Heap_t.");
+#endif
+        return NULL;
+    }
+
+    Heap->NodePool = Pool_Create(sizeof(Binary_Heap_PairingNode_t));
+    if ( NULL == Heap->NodePool ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to create Node Pool_t for Binary_Heap_t.");
+#endif
+        free(Heap);
+        return NULL;
+    }
+
+    Heap->Mode           = Binary_Heap_Mode_Pairing;
+    Heap->KeyCompareFunc = KeyCompareFunc;
+    Heap->KeyReleaseFunc = KeyReleaseFunc;
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully created and initialized new meldable Binary_Heap_t.");
+#endif
+    return Heap;
+}
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+Binary_Heap_PairingNode_t *Binary_Heap_pairingPush(Binary_Heap_t *Heap, void *Key, size_t KeySize,
+                                                   void *Value, size_t ValueSize,
+                                                   ReleaseFunc_t *ValueReleaseFunc) {
+
+    Binary_Heap_PairingNode_t *Node = NULL;
+
+    Node = (Binary_Heap_PairingNode_t *)Binary_Heap_Node_Create(
+        Heap->NodePool, Key, Value, KeySize, ValueSize, Heap->KeyReleaseFunc, ValueReleaseFunc);
+    if ( NULL == Node ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to create new Binary_Heap_PairingNode_t.");
+#endif
+        return NULL;
+    }
+
+    Heap->Root = Binary_Heap_pairingMeld(Heap, Heap->Root, Node);
+    Heap->Count++;
+
+    return Node;
+}
+
+int Binary_Heap_pairingPushN(Binary_Heap_t *Heap, uint8_t *Keys, size_t KeySize, uint8_t *Values,
+                             size_t ValueSize, size_t Count, ReleaseFunc_t *ValueReleaseFunc) {
+
+    Binary_Heap_PairingNode_t *Batch = NULL, *Node = NULL;
+    void *                     Value = NULL;
+    size_t                     Index = 0;
+
+    for ( Index = 0; Index < Count; Index++ ) {
+        if ( 0 == ValueSize ) {
+            Value = (NULL == Values) ? NULL : ((void **)Values)[Index];
+        } else {
+            Value = Values + (Index * ValueSize);
+        }
+
+        Node = (Binary_Heap_PairingNode_t *)Binary_Heap_Node_Create(
+            Heap->NodePool, Keys + (Index * KeySize), Value, KeySize, ValueSize,
+            Heap->KeyReleaseFunc, ValueReleaseFunc);
+        if ( NULL == Node ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to add new Node to Binary_Heap_t.");
+#endif
+            /* Undo every Node added so far, leaving any Values held by reference to the caller. */
+            Binary_Heap_pairingRelease(Batch, true);
+            return 1;
+        }
+
+        Batch = Binary_Heap_pairingMeld(Heap, Batch, Node);
+    }
+
+    Heap->Root = Binary_Heap_pairingMeld(Heap, Heap->Root, Batch);
+    Heap->Count += Count;
+
+    return 0;
+}
+
+void Binary_Heap_pairingDetach(Binary_Heap_t *Heap, Binary_Heap_PairingNode_t *Node) {
+
+    Binary_Heap_PairingNode_t *Children = NULL;
+
+    Children = Binary_Heap_pairingCombine(Heap, Node->Child);
+
+    if ( Node == Heap->Root ) {
+        Heap->Root = Children;
+    } else {
+        /* Unlink the Node from its Siblings, taking care of whether it is the first child. */
+        if ( Node == Node->Previous->Child ) {
+            Node->Previous->Child = Node->Sibling;
+        } else {
+            Node->Previous->Sibling = Node->Sibling;
+        }
+        if ( NULL != Node->Sibling ) {
+            Node->Sibling->Previous = Node->Previous;
+        }
+        Heap->Root = Binary_Heap_pairingMeld(Heap, Heap->Root, Children);
+    }
+
+    Node->Child    = NULL;
+    Node->Sibling  = NULL;
+    Node->Previous = NULL;
+    Heap->Count--;
+
+    return;
+}
+
+Binary_Heap_PairingNode_t *Binary_Heap_pairingMeld(Binary_Heap_t *Heap,
+                                                   Binary_Heap_PairingNode_t *A,
+                                                   Binary_Heap_PairingNode_t *B) {
+
+    Binary_Heap_PairingNode_t *Swap       = NULL;
+    size_t                     MinKeySize = 0;
+
+    if ( NULL == A ) {
+        return B;
+    } else if ( NULL == B ) {
+        return A;
+    }
+
+    MinKeySize = (A->Node.KeySize > B->Node.KeySize) ? (B->Node.KeySize) : (A->Node.KeySize);
+    if ( Heap->KeyCompareFunc(B->Node.Key, A->Node.Key, MinKeySize) > 0 ) {
+        Swap = A;
+        A    = B;
+        B    = Swap;
+    }
+
+    B->Sibling = A->Child;
+    if ( NULL != A->Child ) {
+        A->Child->Previous = B;
+    }
+    B->Previous = A;
+    A->Child    = B;
+
+    A->Sibling  = NULL;
+    A->Previous = NULL;
+
+    return A;
+}
+
+Binary_Heap_PairingNode_t *Binary_Heap_pairingCombine(Binary_Heap_t *Heap,
+                                                      Binary_Heap_PairingNode_t *First) {
+
+    Binary_Heap_PairingNode_t *Pairs = NULL, *Result = NULL, *A = NULL, *B = NULL, *Next = NULL;
+
+    /* First pass, melding neighbours left to right, collecting each pair onto a reversed list. */
+    while ( NULL != First ) {
+        A    = First;
+        B    = A->Sibling;
+        Next = (NULL == B) ? NULL : B->Sibling;
+
+        A->Sibling  = NULL;
+        A->Previous = NULL;
+        if ( NULL != B ) {
+            B->Sibling  = NULL;
+            B->Previous = NULL;
+        }
+
+        A          = Binary_Heap_pairingMeld(Heap, A, B);
+        A->Sibling = Pairs;
+        Pairs      = A;
+        First      = Next;
+    }
+
+    /* Second pass, melding each pair into the result, from the right-most pair back. */
+    while ( NULL != Pairs ) {
+        Next           = Pairs->Sibling;
+        Pairs->Sibling = NULL;
+        Result         = Binary_Heap_pairingMeld(Heap, Result, Pairs);
+        Pairs          = Next;
+    }
+
+    return Result;
+}
+
+Binary_Heap_PairingNode_t *Binary_Heap_pairingNext(Binary_Heap_t *Heap) {
+
+    Binary_Heap_PairingNode_t *Node = Heap->Cursor;
+
+    if ( NULL == Node ) {
+        Heap->Cursor = Heap->Root;
+        return Heap->Cursor;
+    }
+
+    if ( NULL != Node->Child ) {
+        Heap->Cursor = Node->Child;
+        return Heap->Cursor;
+    }
+
+    /* Climb until some ancestor has a Sibling still to visit, or the Root is passed. */
+    while ( NULL == Node->Sibling ) {
+        while ( (NULL != Node->Previous) && (Node == Node->Previous->Sibling) ) {
+            Node = Node->Previous;
+        }
+        Node = Node->Previous;
+        if ( NULL == Node ) {
+            Heap->Cursor = NULL;
+            return NULL;
+        }
+    }
+
+    Heap->Cursor = Node->Sibling;
+    return Heap->Cursor;
+}
+
+void Binary_Heap_pairingRelease(Binary_Heap_PairingNode_t *Root, bool KeepReferences) {
+
+    Binary_Heap_PairingNode_t *Node = Root, *Last = NULL, *Next = NULL;
+
+    /*
+        The children of each Node are spliced in after it before it is released, flattening
+        the Heap into one list as it goes, so every Node is reached without a stack.
+    */
+    while ( NULL != Node ) {
+        if ( NULL != Node->Child ) {
+            for ( Last = Node->Child; NULL != Last->Sibling; Last = Last->Sibling ) {
+                continue;
+            }
+            Last->Sibling = Node->Sibling;
+            Node->Sibling = Node->Child;
+        }
+
+        Next = Node->Sibling;
+
+        if ( (KeepReferences) && (0 == Node->Node.ValueSize) ) {
+            Node->Node.ValueReleaseFunc = NULL;
+        }
+
+        Node->Child    = NULL;
+        Node->Sibling  = NULL;
+        Node->Previous = NULL;
+        Binary_Heap_Node_Release(&(Node->Node));
+
+        Node = Next;
+    }
+
+    return;
+}
+
+int Binary_Heap_pairingCheckHandle(Binary_Heap_t *Heap, Binary_Heap_PairingNode_t *Node) {
+
+    /* Only the Root has no Previous, so any other Node without one has left the Heap. */
+    if ( (NULL == Node) || ((Node != Heap->Root) && (NULL == Node->Previous)) ) {
+        return 1;
+    }
+
+    return 0;
+}
+
+/* ---------- Private Functions ---------- */
@@ -0,0 +1,378 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../logging/logging.h"
+#include "include/binary_heap.h"
+
+static void ReleaseNothing(__attribute__((unused)) void *Value) {
+    return;
+}
+
+static int PairingCountCallback(void *KeyValuePair, void *Args) {
+
+    Binary_Heap_KeyValuePair_t *Pair = (Binary_Heap_KeyValuePair_t *)KeyValuePair;
+
+    /* Every Value holds a copy of its own Key. */
+    if ( *(int *)Pair->Key != *(int *)Pair->Value ) {
+        return 1;
+    }
+
+    (*(size_t *)Args)++;
+    return 0;
+}
+
+/*
+    Pops every item of the Heap, checking each Key matches its Value and that the Keys
+    come out in ascending order, as from a Heap ordered by CompareFunc_Int_Descending.
+    Returns the number of items popped, or -1 if any item was found out of order.
+*/
+static int DrainInOrder(Binary_Heap_t *Heap) {
+
+    Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    int                        Count = 0, Previous = 0, Failed = 0;
+
+    while ( !Binary_Heap_IsEmpty(Heap) ) {
+        KeyValuePair = Binary_Heap_Pop(Heap);
+        if ( (NULL == KeyValuePair.Key) ||
+             (*(int *)KeyValuePair.Key != *(int *)KeyValuePair.Value) ||
+             ((0 != Count) && (*(int *)KeyValuePair.Key < Previous)) ) {
+            Failed = 1;
+        }
+        if ( NULL != KeyValuePair.Key ) {
+            Previous = *(int *)KeyValuePair.Key;
+        }
+        free(KeyValuePair.Key);
+        free(KeyValuePair.Value);
+        Count++;
+    }
+
+    return (0 == Failed) ? Count : -1;
+}
+
+static void ReleaseHeaps(Binary_Heap_t *A, Binary_Heap_t *B, Binary_Heap_t *C) {
+    Binary_Heap_Release(A);
+    Binary_Heap_Release(B);
+    Binary_Heap_Release(C);
+}
+
+int Test_binary_heap_pairing(void) {
+
+    int FailedTests = 0;
+
+    FailedTests += Test_Binary_Heap_Pairing_Order();
+    FailedTests += Test_Binary_Heap_Pairing_Handles();
+    FailedTests += Test_Binary_Heap_Pairing_Iterate();
+    FailedTests += Test_Binary_Heap_Merge();
+
+    return FailedTests;
+}
+
+int Test_Binary_Heap_Pairing_Order(void) {
+
+    Binary_Heap_t *Heap = NULL;
+    int            Keys[300], *Values[300], i = 0, Key = 0;
+
+    Heap = Binary_Heap_CreateMeldable(CompareFunc_Int_Descending, NULL);
+    if ( NULL == Heap ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create meldable Binary_Heap_t for testing.");
+        TEST_FAILURE;
+    }
+
+    /* Plenty of duplicates, with a Remove now and then to force the Root to be re-paired. */
+    for ( i = 0; i < 1000; i++ ) {
+        Key = (i * 7919) % 397;
+        if ( 0 != Binary_Heap_Push(Heap, &Key, sizeof(Key), &Key, sizeof(Key), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to push Key (%d) onto meldable Heap.", Key);
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+        if ( (0 == (i % 10)) && (0 != Binary_Heap_Remove(Heap)) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to Remove Root of meldable Heap.");
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( (900 != Binary_Heap_Length(Heap)) ||
+         (*(int *)Binary_Heap_Peek(Heap).Key != *(int *)Binary_Heap_Peek(Heap).Value) ) {
+        TEST_PRINTF("Test Failure - Meldable Heap Length (%lu) not equal to expectation (900).",
+                    (unsigned long)Binary_Heap_Length(Heap));
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    if ( 900 != DrainInOrder(Heap) ) {
+        TEST_PRINTF("%s", "Test Failure - Meldable Heap popped items out of order.");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    if ( NULL != Binary_Heap_Pop(Heap).Key ) {
+        TEST_PRINTF("%s", "Test Failure - Popped an item from an empty meldable Heap.");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    /* Batches are paired up on their own before being melded in. */
+    for ( i = 0; i < 300; i++ ) {
+        Keys[i]   = (i * 7919) % 101;
+        Values[i] = &Keys[i];
+    }
+
+    if ( (0 != Binary_Heap_PushN(Heap, Keys, sizeof(int), Values, 0, 250, ReleaseNothing)) ||
+         (0 != Binary_Heap_PushN(Heap, &Keys[250], sizeof(int), &Values[250], 0, 50,
+                                 ReleaseNothing)) ||
+         (300 != Binary_Heap_Length(Heap)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to push batches onto meldable Heap.");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0, i = 0; i < 300; i++ ) {
+        if ( *(int *)Binary_Heap_Peek(Heap).Key < Key ) {
+            TEST_PRINTF("%s", "Test Failure - Batched meldable Heap popped items out of order.");
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+        Key = *(int *)Binary_Heap_Peek(Heap).Key;
+        Binary_Heap_Remove(Heap);
+    }
+
+    Binary_Heap_Release(Heap);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Heap_Pairing_Handles(void) {
+
+    Binary_Heap_t *       Heap = NULL;
+    Binary_Heap_Handle_t *Handles[200];
+    int                   Keys[200], Removed[200] = {0}, i = 0, Count = 0, Previous = 0;
+
+    Heap = Binary_Heap_CreateMeldable(CompareFunc_Int_Descending, NULL);
+    if ( NULL == Heap ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create meldable Binary_Heap_t for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 200; i++ ) {
+        Keys[i]    = (i * 37) % 101;
+        Handles[i] = Binary_Heap_PushHandle(Heap, &Keys[i], sizeof(int), &i, sizeof(i), NULL);
+        if ( NULL == Handles[i] ) {
+            TEST_PRINTF("Test Failure - Failed to push item (%d) with a Handle.", i);
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+    }
+
+    /* Mirroring the Keys moves some items towards the Root, and takes the Root itself away. */
+    for ( i = 0; i < 200; i += 3 ) {
+        Keys[i] = 100 - Keys[i];
+        if ( 0 != Binary_Heap_UpdateKey(Heap, Handles[i], &Keys[i], sizeof(int)) ) {
+            TEST_PRINTF("Test Failure - Failed to update Key of item (%d).", i);
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( i = 0; i < 200; i += 5 ) {
+        Removed[i] = 1;
+        if ( 0 != Binary_Heap_RemoveHandle(Heap, Handles[i]) ) {
+            TEST_PRINTF("Test Failure - Failed to remove item (%d) by Handle.", i);
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( 0 == Binary_Heap_RemoveHandle(Heap, Handles[0]) ) {
+        TEST_PRINTF("%s", "Test Failure - Removed an item by Handle twice.");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    if ( 160 != Binary_Heap_Length(Heap) ) {
+        TEST_PRINTF("Test Failure - Heap Length (%lu) not equal to expectation (160).",
+                    (unsigned long)Binary_Heap_Length(Heap));
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    while ( !Binary_Heap_IsEmpty(Heap) ) {
+        i = *(int *)Binary_Heap_Peek(Heap).Value;
+        if ( (Removed[i]) || (Keys[i] != *(int *)Binary_Heap_Peek(Heap).Key) ||
+             ((0 != Count) && (Keys[i] < Previous)) ) {
+            TEST_PRINTF("Test Failure - Item (%d) popped out of order after Handle updates.", i);
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+        Previous = Keys[i];
+        Binary_Heap_Remove(Heap);
+        Count++;
+    }
+
+    Binary_Heap_Release(Heap);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Heap_Pairing_Iterate(void) {
+
+    Binary_Heap_t *            Heap         = NULL;
+    Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    size_t                     Count = 100, Visited = 0;
+    int                        i = 0;
+
+    Heap = Binary_Heap_CreateMeldable(CompareFunc_Int_Descending, NULL);
+    if ( NULL == Heap ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create meldable Binary_Heap_t for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < (int)Count; i++ ) {
+        Binary_Heap_Push(Heap, &i, sizeof(i), &i, sizeof(i), NULL);
+    }
+
+    /* A Pop pairs up the children of the Root, giving the Heap some depth to walk. */
+    Binary_Heap_Remove(Heap);
+    Count--;
+
+    BINARY_HEAP_FOREACH(Heap, KeyValuePair) { Visited++; }
+
+    if ( Count != Visited ) {
+        TEST_PRINTF("Test Failure - Iteration visited (%lu) of (%lu) items.",
+                    (unsigned long)Visited, (unsigned long)Count);
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    Visited = 0;
+    if ( (0 != Binary_Heap_DoCallbackArg(Heap, PairingCountCallback, &Visited)) ||
+         (Count != Visited) ) {
+        TEST_PRINTF("Test Failure - Callback visited (%lu) of (%lu) items.",
+                    (unsigned long)Visited, (unsigned long)Count);
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    if ( (0 != Binary_Heap_Clear(Heap)) || (!Binary_Heap_IsEmpty(Heap)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to Clear meldable Heap.");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    /* The Heap remains usable after a Clear. */
+    if ( (0 != Binary_Heap_Push(Heap, &i, sizeof(i), &i, sizeof(i), NULL)) ||
+         (i != *(int *)Binary_Heap_Peek(Heap).Key) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to reuse meldable Heap after Clear.");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    Binary_Heap_Release(Heap);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Heap_Merge(void) {
+
+    Binary_Heap_t *       Dst = NULL, *Src = NULL, *Other = NULL;
+    Binary_Heap_Handle_t *Handle = NULL;
+    int                   Round = 0, i = 0, Key = 0, Moved = 0;
+
+    /* The same steps are run against a pair of meldable Heaps, and then a pair of node Heaps. */
+    for ( Round = 0; Round < 2; Round++ ) {
+
+        if ( 0 == Round ) {
+            Dst   = Binary_Heap_CreateMeldable(CompareFunc_Int_Descending, NULL);
+            Src   = Binary_Heap_CreateMeldable(CompareFunc_Int_Descending, NULL);
+            Other = Binary_Heap_Create(CompareFunc_Int_Descending, NULL);
+        } else {
+            Dst   = Binary_Heap_Create(CompareFunc_Int_Descending, NULL);
+            Src   = Binary_Heap_Create(CompareFunc_Int_Descending, NULL);
+            Other = Binary_Heap_CreateMeldable(CompareFunc_Int_Descending, NULL);
+        }
+        if ( (NULL == Dst) || (NULL == Src) || (NULL == Other) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to create Binary_Heap_t for testing.");
+            ReleaseHeaps(Dst, Src, Other);
+            TEST_FAILURE;
+        }
+
+        for ( i = 0; i < 500; i++ ) {
+            Key = (i * 7919) % 211;
+            Binary_Heap_Push(((i % 3) ? Dst : Src), &Key, sizeof(Key), &Key, sizeof(Key), NULL);
+        }
+        Key    = -1;
+        Handle = Binary_Heap_PushHandle(Src, &Key, sizeof(Key), &Key, sizeof(Key), NULL);
+        Moved  = (int)Binary_Heap_Length(Src);
+
+        Binary_Heap_Push(Other, &Key, sizeof(Key), &Key, sizeof(Key), NULL);
+        if ( (0 == Binary_Heap_Merge(Dst, Other)) || (0 == Binary_Heap_Merge(Dst, Dst)) ) {
+            TEST_PRINTF("%s", "Test Failure - Merged Binary_Heap_t which cannot be merged.");
+            ReleaseHeaps(Dst, Src, Other);
+            TEST_FAILURE;
+        }
+
+        if ( (0 != Binary_Heap_Merge(Dst, Src)) || (!Binary_Heap_IsEmpty(Src)) ||
+             (500 + 1 != Binary_Heap_Length(Dst)) ) {
+            TEST_PRINTF("Test Failure - Failed to merge (%d) items into Dst.", Moved);
+            ReleaseHeaps(Dst, Src, Other);
+            TEST_FAILURE;
+        }
+
+        /* The Handle follows its item into Dst, and Src carries on as an empty Heap. */
+        Key = -1000;
+        if ( (0 != Binary_Heap_UpdateKey(Dst, Handle, &Key, sizeof(Key))) ||
+             (-1000 != *(int *)Binary_Heap_Peek(Dst).Key) ) {
+            TEST_PRINTF("%s", "Test Failure - Handle was not carried across the merge.");
+            ReleaseHeaps(Dst, Src, Other);
+            TEST_FAILURE;
+        }
+        Binary_Heap_Remove(Dst);
+
+        for ( i = 0; i < 100; i++ ) {
+            Key = -1 - i;
+            Binary_Heap_Push(Src, &Key, sizeof(Key), &Key, sizeof(Key), NULL);
+        }
+        if ( (0 != Binary_Heap_Merge(Dst, Src)) || (600 != Binary_Heap_Length(Dst)) ||
+             (-100 != *(int *)Binary_Heap_Peek(Dst).Key) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to merge a reused Src into Dst.");
+            ReleaseHeaps(Dst, Src, Other);
+            TEST_FAILURE;
+        }
+
+        /* Src is released while Dst still holds Nodes which Src allocated. */
+        Binary_Heap_Release(Src);
+        Src = NULL;
+
+        if ( 600 != DrainInOrder(Dst) ) {
+            TEST_PRINTF("%s", "Test Failure - Merged Heap popped items out of order.");
+            ReleaseHeaps(Dst, Src, Other);
+            TEST_FAILURE;
+        }
+
+        ReleaseHeaps(Dst, NULL, Other);
+    }
+
+    TEST_SUCCESSFUL;
+}
@@ -97,6 +97,32 @@ __attribute__((unused)) static int Test_Binary_Heap_DoCallbackArgFunc(void *Valu
     return 0;
 }
 
+/*
+    Pops every item from a node-based Heap, ensuring the Keys arrive in ascending order
+    and each Value matches its Key. Returns the number of items popped, or -1 on failure.
+*/
+static int DrainAscending(Binary_Heap_t *Heap) {
+
+    Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    int                        Count = 0, Previous = 0, Failed = 0;
+
+    while ( !Binary_Heap_IsEmpty(Heap) ) {
+        KeyValuePair = Binary_Heap_Pop(Heap);
+        if ( (NULL == KeyValuePair.Key) || (NULL == KeyValuePair.Value) ||
+             (*(int *)KeyValuePair.Key != *(int *)KeyValuePair.Value) ||
+             ((0 != Count) && (*(int *)KeyValuePair.Key < Previous)) ) {
+            Failed = 1;
+        } else {
+            Previous = *(int *)KeyValuePair.Key;
+        }
+        free(KeyValuePair.Key);
+        free(KeyValuePair.Value);
+        Count++;
+    }
+
+    return (0 == Failed) ? Count : -1;
+}
+
 int Test_binary_heap(void) {
 
     int FailedTests = 0;
@@ -107,6 +133,8 @@ int Test_binary_heap(void) {
     FailedTests += Test_Binary_Heap_Length();
     FailedTests += Test_Binary_Heap_IsEmpty();
     FailedTests += Test_Binary_Heap_Push();
+    FailedTests += Test_Binary_Heap_PushN();
+    FailedTests += Test_Binary_Heap_Handles();
     FailedTests += Test_Binary_Heap_Peek();
     FailedTests += Test_Binary_Heap_Pop();
     FailedTests += Test_Binary_Heap_Remove();
@@ -115,6 +143,10 @@ int Test_binary_heap(void) {
     FailedTests += Test_Binary_Heap_DoCallbackArg();
     FailedTests += Test_Binary_Heap_Clear();
 
+    FailedTests += Test_binary_heap_inline();
+    FailedTests += Test_binary_heap_pairing();
+    FailedTests += Test_binary_heap_minmax();
+
     return FailedTests;
 }
 
@@ -430,6 +462,156 @@ int Test_Binary_Heap_Clear(void) {
         TEST_FAILURE;
     }
 
+    if ( (0 != Heap->NodePool->InUse) || (NULL != Heap->NodePool->Slabs) ) {
+        TEST_PRINTF("%s", "Test Failure - Binary_Heap_t Pool still holds memory after Clear().");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    Binary_Heap_Release(Heap);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Heap_PushN(void) {
+
+    Binary_Heap_t *Heap = NULL;
+    Array_t *      Keys = NULL;
+    int            Batch[500], i = 0;
+
+    for ( i = 0; i < 500; i++ ) {
+        Batch[i] = (i * 7919) % 211;
+    }
+
+    Heap = Binary_Heap_Create(CompareFunc_Int_Descending, NULL);
+    if ( NULL == Heap ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Binary_Heap_t for testing.");
+        TEST_FAILURE;
+    }
+
+    if ( 0 == Binary_Heap_PushN(Heap, Batch, 0, Batch, sizeof(int), 10, NULL) ) {
+        TEST_PRINTF("%s", "Test Failure - Binary_Heap_PushN() accepted Keys of size 0.");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    /* Loading from empty rebuilds the Heap bottom-up, a small batch is sifted up one by one. */
+    if ( (0 != Binary_Heap_PushN(Heap, Batch, sizeof(int), Batch, sizeof(int), 400, NULL)) ||
+         (0 != Binary_Heap_PushN(Heap, &Batch[400], sizeof(int), &Batch[400], sizeof(int), 100,
+                                 NULL)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to push batches onto Binary_Heap_t.");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    if ( 500 != DrainAscending(Heap) ) {
+        TEST_PRINTF("%s", "Test Failure - Batched Binary_Heap_t did not drain in order.");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    Binary_Heap_Release(Heap);
+
+    Keys = Array_Create(500, sizeof(int));
+    if ( (NULL == Keys) || (0 != Array_InsertN(Keys, Batch, 0, 500)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to prepare Array_t for testing.");
+        Array_Release(Keys);
+        TEST_FAILURE;
+    }
+
+    Heap = Binary_Heap_FromArray(CompareFunc_Int_Descending, Keys, Keys, NULL);
+    if ( (NULL == Heap) || (500 != Binary_Heap_Length(Heap)) || (500 != DrainAscending(Heap)) ) {
+        TEST_PRINTF("%s", "Test Failure - Binary_Heap_FromArray() did not build a valid Heap.");
+        Binary_Heap_Release(Heap);
+        Array_Release(Keys);
+        TEST_FAILURE;
+    }
+
+    Binary_Heap_Release(Heap);
+    Array_Release(Keys);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Heap_Handles(void) {
+
+    Binary_Heap_t *            Heap = NULL;
+    Binary_Heap_Handle_t *     Handles[200];
+    Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    int                        Keys[200], Removed[200] = {0}, i = 0, Count = 0, Previous = 0;
+
+    Heap = Binary_Heap_CreateInline(CompareFunc_Int_Descending, sizeof(int), 4);
+    if ( (NULL == Heap) || (NULL != Binary_Heap_PushHandle(Heap, &i, sizeof(i), &i, sizeof(i),
+                                                           NULL)) ) {
+        TEST_PRINTF("%s", "Test Failure - Inline Binary_Heap_t handed out a Handle.");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+    Binary_Heap_Release(Heap);
+
+    Heap = Binary_Heap_Create(CompareFunc_Int_Descending, NULL);
+    if ( NULL == Heap ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Binary_Heap_t for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 200; i++ ) {
+        Keys[i]    = (i * 37) % 101;
+        Handles[i] = Binary_Heap_PushHandle(Heap, &Keys[i], sizeof(int), &i, sizeof(i), NULL);
+        if ( NULL == Handles[i] ) {
+            TEST_PRINTF("Test Failure - Failed to push item (%d) with a Handle.", i);
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( 0 == Binary_Heap_UpdateKey(Heap, NULL, &i, sizeof(i)) ) {
+        TEST_PRINTF("%s", "Test Failure - Binary_Heap_UpdateKey() accepted a NULL Handle.");
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    /* Mirroring the Keys moves some items towards the top and others towards the bottom. */
+    for ( i = 0; i < 200; i += 3 ) {
+        Keys[i] = 100 - Keys[i];
+        if ( 0 != Binary_Heap_UpdateKey(Heap, Handles[i], &Keys[i], sizeof(int)) ) {
+            TEST_PRINTF("Test Failure - Failed to update Key of item (%d).", i);
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( i = 0; i < 200; i += 5 ) {
+        Removed[i] = 1;
+        if ( 0 != Binary_Heap_RemoveHandle(Heap, Handles[i]) ) {
+            TEST_PRINTF("Test Failure - Failed to remove item (%d) by Handle.", i);
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( 160 != Binary_Heap_Length(Heap) ) {
+        TEST_PRINTF("Test Failure - Heap Length (%lu) not equal to expectation (160).",
+                    (unsigned long)Binary_Heap_Length(Heap));
+        Binary_Heap_Release(Heap);
+        TEST_FAILURE;
+    }
+
+    while ( !Binary_Heap_IsEmpty(Heap) ) {
+        KeyValuePair = Binary_Heap_Pop(Heap);
+        i            = *(int *)KeyValuePair.Value;
+        if ( (Removed[i]) || (Keys[i] != *(int *)KeyValuePair.Key) ||
+             ((0 != Count) && (Keys[i] < Previous)) ) {
+            TEST_PRINTF("Test Failure - Item (%d) popped out of order after Handle updates.", i);
+            free(KeyValuePair.Key);
+            free(KeyValuePair.Value);
+            Binary_Heap_Release(Heap);
+            TEST_FAILURE;
+        }
+        Previous = Keys[i];
+        free(KeyValuePair.Key);
+        free(KeyValuePair.Value);
+        Count++;
+    }
+
     Binary_Heap_Release(Heap);
     TEST_SUCCESSFUL;
 }
@@ -36,20 +36,91 @@ extern "C" {
 #define LIBCONTAINER_ENABLE_ARRAY
 #include "../../../../include/libcontainer.h"
 
+#include "binary_heap_inline.h"
+#include "binary_heap_minmax.h"
 #include "binary_heap_node.h"
+#include "binary_heap_pairing.h"
 #include "../../../iterator/include/iterator.h"
 #include "../../../array/include/array.h"
+#include "../../../pool/include/pool.h"
 
 #define PARENT_INDEX(Index) ((0 == (Index)) ? (0) : ( ((Index)-1)/2 ))
 #define LEFT_CHILD_INDEX(Index) (2*(Index) + 1)
 #define RIGHT_CHILD_INDEX(Index) (2*(Index) + 2)
 
+/*
+    Binary_Heap_Mode_t
+
+    This enum defines the different storage layouts a Binary_Heap_t can use.
+*/
+typedef enum Binary_Heap_Mode_t {
+    /*
+        Each item is a separately allocated Binary_Heap_Node_t, held by pointer in Items.
+    */
+    Binary_Heap_Mode_Nodes,
+    /*
+        Each item is a fixed-size Binary_Heap_Slot_t with its Key stored inline, with
+        every Slot held back to back in Slots.
+    */
+    Binary_Heap_Mode_Inline,
+    /*
+        Each item is a separately allocated Binary_Heap_PairingNode_t, linked into
+        a pairing heap hanging from Root, so two Heaps can be melded in O(1).
+    */
+    Binary_Heap_Mode_Pairing,
+    /*
+        Each item is held exactly as for Binary_Heap_Mode_Nodes, but Items is ordered
+        as a min-max heap so both the highest and the lowest item are at the top.
+    */
+    Binary_Heap_Mode_MinMax
+} Binary_Heap_Mode_t;
+
 struct Binary_Heap_t {
 
+    Binary_Heap_Mode_t Mode;
+
     Array_t* Items;
 
+    /*
+        NodePool is the slab allocator every Node of this heap is allocated from,
+        allowing Clear and Release to drop all of the Nodes at once.
+    */
+    Pool_t* NodePool;
+
+    /*
+        Pools holds the NodePools taken over from every Heap merged into this one,
+        as the Nodes which came with them must still be returned to the Pool they
+        were allocated from. This is NULL until the first Binary_Heap_Merge().
+    */
+    Array_t* Pools;
+
     CompareFunc_t* KeyCompareFunc;
     ReleaseFunc_t* KeyReleaseFunc;
+
+    /*
+        The remaining fields are only used by an inline Heap, of SlotCount Slots
+        of SlotSize bytes each, every Slot holding a Key of exactly KeySize bytes.
+        Each Slot has (1 << ArityShift) children. NextSlot is the iteration cursor,
+        and Scratch has room for two Slots, one to hold the Slot being sifted and
+        one to hold the most recently popped Slot.
+    */
+    uint8_t* Slots;
+    size_t   SlotCount;
+    size_t   SlotCapacity;
+    size_t   SlotSize;
+    size_t   KeySize;
+    size_t   ArityShift;
+    size_t   NextSlot;
+    uint8_t* Scratch;
+
+    /*
+        The remaining fields are only used by a meldable Heap, of Count Nodes
+        hanging from Root. Cursor is the Node most recently returned by iteration,
+        or NULL if iteration has not yet started.
+    */
+    Binary_Heap_PairingNode_t* Root;
+    Binary_Heap_PairingNode_t* Cursor;
+    size_t                     Count;
 };
 
 /* ++++++++++ Private Binary_Heap_t Functions ++++++++++ */
@@ -62,11 +133,12 @@ struct Binary_Heap_t {
 
     Inputs:
     Heap    -   Pointer to the Binary_Heap_t to operate on.
+    Index   -   Index of the item to sift up. Items past this Index are left untouched.
 
     Outputs:
     int     -   Returns 0 on success, non-zero on failure or error.
 */
-int Binary_Heap_siftUp(Binary_Heap_t* Heap);
+int Binary_Heap_siftUp(Binary_Heap_t* Heap, size_t Index);
 
 /*
     Binary_Heap_siftDown
@@ -76,11 +148,163 @@ int Binary_Heap_siftUp(Binary_Heap_t* Heap);
 
     Inputs:
     Heap    -   Pointer to the Binary_Heap_t to operate on.
+    Index   -   Index of the item to sift down, 0 for the Root.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure or error.
+*/
+int Binary_Heap_siftDown(Binary_Heap_t* Heap, size_t Index);
+
+/*
+    Binary_Heap_pushNodes
+
+    This function adds Count new Nodes to the end of a node-based Heap, and then
+    restores the Heap property. When Count is at least the number of items already
+    held, this rebuilds the whole Heap bottom-up in O(n), otherwise each new Node
+    is sifted up in turn.
+
+    Inputs:
+    Heap                -   Pointer to the node-based Binary_Heap_t to operate on.
+    Keys                -   Pointer to the Count Keys to add, back to back.
+    KeySize             -   The size of each Key.
+    Values              -   Pointer to the Count Values to add, as for Binary_Heap_PushN().
+    ValueSize           -   The size of each Value, or 0 to hold the Values by reference.
+    Count               -   The number of Key-Value pairs to add.
+    ValueReleaseFunc    -   Pointer to the function to release each Value with.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure. On failure, the Heap is unchanged.
+*/
+int Binary_Heap_pushNodes(Binary_Heap_t* Heap, uint8_t* Keys, size_t KeySize, uint8_t* Values, size_t ValueSize, size_t Count, ReleaseFunc_t* ValueReleaseFunc);
+
+/*
+    Binary_Heap_heapify
+
+    This function restores the Heap property of a node-based Heap after new Nodes
+    have been added to the end of its Items, from Start onwards. When at least as
+    many Nodes were added as were already held, this rebuilds the whole Heap
+    bottom-up in O(n), otherwise each new Node is sifted up in turn.
+
+    Inputs:
+    Heap    -   Pointer to the node-based Binary_Heap_t to operate on.
+    Start   -   Index of the first of the new Nodes.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure or error.
+*/
+int Binary_Heap_heapify(Binary_Heap_t* Heap, size_t Start);
+
+/*
+    Binary_Heap_pushNode
+
+    This function creates a new Node for the given Key-Value pair, appends it to a
+    node-based Heap and sifts it up into place.
+
+    Inputs:
+    Heap                -   Pointer to the node-based Binary_Heap_t to operate on.
+    Key                 -   Pointer to the Key of the Key-Value pair to add.
+    KeySize             -   Size of the Key (in bytes). 0 for a Reference-Type.
+    Value               -   Pointer to the Value of the Key-Value pair to add.
+    ValueSize           -   Size of the Value (in bytes). 0 for a Reference-Type.
+    ValueReleaseFunc    -   Pointer to the function to release the Value with.
+
+    Outputs:
+    Binary_Heap_Node_t* -   Pointer to the new Node on success, or NULL on failure.
+*/
+Binary_Heap_Node_t* Binary_Heap_pushNode(Binary_Heap_t* Heap, void* Key, size_t KeySize, void* Value, size_t ValueSize, ReleaseFunc_t* ValueReleaseFunc);
+
+/*
+    Binary_Heap_swapNodes
+
+    This function swaps the Nodes at two positions of a node-based Heap, keeping the
+    Index of each Node in step with its new position.
+
+    Inputs:
+    Heap    -   Pointer to the node-based Binary_Heap_t to operate on.
+    A       -   Index of the first Node to swap.
+    B       -   Index of the second Node to swap.
+
+    Outputs:
+    None, the Nodes are swapped.
+*/
+void Binary_Heap_swapNodes(Binary_Heap_t* Heap, size_t A, size_t B);
+
+/*
+    Binary_Heap_checkHandle
+
+    This function checks that a Handle refers to an item currently held by the Heap.
+
+    Inputs:
+    Heap    -   Pointer to the Binary_Heap_t the Handle should belong to.
+    Handle  -   Pointer to the Handle to check.
+
+    Outputs:
+    int     -   Returns 0 if the Handle is valid for the Heap, non-zero otherwise.
+*/
+int Binary_Heap_checkHandle(Binary_Heap_t* Heap, Binary_Heap_Handle_t* Handle);
+
+/*
+    Binary_Heap_restore
+
+    This function restores the Heap property around a Node whose Key may now belong
+    either above or below its current position, sifting it up or down as needed.
+
+    Inputs:
+    Heap    -   Pointer to the node-based Binary_Heap_t to operate on.
+    Index   -   Index of the Node which may be out of place.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure or error.
+*/
+int Binary_Heap_restore(Binary_Heap_t* Heap, size_t Index);
+
+/*
+    Binary_Heap_invalidate
+
+    This function resets any iteration in progress over the Heap, as is required
+    whenever the contents of the Heap are modified.
+
+    Inputs:
+    Heap    -   Pointer to the Binary_Heap_t to operate on.
+
+    Outputs:
+    None, the next call to Binary_Heap_Next() starts from the beginning.
+*/
+void Binary_Heap_invalidate(Binary_Heap_t* Heap);
+
+/*
+    Binary_Heap_adoptPools
+
+    This function hands the NodePool of Src, along with every Pool Src has itself
+    taken over, to Dst, giving Src the fresh NewPool in its place. Src must be
+    left holding no Nodes once this returns.
+
+    Inputs:
+    Dst     -   Pointer to the Binary_Heap_t which is taking over the Nodes of Src.
+    Src     -   Pointer to the Binary_Heap_t whose Nodes are being taken over.
+    NewPool -   Pointer to the empty Pool_t for Src to allocate from from now on.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure. On failure, neither Heap is changed.
+*/
+int Binary_Heap_adoptPools(Binary_Heap_t* Dst, Binary_Heap_t* Src, Pool_t* NewPool);
+
+/*
+    Binary_Heap_mergeNodes
+
+    This function moves every Node of the node-based Heap Src onto the end of the
+    node-based Heap Dst, and then restores the Heap property as Binary_Heap_pushNodes()
+    does. No Key or Value is copied, and the Items of Dst must already have room for
+    every Node of Src.
+
+    Inputs:
+    Dst     -   Pointer to the node-based Binary_Heap_t to merge into.
+    Src     -   Pointer to the node-based Binary_Heap_t to merge from.
 
     Outputs:
     int     -   Returns 0 on success, non-zero on failure or error.
 */
-int Binary_Heap_siftDown(Binary_Heap_t* Heap);
+int Binary_Heap_mergeNodes(Binary_Heap_t* Dst, Binary_Heap_t* Src);
 
 /* ---------- Private Binary_Heap_t Functions ---------- */
 
@@ -0,0 +1,230 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef LIBCONTAINER_BINARY_HEAP_INLINE_H
+#define LIBCONTAINER_BINARY_HEAP_INLINE_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define LIBCONTAINER_ENABLE_BINARY_HEAP
+#include "../../../../include/libcontainer.h"
+
+#ifndef LIBCONTAINER_BINARY_HEAP_INLINE_ARITY
+/*
+    LIBCONTAINER_BINARY_HEAP_INLINE_ARITY
+
+    This macro defines the number of children of each item of an inline Binary_Heap_t
+    when Binary_Heap_CreateInline() is not given an explicit Arity. With small Keys,
+    all of the children of an item then share one or two cache lines, so each level
+    of a Sift-Down costs a single miss while the heap is half as deep as a binary one.
+
+    This is tunable during build-time be re-defining this macro
+    with the desired integer value. This must be a power of two, from 2 to 16.
+*/
+#define LIBCONTAINER_BINARY_HEAP_INLINE_ARITY 4
+#endif
+
+#ifndef LIBCONTAINER_BINARY_HEAP_INLINE_CAPACITY
+/*
+    LIBCONTAINER_BINARY_HEAP_INLINE_CAPACITY
+
+    This macro defines the number of Slots initially allocated for an inline
+    Binary_Heap_t. The Slots double in number each time they fill.
+*/
+#define LIBCONTAINER_BINARY_HEAP_INLINE_CAPACITY 16
+#endif
+
+/*
+    Binary_Heap_Slot_t
+
+    This struct is the header of each item of an inline Binary_Heap_t. The Slots are
+    laid out back to back in one array, each immediately followed by the bytes of its
+    Key, padded out so that every Slot remains pointer-aligned.
+*/
+typedef struct Binary_Heap_Slot_t {
+
+    /*
+        Value is a pointer to the Value part of the Key-Value pair held by this Slot.
+    */
+    void* Value;
+
+    /*
+        ValueReleaseFunc is a pointer to the function to call to release the resources
+        held by the Value pointer.
+    */
+    ReleaseFunc_t* ValueReleaseFunc;
+} Binary_Heap_Slot_t;
+
+/*
+    BINARY_HEAP_SLOT
+
+    This macro evaluates to the Binary_Heap_Slot_t* at the given Index of an inline Heap.
+*/
+#define BINARY_HEAP_SLOT(Heap, Index) ((Binary_Heap_Slot_t *)((Heap)->Slots + ((Index) * (Heap)->SlotSize)))
+
+/*
+    BINARY_HEAP_SLOT_KEY
+
+    This macro evaluates to a pointer to the inline Key bytes of the given Slot.
+*/
+#define BINARY_HEAP_SLOT_KEY(Slot) ((void *)((uint8_t *)(Slot) + sizeof(Binary_Heap_Slot_t)))
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+/*
+    Binary_Heap_inlinePush
+
+    This function adds a new Key-Value pair to an inline Heap, copying the Key into
+    the next free Slot and sifting it up into place.
+
+    Inputs:
+    Heap                -   Pointer to the inline Binary_Heap_t to operate on.
+    Key                 -   Pointer to the Key to copy into the Heap.
+    KeySize             -   The size of the Key, which must match the KeySize of the Heap.
+    Value               -   Pointer to the Value to add.
+    ValueSize           -   The size of the Value, or 0 to hold the Value by reference.
+    ValueReleaseFunc    -   Pointer to the function to release the Value with.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure.
+*/
+int Binary_Heap_inlinePush(Binary_Heap_t* Heap, void* Key, size_t KeySize, void* Value, size_t ValueSize, ReleaseFunc_t* ValueReleaseFunc);
+
+/*
+    Binary_Heap_inlinePushN
+
+    This function adds Count new Key-Value pairs to the end of an inline Heap, and
+    then restores the Heap property. When Count is at least the number of items already
+    held, this rebuilds the whole Heap bottom-up in O(n), otherwise each new Slot
+    is sifted up in turn.
+
+    Inputs:
+    Heap                -   Pointer to the inline Binary_Heap_t to operate on.
+    Keys                -   Pointer to the Count Keys to add, back to back.
+    KeySize             -   The size of each Key, which must match the KeySize of the Heap.
+    Values              -   Pointer to the Count Values to add, as for Binary_Heap_PushN().
+    ValueSize           -   The size of each Value, or 0 to hold the Values by reference.
+    Count               -   The number of Key-Value pairs to add.
+    ValueReleaseFunc    -   Pointer to the function to release each Value with.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure. On failure, the Heap is unchanged.
+*/
+int Binary_Heap_inlinePushN(Binary_Heap_t* Heap, uint8_t* Keys, size_t KeySize, uint8_t* Values, size_t ValueSize, size_t Count, ReleaseFunc_t* ValueReleaseFunc);
+
+/*
+    Binary_Heap_inlinePop
+
+    This function removes the Root Slot of an inline Heap, copying it aside so the
+    Key and Value can be handed back to the caller.
+
+    Inputs:
+    Heap    -   Pointer to the inline Binary_Heap_t to operate on.
+
+    Outputs:
+    Binary_Heap_Slot_t* -   Pointer to the copy of the removed Slot, or NULL if the Heap is empty.
+                                This copy is only valid until the next Pop or Remove.
+*/
+Binary_Heap_Slot_t* Binary_Heap_inlinePop(Binary_Heap_t* Heap);
+
+/*
+    Binary_Heap_inlineNext
+
+    This function returns the next Slot of an inline Heap, in storage order.
+
+    Inputs:
+    Heap    -   Pointer to the inline Binary_Heap_t to operate on.
+
+    Outputs:
+    Binary_Heap_Slot_t* -   Pointer to the next Slot, or NULL once every Slot has been
+                                visited, after which iteration starts over.
+*/
+Binary_Heap_Slot_t* Binary_Heap_inlineNext(Binary_Heap_t* Heap);
+
+/*
+    Binary_Heap_inlineClear
+
+    This function releases the Values held by every Slot of an inline Heap, leaving
+    the Heap empty but keeping the Slots allocated.
+
+    Inputs:
+    Heap    -   Pointer to the inline Binary_Heap_t to operate on.
+
+    Outputs:
+    None, the Heap is emptied.
+*/
+void Binary_Heap_inlineClear(Binary_Heap_t* Heap);
+
+/*
+    Binary_Heap_inlineSiftUp
+
+    This function moves the Slot at the given Index up towards the Root until the
+    Heap property holds again. The Slot is held aside while its ancestors are shifted
+    down into the gap, so each level costs one copy rather than a swap.
+
+    Inputs:
+    Heap    -   Pointer to the inline Binary_Heap_t to operate on.
+    Index   -   Index of the Slot to sift up.
+
+    Outputs:
+    None, the Heap property is restored.
+*/
+void Binary_Heap_inlineSiftUp(Binary_Heap_t* Heap, size_t Index);
+
+/*
+    Binary_Heap_inlineSiftDown
+
+    This function moves the Slot at the given Index down towards the leaves until the
+    Heap property holds again, shifting the best of its children up at each level.
+
+    Inputs:
+    Heap    -   Pointer to the inline Binary_Heap_t to operate on.
+    Index   -   Index of the Slot to sift down.
+
+    Outputs:
+    None, the Heap property is restored.
+*/
+void Binary_Heap_inlineSiftDown(Binary_Heap_t* Heap, size_t Index);
+
+/* ---------- Private Functions ---------- */
+
+#if defined(TESTING) || defined(DEBUGGER)
+
+#include "binary_heap_inline_test.h"
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,139 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef LIBCONTAINER_BINARY_HEAP_MINMAX_H
+#define LIBCONTAINER_BINARY_HEAP_MINMAX_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+
+#define LIBCONTAINER_ENABLE_BINARY_HEAP
+#include "../../../../include/libcontainer.h"
+
+/*
+    BINARY_HEAP_IS_MAX_LEVEL
+
+    This macro evaluates to true if the given Index of a min-max Heap lies on a
+    max level, one whose items compare highest within their subtrees. The Root is
+    on a max level, and the levels then alternate.
+*/
+#define BINARY_HEAP_IS_MAX_LEVEL(Index) (0 == (Binary_Heap_minMaxDepth(Index) & 1))
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+/*
+    Binary_Heap_minMaxDepth
+
+    This function returns the depth of the given Index within a binary heap, with
+    the Root at depth 0.
+
+    Inputs:
+    Index   -   The Index to find the depth of.
+
+    Outputs:
+    size_t  -   The depth of the Index, floor(log2(Index + 1)).
+*/
+size_t Binary_Heap_minMaxDepth(size_t Index);
+
+/*
+    Binary_Heap_minMaxCompare
+
+    This function compares the Keys of the Nodes at two positions of a min-max Heap.
+
+    Inputs:
+    Heap    -   Pointer to the min-max Binary_Heap_t to operate on.
+    A       -   Index of the first Node.
+    B       -   Index of the second Node.
+
+    Outputs:
+    int     -   The result of the KeyCompareFunc of the Heap, applied to the Keys at A and B.
+*/
+int Binary_Heap_minMaxCompare(Binary_Heap_t* Heap, size_t A, size_t B);
+
+/*
+    Binary_Heap_minMaxSiftUp
+
+    This function moves the Node at the given Index up a min-max Heap until the
+    min-max Heap property holds again. The Node is first compared against its parent
+    to decide whether it belongs on the min or the max levels, and is then only ever
+    compared against its grandparents.
+
+    Inputs:
+    Heap    -   Pointer to the min-max Binary_Heap_t to operate on.
+    Index   -   Index of the Node to sift up, which must have no descendants out of place.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure or error.
+*/
+int Binary_Heap_minMaxSiftUp(Binary_Heap_t* Heap, size_t Index);
+
+/*
+    Binary_Heap_minMaxSiftDown
+
+    This function moves the Node at the given Index down a min-max Heap until the
+    min-max Heap property holds again. At each step the Node is swapped with the
+    best of its children and grandchildren, so it descends two levels at a time.
+
+    Inputs:
+    Heap    -   Pointer to the min-max Binary_Heap_t to operate on.
+    Index   -   Index of the Node to sift down, 0 for the Root.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure or error.
+*/
+int Binary_Heap_minMaxSiftDown(Binary_Heap_t* Heap, size_t Index);
+
+/*
+    Binary_Heap_minIndex
+
+    This function finds the Index of the Node which compares lowest within a
+    non-empty min-max Heap, which is always either the Root or one of its children.
+
+    Inputs:
+    Heap    -   Pointer to the min-max Binary_Heap_t to operate on.
+
+    Outputs:
+    size_t  -   Index of the lowest Node.
+*/
+size_t Binary_Heap_minIndex(Binary_Heap_t* Heap);
+
+/* ---------- Private Functions ---------- */
+
+#if defined(TESTING) || defined(DEBUGGER)
+
+#include "binary_heap_minmax_test.h"
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
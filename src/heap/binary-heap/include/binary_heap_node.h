@@ -34,6 +34,8 @@ extern "C" {
 
 #include "../../../../include/libcontainer.h"
 
+#include "../../../pool/include/pool.h"
+
 /*
     Binary_Heap_Node_t
 
@@ -74,6 +76,17 @@ struct Binary_Heap_Node_t {
     */
     size_t ValueSize;
 
+    /*
+        Pool is the Pool_t this Node was allocated from, and must be returned to,
+        or NULL if the Node was allocated on its own.
+    */
+    Pool_t* Pool;
+
+    /*
+        Index is the current position of this Node within the Items of its Heap,
+        kept up to date through every swap so a Node can be found from its handle.
+    */
+    size_t Index;
 };
 
 /*
@@ -83,6 +96,7 @@ struct Binary_Heap_Node_t {
     for use within a Binary_Heap_t.
 
     Inputs:
+    Pool    -   Pointer to the Pool_t to allocate the Node from, or NULL to allocate it on its own.
     Key     -   Pointer to the Key field of the Node.
     Value   -   Pointer to the Value field of the Node.
     KeySize     -   Size to allocate for the Key field (in bytes).
@@ -96,7 +110,7 @@ struct Binary_Heap_Node_t {
     Binary_Heap_Node_t* -   Pointer to a created and initialized Binary_Heap_Node_t
                                 on success, or NULL on failure.
 */
-Binary_Heap_Node_t *Binary_Heap_Node_Create(void* Key, void* Value,
+Binary_Heap_Node_t *Binary_Heap_Node_Create(Pool_t* Pool, void* Key, void* Value,
                                             size_t KeySize, size_t ValueSize,
                                             ReleaseFunc_t* KeyReleaseFunc,
                                             ReleaseFunc_t* ValueReleaseFunc);
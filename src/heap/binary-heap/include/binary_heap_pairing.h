@@ -0,0 +1,216 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef LIBCONTAINER_BINARY_HEAP_PAIRING_H
+#define LIBCONTAINER_BINARY_HEAP_PAIRING_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define LIBCONTAINER_ENABLE_BINARY_HEAP
+#include "../../../../include/libcontainer.h"
+
+#include "binary_heap_node.h"
+
+/*
+    Binary_Heap_PairingNode_t
+
+    This struct is a single item of a meldable Binary_Heap_t, which is held as a
+    pairing heap. Every Node keeps its children as a list, so two Heaps can be joined
+    by linking one Root beneath the other, without touching any other Node.
+*/
+typedef struct Binary_Heap_PairingNode_t Binary_Heap_PairingNode_t;
+
+struct Binary_Heap_PairingNode_t {
+
+    /*
+        Node holds the Key-Value pair, exactly as for a node-based Heap. This must
+        be the first member, so a Binary_Heap_PairingNode_t* is also a valid
+        Binary_Heap_Node_t*, and Handle.
+    */
+    Binary_Heap_Node_t Node;
+
+    /*
+        Child is the first of the children of this Node, and Sibling the next child
+        of the same parent. Previous is the preceding Sibling, or the parent for the
+        first child, and is NULL only for the Root.
+    */
+    Binary_Heap_PairingNode_t* Child;
+    Binary_Heap_PairingNode_t* Sibling;
+    Binary_Heap_PairingNode_t* Previous;
+};
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+/*
+    Binary_Heap_pairingPush
+
+    This function creates a new Node for the given Key-Value pair and links it
+    in beside the Root of a meldable Heap, in O(1).
+
+    Inputs:
+    Heap                -   Pointer to the meldable Binary_Heap_t to operate on.
+    Key                 -   Pointer to the Key of the Key-Value pair to add.
+    KeySize             -   Size of the Key (in bytes). 0 for a Reference-Type.
+    Value               -   Pointer to the Value of the Key-Value pair to add.
+    ValueSize           -   Size of the Value (in bytes). 0 for a Reference-Type.
+    ValueReleaseFunc    -   Pointer to the function to release the Value with.
+
+    Outputs:
+    Binary_Heap_PairingNode_t*  -   Pointer to the new Node on success, or NULL on failure.
+*/
+Binary_Heap_PairingNode_t* Binary_Heap_pairingPush(Binary_Heap_t* Heap, void* Key, size_t KeySize, void* Value, size_t ValueSize, ReleaseFunc_t* ValueReleaseFunc);
+
+/*
+    Binary_Heap_pairingPushN
+
+    This function adds Count new Key-Value pairs to a meldable Heap. The new Nodes
+    are first gathered into a Heap of their own, which is only melded in once every
+    Node has been created.
+
+    Inputs:
+    Heap                -   Pointer to the meldable Binary_Heap_t to operate on.
+    Keys                -   Pointer to the Count Keys to add, back to back.
+    KeySize             -   The size of each Key.
+    Values              -   Pointer to the Count Values to add, as for Binary_Heap_PushN().
+    ValueSize           -   The size of each Value, or 0 to hold the Values by reference.
+    Count               -   The number of Key-Value pairs to add.
+    ValueReleaseFunc    -   Pointer to the function to release each Value with.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure. On failure, the Heap is unchanged.
+*/
+int Binary_Heap_pairingPushN(Binary_Heap_t* Heap, uint8_t* Keys, size_t KeySize, uint8_t* Values, size_t ValueSize, size_t Count, ReleaseFunc_t* ValueReleaseFunc);
+
+/*
+    Binary_Heap_pairingDetach
+
+    This function removes a Node from anywhere within a meldable Heap, melding its
+    children back in its place. The Node itself is left intact, ready to be either
+    released or linked back in.
+
+    Inputs:
+    Heap    -   Pointer to the meldable Binary_Heap_t to operate on.
+    Node    -   Pointer to the Node to remove.
+
+    Outputs:
+    None, the Node is no longer part of the Heap.
+*/
+void Binary_Heap_pairingDetach(Binary_Heap_t* Heap, Binary_Heap_PairingNode_t* Node);
+
+/*
+    Binary_Heap_pairingMeld
+
+    This function joins two Roots, linking whichever compares lower beneath the
+    other as its first child.
+
+    Inputs:
+    Heap    -   Pointer to the meldable Binary_Heap_t the Nodes belong to.
+    A       -   Pointer to the first Root, or NULL.
+    B       -   Pointer to the second Root, or NULL.
+
+    Outputs:
+    Binary_Heap_PairingNode_t*  -   Pointer to the Root of the joined Heap.
+*/
+Binary_Heap_PairingNode_t* Binary_Heap_pairingMeld(Binary_Heap_t* Heap, Binary_Heap_PairingNode_t* A, Binary_Heap_PairingNode_t* B);
+
+/*
+    Binary_Heap_pairingCombine
+
+    This function joins a list of Siblings into a single Heap with the standard
+    two-pass pairing, first melding neighbouring pairs from left to right and then
+    melding each pair into the result from right to left.
+
+    Inputs:
+    Heap    -   Pointer to the meldable Binary_Heap_t the Nodes belong to.
+    First   -   Pointer to the first of the Siblings, or NULL.
+
+    Outputs:
+    Binary_Heap_PairingNode_t*  -   Pointer to the Root of the joined Heap, or NULL for no Siblings.
+*/
+Binary_Heap_PairingNode_t* Binary_Heap_pairingCombine(Binary_Heap_t* Heap, Binary_Heap_PairingNode_t* First);
+
+/*
+    Binary_Heap_pairingNext
+
+    This function returns the next Node of a meldable Heap, in pre-order. Each
+    step follows the links of the Nodes themselves, so no stack is needed.
+
+    Inputs:
+    Heap    -   Pointer to the meldable Binary_Heap_t to operate on.
+
+    Outputs:
+    Binary_Heap_PairingNode_t*  -   Pointer to the next Node, or NULL once every Node has
+                                        been visited, after which iteration starts over.
+*/
+Binary_Heap_PairingNode_t* Binary_Heap_pairingNext(Binary_Heap_t* Heap);
+
+/*
+    Binary_Heap_pairingRelease
+
+    This function releases every Node of the Heap rooted at Root.
+
+    Inputs:
+    Root            -   Pointer to the Root of the Nodes to release, or NULL.
+    KeepReferences  -   If true, Values held by reference are left to the caller.
+
+    Outputs:
+    None, every Node is returned to its Pool.
+*/
+void Binary_Heap_pairingRelease(Binary_Heap_PairingNode_t* Root, bool KeepReferences);
+
+/*
+    Binary_Heap_pairingCheckHandle
+
+    This function checks that a Handle refers to a Node currently held by a meldable Heap.
+
+    Inputs:
+    Heap    -   Pointer to the meldable Binary_Heap_t the Handle should belong to.
+    Node    -   Pointer to the Node the Handle refers to.
+
+    Outputs:
+    int     -   Returns 0 if the Node appears to be held by a Heap, non-zero otherwise.
+*/
+int Binary_Heap_pairingCheckHandle(Binary_Heap_t* Heap, Binary_Heap_PairingNode_t* Node);
+
+/* ---------- Private Functions ---------- */
+
+#if defined(TESTING) || defined(DEBUGGER)
+
+#include "binary_heap_pairing_test.h"
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -44,6 +44,8 @@ int Test_Binary_Heap_Peek(void);
 int Test_Binary_Heap_Pop(void);
 int Test_Binary_Heap_Remove(void);
 int Test_Binary_Heap_Push(void);
+int Test_Binary_Heap_PushN(void);
+int Test_Binary_Heap_Handles(void);
 int Test_Binary_Heap_Next(void);
 int Test_Binary_Heap_DoCallback(void);
 int Test_Binary_Heap_DoCallbackArg(void);
@@ -0,0 +1,84 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef LIBCONTAINER_TOP_K_H
+#define LIBCONTAINER_TOP_K_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+
+#define LIBCONTAINER_ENABLE_TOP_K
+#include "../../../../include/libcontainer.h"
+
+#include "../../binary-heap/include/binary_heap.h"
+
+struct TopK_t {
+
+    /*
+        Items holds at most K items, ordered such that the last of them under
+        CompareFunc is at the root. This is an inline Heap when the Keys are copied,
+        so accepting an item never allocates once the Heap has grown to K items.
+    */
+    Binary_Heap_t* Items;
+    CompareFunc_t* CompareFunc;
+
+    size_t K;
+    size_t KeySize;
+};
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+/*
+    TopK_releaseNothing
+
+    This function is the ReleaseFunc_t given to the Heap of a TopK_t for every item
+    it does not own, which is every Value and any Key held by reference.
+
+    Inputs:
+    Item    -   The item which is not to be released.
+
+    Outputs:
+    None, nothing is released.
+*/
+void TopK_releaseNothing(void* Item);
+
+/* ---------- Private Functions ---------- */
+
+#if defined(TESTING) || defined(DEBUGGER)
+
+#include "top_k_test.h"
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
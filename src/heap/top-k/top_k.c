@@ -0,0 +1,168 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+
+#include "../../logging/logging.h"
+#include "include/top_k.h"
+
+TopK_t *TopK_Create(size_t K, CompareFunc_t *CompareFunc, size_t KeySize) {
+
+    TopK_t *TopK = NULL;
+
+    if ( (0 == K) || (NULL == CompareFunc) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: TopK_t requires a non-zero K and a CompareFunc*.");
+#endif
+        return NULL;
+    }
+
+    TopK = (TopK_t *)calloc(1, sizeof(TopK_t));
+    if ( NULL == TopK ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for TopK_t.");
+#endif
+        return NULL;
+    }
+
+    if ( 0 == KeySize ) {
+        TopK->Items = Binary_Heap_Create(CompareFunc, TopK_releaseNothing);
+    } else {
+        TopK->Items = Binary_Heap_CreateInline(CompareFunc, KeySize, 0);
+    }
+    if ( NULL == TopK->Items ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to create Binary_Heap_t for TopK_t.");
+#endif
+        free(TopK);
+        return NULL;
+    }
+
+    TopK->CompareFunc = CompareFunc;
+    TopK->K           = K;
+    TopK->KeySize     = KeySize;
+
+    return TopK;
+}
+
+size_t TopK_Length(TopK_t *TopK) {
+
+    if ( NULL == TopK ) {
+        return 0;
+    }
+
+    return Binary_Heap_Length(TopK->Items);
+}
+
+bool TopK_IsEmpty(TopK_t *TopK) {
+    return (0 == TopK_Length(TopK));
+}
+
+int TopK_Push(TopK_t *TopK, void *Key, void *Value) {
+
+    Binary_Heap_KeyValuePair_t Last = {NULL, NULL};
+
+    if ( (NULL == TopK) || (NULL == Key) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL TopK* or Key* provided.");
+#endif
+        return 1;
+    }
+
+    /* Once full, an item must come strictly before the last one kept to replace it. */
+    if ( Binary_Heap_Length(TopK->Items) >= TopK->K ) {
+        Last = Binary_Heap_Peek(TopK->Items);
+        if ( TopK->CompareFunc(Key, Last.Key, TopK->KeySize) >= 0 ) {
+            return 0;
+        }
+        if ( 0 != Binary_Heap_Remove(TopK->Items) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to drop the last item of TopK_t.");
+#endif
+            return 1;
+        }
+    }
+
+    return Binary_Heap_Push(TopK->Items, Key, TopK->KeySize, Value, 0, TopK_releaseNothing);
+}
+
+Binary_Heap_KeyValuePair_t TopK_Peek(TopK_t *TopK) {
+
+    Binary_Heap_KeyValuePair_t Empty = {NULL, NULL};
+
+    if ( NULL == TopK ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL TopK* provided.");
+#endif
+        return Empty;
+    }
+
+    return Binary_Heap_Peek(TopK->Items);
+}
+
+Binary_Heap_KeyValuePair_t TopK_Pop(TopK_t *TopK) {
+
+    Binary_Heap_KeyValuePair_t Empty = {NULL, NULL};
+
+    if ( NULL == TopK ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL TopK* provided.");
+#endif
+        return Empty;
+    }
+
+    return Binary_Heap_Pop(TopK->Items);
+}
+
+int TopK_Clear(TopK_t *TopK) {
+
+    if ( NULL == TopK ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL TopK* provided.");
+#endif
+        return 1;
+    }
+
+    return Binary_Heap_Clear(TopK->Items);
+}
+
+void TopK_Release(TopK_t *TopK) {
+
+    if ( NULL == TopK ) {
+        return;
+    }
+
+    Binary_Heap_Release(TopK->Items);
+
+    ZERO_CONTAINER(TopK, TopK_t);
+    free(TopK);
+
+    return;
+}
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+void TopK_releaseNothing(__attribute__((unused)) void *Item) {
+    return;
+}
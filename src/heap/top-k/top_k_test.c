@@ -0,0 +1,148 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../logging/logging.h"
+#include "include/top_k.h"
+
+static int CompareWords(const void *A, const void *B, __attribute__((unused)) size_t Size) {
+    return strcmp((const char *)A, (const char *)B);
+}
+
+int Test_top_k(void) {
+
+    int FailedTests = 0;
+
+    FailedTests += Test_TopK_Create();
+    FailedTests += Test_TopK_Push();
+    FailedTests += Test_TopK_Reference();
+
+    return FailedTests;
+}
+
+int Test_TopK_Create(void) {
+
+    TopK_t *TopK  = NULL;
+    int     Value = 0;
+
+    if ( (NULL != (TopK = TopK_Create(0, CompareFunc_Int_Ascending, sizeof(int)))) ||
+         (NULL != (TopK = TopK_Create(4, NULL, sizeof(int)))) ) {
+        TEST_PRINTF("%s", "Test Failure - Created TopK_t with invalid arguments.");
+        TopK_Release(TopK);
+        TEST_FAILURE;
+    }
+
+    TopK = TopK_Create(4, CompareFunc_Int_Ascending, sizeof(int));
+    if ( (NULL == TopK) || (!TopK_IsEmpty(TopK)) || (NULL != TopK_Peek(TopK).Key) ||
+         (NULL != TopK_Pop(TopK).Key) || (0 == TopK_Push(TopK, NULL, &Value)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create empty TopK_t.");
+        TopK_Release(TopK);
+        TEST_FAILURE;
+    }
+
+    TopK_Release(TopK);
+    TEST_SUCCESSFUL;
+}
+
+int Test_TopK_Push(void) {
+
+    TopK_t *                   TopK    = NULL;
+    Binary_Heap_KeyValuePair_t Item    = {NULL, NULL};
+    int                        Keys[4000], i = 0, Expected = 0, Taken = 0;
+
+    TopK = TopK_Create(25, CompareFunc_Int_Descending, sizeof(int));
+    if ( NULL == TopK ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create TopK_t.");
+        TEST_FAILURE;
+    }
+
+    /* Every Key from 0 to 999 appears exactly 4 times, in a scrambled order. */
+    for ( i = 0; i < 4000; i++ ) {
+        Keys[i] = (i * 7919) % 4000 / 4;
+        if ( (0 != TopK_Push(TopK, &Keys[i], &Keys[i])) || (TopK_Length(TopK) > 25) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to push item to TopK_t.");
+            TopK_Release(TopK);
+            TEST_FAILURE;
+        }
+    }
+
+    /* The 25 largest are 999 to 994 four times each, then one 993, returned smallest first. */
+    for ( Item = TopK_Pop(TopK); NULL != Item.Key; Item = TopK_Pop(TopK) ) {
+        Expected = (0 == Taken) ? 993 : 994 + (Taken - 1) / 4;
+        if ( (*(int *)Item.Key != Expected) || (*(int *)Item.Value != Expected) ) {
+            TEST_PRINTF("Test Failure - Popped (%d) from TopK_t, expected (%d).",
+                        *(int *)Item.Key, Expected);
+            TopK_Release(TopK);
+            TEST_FAILURE;
+        }
+        Taken++;
+    }
+
+    if ( 25 != Taken ) {
+        TEST_PRINTF("Test Failure - TopK_t kept (%d) items, expected (25).", Taken);
+        TopK_Release(TopK);
+        TEST_FAILURE;
+    }
+
+    TopK_Release(TopK);
+    TEST_SUCCESSFUL;
+}
+
+int Test_TopK_Reference(void) {
+
+    TopK_t *TopK    = NULL;
+    char *  Words[] = {"pear", "apple", "fig", "banana", "cherry", "date", "apricot"};
+    char *  First[] = {"date", "cherry", "banana", "apricot", "apple"};
+    size_t  i       = 0;
+
+    /* Keys held by reference are never copied, and never released. */
+    TopK = TopK_Create(5, CompareWords, 0);
+    if ( NULL == TopK ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create TopK_t.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < sizeof(Words) / sizeof(Words[0]); i++ ) {
+        if ( 0 != TopK_Push(TopK, Words[i], &Words[i]) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to push item to TopK_t.");
+            TopK_Release(TopK);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( i = 0; i < 5; i++ ) {
+        if ( (0 != strcmp(First[i], (char *)TopK_Peek(TopK).Key)) ||
+             (*(char **)TopK_Pop(TopK).Value != First[i]) ) {
+            TEST_PRINTF("Test Failure - Expected (%s) from TopK_t.", First[i]);
+            TopK_Release(TopK);
+            TEST_FAILURE;
+        }
+    }
+
+    TopK_Release(TopK);
+    TEST_SUCCESSFUL;
+}
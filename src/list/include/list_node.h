@@ -183,6 +183,22 @@ int ListNode_InsertBefore(List_Node_t* Base, List_Node_t* ToInsert);
 */
 void ListNode_Delete(List_Node_t* Node);
 
+/*
+    ListNode_Detach
+
+    This function will unlink a List_Node_t from its neighbours, leaving the Node itself and its
+    contents untouched. This is useful when a Node is being moved between lists, or is owned by
+    something other than the heap allocator.
+
+    Inputs:
+    Node    -   Pointer to the List_Node_t to detach.
+
+    Outputs:
+    None, the neighbouring pointers are safely updated, and the Node is left with NULL Next
+    and Previous pointers.
+*/
+void ListNode_Detach(List_Node_t* Node);
+
 /*
     ListNode_UpdateValue
 
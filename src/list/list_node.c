@@ -198,6 +198,26 @@ void ListNode_Delete(List_Node_t *Node) {
         return;
     }
 
+    ListNode_Detach(Node);
+
+    ZERO_CONTAINER(Node, List_Node_t);
+    free(Node);
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully deleted List_Node_t.");
+#endif
+    return;
+}
+
+void ListNode_Detach(List_Node_t *Node) {
+
+    if ( NULL == Node ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "NULL List_Node_t* provided, nothing to detach.");
+#endif
+        return;
+    }
+
     if ( NULL != Node->Previous ) {
         Node->Previous->Next = Node->Next;
     }
@@ -206,12 +226,9 @@ void ListNode_Delete(List_Node_t *Node) {
         Node->Next->Previous = Node->Previous;
     }
 
-    ZERO_CONTAINER(Node, List_Node_t);
-    free(Node);
+    Node->Next     = NULL;
+    Node->Previous = NULL;
 
-#ifdef DEBUG
-    DEBUG_PRINTF("%s", "Successfully deleted List_Node_t.");
-#endif
     return;
 }
 
@@ -34,6 +34,7 @@ int Test_list_node(void) {
     FailedTests += Test_ListNode_RefCreate();
     FailedTests += Test_ListNode_InsertAfter();
     FailedTests += Test_ListNode_InsertBefore();
+    FailedTests += Test_ListNode_Detach();
     FailedTests += Test_ListNode_UpdateValue();
 
     return FailedTests;
@@ -168,6 +169,49 @@ int Test_ListNode_InsertBefore(void) {
     TEST_SUCCESSFUL;
 }
 
+int Test_ListNode_Detach(void) {
+
+    List_Node_t *Nodes[3] = {NULL, NULL, NULL};
+    char         Contents[] = "Hello World";
+    size_t       i          = 0;
+
+    for ( i = 0; i < 3; i++ ) {
+        Nodes[i] = ListNode_Create(Contents, sizeof(Contents));
+        if ( NULL == Nodes[i] ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to allocate List_Node_t.");
+            ListNode_Release(Nodes[0]);
+            ListNode_Release(Nodes[1]);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( (0 != ListNode_InsertAfter(Nodes[0], Nodes[1])) ||
+         (0 != ListNode_InsertAfter(Nodes[1], Nodes[2])) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to insert List_Node_t.");
+        ListNode_Release(Nodes[0]);
+        ListNode_Release(Nodes[1]);
+        ListNode_Release(Nodes[2]);
+        TEST_FAILURE;
+    }
+
+    /* Detaching the middle Node must close the gap it leaves, and keep its contents. */
+    ListNode_Detach(Nodes[1]);
+    if ( !((Nodes[0]->Next == Nodes[2]) && (Nodes[2]->Previous == Nodes[0]) &&
+           (NULL == Nodes[1]->Next) && (NULL == Nodes[1]->Previous) &&
+           (0 == strcmp(Contents, (char *)Nodes[1]->Contents.ContentRaw))) ) {
+        TEST_PRINTF("%s", "Test Failure - Inter-Node linking not equal to expectation.");
+        ListNode_Release(Nodes[0]);
+        ListNode_Release(Nodes[1]);
+        ListNode_Release(Nodes[2]);
+        TEST_FAILURE;
+    }
+
+    ListNode_Release(Nodes[0]);
+    ListNode_Release(Nodes[1]);
+    ListNode_Release(Nodes[2]);
+    TEST_SUCCESSFUL;
+}
+
 int Test_ListNode_UpdateValue(void) {
 
     List_Node_t *Node            = NULL;
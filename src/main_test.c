@@ -29,12 +29,16 @@
 #include "array/include/array.h"
 #include "hashmap/include/hashmap.h"
 #include "heap/binary-heap/include/binary_heap.h"
+#include "heap/top-k/include/top_k.h"
 #include "list/include/list.h"
+#include "pool/include/pool.h"
 #include "priority-queue/include/priority_queue.h"
 #include "queue/include/queue.h"
 #include "set/include/set.h"
 #include "stack/include/stack.h"
 #include "string/include/string.h"
+#include "timer-wheel/include/timer_wheel.h"
+#include "tree/b-tree/include/btree.h"
 #include "tree/binary-tree/include/binary_tree.h"
 
 int Test_main(void);
@@ -50,17 +54,21 @@ int Test_main(void) {
     printf("Libcontainer Version code: %ld\n", Libcontainer_Library_Version());
     printf("Libcontainer Compilation Datestamp: %ld\n", Libcontainer_Build_Time());
 
+    FailedTests += Test_pool();
     FailedTests += Test_array();
     FailedTests += Test_list();
     FailedTests += Test_hashmap();
     FailedTests += Test_binary_tree();
+    FailedTests += Test_btree();
     FailedTests += Test_stack();
     FailedTests += Test_string();
     FailedTests += Test_set();
     FailedTests += Test_queue();
     FailedTests += Test_CompareFunc();
     FailedTests += Test_binary_heap();
+    FailedTests += Test_top_k();
     FailedTests += Test_priority_queue();
+    FailedTests += Test_timer_wheel();
 
     /* Returning non-zero indicates to the Makefile during make to abort.
         This lets failing tests block further builds with the "all" target
@@ -0,0 +1,237 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef LIBCONTAINER_POOL_H
+#define LIBCONTAINER_POOL_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "../../../include/libcontainer.h"
+
+#ifndef LIBCONTAINER_POOL_SLAB_SIZE
+/*
+    LIBCONTAINER_POOL_SLAB_SIZE
+
+    This macro defines the approximate size, in bytes, of each slab of memory a
+    Pool_t requests from the system. Every slab holds at least one object,
+    regardless of this value.
+
+    This is tunable during build-time be re-defining this macro
+    with the desired integer value.
+*/
+#define LIBCONTAINER_POOL_SLAB_SIZE 4096
+#endif
+
+#ifndef LIBCONTAINER_POOL_INLINE_KEY_SIZE
+/*
+    LIBCONTAINER_POOL_INLINE_KEY_SIZE
+
+    This macro defines the largest fixed Key size, in bytes, which a container
+    will store inline within its pooled Nodes, rather than in a separate allocation.
+    Set this to 0 to never store Keys inline.
+
+    This is tunable during build-time be re-defining this macro
+    with the desired integer value.
+*/
+#define LIBCONTAINER_POOL_INLINE_KEY_SIZE 16
+#endif
+
+/*
+    Pool_Align_t
+
+    This union holds each of the fundamental types with the strictest alignment
+    requirements, such that its size is a safe stride for any object placed
+    within a slab.
+*/
+typedef union Pool_Align_t {
+    void*       Pointer;
+    size_t      Size;
+    long        Long;
+    double      Double;
+    long double LongDouble;
+} Pool_Align_t;
+
+/*
+    Pool_t
+
+    A Pool_t is a slab allocator for objects of a single, fixed size. Objects are
+    carved out of large slabs, and released objects are kept on a free list for
+    re-use rather than returned to the system. This removes the per-object
+    allocation overhead and fragmentation of containers built from many small
+    Nodes, and allows every object to be released at once by releasing the slabs.
+
+    This is an internal helper for the containers of this library, and is not
+    exported through the public API.
+*/
+typedef struct Pool_t {
+
+    /*
+        Slabs is the most recently allocated slab. The first word of each
+        slab links to the slab allocated before it.
+    */
+    void* Slabs;
+
+    /*
+        FreeList is the most recently released object. The first word of each
+        released object links to the object released before it.
+    */
+    void* FreeList;
+
+    /*
+        Unused points to the next never-used object of the newest slab, with
+        Remaining of them left before another slab is required.
+    */
+    uint8_t* Unused;
+    size_t   Remaining;
+
+    /*
+        ObjectSize is the size of each object, rounded up to a multiple of
+        the size of Pool_Align_t.
+    */
+    size_t ObjectSize;
+
+    /*
+        SlabObjects is the number of objects carved from each slab.
+    */
+    size_t SlabObjects;
+
+    /*
+        InUse counts the objects currently handed out by the Pool.
+    */
+    size_t InUse;
+
+    /*
+        References counts the holders of the Pool, each of which must call
+        Pool_Release() once. The Pool is only freed once the last holder does.
+    */
+    size_t References;
+} Pool_t;
+
+/*
+    Pool_Create
+
+    This function creates a new, empty Pool_t for objects of the given size.
+    No slabs are allocated until the first object is requested.
+
+    Inputs:
+    ObjectSize  -   The size, in bytes, of each object the Pool will provide.
+
+    Outputs:
+    Pool_t*     -   Pointer to the new Pool, or NULL on failure.
+*/
+Pool_t* Pool_Create(size_t ObjectSize);
+
+/*
+    Pool_Alloc
+
+    This function returns a zero-filled object from the Pool, re-using a released
+    object if one is available, and allocating a new slab only if none remain.
+
+    Inputs:
+    Pool    -   Pointer to the Pool to allocate from.
+
+    Outputs:
+    void*   -   Pointer to the object, or NULL on failure.
+*/
+void* Pool_Alloc(Pool_t* Pool);
+
+/*
+    Pool_Free
+
+    This function returns an object to the Pool it was allocated from, making
+    it available to later Pool_Alloc() calls.
+
+    Inputs:
+    Pool    -   Pointer to the Pool the object was allocated from.
+    Object  -   Pointer to the object to release. May be NULL.
+
+    Outputs:
+    None, the object is placed on the free list of the Pool.
+*/
+void Pool_Free(Pool_t* Pool, void* Object);
+
+/*
+    Pool_Reset
+
+    This function releases every slab of the Pool at once, invalidating every
+    object it has provided.
+
+    Inputs:
+    Pool    -   Pointer to the Pool to reset.
+
+    Outputs:
+    None, the Pool is returned to its freshly created state.
+
+    Note:
+    Any resources referenced by the objects must be released before this is called.
+*/
+void Pool_Reset(Pool_t* Pool);
+
+/*
+    Pool_Retain
+
+    This function adds a holder to the Pool, keeping it and every object it
+    has provided alive until a matching call to Pool_Release().
+
+    Inputs:
+    Pool    -   Pointer to the Pool to retain.
+
+    Outputs:
+    Pool_t* -   The same Pool, for convenience.
+*/
+Pool_t* Pool_Retain(Pool_t* Pool);
+
+/*
+    Pool_Release
+
+    This function drops a holder of the Pool. Once the last holder is dropped,
+    this releases every slab of the Pool, and the Pool itself.
+
+    Inputs:
+    Pool    -   Pointer to the Pool to release.
+
+    Outputs:
+    None, the Pool and all objects it provided are released.
+*/
+void Pool_Release(Pool_t* Pool);
+
+#if defined(TESTING) || defined(DEBUGGER)
+
+#include "pool_test.h"
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,164 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../logging/logging.h"
+#include "include/pool.h"
+
+Pool_t *Pool_Create(size_t ObjectSize) {
+
+    Pool_t *Pool = NULL;
+
+    if ( 0 == ObjectSize ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Cannot create Pool_t of 0-sized objects.");
+#endif
+        return NULL;
+    }
+
+    Pool = (Pool_t *)calloc(1, sizeof(Pool_t));
+    if ( NULL == Pool ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Pool_t.");
+#endif
+        return NULL;
+    }
+
+    /* Every object must be able to hold the free list link, and keep the next object aligned. */
+    Pool->ObjectSize =
+        ((ObjectSize + sizeof(Pool_Align_t) - 1) / sizeof(Pool_Align_t)) * sizeof(Pool_Align_t);
+    Pool->SlabObjects = (LIBCONTAINER_POOL_SLAB_SIZE - sizeof(Pool_Align_t)) / Pool->ObjectSize;
+    if ( 0 == Pool->SlabObjects ) {
+        Pool->SlabObjects = 1;
+    }
+    Pool->References = 1;
+
+#ifdef DEBUG
+    DEBUG_PRINTF("Successfully created Pool_t of [ %lu ] byte objects.",
+                 (unsigned long)Pool->ObjectSize);
+#endif
+    return Pool;
+}
+
+void *Pool_Alloc(Pool_t *Pool) {
+
+    uint8_t *Object = NULL, *Slab = NULL;
+
+    if ( NULL == Pool ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Pool* provided.");
+#endif
+        return NULL;
+    }
+
+    if ( NULL != Pool->FreeList ) {
+        Object         = (uint8_t *)Pool->FreeList;
+        Pool->FreeList = *(void **)Pool->FreeList;
+    } else {
+        if ( 0 == Pool->Remaining ) {
+            Slab = (uint8_t *)malloc(sizeof(Pool_Align_t) + (Pool->SlabObjects * Pool->ObjectSize));
+            if ( NULL == Slab ) {
+#ifdef DEBUG
+                DEBUG_PRINTF("%s", "Error: Failed to allocate memory for new Pool_t slab.");
+#endif
+                return NULL;
+            }
+            *(void **)Slab  = Pool->Slabs;
+            Pool->Slabs     = Slab;
+            Pool->Unused    = Slab + sizeof(Pool_Align_t);
+            Pool->Remaining = Pool->SlabObjects;
+        }
+        Object = Pool->Unused;
+        Pool->Unused += Pool->ObjectSize;
+        Pool->Remaining--;
+    }
+
+    memset(Object, 0, Pool->ObjectSize);
+    Pool->InUse++;
+    return Object;
+}
+
+void Pool_Free(Pool_t *Pool, void *Object) {
+
+    if ( (NULL == Pool) || (NULL == Object) ) {
+        return;
+    }
+
+    *(void **)Object = Pool->FreeList;
+    Pool->FreeList   = Object;
+    Pool->InUse--;
+
+    return;
+}
+
+void Pool_Reset(Pool_t *Pool) {
+
+    void *Slab = NULL;
+
+    if ( NULL == Pool ) {
+        return;
+    }
+
+    while ( NULL != Pool->Slabs ) {
+        Slab        = Pool->Slabs;
+        Pool->Slabs = *(void **)Slab;
+        free(Slab);
+    }
+
+    Pool->FreeList  = NULL;
+    Pool->Unused    = NULL;
+    Pool->Remaining = 0;
+    Pool->InUse     = 0;
+
+    return;
+}
+
+Pool_t *Pool_Retain(Pool_t *Pool) {
+
+    if ( NULL != Pool ) {
+        Pool->References++;
+    }
+
+    return Pool;
+}
+
+void Pool_Release(Pool_t *Pool) {
+
+    if ( NULL == Pool ) {
+        return;
+    }
+
+    if ( 0 != --(Pool->References) ) {
+        return;
+    }
+
+    Pool_Reset(Pool);
+
+    ZERO_CONTAINER(Pool, Pool_t);
+    free(Pool);
+
+    return;
+}
@@ -0,0 +1,149 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../logging/logging.h"
+#include "include/pool.h"
+
+int Test_pool(void) {
+
+    int FailedTests = 0;
+
+    FailedTests += Test_Pool_Alloc();
+    FailedTests += Test_Pool_Reset();
+
+    return FailedTests;
+}
+
+int Test_Pool_Alloc(void) {
+
+    Pool_t *Pool = NULL;
+    int *   Objects[1000], *Recycled = NULL;
+    size_t  Count = 1000, i = 0, j = 0;
+
+    Pool = Pool_Create(3 * sizeof(int));
+    if ( NULL == Pool ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Pool_t for testing.");
+        TEST_FAILURE;
+    }
+
+    if ( 0 != (Pool->ObjectSize % sizeof(Pool_Align_t)) ) {
+        TEST_PRINTF("Test Failure - Object size (%lu) is not a multiple of the alignment.",
+                    (unsigned long)Pool->ObjectSize);
+        Pool_Release(Pool);
+        TEST_FAILURE;
+    }
+
+    /* Span several slabs, and check no two live objects overlap. */
+    for ( i = 0; i < Count; i++ ) {
+        Objects[i] = (int *)Pool_Alloc(Pool);
+        if ( (NULL == Objects[i]) || (0 != Objects[i][0]) || (0 != Objects[i][2]) ) {
+            TEST_PRINTF("Test Failure - Object (%lu) was not allocated zero-filled.",
+                        (unsigned long)i);
+            Pool_Release(Pool);
+            TEST_FAILURE;
+        }
+        Objects[i][0] = (int)i;
+        Objects[i][2] = (int)i;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        if ( ((int)i != Objects[i][0]) || ((int)i != Objects[i][2]) ) {
+            TEST_PRINTF("Test Failure - Object (%lu) was overwritten by another object.",
+                        (unsigned long)i);
+            Pool_Release(Pool);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( i = 0; i < Count; i += 2 ) { Pool_Free(Pool, Objects[i]); }
+
+    if ( (Count / 2) != Pool->InUse ) {
+        TEST_PRINTF("Test Failure - Pool reports (%lu) objects in use, expected (%lu).",
+                    (unsigned long)Pool->InUse, (unsigned long)(Count / 2));
+        Pool_Release(Pool);
+        TEST_FAILURE;
+    }
+
+    /* Released objects are re-used before any new memory is carved out. */
+    for ( i = 0; i < Count / 2; i++ ) {
+        Recycled = (int *)Pool_Alloc(Pool);
+        for ( j = 0; (j < Count) && (Recycled != Objects[j]); j += 2 ) { ; }
+        if ( j >= Count ) {
+            TEST_PRINTF("%s", "Test Failure - Pool allocated new memory while objects were free.");
+            Pool_Release(Pool);
+            TEST_FAILURE;
+        }
+    }
+
+    Pool_Release(Pool);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Pool_Reset(void) {
+
+    Pool_t *Pool = NULL;
+    size_t  i    = 0;
+
+    Pool = Pool_Create(LIBCONTAINER_POOL_SLAB_SIZE * 2);
+    if ( NULL == Pool ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Pool_t for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 8; i++ ) {
+        if ( NULL == Pool_Alloc(Pool) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to allocate object larger than a slab.");
+            Pool_Release(Pool);
+            TEST_FAILURE;
+        }
+    }
+
+    Pool_Reset(Pool);
+    if ( (0 != Pool->InUse) || (NULL != Pool->Slabs) || (NULL != Pool->FreeList) ) {
+        TEST_PRINTF("%s", "Test Failure - Pool_t still holds memory after reset.");
+        Pool_Release(Pool);
+        TEST_FAILURE;
+    }
+
+    if ( NULL == Pool_Alloc(Pool) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to allocate from Pool_t after reset.");
+        Pool_Release(Pool);
+        TEST_FAILURE;
+    }
+
+    /* A retained Pool outlives the release of its first holder. */
+    Pool_Retain(Pool);
+    Pool_Release(Pool);
+    if ( 1 != Pool->InUse ) {
+        TEST_PRINTF("%s", "Test Failure - Retained Pool_t was released by its first holder.");
+        Pool_Release(Pool);
+        TEST_FAILURE;
+    }
+
+    Pool_Release(Pool);
+    TEST_SUCCESSFUL;
+}
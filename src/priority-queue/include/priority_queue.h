@@ -36,13 +36,53 @@ extern "C" {
 #define LIBCONTAINER_ENABLE_BINARY_HEAP
 #include "../../../include/libcontainer.h"
 
+#include "priority_queue_concurrent.h"
+#include "priority_queue_radix.h"
+#include "priority_queue_typed.h"
+
 struct Priority_Queue_t {
 
     /*
         A Priority Queue is simply an interface over an existing Binary Heap
         structure. The priority queue simply enforces integer keys.
+
+        This is NULL for a Queue from Priority_Queue_CreateTyped(),
+        Priority_Queue_CreateMonotone() or Priority_Queue_CreateConcurrent(), which
+        hold their items themselves.
     */
     Binary_Heap_t* Items;
+
+    /*
+        Type is the native type of the Priorities held by the Queue, and Ascending
+        records whether the highest Priorities are returned first.
+    */
+    Priority_Queue_Priority_t Type;
+    bool                      Ascending;
+
+    /*
+        The remaining fields are only used by a typed Queue. Entries is a 4-ary
+        min-heap of Count Entries, ordered by their encoded Keys, with room for
+        Capacity Entries in total. NextEntry is the iteration cursor.
+    */
+    Priority_Queue_Entry_t* Entries;
+    size_t                  Count;
+    size_t                  Capacity;
+    size_t                  NextEntry;
+
+    /*
+        A monotone Queue leaves Entries unused, and instead spreads its Count Entries
+        over PRIORITY_QUEUE_RADIX_BUCKETS Buckets, relative to the Last Key returned.
+        Buckets is NULL for any other Queue.
+    */
+    Priority_Queue_Bucket_t* Buckets;
+    uint64_t                 Last;
+
+    /*
+        Concurrent holds the independently locked heaps of a Queue from
+        Priority_Queue_CreateConcurrent(). This is NULL for any other Queue, and
+        when it is non-NULL every operation is forwarded to one or more of its heaps.
+    */
+    Priority_Queue_Concurrent_t* Concurrent;
 };
 
 #if defined(TESTING) || defined(DEBUGGER)
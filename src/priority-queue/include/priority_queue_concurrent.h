@@ -0,0 +1,281 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef LIBCONTAINER_PRIORITY_QUEUE_CONCURRENT_H
+#define LIBCONTAINER_PRIORITY_QUEUE_CONCURRENT_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define LIBCONTAINER_ENABLE_PRIORITY_QUEUE
+#include "../../../include/libcontainer.h"
+
+#ifndef LIBCONTAINER_PRIORITY_QUEUE_CONCURRENT_HEAPS
+/*
+    LIBCONTAINER_PRIORITY_QUEUE_CONCURRENT_HEAPS
+
+    This macro defines the number of independently locked heaps a concurrent
+    Priority Queue is split into when no explicit count is requested. Two to four
+    heaps per thread using the Queue keeps lock collisions rare, so the default
+    suits a pool of four to eight workers.
+
+    This is tunable during build-time be re-defining this macro
+    with the desired integer value.
+*/
+#define LIBCONTAINER_PRIORITY_QUEUE_CONCURRENT_HEAPS 16
+#endif
+
+#ifndef LIBCONTAINER_PRIORITY_QUEUE_CONCURRENT_ATTEMPTS
+/*
+    LIBCONTAINER_PRIORITY_QUEUE_CONCURRENT_ATTEMPTS
+
+    This macro defines how many random heaps a concurrent Priority Queue tries
+    to lock without waiting, before it falls back to waiting on the locks in turn.
+
+    This is tunable during build-time be re-defining this macro
+    with the desired integer value.
+*/
+#define LIBCONTAINER_PRIORITY_QUEUE_CONCURRENT_ATTEMPTS 4
+#endif
+
+/*
+    Priority_Queue_Shard_t
+
+    A single heap of a concurrent Priority Queue, and the lock guarding it.
+    This is only ever defined within the translation unit providing the
+    concurrent operations, as it requires the platform threading headers.
+*/
+typedef struct Priority_Queue_Shard_t Priority_Queue_Shard_t;
+
+/*
+    Priority_Queue_Concurrent_t
+
+    The set of heaps making up a concurrent Priority Queue, along with the
+    per-thread random state used to choose between them. This is defined
+    alongside Priority_Queue_Shard_t for the same reason.
+*/
+typedef struct Priority_Queue_Concurrent_t Priority_Queue_Concurrent_t;
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+/*
+    Priority_Queue_concurrentRandom
+
+    This function picks a heap of a concurrent Priority Queue uniformly at random,
+    using a random state private to the calling thread.
+
+    Inputs:
+    Concurrent  -   Pointer to the heaps of the concurrent Queue.
+
+    Outputs:
+    size_t  -   The index of the chosen heap.
+*/
+size_t Priority_Queue_concurrentRandom(Priority_Queue_Concurrent_t* Concurrent);
+
+/*
+    Priority_Queue_concurrentLockAny
+
+    This function locks one heap of a concurrent Priority Queue chosen at random,
+    for a new item to be added to. Busy heaps are skipped over while possible.
+
+    Inputs:
+    Concurrent  -   Pointer to the heaps of the concurrent Queue.
+
+    Outputs:
+    Priority_Queue_Shard_t* -   Pointer to the locked heap. The caller must unlock it.
+*/
+Priority_Queue_Shard_t* Priority_Queue_concurrentLockAny(Priority_Queue_Concurrent_t* Concurrent);
+
+/*
+    Priority_Queue_concurrentLockBest
+
+    This function locks the heap of a concurrent Priority Queue holding the next
+    item to take. Two heaps are chosen at random and the one with the better front
+    item is kept, so the item returned is close to, but not always, the best of
+    the whole Queue. If the chosen heaps are busy or empty a few more pairs are
+    tried, before every heap is checked in turn.
+
+    Inputs:
+    Queue   -   Pointer to the concurrent Priority_Queue_t to operate on.
+
+    Outputs:
+    Priority_Queue_Shard_t* -   Pointer to the locked, non-empty heap, or NULL if every
+                                    heap was found empty. The caller must unlock it.
+*/
+Priority_Queue_Shard_t* Priority_Queue_concurrentLockBest(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_concurrentPush
+
+    This function is the concurrent counterpart to Priority_Queue_Push(), locking
+    only the heap the item is added to.
+
+    Inputs:
+    Queue       -   Pointer to the concurrent Priority_Queue_t to operate on.
+    Priority    -   The Priority of the new item.
+    Value       -   Pointer to the Value of the new item.
+    ValueSize   -   Size of the Value, or 0 to hold it by reference.
+    ReleaseFunc -   Pointer to the function to call to release the Value.
+
+    Outputs:
+    int     -   Returns 0 on success, nonzero on failure.
+*/
+int Priority_Queue_concurrentPush(Priority_Queue_t* Queue, int Priority, void* Value, size_t ValueSize, ReleaseFunc_t* ReleaseFunc);
+
+/*
+    Priority_Queue_concurrentPushN
+
+    This function is the concurrent counterpart to Priority_Queue_PushN(). The batch
+    is split evenly over every heap, with each share added in one locked step.
+
+    Inputs:
+    Queue       -   Pointer to the concurrent Priority_Queue_t to operate on.
+    Priorities  -   Array of Count Priorities.
+    Values      -   Array of Count Values, or of Count pointers if ValueSize is 0.
+    ValueSize   -   Size of each Value, or 0 to hold them by reference.
+    Count       -   The number of items to add.
+    ReleaseFunc -   Pointer to the function to call to release each Value.
+
+    Outputs:
+    int     -   Returns 0 on success, nonzero on failure. Shares added before a failure remain.
+*/
+int Priority_Queue_concurrentPushN(Priority_Queue_t* Queue, int* Priorities, uint8_t* Values, size_t ValueSize, size_t Count, ReleaseFunc_t* ReleaseFunc);
+
+/*
+    Priority_Queue_concurrentPeek
+
+    This function finds the best front item over every heap of a concurrent
+    Priority Queue, locking each heap only while it is inspected.
+
+    Inputs:
+    Queue   -   Pointer to the concurrent Priority_Queue_t to operate on.
+
+    Outputs:
+    Priority_Queue_Item_t   -   The best front item, or an empty Item if the Queue is empty.
+*/
+Priority_Queue_Item_t Priority_Queue_concurrentPeek(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_concurrentPop
+
+    This function is the concurrent counterpart to Priority_Queue_Pop(), see
+    Priority_Queue_concurrentLockBest() for how the item is chosen.
+
+    Inputs:
+    Queue   -   Pointer to the concurrent Priority_Queue_t to operate on.
+
+    Outputs:
+    Priority_Queue_Item_t   -   The removed item, or an empty Item if the Queue is empty.
+*/
+Priority_Queue_Item_t Priority_Queue_concurrentPop(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_concurrentRemove
+
+    This function is the concurrent counterpart to Priority_Queue_Remove().
+
+    Inputs:
+    Queue   -   Pointer to the concurrent Priority_Queue_t to operate on.
+
+    Outputs:
+    int     -   Returns 0 on success, nonzero on failure.
+*/
+int Priority_Queue_concurrentRemove(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_concurrentLength
+
+    This function sums the lengths of each heap of a concurrent Priority Queue.
+    As each heap is only locked while it is being counted, the result is only
+    exact when no other thread is using the Queue.
+
+    Inputs:
+    Queue   -   Pointer to the concurrent Priority_Queue_t to query.
+
+    Outputs:
+    size_t  -   The count of items contained within the Queue.
+*/
+size_t Priority_Queue_concurrentLength(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_concurrentNext
+
+    This function iterates over each heap of a concurrent Priority Queue in turn,
+    with the Cursor of the Queue tracking the current heap.
+
+    Inputs:
+    Queue   -   Pointer to the concurrent Priority_Queue_t to iterate over.
+
+    Outputs:
+    Priority_Queue_Item_t   -   The next item, or an empty Item once iteration is complete.
+*/
+Priority_Queue_Item_t Priority_Queue_concurrentNext(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_concurrentClear
+
+    This function clears every heap of a concurrent Priority Queue in turn.
+
+    Inputs:
+    Queue   -   Pointer to the concurrent Priority_Queue_t to clear.
+
+    Outputs:
+    int     -   Returns 0 on success, nonzero on failure.
+*/
+int Priority_Queue_concurrentClear(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_concurrentRelease
+
+    This function releases every heap of a concurrent Priority Queue, along with
+    their locks and the random state of the calling thread.
+
+    Inputs:
+    Concurrent  -   Pointer to the heaps to release. This may be partially initialized.
+
+    Outputs:
+    None, the heaps are released.
+*/
+void Priority_Queue_concurrentRelease(Priority_Queue_Concurrent_t* Concurrent);
+
+/* ---------- Private Functions ---------- */
+
+#if defined(TESTING) || defined(DEBUGGER)
+
+#include "priority_queue_concurrent_test.h"
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,190 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+
+#ifndef LIBCONTAINER_PRIORITY_QUEUE_RADIX_H
+#define LIBCONTAINER_PRIORITY_QUEUE_RADIX_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define LIBCONTAINER_ENABLE_PRIORITY_QUEUE
+#include "../../../include/libcontainer.h"
+
+#include "priority_queue_typed.h"
+
+/*
+    PRIORITY_QUEUE_RADIX_BUCKETS
+
+    The number of Buckets of a monotone Queue. Bucket 0 holds the Entries whose Key
+    equals the Last Key returned, and Bucket b holds those whose Key first differs
+    from it at bit (b - 1), counting from the least significant bit.
+*/
+#define PRIORITY_QUEUE_RADIX_BUCKETS 65
+
+/*
+    Priority_Queue_Bucket_t
+
+    This struct is a single Bucket of a monotone Priority_Queue_t, an unordered
+    array of Count Entries with room for Capacity Entries in total.
+*/
+typedef struct Priority_Queue_Bucket_t {
+    Priority_Queue_Entry_t* Entries;
+    size_t                  Count;
+    size_t                  Capacity;
+} Priority_Queue_Bucket_t;
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+/*
+    Priority_Queue_radixBucket
+
+    This function returns the index of the Bucket an Entry with the given Key belongs
+    in, relative to the Last Key of the Queue.
+
+    Inputs:
+    Queue   -   Pointer to the monotone Priority_Queue_t the Key is for.
+    Key     -   The encoded Key, which must not be less than the Last Key of the Queue.
+
+    Outputs:
+    size_t  -   The index of the Bucket, from 0 to PRIORITY_QUEUE_RADIX_BUCKETS - 1.
+*/
+size_t Priority_Queue_radixBucket(Priority_Queue_t* Queue, uint64_t Key);
+
+/*
+    Priority_Queue_radixReserve
+
+    This function grows a Bucket to hold at least Count more Entries.
+
+    Inputs:
+    Bucket  -   Pointer to the Priority_Queue_Bucket_t to grow.
+    Count   -   The number of Entries which are about to be added.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure. On failure, the Bucket is unchanged.
+*/
+int Priority_Queue_radixReserve(Priority_Queue_Bucket_t* Bucket, size_t Count);
+
+/*
+    Priority_Queue_radixPush
+
+    This function adds a new Entry with the given Key to a monotone Queue in O(1).
+
+    Inputs:
+    Queue       -   Pointer to the monotone Priority_Queue_t to operate on.
+    Key         -   The encoded Priority of the new Entry.
+    Value       -   Pointer to the raw item to add to the Queue.
+    ValueSize   -   The size of the item, or 0 to hold the Value by reference.
+    ReleaseFunc -   Pointer to the function to release the Value with.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure, including when the Key is
+                    less than the Last Key returned from the Queue.
+*/
+int Priority_Queue_radixPush(Priority_Queue_t* Queue, uint64_t Key, void* Value, size_t ValueSize, ReleaseFunc_t* ReleaseFunc);
+
+/*
+    Priority_Queue_radixPushN
+
+    This function adds Count new Entries to a monotone Queue, as for Priority_Queue_PushN().
+
+    Inputs:
+    Queue       -   Pointer to the monotone Priority_Queue_t to operate on.
+    Priorities  -   Pointer to the Count int Priorities of the new Entries.
+    Values      -   Pointer to the Count Values to add, as for Priority_Queue_PushN().
+    ValueSize   -   The size of each Value, or 0 to hold the Values by reference.
+    Count       -   The number of Entries to add.
+    ReleaseFunc -   Pointer to the function to release each Value with.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure. On failure, the Queue is unchanged.
+*/
+int Priority_Queue_radixPushN(Priority_Queue_t* Queue, int* Priorities, uint8_t* Values, size_t ValueSize, size_t Count, ReleaseFunc_t* ReleaseFunc);
+
+/*
+    Priority_Queue_radixSettle
+
+    This function ensures Bucket 0 holds the front of a non-empty monotone Queue. If
+    it is empty, the lowest non-empty Bucket is found, its smallest Key becomes the
+    Last Key, and its Entries are redistributed into the Buckets below it.
+
+    Inputs:
+    Queue   -   Pointer to the monotone Priority_Queue_t to operate on.
+
+    Outputs:
+    int     -   Returns 0 if Bucket 0 now holds the front of the Queue, non-zero if
+                    the Queue is empty or memory could not be allocated. On failure,
+                    the Queue is unchanged.
+*/
+int Priority_Queue_radixSettle(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_radixNext
+
+    This function returns the next Entry of a monotone Queue, in storage order.
+
+    Inputs:
+    Queue   -   Pointer to the monotone Priority_Queue_t to operate on.
+
+    Outputs:
+    Priority_Queue_Entry_t* -   Pointer to the next Entry, or NULL once every Entry has
+                                    been visited, after which iteration starts over.
+*/
+Priority_Queue_Entry_t* Priority_Queue_radixNext(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_radixClear
+
+    This function releases the Values of every Entry of a monotone Queue, leaving
+    the Queue empty but keeping the Buckets allocated. The Last Key is reset, so
+    any Priority may be pushed again.
+
+    Inputs:
+    Queue   -   Pointer to the monotone Priority_Queue_t to operate on.
+
+    Outputs:
+    None, the Queue is emptied.
+*/
+void Priority_Queue_radixClear(Priority_Queue_t* Queue);
+
+/* ---------- Private Functions ---------- */
+
+#if defined(TESTING) || defined(DEBUGGER)
+
+#include "priority_queue_radix_test.h"
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
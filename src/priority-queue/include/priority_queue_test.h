@@ -41,10 +41,14 @@ int Test_Priority_Queue_Peek(void);
 int Test_Priority_Queue_Pop(void);
 int Test_Priority_Queue_Remove(void);
 int Test_Priority_Queue_Push(void);
+int Test_Priority_Queue_PushN(void);
+int Test_Priority_Queue_Handles(void);
 int Test_Priority_Queue_Next(void);
 int Test_Priority_Queue_DoCallback(void);
 int Test_Priority_Queue_DoCallbackArg(void);
 int Test_Priority_Queue_Clear(void);
+int Test_Priority_Queue_Merge(void);
+int Test_Priority_Queue_DoubleEnded(void);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,352 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+
+#ifndef LIBCONTAINER_PRIORITY_QUEUE_TYPED_H
+#define LIBCONTAINER_PRIORITY_QUEUE_TYPED_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define LIBCONTAINER_ENABLE_PRIORITY_QUEUE
+#include "../../../include/libcontainer.h"
+
+#ifndef LIBCONTAINER_PRIORITY_QUEUE_TYPED_CAPACITY
+/*
+    LIBCONTAINER_PRIORITY_QUEUE_TYPED_CAPACITY
+
+    This macro defines the number of Entries initially allocated for a
+    Priority_Queue_t created by Priority_Queue_CreateTyped(). The Entries double
+    in number each time they fill.
+
+    This is tunable during build-time be re-defining this macro
+    with the desired integer value.
+*/
+#define LIBCONTAINER_PRIORITY_QUEUE_TYPED_CAPACITY 16
+#endif
+
+/*
+    PRIORITY_QUEUE_TYPED_ARITY_SHIFT
+
+    The Entries of a typed Queue form a heap with (1 << PRIORITY_QUEUE_TYPED_ARITY_SHIFT)
+    children per Entry. Four children of 24 bytes each share one or two cache lines,
+    halving the depth of the heap for at most one extra miss per level.
+*/
+#define PRIORITY_QUEUE_TYPED_ARITY_SHIFT 2
+
+/*
+    Priority_Queue_Entry_t
+
+    This struct is a single item of a typed Priority_Queue_t. The Priority is held
+    as an encoded Key, an unsigned integer which sorts in the order the items are to
+    be returned, so every comparison is a single integer comparison regardless of
+    the Type of the Queue.
+*/
+typedef struct Priority_Queue_Entry_t {
+
+    /*
+        Key is the encoded Priority of this Entry, see Priority_Queue_typedEncode().
+    */
+    uint64_t Key;
+
+    /*
+        Value is a pointer to the raw item held by this Entry.
+    */
+    void* Value;
+
+    /*
+        ReleaseFunc is a pointer to the function to call to release the resources
+        held by the Value pointer.
+    */
+    ReleaseFunc_t* ReleaseFunc;
+
+} Priority_Queue_Entry_t;
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+/*
+    Priority_Queue_typedEncode
+
+    This function encodes a Priority of the native Type of the Queue as a Key.
+    Keys compare as unsigned integers in exactly the order the Priorities should
+    be returned from the Queue, the smallest Key first.
+
+    Inputs:
+    Queue       -   Pointer to the typed Priority_Queue_t the Key is for.
+    Priority    -   Pointer to the int, int64_t or double Priority to encode.
+
+    Outputs:
+    uint64_t    -   The encoded Key.
+*/
+uint64_t Priority_Queue_typedEncode(Priority_Queue_t* Queue, void* Priority);
+
+/*
+    Priority_Queue_typedDecode
+
+    This function reverses Priority_Queue_typedEncode(), writing out the Priority
+    a Key was encoded from.
+
+    Inputs:
+    Queue       -   Pointer to the typed Priority_Queue_t the Key is from.
+    Key         -   The encoded Key to decode.
+    Priority    -   Pointer to the int, int64_t or double to write the Priority into.
+
+    Outputs:
+    None, the Priority is written out.
+*/
+void Priority_Queue_typedDecode(Priority_Queue_t* Queue, uint64_t Key, void* Priority);
+
+/*
+    Priority_Queue_typedEncodeInt
+
+    This function encodes an int Priority as a Key, first converting it to the
+    native Type of the Queue.
+
+    Inputs:
+    Queue       -   Pointer to the typed Priority_Queue_t the Key is for.
+    Priority    -   The int Priority to encode.
+
+    Outputs:
+    uint64_t    -   The encoded Key.
+*/
+uint64_t Priority_Queue_typedEncodeInt(Priority_Queue_t* Queue, int Priority);
+
+/*
+    Priority_Queue_typedDecodeInt
+
+    This function decodes a Key back to its Priority, converted to an int.
+
+    Inputs:
+    Queue   -   Pointer to the typed Priority_Queue_t the Key is from.
+    Key     -   The encoded Key to decode.
+
+    Outputs:
+    int     -   The Priority, converted from the native Type of the Queue.
+*/
+int Priority_Queue_typedDecodeInt(Priority_Queue_t* Queue, uint64_t Key);
+
+/*
+    Priority_Queue_typedReserve
+
+    This function grows the Entries of a typed Queue to hold at least Count more Entries.
+
+    Inputs:
+    Queue   -   Pointer to the typed Priority_Queue_t to operate on.
+    Count   -   The number of Entries which are about to be added.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure. On failure, the Queue is unchanged.
+*/
+int Priority_Queue_typedReserve(Priority_Queue_t* Queue, size_t Count);
+
+/*
+    Priority_Queue_typedPush
+
+    This function adds a new Entry with the given Key to a typed Queue, and sifts
+    it up into place.
+
+    Inputs:
+    Queue       -   Pointer to the typed Priority_Queue_t to operate on.
+    Key         -   The encoded Priority of the new Entry.
+    Value       -   Pointer to the raw item to add to the Queue.
+    ValueSize   -   The size of the item, or 0 to hold the Value by reference.
+    ReleaseFunc -   Pointer to the function to release the Value with.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure.
+*/
+int Priority_Queue_typedPush(Priority_Queue_t* Queue, uint64_t Key, void* Value, size_t ValueSize, ReleaseFunc_t* ReleaseFunc);
+
+/*
+    Priority_Queue_typedPushN
+
+    This function adds Count new Entries to a typed Queue, as for Priority_Queue_PushN().
+    When Count is at least the number of Entries already held, the whole Queue is
+    rebuilt bottom-up in O(n), otherwise each new Entry is sifted up in turn.
+
+    Inputs:
+    Queue       -   Pointer to the typed Priority_Queue_t to operate on.
+    Priorities  -   Pointer to the Count int Priorities of the new Entries.
+    Values      -   Pointer to the Count Values to add, as for Priority_Queue_PushN().
+    ValueSize   -   The size of each Value, or 0 to hold the Values by reference.
+    Count       -   The number of Entries to add.
+    ReleaseFunc -   Pointer to the function to release each Value with.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure. On failure, the Queue is unchanged.
+*/
+int Priority_Queue_typedPushN(Priority_Queue_t* Queue, int* Priorities, uint8_t* Values, size_t ValueSize, size_t Count, ReleaseFunc_t* ReleaseFunc);
+
+/*
+    Priority_Queue_typedMerge
+
+    This function moves every Entry of the typed Queue Src onto the end of the
+    typed Queue Dst, and then restores the heap property. No Value is copied.
+
+    Inputs:
+    Dst     -   Pointer to the typed Priority_Queue_t to merge into.
+    Src     -   Pointer to the typed Priority_Queue_t to merge from, of the same Type and order.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure. On failure, neither Queue is changed.
+*/
+int Priority_Queue_typedMerge(Priority_Queue_t* Dst, Priority_Queue_t* Src);
+
+/*
+    Priority_Queue_typedHeapify
+
+    This function restores the heap property of a typed Queue after new Entries have
+    been added to the end of its Entries, from Start onwards. When at least as many
+    Entries were added as were already held, the whole Queue is rebuilt bottom-up
+    in O(n), otherwise each new Entry is sifted up in turn.
+
+    Inputs:
+    Queue   -   Pointer to the typed Priority_Queue_t to operate on.
+    Start   -   Index of the first of the new Entries.
+
+    Outputs:
+    None, the heap property is restored.
+*/
+void Priority_Queue_typedHeapify(Priority_Queue_t* Queue, size_t Start);
+
+/*
+    Priority_Queue_typedPop
+
+    This function removes the Entry at the front of a typed Queue.
+
+    Inputs:
+    Queue   -   Pointer to the typed Priority_Queue_t to operate on.
+    Entry   -   Pointer to the Priority_Queue_Entry_t to copy the removed Entry into.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero if the Queue is empty.
+*/
+int Priority_Queue_typedPop(Priority_Queue_t* Queue, Priority_Queue_Entry_t* Entry);
+
+/*
+    Priority_Queue_typedPeek
+
+    This function returns the Entry at the front of a typed Queue, without removing it.
+
+    Inputs:
+    Queue   -   Pointer to the typed Priority_Queue_t to operate on.
+
+    Outputs:
+    Priority_Queue_Entry_t* -   Pointer to the front Entry, or NULL if the Queue is empty.
+                                    This is only valid until the Queue is next modified.
+*/
+Priority_Queue_Entry_t* Priority_Queue_typedPeek(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_typedNext
+
+    This function returns the next Entry of a typed Queue, in storage order.
+
+    Inputs:
+    Queue   -   Pointer to the typed Priority_Queue_t to operate on.
+
+    Outputs:
+    Priority_Queue_Entry_t* -   Pointer to the next Entry, or NULL once every Entry has
+                                    been visited, after which iteration starts over.
+*/
+Priority_Queue_Entry_t* Priority_Queue_typedNext(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_typedClear
+
+    This function releases the Values of every Entry of a typed Queue, leaving
+    the Queue empty but keeping the Entries allocated.
+
+    Inputs:
+    Queue   -   Pointer to the typed Priority_Queue_t to operate on.
+
+    Outputs:
+    None, the Queue is emptied.
+*/
+void Priority_Queue_typedClear(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_typedRelease
+
+    This function releases the Values of every Entry of a typed Queue, along with
+    all of the memory the Queue holds them in. The Queue itself is not freed.
+
+    Inputs:
+    Queue   -   Pointer to the typed Priority_Queue_t to operate on.
+
+    Outputs:
+    None, the contents of the Queue are released.
+*/
+void Priority_Queue_typedRelease(Priority_Queue_t* Queue);
+
+/*
+    Priority_Queue_typedSiftUp
+
+    This function moves the Entry at the given Index up towards the front of the
+    Queue until the heap property holds again.
+
+    Inputs:
+    Queue   -   Pointer to the typed Priority_Queue_t to operate on.
+    Index   -   Index of the Entry to sift up.
+
+    Outputs:
+    None, the heap property is restored.
+*/
+void Priority_Queue_typedSiftUp(Priority_Queue_t* Queue, size_t Index);
+
+/*
+    Priority_Queue_typedSiftDown
+
+    This function moves the Entry at the given Index down towards the leaves until
+    the heap property holds again.
+
+    Inputs:
+    Queue   -   Pointer to the typed Priority_Queue_t to operate on.
+    Index   -   Index of the Entry to sift down.
+
+    Outputs:
+    None, the heap property is restored.
+*/
+void Priority_Queue_typedSiftDown(Priority_Queue_t* Queue, size_t Index);
+
+/* ---------- Private Functions ---------- */
+
+#if defined(TESTING) || defined(DEBUGGER)
+
+#include "priority_queue_typed_test.h"
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -53,12 +53,85 @@ Priority_Queue_t *Priority_Queue_Create(bool Ascending) {
         return NULL;
     }
 
+    Queue->Type      = Priority_Int;
+    Queue->Ascending = Ascending;
+
 #ifdef DEBUG
     DEBUG_PRINTF("%s", "Successfully created Priority_Queue_t.");
 #endif
     return Queue;
 }
 
+Priority_Queue_t *Priority_Queue_CreateMeldable(bool Ascending) {
+
+    Priority_Queue_t *Queue = NULL;
+
+    Queue = (Priority_Queue_t *)calloc(1, sizeof(Priority_Queue_t));
+    if ( NULL == Queue ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Priority_Queue_t.");
+#endif
+        return NULL;
+    }
+
+    if ( Ascending ) {
+        Queue->Items = Binary_Heap_CreateMeldable(CompareFunc_Int_Ascending, NULL);
+    } else {
+        Queue->Items = Binary_Heap_CreateMeldable(CompareFunc_Int_Descending, NULL);
+    }
+
+    if ( NULL == Queue->Items ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate internal memory to hold Queued items.");
+#endif
+        free(Queue);
+        return NULL;
+    }
+
+    Queue->Type      = Priority_Int;
+    Queue->Ascending = Ascending;
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully created meldable Priority_Queue_t.");
+#endif
+    return Queue;
+}
+
+Priority_Queue_t *Priority_Queue_CreateDoubleEnded(bool Ascending) {
+
+    Priority_Queue_t *Queue = NULL;
+
+    Queue = (Priority_Queue_t *)calloc(1, sizeof(Priority_Queue_t));
+    if ( NULL == Queue ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Priority_Queue_t.");
+#endif
+        return NULL;
+    }
+
+    if ( Ascending ) {
+        Queue->Items = Binary_Heap_CreateMinMax(CompareFunc_Int_Ascending, NULL);
+    } else {
+        Queue->Items = Binary_Heap_CreateMinMax(CompareFunc_Int_Descending, NULL);
+    }
+
+    if ( NULL == Queue->Items ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate internal memory to hold Queued items.");
+#endif
+        free(Queue);
+        return NULL;
+    }
+
+    Queue->Type      = Priority_Int;
+    Queue->Ascending = Ascending;
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully created double-ended Priority_Queue_t.");
+#endif
+    return Queue;
+}
+
 size_t Priority_Queue_Length(Priority_Queue_t *Queue) {
 
     if ( NULL == Queue ) {
@@ -68,6 +141,14 @@ size_t Priority_Queue_Length(Priority_Queue_t *Queue) {
         return 0;
     }
 
+    if ( NULL != Queue->Concurrent ) {
+        return Priority_Queue_concurrentLength(Queue);
+    }
+
+    if ( NULL == Queue->Items ) {
+        return Queue->Count;
+    }
+
     return Binary_Heap_Length(Queue->Items);
 }
 
@@ -80,6 +161,14 @@ bool Priority_Queue_IsEmpty(Priority_Queue_t *Queue) {
         return true;
     }
 
+    if ( NULL != Queue->Concurrent ) {
+        return (0 == Priority_Queue_concurrentLength(Queue));
+    }
+
+    if ( NULL == Queue->Items ) {
+        return (0 == Queue->Count);
+    }
+
     return Binary_Heap_IsEmpty(Queue->Items);
 }
 
@@ -87,6 +176,7 @@ Priority_Queue_Item_t Priority_Queue_Peek(Priority_Queue_t *Queue) {
 
     Priority_Queue_Item_t      Item         = {0, NULL};
     Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    Priority_Queue_Entry_t *   Entry        = NULL;
 
     if ( NULL == Queue ) {
 #ifdef DEBUG
@@ -95,6 +185,18 @@ Priority_Queue_Item_t Priority_Queue_Peek(Priority_Queue_t *Queue) {
         return Item;
     }
 
+    if ( NULL != Queue->Concurrent ) {
+        return Priority_Queue_concurrentPeek(Queue);
+    }
+
+    if ( NULL == Queue->Items ) {
+        if ( NULL != (Entry = Priority_Queue_typedPeek(Queue)) ) {
+            Item.Priority = Priority_Queue_typedDecodeInt(Queue, Entry->Key);
+            Item.Value    = Entry->Value;
+        }
+        return Item;
+    }
+
     KeyValuePair = Binary_Heap_Peek(Queue->Items);
     if ( NULL != KeyValuePair.Key ) {
         Item.Priority = *(int *)KeyValuePair.Key;
@@ -112,6 +214,7 @@ Priority_Queue_Item_t Priority_Queue_Pop(Priority_Queue_t *Queue) {
 
     Priority_Queue_Item_t      Item         = {0, NULL};
     Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    Priority_Queue_Entry_t     Entry;
 
     if ( NULL == Queue ) {
 #ifdef DEBUG
@@ -120,6 +223,18 @@ Priority_Queue_Item_t Priority_Queue_Pop(Priority_Queue_t *Queue) {
         return Item;
     }
 
+    if ( NULL != Queue->Concurrent ) {
+        return Priority_Queue_concurrentPop(Queue);
+    }
+
+    if ( NULL == Queue->Items ) {
+        if ( 0 == Priority_Queue_typedPop(Queue, &Entry) ) {
+            Item.Priority = Priority_Queue_typedDecodeInt(Queue, Entry.Key);
+            Item.Value    = Entry.Value;
+        }
+        return Item;
+    }
+
     KeyValuePair = Binary_Heap_Pop(Queue->Items);
     if ( NULL != KeyValuePair.Key ) {
         Item.Priority = *(int *)KeyValuePair.Key;
@@ -134,8 +249,136 @@ Priority_Queue_Item_t Priority_Queue_Pop(Priority_Queue_t *Queue) {
     return Item;
 }
 
+Priority_Queue_Item_t Priority_Queue_PeekBack(Priority_Queue_t *Queue) {
+
+    Priority_Queue_Item_t      Item         = {0, NULL};
+    Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+
+    if ( (NULL == Queue) || (NULL == Queue->Items) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL or non double-ended Queue* provided.");
+#endif
+        return Item;
+    }
+
+    KeyValuePair = Binary_Heap_PeekMin(Queue->Items);
+    if ( NULL != KeyValuePair.Key ) {
+        Item.Priority = *(int *)KeyValuePair.Key;
+    }
+
+    Item.Value = KeyValuePair.Value;
+
+    return Item;
+}
+
+Priority_Queue_Item_t Priority_Queue_PopBack(Priority_Queue_t *Queue) {
+
+    Priority_Queue_Item_t      Item         = {0, NULL};
+    Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+
+    if ( (NULL == Queue) || (NULL == Queue->Items) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL or non double-ended Queue* provided.");
+#endif
+        return Item;
+    }
+
+    KeyValuePair = Binary_Heap_PopMin(Queue->Items);
+    if ( NULL != KeyValuePair.Key ) {
+        Item.Priority = *(int *)KeyValuePair.Key;
+        free(KeyValuePair.Key);
+    }
+
+    Item.Value = KeyValuePair.Value;
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully Pop()'d back item from Priority_Queue_t.");
+#endif
+    return Item;
+}
+
+int Priority_Queue_PushTyped(Priority_Queue_t *Queue, void *Priority, void *Value, size_t ValueSize,
+                             ReleaseFunc_t *ReleaseFunc) {
+
+    if ( (NULL == Queue) || (NULL == Priority) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Queue* or Priority* provided.");
+#endif
+        return 1;
+    }
+
+    if ( (NULL == Queue->Items) && (NULL == Queue->Concurrent) ) {
+        return Priority_Queue_typedPush(Queue, Priority_Queue_typedEncode(Queue, Priority), Value,
+                                        ValueSize, ReleaseFunc);
+    }
+
+    return Priority_Queue_Push(Queue, *(int *)Priority, Value, ValueSize, ReleaseFunc);
+}
+
+void *Priority_Queue_PeekTyped(Priority_Queue_t *Queue, void *Priority) {
+
+    Priority_Queue_Item_t   Item  = {0, NULL};
+    Priority_Queue_Entry_t *Entry = NULL;
+
+    if ( NULL == Queue ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Queue* provided.");
+#endif
+        return NULL;
+    }
+
+    if ( (NULL == Queue->Items) && (NULL == Queue->Concurrent) ) {
+        if ( NULL == (Entry = Priority_Queue_typedPeek(Queue)) ) {
+            return NULL;
+        }
+        if ( NULL != Priority ) {
+            Priority_Queue_typedDecode(Queue, Entry->Key, Priority);
+        }
+        return Entry->Value;
+    }
+
+    Item = Priority_Queue_Peek(Queue);
+    if ( (NULL != Item.Value) && (NULL != Priority) ) {
+        *(int *)Priority = Item.Priority;
+    }
+
+    return Item.Value;
+}
+
+void *Priority_Queue_PopTyped(Priority_Queue_t *Queue, void *Priority) {
+
+    Priority_Queue_Item_t  Item = {0, NULL};
+    Priority_Queue_Entry_t Entry;
+
+    if ( NULL == Queue ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Queue* provided.");
+#endif
+        return NULL;
+    }
+
+    if ( (NULL == Queue->Items) && (NULL == Queue->Concurrent) ) {
+        if ( 0 != Priority_Queue_typedPop(Queue, &Entry) ) {
+            return NULL;
+        }
+        if ( NULL != Priority ) {
+            Priority_Queue_typedDecode(Queue, Entry.Key, Priority);
+        }
+        return Entry.Value;
+    }
+
+    Item = Priority_Queue_Pop(Queue);
+    if ( (NULL != Item.Value) && (NULL != Priority) ) {
+        *(int *)Priority = Item.Priority;
+    }
+
+    return Item.Value;
+}
+
 int Priority_Queue_Remove(Priority_Queue_t *Queue) {
 
+    Priority_Queue_Entry_t Entry;
+
     if ( NULL == Queue ) {
 #ifdef DEBUG
         DEBUG_PRINTF("%s", "Error: NULL Queue* provided.");
@@ -143,6 +386,17 @@ int Priority_Queue_Remove(Priority_Queue_t *Queue) {
         return 1;
     }
 
+    if ( NULL != Queue->Concurrent ) {
+        return Priority_Queue_concurrentRemove(Queue);
+    }
+
+    if ( NULL == Queue->Items ) {
+        if ( (0 == Priority_Queue_typedPop(Queue, &Entry)) && (NULL != Entry.Value) ) {
+            Entry.ReleaseFunc(Entry.Value);
+        }
+        return 0;
+    }
+
     return Binary_Heap_Remove(Queue->Items);
 }
 
@@ -156,14 +410,147 @@ int Priority_Queue_Push(Priority_Queue_t *Queue, int Priority, void *Value, size
         return 1;
     }
 
+    if ( NULL != Queue->Concurrent ) {
+        return Priority_Queue_concurrentPush(Queue, Priority, Value, ValueSize, ReleaseFunc);
+    }
+
+    if ( NULL == Queue->Items ) {
+        return Priority_Queue_typedPush(Queue, Priority_Queue_typedEncodeInt(Queue, Priority),
+                                        Value, ValueSize, ReleaseFunc);
+    }
+
     return Binary_Heap_Push(Queue->Items, &(Priority), sizeof(Priority), Value, ValueSize,
                             ReleaseFunc);
 }
 
+int Priority_Queue_PushN(Priority_Queue_t *Queue, int *Priorities, void *Values, size_t ValueSize,
+                         size_t Count, ReleaseFunc_t *ReleaseFunc) {
+
+    if ( NULL == Queue ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Queue* provided.");
+#endif
+        return 1;
+    }
+
+    if ( NULL == Queue->Items ) {
+        if ( (0 != Count) && (NULL == Priorities) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: NULL Priorities* provided.");
+#endif
+            return 1;
+        }
+        if ( NULL != Queue->Concurrent ) {
+            return Priority_Queue_concurrentPushN(Queue, Priorities, (uint8_t *)Values, ValueSize,
+                                                  Count, ReleaseFunc);
+        }
+        return Priority_Queue_typedPushN(Queue, Priorities, (uint8_t *)Values, ValueSize, Count,
+                                         ReleaseFunc);
+    }
+
+    return Binary_Heap_PushN(Queue->Items, Priorities, sizeof(*Priorities), Values, ValueSize,
+                             Count, ReleaseFunc);
+}
+
+Priority_Queue_Handle_t *Priority_Queue_PushHandle(Priority_Queue_t *Queue, int Priority,
+                                                   void *Value, size_t ValueSize,
+                                                   ReleaseFunc_t *ReleaseFunc) {
+
+    if ( NULL == Queue ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Queue* provided.");
+#endif
+        return NULL;
+    }
+
+    if ( NULL == Queue->Items ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Handles are not available for a typed Priority_Queue_t.");
+#endif
+        return NULL;
+    }
+
+    return (Priority_Queue_Handle_t *)Binary_Heap_PushHandle(
+        Queue->Items, &(Priority), sizeof(Priority), Value, ValueSize, ReleaseFunc);
+}
+
+int Priority_Queue_UpdatePriority(Priority_Queue_t *Queue, Priority_Queue_Handle_t *Handle,
+                                  int Priority) {
+
+    if ( NULL == Queue ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Queue* provided.");
+#endif
+        return 1;
+    }
+
+    if ( NULL == Queue->Items ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Handles are not available for a typed Priority_Queue_t.");
+#endif
+        return 1;
+    }
+
+    return Binary_Heap_UpdateKey(Queue->Items, (Binary_Heap_Handle_t *)Handle, &(Priority),
+                                 sizeof(Priority));
+}
+
+int Priority_Queue_RemoveHandle(Priority_Queue_t *Queue, Priority_Queue_Handle_t *Handle) {
+
+    if ( NULL == Queue ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Queue* provided.");
+#endif
+        return 1;
+    }
+
+    if ( NULL == Queue->Items ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Handles are not available for a typed Priority_Queue_t.");
+#endif
+        return 1;
+    }
+
+    return Binary_Heap_RemoveHandle(Queue->Items, (Binary_Heap_Handle_t *)Handle);
+}
+
+int Priority_Queue_Merge(Priority_Queue_t *Dst, Priority_Queue_t *Src) {
+
+    if ( (NULL == Dst) || (NULL == Src) || (Dst == Src) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Two distinct, non-NULL Queue* must be provided.");
+#endif
+        return 1;
+    }
+
+    if ( (Dst->Type != Src->Type) || (Dst->Ascending != Src->Ascending) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s",
+                     "Error: Priority_Queue_t of different Types or orders cannot be merged.");
+#endif
+        return 1;
+    }
+
+    if ( (NULL != Dst->Items) && (NULL != Src->Items) ) {
+        return Binary_Heap_Merge(Dst->Items, Src->Items);
+    }
+
+    if ( (NULL == Dst->Items) && (NULL == Src->Items) && (NULL == Dst->Buckets) &&
+         (NULL == Src->Buckets) && (NULL == Dst->Concurrent) && (NULL == Src->Concurrent) ) {
+        return Priority_Queue_typedMerge(Dst, Src);
+    }
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Error: Only Priority_Queue_t created by the same function can be merged.");
+#endif
+    return 1;
+}
+
 Priority_Queue_Item_t Priority_Queue_Next(Priority_Queue_t *Queue) {
 
     Priority_Queue_Item_t      Item         = {0, NULL};
     Binary_Heap_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    Priority_Queue_Entry_t *   Entry        = NULL;
 
     if ( NULL == Queue ) {
 #ifdef DEBUG
@@ -172,6 +559,18 @@ Priority_Queue_Item_t Priority_Queue_Next(Priority_Queue_t *Queue) {
         return Item;
     }
 
+    if ( NULL != Queue->Concurrent ) {
+        return Priority_Queue_concurrentNext(Queue);
+    }
+
+    if ( NULL == Queue->Items ) {
+        if ( NULL != (Entry = Priority_Queue_typedNext(Queue)) ) {
+            Item.Priority = Priority_Queue_typedDecodeInt(Queue, Entry->Key);
+            Item.Value    = Entry->Value;
+        }
+        return Item;
+    }
+
     KeyValuePair = Binary_Heap_Next(Queue->Items);
     if ( NULL != KeyValuePair.Key ) {
         Item.Priority = *(int *)KeyValuePair.Key;
@@ -241,6 +640,15 @@ int Priority_Queue_Clear(Priority_Queue_t *Queue) {
         return 1;
     }
 
+    if ( NULL != Queue->Concurrent ) {
+        return Priority_Queue_concurrentClear(Queue);
+    }
+
+    if ( NULL == Queue->Items ) {
+        Priority_Queue_typedClear(Queue);
+        return 0;
+    }
+
     return Binary_Heap_Clear(Queue->Items);
 }
 
@@ -253,7 +661,13 @@ void Priority_Queue_Release(Priority_Queue_t *Queue) {
         return;
     }
 
-    Binary_Heap_Release(Queue->Items);
+    if ( NULL != Queue->Concurrent ) {
+        Priority_Queue_concurrentRelease(Queue->Concurrent);
+    } else if ( NULL == Queue->Items ) {
+        Priority_Queue_typedRelease(Queue);
+    } else {
+        Binary_Heap_Release(Queue->Items);
+    }
 
     ZERO_CONTAINER(Queue, Priority_Queue_t);
     free(Queue);
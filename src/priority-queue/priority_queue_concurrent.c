@@ -0,0 +1,449 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+    The mutexes and thread-specific keys used here are only declared by the system
+    headers when POSIX features are requested, which the strict ANSI builds of this
+    library otherwise disable.
+*/
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../logging/logging.h"
+#include "include/priority_queue.h"
+
+struct Priority_Queue_Shard_t {
+
+    /*
+        Lock guards every access to the Queue of this heap. It is only ever held
+        for a single Push or Pop, so contention stays low with enough heaps.
+    */
+    pthread_mutex_t Lock;
+
+    /*
+        Queue is the regular, single-threaded, typed Priority Queue holding the items of this heap.
+    */
+    Priority_Queue_t *Queue;
+};
+
+struct Priority_Queue_Concurrent_t {
+
+    /*
+        Seed holds a pointer to the random state of each thread using the Queue, which is
+        allocated on first use and released as the thread exits.
+    */
+    pthread_key_t Seed;
+
+    /*
+        Shards holds the ShardCount independently locked heaps of the Queue. Only the
+        first Prepared of these have been fully initialized.
+    */
+    Priority_Queue_Shard_t *Shards;
+    size_t                  ShardCount;
+    size_t                  Prepared;
+
+    /*
+        Cursor is the index of the heap currently being iterated over by Priority_Queue_Next().
+    */
+    size_t Cursor;
+};
+
+Priority_Queue_t *Priority_Queue_CreateConcurrent(bool Ascending, size_t HeapCount) {
+
+    Priority_Queue_t *           Queue      = NULL;
+    Priority_Queue_Concurrent_t *Concurrent = NULL;
+    Priority_Queue_Shard_t *     Shard      = NULL;
+
+    if ( 0 == HeapCount ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Note: No HeapCount provided, defaulting to (%lu).",
+                     (unsigned long)LIBCONTAINER_PRIORITY_QUEUE_CONCURRENT_HEAPS);
+#endif
+        HeapCount = LIBCONTAINER_PRIORITY_QUEUE_CONCURRENT_HEAPS;
+    }
+
+    Queue = (Priority_Queue_t *)calloc(1, sizeof(Priority_Queue_t));
+    if ( NULL == Queue ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Priority_Queue_t.");
+#endif
+        return NULL;
+    }
+
+    Concurrent = (Priority_Queue_Concurrent_t *)calloc(1, sizeof(Priority_Queue_Concurrent_t));
+    if ( NULL == Concurrent ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for concurrent Priority_Queue_t.");
+#endif
+        free(Queue);
+        return NULL;
+    }
+
+    if ( 0 != pthread_key_create(&(Concurrent->Seed), free) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to create thread-specific key for random state.");
+#endif
+        free(Concurrent);
+        free(Queue);
+        return NULL;
+    }
+
+    Concurrent->Shards =
+        (Priority_Queue_Shard_t *)calloc(HeapCount, sizeof(Priority_Queue_Shard_t));
+    if ( NULL == Concurrent->Shards ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Priority_Queue_t heaps.");
+#endif
+        Priority_Queue_concurrentRelease(Concurrent);
+        free(Queue);
+        return NULL;
+    }
+    Concurrent->ShardCount = HeapCount;
+
+    for ( ; Concurrent->Prepared < HeapCount; Concurrent->Prepared++ ) {
+        Shard        = &(Concurrent->Shards[Concurrent->Prepared]);
+        Shard->Queue = Priority_Queue_CreateTyped(Priority_Int, Ascending);
+        if ( NULL == Shard->Queue ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("Error: Failed to create Priority_Queue_t for heap [ %lu ].",
+                         (unsigned long)Concurrent->Prepared);
+#endif
+            Priority_Queue_concurrentRelease(Concurrent);
+            free(Queue);
+            return NULL;
+        }
+
+        if ( 0 != pthread_mutex_init(&(Shard->Lock), NULL) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("Error: Failed to initialize lock for heap [ %lu ].",
+                         (unsigned long)Concurrent->Prepared);
+#endif
+            Priority_Queue_Release(Shard->Queue);
+            Priority_Queue_concurrentRelease(Concurrent);
+            free(Queue);
+            return NULL;
+        }
+    }
+
+    Queue->Concurrent = Concurrent;
+    Queue->Type       = Priority_Int;
+    Queue->Ascending  = Ascending;
+
+#ifdef DEBUG
+    DEBUG_PRINTF("Successfully created concurrent Priority_Queue_t with (%lu) heaps.",
+                 (unsigned long)HeapCount);
+#endif
+    return Queue;
+}
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+size_t Priority_Queue_concurrentRandom(Priority_Queue_Concurrent_t *Concurrent) {
+
+    unsigned long *Seed = NULL, Fallback = 0;
+
+    Seed = (unsigned long *)pthread_getspecific(Concurrent->Seed);
+    if ( NULL == Seed ) {
+        Seed = (unsigned long *)malloc(sizeof(unsigned long));
+        if ( (NULL == Seed) || (0 != pthread_setspecific(Concurrent->Seed, Seed)) ) {
+            /* Without a state of its own, the thread falls back on where its stack lies. */
+            free(Seed);
+            Seed     = &Fallback;
+            Fallback = (unsigned long)(size_t)&Fallback;
+        } else {
+            /* Each thread's state lives at a distinct address, which seeds it differently. */
+            *Seed = (unsigned long)(size_t)Seed;
+        }
+        *Seed = ((*Seed ^ (*Seed >> 16)) * 2654435761UL) & 0xFFFFFFFFUL;
+        *Seed = (0 == *Seed) ? 2463534242UL : *Seed;
+    }
+
+    /* A 32-bit xorshift generator, which is plenty to spread the choice of heap. */
+    *Seed ^= (*Seed << 13) & 0xFFFFFFFFUL;
+    *Seed ^= *Seed >> 17;
+    *Seed ^= (*Seed << 5) & 0xFFFFFFFFUL;
+
+    return (size_t)(*Seed % Concurrent->ShardCount);
+}
+
+Priority_Queue_Shard_t *Priority_Queue_concurrentLockAny(Priority_Queue_Concurrent_t *Concurrent) {
+
+    Priority_Queue_Shard_t *Shard   = NULL;
+    size_t                  Attempt = 0;
+
+    for ( Attempt = 0; Attempt < LIBCONTAINER_PRIORITY_QUEUE_CONCURRENT_ATTEMPTS; Attempt++ ) {
+        Shard = &(Concurrent->Shards[Priority_Queue_concurrentRandom(Concurrent)]);
+        if ( 0 == pthread_mutex_trylock(&(Shard->Lock)) ) {
+            return Shard;
+        }
+    }
+
+    pthread_mutex_lock(&(Shard->Lock));
+    return Shard;
+}
+
+Priority_Queue_Shard_t *Priority_Queue_concurrentLockBest(Priority_Queue_t *Queue) {
+
+    Priority_Queue_Concurrent_t *Concurrent = Queue->Concurrent;
+    Priority_Queue_Shard_t *     First = NULL, *Second = NULL, *Shard = NULL;
+    size_t                       Attempt = 0, Index = 0, Start = 0;
+    int                          A = 0, B = 0;
+
+    for ( Attempt = 0; Attempt < LIBCONTAINER_PRIORITY_QUEUE_CONCURRENT_ATTEMPTS; Attempt++ ) {
+        First  = &(Concurrent->Shards[Priority_Queue_concurrentRandom(Concurrent)]);
+        Second = &(Concurrent->Shards[Priority_Queue_concurrentRandom(Concurrent)]);
+
+        /* Neither lock is waited on, so two threads choosing the same pair can never deadlock. */
+        if ( 0 != pthread_mutex_trylock(&(First->Lock)) ) {
+            continue;
+        }
+        if ( (First == Second) || (0 != pthread_mutex_trylock(&(Second->Lock))) ) {
+            Second = NULL;
+        }
+
+        if ( (NULL != Second) && !Priority_Queue_IsEmpty(Second->Queue) ) {
+            if ( Priority_Queue_IsEmpty(First->Queue) ) {
+                Shard = Second;
+            } else {
+                A     = Priority_Queue_Peek(First->Queue).Priority;
+                B     = Priority_Queue_Peek(Second->Queue).Priority;
+                Shard = ((Queue->Ascending) ? (B > A) : (B < A)) ? Second : First;
+            }
+        } else if ( !Priority_Queue_IsEmpty(First->Queue) ) {
+            Shard = First;
+        }
+
+        if ( (NULL != Second) && (Second != Shard) ) {
+            pthread_mutex_unlock(&(Second->Lock));
+        }
+        if ( First != Shard ) {
+            pthread_mutex_unlock(&(First->Lock));
+        }
+        if ( NULL != Shard ) {
+            return Shard;
+        }
+    }
+
+    /*
+        The random choices kept landing on busy or empty heaps, which is typical as the
+        Queue runs dry. Every heap is now waited on in turn, from a random start, so the
+        Queue is only reported empty once each heap has been seen empty.
+    */
+    Start = Priority_Queue_concurrentRandom(Concurrent);
+    for ( Index = 0; Index < Concurrent->ShardCount; Index++ ) {
+        Shard = &(Concurrent->Shards[(Start + Index) % Concurrent->ShardCount]);
+        pthread_mutex_lock(&(Shard->Lock));
+        if ( !Priority_Queue_IsEmpty(Shard->Queue) ) {
+            return Shard;
+        }
+        pthread_mutex_unlock(&(Shard->Lock));
+    }
+
+    return NULL;
+}
+
+int Priority_Queue_concurrentPush(Priority_Queue_t *Queue, int Priority, void *Value,
+                                  size_t ValueSize, ReleaseFunc_t *ReleaseFunc) {
+
+    Priority_Queue_Shard_t *Shard  = NULL;
+    int                     RetVal = 0;
+
+    Shard  = Priority_Queue_concurrentLockAny(Queue->Concurrent);
+    RetVal = Priority_Queue_Push(Shard->Queue, Priority, Value, ValueSize, ReleaseFunc);
+    pthread_mutex_unlock(&(Shard->Lock));
+
+    return RetVal;
+}
+
+int Priority_Queue_concurrentPushN(Priority_Queue_t *Queue, int *Priorities, uint8_t *Values,
+                                   size_t ValueSize, size_t Count, ReleaseFunc_t *ReleaseFunc) {
+
+    Priority_Queue_Concurrent_t *Concurrent = Queue->Concurrent;
+    Priority_Queue_Shard_t *     Shard      = NULL;
+    size_t                       Index = 0, Start = 0, End = 0, Stride = 0;
+    int                          RetVal = 0;
+
+    Stride = (0 == ValueSize) ? sizeof(void *) : ValueSize;
+
+    for ( Index = 0; (Index < Concurrent->ShardCount) && (0 == RetVal); Index++ ) {
+        Start = (Count * Index) / Concurrent->ShardCount;
+        End   = (Count * (Index + 1)) / Concurrent->ShardCount;
+        if ( Start == End ) {
+            continue;
+        }
+
+        Shard = &(Concurrent->Shards[Index]);
+        pthread_mutex_lock(&(Shard->Lock));
+        RetVal = Priority_Queue_PushN(Shard->Queue, Priorities + Start,
+                                      (NULL == Values) ? NULL : Values + (Start * Stride),
+                                      ValueSize, End - Start, ReleaseFunc);
+        pthread_mutex_unlock(&(Shard->Lock));
+    }
+
+    return RetVal;
+}
+
+Priority_Queue_Item_t Priority_Queue_concurrentPeek(Priority_Queue_t *Queue) {
+
+    Priority_Queue_Concurrent_t *Concurrent = Queue->Concurrent;
+    Priority_Queue_Shard_t *     Shard      = NULL;
+    Priority_Queue_Item_t        Item = {0, NULL}, Best = {0, NULL};
+    size_t                       Index = 0;
+    bool                         Found = false;
+
+    for ( Index = 0; Index < Concurrent->ShardCount; Index++ ) {
+        Shard = &(Concurrent->Shards[Index]);
+        pthread_mutex_lock(&(Shard->Lock));
+        if ( !Priority_Queue_IsEmpty(Shard->Queue) ) {
+            Item = Priority_Queue_Peek(Shard->Queue);
+            if ( (!Found) || ((Queue->Ascending) ? (Item.Priority > Best.Priority)
+                                                 : (Item.Priority < Best.Priority)) ) {
+                Best  = Item;
+                Found = true;
+            }
+        }
+        pthread_mutex_unlock(&(Shard->Lock));
+    }
+
+    return Best;
+}
+
+Priority_Queue_Item_t Priority_Queue_concurrentPop(Priority_Queue_t *Queue) {
+
+    Priority_Queue_Shard_t *Shard = NULL;
+    Priority_Queue_Item_t   Item  = {0, NULL};
+
+    Shard = Priority_Queue_concurrentLockBest(Queue);
+    if ( NULL == Shard ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Warning: Concurrent Priority_Queue_t is empty.");
+#endif
+        return Item;
+    }
+
+    Item = Priority_Queue_Pop(Shard->Queue);
+    pthread_mutex_unlock(&(Shard->Lock));
+
+    return Item;
+}
+
+int Priority_Queue_concurrentRemove(Priority_Queue_t *Queue) {
+
+    Priority_Queue_Shard_t *Shard  = NULL;
+    int                     RetVal = 0;
+
+    Shard = Priority_Queue_concurrentLockBest(Queue);
+    if ( NULL == Shard ) {
+        return 0;
+    }
+
+    RetVal = Priority_Queue_Remove(Shard->Queue);
+    pthread_mutex_unlock(&(Shard->Lock));
+
+    return RetVal;
+}
+
+size_t Priority_Queue_concurrentLength(Priority_Queue_t *Queue) {
+
+    Priority_Queue_Concurrent_t *Concurrent = Queue->Concurrent;
+    size_t                       Index = 0, Length = 0;
+
+    for ( Index = 0; Index < Concurrent->ShardCount; Index++ ) {
+        pthread_mutex_lock(&(Concurrent->Shards[Index].Lock));
+        Length += Priority_Queue_Length(Concurrent->Shards[Index].Queue);
+        pthread_mutex_unlock(&(Concurrent->Shards[Index].Lock));
+    }
+
+    return Length;
+}
+
+Priority_Queue_Item_t Priority_Queue_concurrentNext(Priority_Queue_t *Queue) {
+
+    Priority_Queue_Concurrent_t *Concurrent = Queue->Concurrent;
+    Priority_Queue_Item_t        Item       = {0, NULL};
+
+    for ( ; Concurrent->Cursor < Concurrent->ShardCount; Concurrent->Cursor++ ) {
+        if ( Priority_Queue_IsEmpty(Concurrent->Shards[Concurrent->Cursor].Queue) ) {
+            continue;
+        }
+        Item = Priority_Queue_Next(Concurrent->Shards[Concurrent->Cursor].Queue);
+        if ( NULL != Item.Value ) {
+            return Item;
+        }
+    }
+
+    Concurrent->Cursor = 0;
+    return Item;
+}
+
+int Priority_Queue_concurrentClear(Priority_Queue_t *Queue) {
+
+    Priority_Queue_Concurrent_t *Concurrent = Queue->Concurrent;
+    size_t                       Index      = 0;
+    int                          RetVal     = 0;
+
+    for ( Index = 0; Index < Concurrent->ShardCount; Index++ ) {
+        pthread_mutex_lock(&(Concurrent->Shards[Index].Lock));
+        RetVal += Priority_Queue_Clear(Concurrent->Shards[Index].Queue);
+        pthread_mutex_unlock(&(Concurrent->Shards[Index].Lock));
+    }
+
+    Concurrent->Cursor = 0;
+    return RetVal;
+}
+
+void Priority_Queue_concurrentRelease(Priority_Queue_Concurrent_t *Concurrent) {
+
+    size_t Index = 0;
+
+    if ( NULL == Concurrent ) {
+        return;
+    }
+
+    for ( Index = 0; Index < Concurrent->Prepared; Index++ ) {
+        pthread_mutex_destroy(&(Concurrent->Shards[Index].Lock));
+        Priority_Queue_Release(Concurrent->Shards[Index].Queue);
+    }
+
+    /*
+        Deleting the key does not release the state of threads which are still running,
+        so at least the state of the releasing thread is returned here.
+    */
+    free(pthread_getspecific(Concurrent->Seed));
+    pthread_setspecific(Concurrent->Seed, NULL);
+    pthread_key_delete(Concurrent->Seed);
+
+    free(Concurrent->Shards);
+    ZERO_CONTAINER(Concurrent, Priority_Queue_Concurrent_t);
+    free(Concurrent);
+
+    return;
+}
+
+/* ---------- Private Functions ---------- */
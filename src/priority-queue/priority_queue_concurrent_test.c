@@ -0,0 +1,349 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../logging/logging.h"
+#include "include/priority_queue.h"
+
+#define CONCURRENT_TEST_THREADS 4
+#define CONCURRENT_TEST_ITEMS   2000
+
+typedef struct Priority_Queue_Concurrent_TestArgs_t {
+    Priority_Queue_t *Queue;
+    int               First;
+    int               Count;
+    int               Failures;
+    unsigned char     Seen[CONCURRENT_TEST_THREADS * CONCURRENT_TEST_ITEMS];
+} Priority_Queue_Concurrent_TestArgs_t;
+
+static void *ConcurrentPushWorker(void *Args) {
+
+    Priority_Queue_Concurrent_TestArgs_t *Context = (Priority_Queue_Concurrent_TestArgs_t *)Args;
+    int                                   Priority = 0;
+
+    for ( Priority = Context->First; Priority < Context->First + Context->Count; Priority++ ) {
+        if ( 0 != Priority_Queue_Push(Context->Queue, Priority, &Priority, sizeof(Priority),
+                                      NULL) ) {
+            Context->Failures += 1;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+    Pops until the Queue is found empty, noting every Value seen. If Count is non-zero,
+    the worker first pushes its own range of items, and pops one after each Push. The
+    drain at the end picks up anything left behind by those Pops.
+*/
+static void *ConcurrentPopWorker(void *Args) {
+
+    Priority_Queue_Concurrent_TestArgs_t *Context = (Priority_Queue_Concurrent_TestArgs_t *)Args;
+    Priority_Queue_Item_t                 Item    = {0, NULL};
+    int                                   Priority = 0;
+
+    for ( Priority = Context->First; Priority < Context->First + Context->Count; Priority++ ) {
+        if ( 0 != Priority_Queue_Push(Context->Queue, Priority, &Priority, sizeof(Priority),
+                                      NULL) ) {
+            Context->Failures += 1;
+        }
+        /* A Pop racing with Pushes to heaps it has already checked may find nothing. */
+        Item = Priority_Queue_Pop(Context->Queue);
+        if ( NULL == Item.Value ) {
+            continue;
+        } else if ( Item.Priority != *(int *)Item.Value ) {
+            Context->Failures += 1;
+        } else {
+            Context->Seen[Item.Priority] += 1;
+        }
+        free(Item.Value);
+    }
+
+    while ( NULL != (Item = Priority_Queue_Pop(Context->Queue)).Value ) {
+        if ( Item.Priority != *(int *)Item.Value ) {
+            Context->Failures += 1;
+        } else {
+            Context->Seen[Item.Priority] += 1;
+        }
+        free(Item.Value);
+    }
+
+    return NULL;
+}
+
+/*
+    Runs one round of workers over the Queue, then checks every item was popped exactly once.
+    Returns the number of failures found.
+*/
+static int RunConcurrentRound(Priority_Queue_t *Queue, void *(*Pusher)(void *),
+                              void *(*Popper)(void *), bool Mixed) {
+
+    Priority_Queue_Concurrent_TestArgs_t *Args = NULL;
+    pthread_t                             Threads[CONCURRENT_TEST_THREADS];
+    int                                   i = 0, Item = 0, Seen = 0, Failures = 0;
+
+    Args = (Priority_Queue_Concurrent_TestArgs_t *)calloc(
+        CONCURRENT_TEST_THREADS, sizeof(Priority_Queue_Concurrent_TestArgs_t));
+    if ( NULL == Args ) {
+        return 1;
+    }
+
+    for ( i = 0; i < CONCURRENT_TEST_THREADS; i++ ) {
+        Args[i].Queue = Queue;
+        Args[i].First = i * CONCURRENT_TEST_ITEMS;
+        Args[i].Count = CONCURRENT_TEST_ITEMS;
+    }
+
+    if ( NULL != Pusher ) {
+        for ( i = 0; i < CONCURRENT_TEST_THREADS; i++ ) {
+            pthread_create(&Threads[i], NULL, Pusher, &Args[i]);
+        }
+        for ( i = 0; i < CONCURRENT_TEST_THREADS; i++ ) {
+            pthread_join(Threads[i], NULL);
+            Args[i].Count = Mixed ? CONCURRENT_TEST_ITEMS : 0;
+        }
+    }
+
+    for ( i = 0; i < CONCURRENT_TEST_THREADS; i++ ) {
+        pthread_create(&Threads[i], NULL, Popper, &Args[i]);
+    }
+    for ( i = 0; i < CONCURRENT_TEST_THREADS; i++ ) {
+        pthread_join(Threads[i], NULL);
+        Failures += Args[i].Failures;
+    }
+
+    for ( Item = 0; Item < CONCURRENT_TEST_THREADS * CONCURRENT_TEST_ITEMS; Item++ ) {
+        for ( i = 0, Seen = 0; i < CONCURRENT_TEST_THREADS; i++ ) {
+            Seen += Args[i].Seen[Item];
+        }
+        Failures += (1 == Seen) ? 0 : 1;
+    }
+
+    free(Args);
+    return Failures;
+}
+
+int Test_priority_queue_concurrent(void) {
+
+    int FailedTests = 0;
+
+    FailedTests += Test_Priority_Queue_Concurrent_Order();
+    FailedTests += Test_Priority_Queue_Concurrent_Interface();
+    FailedTests += Test_Priority_Queue_Concurrent_Threaded();
+
+    return FailedTests;
+}
+
+int Test_Priority_Queue_Concurrent_Order(void) {
+
+    Priority_Queue_t *    Queue = NULL;
+    Priority_Queue_Item_t Item  = {0, NULL};
+    int                   Priorities[1000], i = 0;
+    unsigned char         Seen[1000];
+    long                  RankError = 0;
+
+    for ( i = 0; i < 1000; i++ ) {
+        Priorities[i] = (i * 7919) % 1000;
+    }
+
+    /* A single heap is an ordinary locked Queue, and so pops in exact order. */
+    Queue = Priority_Queue_CreateConcurrent(false, 1);
+    if ( NULL == Queue ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create concurrent Priority_Queue_t.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 1000; i++ ) {
+        Priority_Queue_Push(Queue, Priorities[i], &Priorities[i], sizeof(int), NULL);
+    }
+
+    for ( i = 0; i < 1000; i++ ) {
+        Item = Priority_Queue_Pop(Queue);
+        if ( (NULL == Item.Value) || (i != Item.Priority) || (i != *(int *)Item.Value) ) {
+            TEST_PRINTF("Test Failure - Single heap popped (%d), expected (%d).", Item.Priority,
+                        i);
+            free(Item.Value);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+        free(Item.Value);
+    }
+    Priority_Queue_Release(Queue);
+
+    /*
+        With many heaps every item still comes out exactly once, but only roughly in order.
+        Each Pop takes the better of two random heaps, so the mean distance of an item
+        from its exact position stays within a small multiple of the number of heaps.
+    */
+    Queue = Priority_Queue_CreateConcurrent(false, 8);
+    if ( NULL == Queue ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create concurrent Priority_Queue_t.");
+        TEST_FAILURE;
+    }
+
+    if ( (0 != Priority_Queue_PushN(Queue, Priorities, Priorities, sizeof(int), 1000, NULL)) ||
+         (1000 != Priority_Queue_Length(Queue)) || (0 != Priority_Queue_Peek(Queue).Priority) ) {
+        TEST_PRINTF("Test Failure - Concurrent Queue Length (%lu) not equal to expectation (1000).",
+                    (unsigned long)Priority_Queue_Length(Queue));
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    memset(Seen, 0, sizeof(Seen));
+    for ( i = 0; i < 1000; i++ ) {
+        Item = Priority_Queue_Pop(Queue);
+        if ( (NULL == Item.Value) || (Item.Priority != *(int *)Item.Value) ||
+             (0 != Seen[Item.Priority]) ) {
+            TEST_PRINTF("Test Failure - Concurrent Queue popped an unexpected item at (%d).", i);
+            free(Item.Value);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+        Seen[Item.Priority] = 1;
+        RankError += (Item.Priority > i) ? (Item.Priority - i) : (i - Item.Priority);
+        free(Item.Value);
+    }
+
+    if ( (RankError / 1000) > (4 * 8) ) {
+        TEST_PRINTF("Test Failure - Mean rank error (%ld) of concurrent Queue too large.",
+                    RankError / 1000);
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    if ( (NULL != Priority_Queue_Pop(Queue).Value) || (!Priority_Queue_IsEmpty(Queue)) ) {
+        TEST_PRINTF("%s", "Test Failure - Popped an item from an empty concurrent Queue.");
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    Priority_Queue_Release(Queue);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Priority_Queue_Concurrent_Interface(void) {
+
+    Priority_Queue_t *    Queue = NULL, *Other = NULL;
+    Priority_Queue_Item_t Item  = {0, NULL};
+    int                   i = 0, Priority = 0, *Value = NULL;
+    size_t                Count = 0;
+
+    Queue = Priority_Queue_CreateConcurrent(true, 0);
+    Other = Priority_Queue_CreateConcurrent(true, 0);
+    if ( (NULL == Queue) || (NULL == Other) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create concurrent Priority_Queue_t.");
+        Priority_Queue_Release(Queue);
+        Priority_Queue_Release(Other);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 100; i++ ) {
+        Priority_Queue_PushTyped(Queue, &i, &i, sizeof(i), NULL);
+    }
+
+    /* Iteration visits every heap, and Peek finds the best item over all of them. */
+    PRIORITY_QUEUE_FOREACH(Queue, Item) {
+        Count += (Item.Priority == *(int *)Item.Value) ? 1 : 0;
+    }
+
+    Value = (int *)Priority_Queue_PeekTyped(Queue, &Priority);
+    if ( (100 != Count) || (NULL == Value) || (99 != Priority) || (99 != *Value) ) {
+        TEST_PRINTF("Test Failure - Iterated (%lu) items and Peeked (%d) from concurrent Queue.",
+                    (unsigned long)Count, Priority);
+        Priority_Queue_Release(Queue);
+        Priority_Queue_Release(Other);
+        TEST_FAILURE;
+    }
+
+    Value = (int *)Priority_Queue_PopTyped(Queue, &Priority);
+    if ( (NULL == Value) || (Priority != *Value) || (0 != Priority_Queue_Remove(Queue)) ||
+         (98 != Priority_Queue_Length(Queue)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to Pop and Remove from concurrent Queue.");
+        free(Value);
+        Priority_Queue_Release(Queue);
+        Priority_Queue_Release(Other);
+        TEST_FAILURE;
+    }
+    free(Value);
+
+    /* Handles, Merge and the back of the Queue are not offered. */
+    if ( (NULL != Priority_Queue_PushHandle(Queue, 1, NULL, 0, NULL)) ||
+         (0 == Priority_Queue_Merge(Queue, Other)) ||
+         (NULL != Priority_Queue_PopBack(Queue).Value) || (98 != Priority_Queue_Length(Queue)) ) {
+        TEST_PRINTF("%s", "Test Failure - Unsupported operation succeeded on concurrent Queue.");
+        Priority_Queue_Release(Queue);
+        Priority_Queue_Release(Other);
+        TEST_FAILURE;
+    }
+
+    if ( (0 != Priority_Queue_Clear(Queue)) || (!Priority_Queue_IsEmpty(Queue)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to Clear concurrent Queue.");
+        Priority_Queue_Release(Queue);
+        Priority_Queue_Release(Other);
+        TEST_FAILURE;
+    }
+
+    Priority_Queue_Release(Queue);
+    Priority_Queue_Release(Other);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Priority_Queue_Concurrent_Threaded(void) {
+
+    Priority_Queue_t *Queue    = NULL;
+    int               Failures = 0;
+
+    Queue = Priority_Queue_CreateConcurrent(false, 2 * CONCURRENT_TEST_THREADS);
+    if ( NULL == Queue ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create concurrent Priority_Queue_t.");
+        TEST_FAILURE;
+    }
+
+    /* Every thread pushes, and then every thread pops until the Queue runs dry. */
+    Failures = RunConcurrentRound(Queue, ConcurrentPushWorker, ConcurrentPopWorker, false);
+    if ( (0 != Failures) || (!Priority_Queue_IsEmpty(Queue)) ) {
+        TEST_PRINTF("Test Failure - (%d) failures after concurrent Push then Pop.", Failures);
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    /* Pushes and Pops now interleave freely across threads. */
+    Failures = RunConcurrentRound(Queue, NULL, ConcurrentPopWorker, true);
+    if ( (0 != Failures) || (!Priority_Queue_IsEmpty(Queue)) ) {
+        TEST_PRINTF("Test Failure - (%d) failures after interleaved Push and Pop.", Failures);
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    Priority_Queue_Release(Queue);
+    TEST_SUCCESSFUL;
+}
@@ -0,0 +1,333 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../logging/logging.h"
+#include "include/priority_queue.h"
+
+Priority_Queue_t *Priority_Queue_CreateMonotone(Priority_Queue_Priority_t Type) {
+
+    Priority_Queue_t *Queue = NULL;
+
+    if ( (Priority_Int != Type) && (Priority_Int64 != Type) && (Priority_Double != Type) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Error: Unknown Priority_Queue_Priority_t (%d) provided.", (int)Type);
+#endif
+        return NULL;
+    }
+
+    Queue = (Priority_Queue_t *)calloc(1, sizeof(Priority_Queue_t));
+    if ( NULL == Queue ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Priority_Queue_t.");
+#endif
+        return NULL;
+    }
+
+    /* Each Bucket allocates its Entries only once something lands in it. */
+    Queue->Buckets = (Priority_Queue_Bucket_t *)calloc(PRIORITY_QUEUE_RADIX_BUCKETS,
+                                                       sizeof(Priority_Queue_Bucket_t));
+    if ( NULL == Queue->Buckets ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate Buckets for monotone Priority_Queue_t.");
+#endif
+        free(Queue);
+        return NULL;
+    }
+
+    Queue->Type      = Type;
+    Queue->Ascending = false;
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully created monotone Priority_Queue_t.");
+#endif
+    return Queue;
+}
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+size_t Priority_Queue_radixBucket(Priority_Queue_t *Queue, uint64_t Key) {
+
+    uint64_t Diff   = Key ^ Queue->Last;
+    size_t   Bucket = 1;
+
+    if ( 0 == Diff ) {
+        return 0;
+    }
+
+    /* Bucket is one more than the index of the highest bit at which Key differs from Last. */
+    if ( 0 != (Diff >> 32) ) {
+        Diff >>= 32;
+        Bucket += 32;
+    }
+    if ( 0 != (Diff >> 16) ) {
+        Diff >>= 16;
+        Bucket += 16;
+    }
+    if ( 0 != (Diff >> 8) ) {
+        Diff >>= 8;
+        Bucket += 8;
+    }
+    if ( 0 != (Diff >> 4) ) {
+        Diff >>= 4;
+        Bucket += 4;
+    }
+    if ( 0 != (Diff >> 2) ) {
+        Diff >>= 2;
+        Bucket += 2;
+    }
+    if ( 0 != (Diff >> 1) ) {
+        Bucket += 1;
+    }
+
+    return Bucket;
+}
+
+int Priority_Queue_radixReserve(Priority_Queue_Bucket_t *Bucket, size_t Count) {
+
+    Priority_Queue_Entry_t *Entries  = NULL;
+    size_t                  Capacity = Bucket->Capacity;
+
+    if ( 0 == Capacity ) {
+        Capacity = LIBCONTAINER_PRIORITY_QUEUE_TYPED_CAPACITY;
+    }
+
+    for ( ; Capacity < Bucket->Count + Count; Capacity *= 2 ) { ; }
+    if ( Capacity == Bucket->Capacity ) {
+        return 0;
+    }
+
+    Entries = (Priority_Queue_Entry_t *)realloc(Bucket->Entries,
+                                                Capacity * sizeof(Priority_Queue_Entry_t));
+    if ( NULL == Entries ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to grow Bucket of monotone Priority_Queue_t.");
+#endif
+        return 1;
+    }
+
+    Bucket->Entries  = Entries;
+    Bucket->Capacity = Capacity;
+
+    return 0;
+}
+
+int Priority_Queue_radixPush(Priority_Queue_t *Queue, uint64_t Key, void *Value,
+                             size_t ValueSize, ReleaseFunc_t *ReleaseFunc) {
+
+    Priority_Queue_Bucket_t *Bucket = NULL;
+    Priority_Queue_Entry_t * Entry  = NULL;
+
+    if ( Key < Queue->Last ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Priority is lower than the last Priority returned from the "
+                           "monotone Priority_Queue_t.");
+#endif
+        return 1;
+    }
+
+    Bucket = &(Queue->Buckets[Priority_Queue_radixBucket(Queue, Key)]);
+    if ( 0 != Priority_Queue_radixReserve(Bucket, 1) ) {
+        return 1;
+    }
+
+    Entry = &(Bucket->Entries[Bucket->Count]);
+
+    if ( 0 == ValueSize ) {
+        Entry->Value = Value;
+    } else {
+        Entry->Value = calloc(ValueSize, sizeof(uint8_t));
+        if ( NULL == Entry->Value ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Value within Entry.");
+#endif
+            return 1;
+        }
+        memcpy(Entry->Value, Value, ValueSize);
+    }
+
+    Entry->Key         = Key;
+    Entry->ReleaseFunc = (NULL == ReleaseFunc) ? free : ReleaseFunc;
+
+    Bucket->Count++;
+    Queue->Count++;
+    Queue->NextEntry = 0;
+
+    return 0;
+}
+
+int Priority_Queue_radixPushN(Priority_Queue_t *Queue, int *Priorities, uint8_t *Values,
+                              size_t ValueSize, size_t Count, ReleaseFunc_t *ReleaseFunc) {
+
+    Priority_Queue_Bucket_t *Bucket = NULL;
+    size_t                   Index  = 0;
+    void *                   Value  = NULL;
+    uint64_t                 Key    = 0;
+
+    /* Every Priority is checked up front, so a rejected batch leaves the Queue unchanged. */
+    for ( Index = 0; Index < Count; Index++ ) {
+        if ( Priority_Queue_typedEncodeInt(Queue, Priorities[Index]) < Queue->Last ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("Error: Priority (%d) is lower than the last Priority returned from the "
+                         "monotone Priority_Queue_t.",
+                         Priorities[Index]);
+#endif
+            return 1;
+        }
+    }
+
+    for ( Index = 0; Index < Count; Index++ ) {
+        if ( 0 == ValueSize ) {
+            Value = (NULL == Values) ? NULL : ((void **)Values)[Index];
+        } else {
+            Value = Values + (Index * ValueSize);
+        }
+
+        Key = Priority_Queue_typedEncodeInt(Queue, Priorities[Index]);
+        if ( 0 != Priority_Queue_radixPush(Queue, Key, Value, ValueSize, ReleaseFunc) ) {
+            break;
+        }
+    }
+
+    if ( Index == Count ) {
+        return 0;
+    }
+
+    /* Each Entry was appended to the end of its Bucket, so they come off again in reverse. */
+    while ( Index-- > 0 ) {
+        Key    = Priority_Queue_typedEncodeInt(Queue, Priorities[Index]);
+        Bucket = &(Queue->Buckets[Priority_Queue_radixBucket(Queue, Key)]);
+        Bucket->Count--;
+        Queue->Count--;
+        if ( 0 != ValueSize ) {
+            free(Bucket->Entries[Bucket->Count].Value);
+        }
+    }
+
+    return 1;
+}
+
+int Priority_Queue_radixSettle(Priority_Queue_t *Queue) {
+
+    Priority_Queue_Bucket_t *Buckets = Queue->Buckets, *Source = NULL, *Target = NULL;
+    size_t                   Needed[PRIORITY_QUEUE_RADIX_BUCKETS];
+    size_t                   Index = 0, b = 0;
+    uint64_t                 Last  = Queue->Last;
+
+    if ( 0 != Buckets[0].Count ) {
+        return 0;
+    }
+
+    for ( b = 1; (b < PRIORITY_QUEUE_RADIX_BUCKETS) && (0 == Buckets[b].Count); b++ ) { ; }
+    if ( PRIORITY_QUEUE_RADIX_BUCKETS == b ) {
+        return 1;
+    }
+
+    Source = &(Buckets[b]);
+
+    /* With distinct Priorities, the Bucket often holds only the Entry which becomes the front. */
+    if ( 1 == Source->Count ) {
+        if ( 0 != Priority_Queue_radixReserve(&(Buckets[0]), 1) ) {
+            return 1;
+        }
+        Queue->Last           = Source->Entries[0].Key;
+        Buckets[0].Entries[0] = Source->Entries[0];
+        Buckets[0].Count      = 1;
+        Source->Count         = 0;
+        return 0;
+    }
+
+    for ( Queue->Last = Source->Entries[0].Key, Index = 1; Index < Source->Count; Index++ ) {
+        if ( Source->Entries[Index].Key < Queue->Last ) {
+            Queue->Last = Source->Entries[Index].Key;
+        }
+    }
+
+    /*
+        Relative to the new Last, every Entry of the Bucket lands strictly below it. Room
+        is made in each target Bucket before anything moves, so this cannot fail halfway.
+    */
+    memset(Needed, 0, b * sizeof(Needed[0]));
+    for ( Index = 0; Index < Source->Count; Index++ ) {
+        Needed[Priority_Queue_radixBucket(Queue, Source->Entries[Index].Key)]++;
+    }
+    for ( Index = 0; Index < b; Index++ ) {
+        if ( 0 != Priority_Queue_radixReserve(&(Buckets[Index]), Needed[Index]) ) {
+            Queue->Last = Last;
+            return 1;
+        }
+    }
+
+    for ( Index = 0; Index < Source->Count; Index++ ) {
+        Target = &(Buckets[Priority_Queue_radixBucket(Queue, Source->Entries[Index].Key)]);
+        Target->Entries[Target->Count++] = Source->Entries[Index];
+    }
+    Source->Count = 0;
+
+    return 0;
+}
+
+Priority_Queue_Entry_t *Priority_Queue_radixNext(Priority_Queue_t *Queue) {
+
+    size_t Index = Queue->NextEntry, b = 0;
+
+    for ( b = 0; b < PRIORITY_QUEUE_RADIX_BUCKETS; b++ ) {
+        if ( Index < Queue->Buckets[b].Count ) {
+            Queue->NextEntry++;
+            return &(Queue->Buckets[b].Entries[Index]);
+        }
+        Index -= Queue->Buckets[b].Count;
+    }
+
+    Queue->NextEntry = 0;
+    return NULL;
+}
+
+void Priority_Queue_radixClear(Priority_Queue_t *Queue) {
+
+    Priority_Queue_Bucket_t *Bucket = NULL;
+    size_t                   Index = 0, b = 0;
+
+    for ( b = 0; b < PRIORITY_QUEUE_RADIX_BUCKETS; b++ ) {
+        Bucket = &(Queue->Buckets[b]);
+        for ( Index = 0; Index < Bucket->Count; Index++ ) {
+            if ( (NULL != Bucket->Entries[Index].Value) &&
+                 (NULL != Bucket->Entries[Index].ReleaseFunc) ) {
+                Bucket->Entries[Index].ReleaseFunc(Bucket->Entries[Index].Value);
+            }
+        }
+        Bucket->Count = 0;
+    }
+
+    Queue->Count     = 0;
+    Queue->NextEntry = 0;
+    Queue->Last      = 0;
+
+    return;
+}
+
+/* ---------- Private Functions ---------- */
@@ -0,0 +1,246 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../logging/logging.h"
+#include "include/priority_queue.h"
+
+static int MonotoneCountCallback(void *Item, void *Args) {
+
+    Priority_Queue_Item_t *QueueItem = (Priority_Queue_Item_t *)Item;
+
+    /* Every Value holds a copy of its own Priority. */
+    if ( QueueItem->Priority != *(int *)QueueItem->Value ) {
+        return 1;
+    }
+
+    (*(size_t *)Args)++;
+    return 0;
+}
+
+int Test_priority_queue_radix(void) {
+
+    int FailedTests = 0;
+
+    FailedTests += Test_Priority_Queue_Monotone_Create();
+    FailedTests += Test_Priority_Queue_Monotone_Order();
+    FailedTests += Test_Priority_Queue_Monotone_Reject();
+    FailedTests += Test_Priority_Queue_Monotone_Interface();
+
+    return FailedTests;
+}
+
+int Test_Priority_Queue_Monotone_Create(void) {
+
+    Priority_Queue_t *        Queue   = NULL;
+    Priority_Queue_Priority_t Types[] = {Priority_Int, Priority_Int64, Priority_Double};
+    size_t                    i       = 0;
+
+    if ( NULL != (Queue = Priority_Queue_CreateMonotone((Priority_Queue_Priority_t)42)) ) {
+        TEST_PRINTF("%s", "Test Failure - Created monotone Priority_Queue_t of unknown Type.");
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < sizeof(Types) / sizeof(Types[0]); i++ ) {
+        Queue = Priority_Queue_CreateMonotone(Types[i]);
+        if ( (NULL == Queue) || (!Priority_Queue_IsEmpty(Queue)) ||
+             (NULL != Priority_Queue_Pop(Queue).Value) ) {
+            TEST_PRINTF("Test Failure - Failed to create monotone Priority_Queue_t of Type (%d).",
+                        (int)Types[i]);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+        Priority_Queue_Release(Queue);
+    }
+
+    TEST_SUCCESSFUL;
+}
+
+int Test_Priority_Queue_Monotone_Order(void) {
+
+    Priority_Queue_t *Queue = NULL;
+    int64_t           Time = 0, Previous = 0, *Event = NULL;
+    unsigned long     State = 12345;
+    int               i = 0, Popped = 0;
+
+    Queue = Priority_Queue_CreateMonotone(Priority_Int64);
+    if ( NULL == Queue ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create monotone Priority_Queue_t.");
+        TEST_FAILURE;
+    }
+
+    /* Start from below zero, so the Buckets are exercised across the sign of the Priority. */
+    for ( i = 0; i < 100; i++ ) {
+        Time = (int64_t)(i * 7919 % 1000) - 500;
+        if ( 0 != Priority_Queue_PushTyped(Queue, &Time, &Time, sizeof(Time), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to push Priority (%ld).", (long)Time);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+    }
+
+    /* Simulate events, each of which schedules up to two more some time after itself. */
+    while ( NULL != (Event = (int64_t *)Priority_Queue_PopTyped(Queue, &Time)) ) {
+        if ( (*Event != Time) || ((0 != Popped) && (Time < Previous)) ) {
+            TEST_PRINTF("Test Failure - Event (%ld) popped out of order after (%ld).", (long)Time,
+                        (long)Previous);
+            free(Event);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+        Previous = Time;
+        free(Event);
+
+        for ( i = 0; (i < 2) && (Popped < 5000); i++ ) {
+            State = (State * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+            Time  = Previous + (int64_t)(State % ((0 == i) ? 16 : 100000));
+            if ( 0 != Priority_Queue_PushTyped(Queue, &Time, &Time, sizeof(Time), NULL) ) {
+                TEST_PRINTF("Test Failure - Failed to schedule event at (%ld).", (long)Time);
+                Priority_Queue_Release(Queue);
+                TEST_FAILURE;
+            }
+        }
+        Popped++;
+    }
+
+    if ( (Popped < 5000) || (!Priority_Queue_IsEmpty(Queue)) ) {
+        TEST_PRINTF("Test Failure - Only (%d) events popped from monotone Priority_Queue_t.",
+                    Popped);
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    Priority_Queue_Release(Queue);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Priority_Queue_Monotone_Reject(void) {
+
+    Priority_Queue_t *Queue    = NULL;
+    double            Priority = 0, Lower = -1.5;
+    int               Batch[2] = {100, 1};
+
+    Queue = Priority_Queue_CreateMonotone(Priority_Double);
+    if ( NULL == Queue ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create monotone Priority_Queue_t.");
+        TEST_FAILURE;
+    }
+
+    Priority = 2.5;
+    if ( (0 != Priority_Queue_PushTyped(Queue, &Priority, NULL, 0, NULL)) ||
+         (0 != Priority_Queue_Push(Queue, 3, NULL, 0, NULL)) ||
+         (NULL != Priority_Queue_PeekTyped(Queue, &Priority)) || (2.5 != Priority) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to push and peek monotone Priority_Queue_t.");
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    /* Once 2.5 has been seen at the front, nothing may be pushed beneath it. */
+    if ( (0 == Priority_Queue_PushTyped(Queue, &Lower, NULL, 0, NULL)) ||
+         (0 == Priority_Queue_Push(Queue, 2, NULL, 0, NULL)) ||
+         (0 == Priority_Queue_PushN(Queue, Batch, NULL, 0, 2, NULL)) ||
+         (2 != Priority_Queue_Length(Queue)) ) {
+        TEST_PRINTF("%s", "Test Failure - Monotone Priority_Queue_t accepted a lower Priority.");
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    if ( (0 != Priority_Queue_Clear(Queue)) ||
+         (0 != Priority_Queue_PushTyped(Queue, &Lower, NULL, 0, NULL)) ||
+         (0 != Priority_Queue_PushHandle(Queue, 1, NULL, 0, NULL)) ) {
+        TEST_PRINTF("%s", "Test Failure - Monotone Priority_Queue_t misbehaved after Clear().");
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    Priority_Queue_Release(Queue);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Priority_Queue_Monotone_Interface(void) {
+
+    Priority_Queue_t *    Queue = NULL;
+    Priority_Queue_Item_t Item  = {0, NULL};
+    int                   Priorities[64], i = 0, Previous = -8000;
+    size_t                Visited = 0;
+
+    for ( i = 0; i < 64; i++ ) {
+        Priorities[i] = ((i * 37) % 16) * 1000 - 8000;
+    }
+
+    Queue = Priority_Queue_CreateMonotone(Priority_Int);
+    if ( NULL == Queue ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create monotone Priority_Queue_t.");
+        TEST_FAILURE;
+    }
+
+    if ( (0 != Priority_Queue_PushN(Queue, Priorities, Priorities, sizeof(int), 64, NULL)) ||
+         (64 != Priority_Queue_Length(Queue)) ||
+         (0 != Priority_Queue_DoCallbackArg(Queue, MonotoneCountCallback, &Visited)) ||
+         (64 != Visited) ) {
+        TEST_PRINTF("Test Failure - Visited (%lu) of (%lu) items of monotone Priority_Queue_t.",
+                    (unsigned long)Visited, (unsigned long)Priority_Queue_Length(Queue));
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 64; i++ ) {
+        if ( 0 == (i % 4) ) {
+            Priority_Queue_Remove(Queue);
+            continue;
+        }
+        Item = Priority_Queue_Pop(Queue);
+        if ( (NULL == Item.Value) || (*(int *)Item.Value != Item.Priority) ||
+             (Item.Priority < Previous) ) {
+            TEST_PRINTF("Test Failure - Item (%d) popped out of order.", i);
+            free(Item.Value);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+        Previous = Item.Priority;
+        free(Item.Value);
+    }
+
+    if ( (!Priority_Queue_IsEmpty(Queue)) || (7000 != Previous) ) {
+        TEST_PRINTF("%s", "Test Failure - Monotone Priority_Queue_t did not drain as expected.");
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    /* Clearing lifts the monotone limit, and items left behind are released with the Queue. */
+    if ( (0 != Priority_Queue_Clear(Queue)) ||
+         (0 != Priority_Queue_PushN(Queue, Priorities, Priorities, sizeof(int), 64, NULL)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to refill monotone Priority_Queue_t.");
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    Priority_Queue_Release(Queue);
+    TEST_SUCCESSFUL;
+}
@@ -83,6 +83,8 @@ int Test_priority_queue(void) {
     int FailedTests = 0;
 
     FailedTests += Test_Priority_Queue_Push();
+    FailedTests += Test_Priority_Queue_PushN();
+    FailedTests += Test_Priority_Queue_Handles();
     FailedTests += Test_Priority_Queue_Peek();
     FailedTests += Test_Priority_Queue_Pop();
     FailedTests += Test_Priority_Queue_Remove();
@@ -90,6 +92,12 @@ int Test_priority_queue(void) {
     FailedTests += Test_Priority_Queue_DoCallback();
     FailedTests += Test_Priority_Queue_DoCallbackArg();
     FailedTests += Test_Priority_Queue_Clear();
+    FailedTests += Test_Priority_Queue_Merge();
+    FailedTests += Test_Priority_Queue_DoubleEnded();
+
+    FailedTests += Test_priority_queue_typed();
+    FailedTests += Test_priority_queue_radix();
+    FailedTests += Test_priority_queue_concurrent();
 
     return FailedTests;
 }
@@ -154,6 +162,93 @@ int Test_Priority_Queue_Push(void) {
     TEST_SUCCESSFUL;
 }
 
+int Test_Priority_Queue_PushN(void) {
+
+    Priority_Queue_t *    Queue      = NULL;
+    Priority_Queue_Item_t PoppedItem = {0, NULL};
+    int                   Priorities[64], Values[64], i = 0, LastPriority = 0;
+
+    for ( i = 0; i < 64; i++ ) {
+        Priorities[i] = (i * 37) % 16;
+        Values[i]     = Priorities[i];
+    }
+
+    Queue = Priority_Queue_Create(true);
+    if ( NULL == Queue ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Priority_Queue_t for testing.");
+        TEST_FAILURE;
+    }
+
+    if ( (0 != Priority_Queue_PushN(Queue, Priorities, Values, sizeof(int), 48, NULL)) ||
+         (0 != Priority_Queue_PushN(Queue, &Priorities[48], &Values[48], sizeof(int), 16, NULL)) ||
+         (64 != Priority_Queue_Length(Queue)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to PushN() items onto Priority_Queue_t.");
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 64; i++ ) {
+        PoppedItem = Priority_Queue_Pop(Queue);
+        if ( (NULL == PoppedItem.Value) || (*(int *)PoppedItem.Value != PoppedItem.Priority) ||
+             ((0 != i) && (LastPriority < PoppedItem.Priority)) ) {
+            TEST_PRINTF("Test Failure - Item (%d) popped out of order after PushN().", i);
+            free(PoppedItem.Value);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+        LastPriority = PoppedItem.Priority;
+        free(PoppedItem.Value);
+    }
+
+    Priority_Queue_Release(Queue);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Priority_Queue_Handles(void) {
+
+    Priority_Queue_t *       Queue      = NULL;
+    Priority_Queue_Handle_t *Handles[3] = {NULL, NULL, NULL};
+    Priority_Queue_Item_t    PoppedItem = {0, NULL};
+    int                      i = 0, Expected[2] = {0, 2};
+
+    Queue = Priority_Queue_Create(true);
+    if ( NULL == Queue ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Priority_Queue_t for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 3; i++ ) {
+        Handles[i] = Priority_Queue_PushHandle(Queue, i, &i, sizeof(i), NULL);
+        if ( NULL == Handles[i] ) {
+            TEST_PRINTF("Test Failure - Failed to push item (%d) with a Handle.", i);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+    }
+
+    /* Item 0 jumps to the front, then item 1 is removed from the middle of the Queue. */
+    if ( (0 != Priority_Queue_UpdatePriority(Queue, Handles[0], 10)) ||
+         (0 != Priority_Queue_RemoveHandle(Queue, Handles[1])) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to update or remove item by Handle.");
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 2; i++ ) {
+        PoppedItem = Priority_Queue_Pop(Queue);
+        if ( (NULL == PoppedItem.Value) || (Expected[i] != *(int *)PoppedItem.Value) ) {
+            TEST_PRINTF("Test Failure - Item (%d) popped out of order after Handle updates.", i);
+            free(PoppedItem.Value);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+        free(PoppedItem.Value);
+    }
+
+    Priority_Queue_Release(Queue);
+    TEST_SUCCESSFUL;
+}
+
 int Test_Priority_Queue_Peek(void) {
 
     Priority_Queue_t *    Queue      = NULL;
@@ -347,3 +442,140 @@ int Test_Priority_Queue_Clear(void) {
     Priority_Queue_Release(Queue);
     TEST_SUCCESSFUL;
 }
+
+int Test_Priority_Queue_Merge(void) {
+
+    Priority_Queue_t *    Dst = NULL, *Src = NULL, *Monotone = NULL;
+    Priority_Queue_Item_t PoppedItem = {0, NULL};
+    int                   Round = 0, i = 0, Previous = 0;
+
+    /* Each of the Queues which can be merged, from Priority_Queue_Create(), Meldable and Typed. */
+    for ( Round = 0; Round < 3; Round++ ) {
+
+        if ( 0 == Round ) {
+            Dst = Priority_Queue_Create(true);
+            Src = Priority_Queue_Create(true);
+        } else if ( 1 == Round ) {
+            Dst = Priority_Queue_CreateMeldable(true);
+            Src = Priority_Queue_CreateMeldable(true);
+        } else {
+            Dst = Priority_Queue_CreateTyped(Priority_Int, true);
+            Src = Priority_Queue_CreateTyped(Priority_Int, true);
+        }
+        if ( (NULL == Dst) || (NULL == Src) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to create Priority_Queue_t for testing.");
+            Priority_Queue_Release(Dst);
+            Priority_Queue_Release(Src);
+            TEST_FAILURE;
+        }
+
+        for ( i = 0; i < 200; i++ ) {
+            Priority_Queue_Push(((i % 2) ? Src : Dst), i, &i, sizeof(i), NULL);
+        }
+
+        if ( (0 != Priority_Queue_Merge(Dst, Src)) || (!Priority_Queue_IsEmpty(Src)) ||
+             (200 != Priority_Queue_Length(Dst)) ) {
+            TEST_PRINTF("Test Failure - Failed to merge Priority_Queue_t in round (%d).", Round);
+            Priority_Queue_Release(Dst);
+            Priority_Queue_Release(Src);
+            TEST_FAILURE;
+        }
+
+        for ( i = 0; i < 200; i++ ) {
+            PoppedItem = Priority_Queue_Pop(Dst);
+            if ( (NULL == PoppedItem.Value) || (PoppedItem.Priority != *(int *)PoppedItem.Value) ||
+                 ((0 != i) && (PoppedItem.Priority > Previous)) ) {
+                TEST_PRINTF("Test Failure - Merged item (%d) popped out of order.", i);
+                free(PoppedItem.Value);
+                Priority_Queue_Release(Dst);
+                Priority_Queue_Release(Src);
+                TEST_FAILURE;
+            }
+            Previous = PoppedItem.Priority;
+            free(PoppedItem.Value);
+        }
+
+        Priority_Queue_Release(Dst);
+        Priority_Queue_Release(Src);
+    }
+
+    /* Queues from different functions, or of different orders, are refused. */
+    Dst      = Priority_Queue_CreateMeldable(true);
+    Src      = Priority_Queue_Create(true);
+    Monotone = Priority_Queue_CreateMonotone(Priority_Int);
+    if ( (0 == Priority_Queue_Merge(Dst, Src)) || (0 == Priority_Queue_Merge(Dst, Monotone)) ||
+         (0 == Priority_Queue_Merge(Monotone, Monotone)) ) {
+        TEST_PRINTF("%s", "Test Failure - Merged Priority_Queue_t which cannot be merged.");
+        Priority_Queue_Release(Dst);
+        Priority_Queue_Release(Src);
+        Priority_Queue_Release(Monotone);
+        TEST_FAILURE;
+    }
+
+    Priority_Queue_Release(Dst);
+    Priority_Queue_Release(Src);
+    Priority_Queue_Release(Monotone);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Priority_Queue_DoubleEnded(void) {
+
+    Priority_Queue_t *    Queue = NULL, *Plain = NULL;
+    Priority_Queue_Item_t Front = {0, NULL}, Back = {0, NULL};
+    int                   i = 0, Priority = 0;
+
+    Queue = Priority_Queue_CreateDoubleEnded(false);
+    Plain = Priority_Queue_Create(false);
+    if ( (NULL == Queue) || (NULL == Plain) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Priority_Queue_t for testing.");
+        Priority_Queue_Release(Queue);
+        Priority_Queue_Release(Plain);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 100; i++ ) {
+        Priority = (i * 37) % 100;
+        Priority_Queue_Push(Queue, Priority, &Priority, sizeof(Priority), NULL);
+        Priority_Queue_Push(Plain, Priority, &Priority, sizeof(Priority), NULL);
+    }
+
+    /* The lowest Priorities come from the front, and the highest from the back. */
+    if ( (0 != Priority_Queue_Peek(Queue).Priority) ||
+         (99 != Priority_Queue_PeekBack(Queue).Priority) ) {
+        TEST_PRINTF("Test Failure - Queue ends (%d, %d) not equal to expectation (0, 99).",
+                    Priority_Queue_Peek(Queue).Priority, Priority_Queue_PeekBack(Queue).Priority);
+        Priority_Queue_Release(Queue);
+        Priority_Queue_Release(Plain);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 50; i++ ) {
+        Front = Priority_Queue_Pop(Queue);
+        Back  = Priority_Queue_PopBack(Queue);
+        if ( (NULL == Front.Value) || (NULL == Back.Value) || (i != *(int *)Front.Value) ||
+             ((99 - i) != *(int *)Back.Value) || (Back.Priority != *(int *)Back.Value) ) {
+            TEST_PRINTF("Test Failure - Items (%d) popped from both ends out of order.", i);
+            free(Front.Value);
+            free(Back.Value);
+            Priority_Queue_Release(Queue);
+            Priority_Queue_Release(Plain);
+            TEST_FAILURE;
+        }
+        free(Front.Value);
+        free(Back.Value);
+    }
+
+    /* Only a double-ended Queue has a back to take items from. */
+    if ( (!Priority_Queue_IsEmpty(Queue)) || (NULL != Priority_Queue_PopBack(Queue).Value) ||
+         (NULL != Priority_Queue_PeekBack(Plain).Value) ||
+         (NULL != Priority_Queue_PopBack(Plain).Value) || (100 != Priority_Queue_Length(Plain)) ) {
+        TEST_PRINTF("%s", "Test Failure - Back of Priority_Queue_t did not behave as expected.");
+        Priority_Queue_Release(Queue);
+        Priority_Queue_Release(Plain);
+        TEST_FAILURE;
+    }
+
+    Priority_Queue_Release(Queue);
+    Priority_Queue_Release(Plain);
+    TEST_SUCCESSFUL;
+}
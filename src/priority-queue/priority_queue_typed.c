@@ -0,0 +1,462 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../logging/logging.h"
+#include "include/priority_queue.h"
+
+Priority_Queue_t *Priority_Queue_CreateTyped(Priority_Queue_Priority_t Type, bool Ascending) {
+
+    Priority_Queue_t *Queue = NULL;
+
+    if ( (Priority_Int != Type) && (Priority_Int64 != Type) && (Priority_Double != Type) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Error: Unknown Priority_Queue_Priority_t (%d) provided.", (int)Type);
+#endif
+        return NULL;
+    }
+
+    Queue = (Priority_Queue_t *)calloc(1, sizeof(Priority_Queue_t));
+    if ( NULL == Queue ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Priority_Queue_t.");
+#endif
+        return NULL;
+    }
+
+    Queue->Entries = (Priority_Queue_Entry_t *)calloc(LIBCONTAINER_PRIORITY_QUEUE_TYPED_CAPACITY,
+                                                      sizeof(Priority_Queue_Entry_t));
+    if ( NULL == Queue->Entries ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate internal memory to hold Queued items.");
+#endif
+        free(Queue);
+        return NULL;
+    }
+
+    Queue->Type      = Type;
+    Queue->Ascending = Ascending;
+    Queue->Capacity  = LIBCONTAINER_PRIORITY_QUEUE_TYPED_CAPACITY;
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully created typed Priority_Queue_t.");
+#endif
+    return Queue;
+}
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+uint64_t Priority_Queue_typedEncode(Priority_Queue_t *Queue, void *Priority) {
+
+    uint64_t SignBit = (uint64_t)1 << 63, Key = 0;
+
+    /*
+        Offsetting a signed integer by the sign bit makes it sort correctly as unsigned.
+        A double is sorted by its sign and then its magnitude, so the bits of a negative
+        double are inverted, and a positive double has its sign bit set to sort above them.
+    */
+    switch ( Queue->Type ) {
+        case Priority_Int: Key = (uint64_t)(int64_t)(*(int *)Priority) ^ SignBit; break;
+        case Priority_Int64: Key = (uint64_t)(*(int64_t *)Priority) ^ SignBit; break;
+        case Priority_Double:
+            memcpy(&Key, Priority, sizeof(Key));
+            Key = (0 != (Key & SignBit)) ? ~Key : (Key | SignBit);
+            break;
+    }
+
+    /* The Entries always form a min-heap, so the highest Priority first is the inverse order. */
+    return (Queue->Ascending) ? ~Key : Key;
+}
+
+void Priority_Queue_typedDecode(Priority_Queue_t *Queue, uint64_t Key, void *Priority) {
+
+    uint64_t SignBit = (uint64_t)1 << 63;
+
+    if ( Queue->Ascending ) {
+        Key = ~Key;
+    }
+
+    switch ( Queue->Type ) {
+        case Priority_Int: *(int *)Priority = (int)(int64_t)(Key ^ SignBit); break;
+        case Priority_Int64: *(int64_t *)Priority = (int64_t)(Key ^ SignBit); break;
+        case Priority_Double:
+            Key = (0 != (Key & SignBit)) ? (Key ^ SignBit) : ~Key;
+            memcpy(Priority, &Key, sizeof(Key));
+            break;
+    }
+
+    return;
+}
+
+uint64_t Priority_Queue_typedEncodeInt(Priority_Queue_t *Queue, int Priority) {
+
+    int64_t Wide = Priority;
+    double  Real = Priority;
+
+    switch ( Queue->Type ) {
+        case Priority_Int64: return Priority_Queue_typedEncode(Queue, &Wide);
+        case Priority_Double: return Priority_Queue_typedEncode(Queue, &Real);
+        default: return Priority_Queue_typedEncode(Queue, &Priority);
+    }
+}
+
+int Priority_Queue_typedDecodeInt(Priority_Queue_t *Queue, uint64_t Key) {
+
+    int64_t Wide     = 0;
+    double  Real     = 0;
+    int     Priority = 0;
+
+    switch ( Queue->Type ) {
+        case Priority_Int64:
+            Priority_Queue_typedDecode(Queue, Key, &Wide);
+            return (int)Wide;
+        case Priority_Double:
+            Priority_Queue_typedDecode(Queue, Key, &Real);
+            return (int)Real;
+        default: Priority_Queue_typedDecode(Queue, Key, &Priority); return Priority;
+    }
+}
+
+int Priority_Queue_typedReserve(Priority_Queue_t *Queue, size_t Count) {
+
+    Priority_Queue_Entry_t *Entries  = NULL;
+    size_t                  Capacity = 0;
+
+    for ( Capacity = Queue->Capacity; Capacity < Queue->Count + Count; Capacity *= 2 ) { ; }
+    if ( Capacity == Queue->Capacity ) {
+        return 0;
+    }
+
+    Entries = (Priority_Queue_Entry_t *)realloc(Queue->Entries,
+                                                Capacity * sizeof(Priority_Queue_Entry_t));
+    if ( NULL == Entries ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to grow Entries of typed Priority_Queue_t.");
+#endif
+        return 1;
+    }
+
+    Queue->Entries  = Entries;
+    Queue->Capacity = Capacity;
+
+    return 0;
+}
+
+int Priority_Queue_typedPush(Priority_Queue_t *Queue, uint64_t Key, void *Value, size_t ValueSize,
+                             ReleaseFunc_t *ReleaseFunc) {
+
+    Priority_Queue_Entry_t *Entry = NULL;
+
+    if ( NULL != Queue->Buckets ) {
+        return Priority_Queue_radixPush(Queue, Key, Value, ValueSize, ReleaseFunc);
+    }
+
+    if ( 0 != Priority_Queue_typedReserve(Queue, 1) ) {
+        return 1;
+    }
+
+    Entry = &(Queue->Entries[Queue->Count]);
+
+    if ( 0 == ValueSize ) {
+        Entry->Value = Value;
+    } else {
+        Entry->Value = calloc(ValueSize, sizeof(uint8_t));
+        if ( NULL == Entry->Value ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Value within Entry.");
+#endif
+            return 1;
+        }
+        memcpy(Entry->Value, Value, ValueSize);
+    }
+
+    Entry->Key         = Key;
+    Entry->ReleaseFunc = (NULL == ReleaseFunc) ? free : ReleaseFunc;
+
+    Queue->NextEntry = 0;
+    Priority_Queue_typedSiftUp(Queue, Queue->Count++);
+
+    return 0;
+}
+
+int Priority_Queue_typedPushN(Priority_Queue_t *Queue, int *Priorities, uint8_t *Values,
+                              size_t ValueSize, size_t Count, ReleaseFunc_t *ReleaseFunc) {
+
+    Priority_Queue_Entry_t *Entry = NULL;
+    size_t                  Start = Queue->Count, Index = 0;
+
+    if ( NULL != Queue->Buckets ) {
+        return Priority_Queue_radixPushN(Queue, Priorities, Values, ValueSize, Count, ReleaseFunc);
+    }
+
+    if ( 0 != Priority_Queue_typedReserve(Queue, Count) ) {
+        return 1;
+    }
+
+    if ( NULL == ReleaseFunc ) {
+        ReleaseFunc = free;
+    }
+
+    for ( Index = 0; Index < Count; Index++ ) {
+        Entry              = &(Queue->Entries[Start + Index]);
+        Entry->Key         = Priority_Queue_typedEncodeInt(Queue, Priorities[Index]);
+        Entry->ReleaseFunc = ReleaseFunc;
+
+        if ( 0 == ValueSize ) {
+            Entry->Value = (NULL == Values) ? NULL : ((void **)Values)[Index];
+            continue;
+        }
+
+        Entry->Value = calloc(ValueSize, sizeof(uint8_t));
+        if ( NULL == Entry->Value ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Value within Entry.");
+#endif
+            while ( Index-- > 0 ) {
+                free(Queue->Entries[Start + Index].Value);
+            }
+            return 1;
+        }
+        memcpy(Entry->Value, Values + (Index * ValueSize), ValueSize);
+    }
+
+    Queue->Count += Count;
+    Queue->NextEntry = 0;
+
+    Priority_Queue_typedHeapify(Queue, Start);
+
+    return 0;
+}
+
+int Priority_Queue_typedMerge(Priority_Queue_t *Dst, Priority_Queue_t *Src) {
+
+    size_t Start = Dst->Count;
+
+    if ( 0 == Src->Count ) {
+        return 0;
+    }
+
+    if ( 0 != Priority_Queue_typedReserve(Dst, Src->Count) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to make room in Dst for the Entries of Src.");
+#endif
+        return 1;
+    }
+
+    /* Each Entry only refers to its Value, so moving the Entries moves the items. */
+    memcpy(&(Dst->Entries[Start]), Src->Entries, Src->Count * sizeof(Priority_Queue_Entry_t));
+    Dst->Count += Src->Count;
+    Dst->NextEntry = 0;
+    Src->Count     = 0;
+    Src->NextEntry = 0;
+
+    Priority_Queue_typedHeapify(Dst, Start);
+
+    return 0;
+}
+
+void Priority_Queue_typedHeapify(Priority_Queue_t *Queue, size_t Start) {
+
+    size_t Index = 0;
+
+    /* As with a Binary_Heap_t, large batches are heapified bottom-up in O(n). */
+    if ( (Queue->Count - Start) >= Start ) {
+        Index = 0;
+        if ( Queue->Count > 1 ) {
+            Index = ((Queue->Count - 2) >> PRIORITY_QUEUE_TYPED_ARITY_SHIFT) + 1;
+        }
+        for ( ; Index > 0; Index-- ) {
+            Priority_Queue_typedSiftDown(Queue, Index - 1);
+        }
+    } else {
+        for ( Index = Start; Index < Queue->Count; Index++ ) {
+            Priority_Queue_typedSiftUp(Queue, Index);
+        }
+    }
+
+    return;
+}
+
+int Priority_Queue_typedPop(Priority_Queue_t *Queue, Priority_Queue_Entry_t *Entry) {
+
+    Priority_Queue_Bucket_t *Front = NULL;
+
+    if ( 0 == Queue->Count ) {
+        return 1;
+    }
+
+    if ( NULL != Queue->Buckets ) {
+        if ( 0 != Priority_Queue_radixSettle(Queue) ) {
+            return 1;
+        }
+        Front  = &(Queue->Buckets[0]);
+        *Entry = Front->Entries[--Front->Count];
+        Queue->Count--;
+        Queue->NextEntry = 0;
+        return 0;
+    }
+
+    *Entry = Queue->Entries[0];
+
+    Queue->NextEntry = 0;
+    Queue->Count--;
+    if ( 0 != Queue->Count ) {
+        Queue->Entries[0] = Queue->Entries[Queue->Count];
+        Priority_Queue_typedSiftDown(Queue, 0);
+    }
+
+    return 0;
+}
+
+Priority_Queue_Entry_t *Priority_Queue_typedPeek(Priority_Queue_t *Queue) {
+
+    if ( 0 == Queue->Count ) {
+        return NULL;
+    }
+
+    if ( NULL != Queue->Buckets ) {
+        if ( 0 != Priority_Queue_radixSettle(Queue) ) {
+            return NULL;
+        }
+        return &(Queue->Buckets[0].Entries[Queue->Buckets[0].Count - 1]);
+    }
+
+    return &(Queue->Entries[0]);
+}
+
+Priority_Queue_Entry_t *Priority_Queue_typedNext(Priority_Queue_t *Queue) {
+
+    if ( NULL != Queue->Buckets ) {
+        return Priority_Queue_radixNext(Queue);
+    }
+
+    if ( Queue->NextEntry >= Queue->Count ) {
+        Queue->NextEntry = 0;
+        return NULL;
+    }
+
+    return &(Queue->Entries[Queue->NextEntry++]);
+}
+
+void Priority_Queue_typedClear(Priority_Queue_t *Queue) {
+
+    Priority_Queue_Entry_t *Entry = NULL;
+    size_t                  Index = 0;
+
+    if ( NULL != Queue->Buckets ) {
+        Priority_Queue_radixClear(Queue);
+        return;
+    }
+
+    for ( Index = 0; Index < Queue->Count; Index++ ) {
+        Entry = &(Queue->Entries[Index]);
+        if ( (NULL != Entry->Value) && (NULL != Entry->ReleaseFunc) ) {
+            Entry->ReleaseFunc(Entry->Value);
+        }
+    }
+
+    Queue->Count     = 0;
+    Queue->NextEntry = 0;
+
+    return;
+}
+
+void Priority_Queue_typedRelease(Priority_Queue_t *Queue) {
+
+    size_t b = 0;
+
+    Priority_Queue_typedClear(Queue);
+
+    if ( NULL != Queue->Buckets ) {
+        for ( b = 0; b < PRIORITY_QUEUE_RADIX_BUCKETS; b++ ) {
+            free(Queue->Buckets[b].Entries);
+        }
+        free(Queue->Buckets);
+    }
+
+    free(Queue->Entries);
+
+    return;
+}
+
+void Priority_Queue_typedSiftUp(Priority_Queue_t *Queue, size_t Index) {
+
+    Priority_Queue_Entry_t *Entries = Queue->Entries;
+    Priority_Queue_Entry_t  Hole    = Entries[Index];
+    size_t                  Parent  = 0;
+
+    while ( Index > 0 ) {
+        Parent = (Index - 1) >> PRIORITY_QUEUE_TYPED_ARITY_SHIFT;
+        if ( Entries[Parent].Key <= Hole.Key ) {
+            break;
+        }
+        Entries[Index] = Entries[Parent];
+        Index          = Parent;
+    }
+
+    Entries[Index] = Hole;
+
+    return;
+}
+
+void Priority_Queue_typedSiftDown(Priority_Queue_t *Queue, size_t Index) {
+
+    Priority_Queue_Entry_t *Entries = Queue->Entries;
+    Priority_Queue_Entry_t  Hole    = Entries[Index];
+    size_t                  Child = 0, Last = 0, Best = 0;
+
+    for ( ;; ) {
+        Child = (Index << PRIORITY_QUEUE_TYPED_ARITY_SHIFT) + 1;
+        if ( Child >= Queue->Count ) {
+            break;
+        }
+
+        Last = Child + ((size_t)1 << PRIORITY_QUEUE_TYPED_ARITY_SHIFT);
+        if ( Last > Queue->Count ) {
+            Last = Queue->Count;
+        }
+
+        for ( Best = Child++; Child < Last; Child++ ) {
+            if ( Entries[Child].Key < Entries[Best].Key ) {
+                Best = Child;
+            }
+        }
+
+        if ( Hole.Key <= Entries[Best].Key ) {
+            break;
+        }
+
+        Entries[Index] = Entries[Best];
+        Index          = Best;
+    }
+
+    Entries[Index] = Hole;
+
+    return;
+}
+
+/* ---------- Private Functions ---------- */
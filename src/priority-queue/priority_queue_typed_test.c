@@ -0,0 +1,316 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../logging/logging.h"
+#include "include/priority_queue.h"
+
+static int TypedCountCallback(void *Item, void *Args) {
+
+    Priority_Queue_Item_t *QueueItem = (Priority_Queue_Item_t *)Item;
+
+    /* Every Value holds a copy of its own Priority. */
+    if ( QueueItem->Priority != *(int *)QueueItem->Value ) {
+        return 1;
+    }
+
+    (*(size_t *)Args)++;
+    return 0;
+}
+
+int Test_priority_queue_typed(void) {
+
+    int FailedTests = 0;
+
+    FailedTests += Test_Priority_Queue_Typed_Create();
+    FailedTests += Test_Priority_Queue_Typed_Int();
+    FailedTests += Test_Priority_Queue_Typed_Int64();
+    FailedTests += Test_Priority_Queue_Typed_Double();
+    FailedTests += Test_Priority_Queue_Typed_Interface();
+
+    return FailedTests;
+}
+
+int Test_Priority_Queue_Typed_Create(void) {
+
+    Priority_Queue_t *        Queue   = NULL;
+    Priority_Queue_Priority_t Types[] = {Priority_Int, Priority_Int64, Priority_Double};
+    size_t                    i       = 0;
+
+    if ( NULL != (Queue = Priority_Queue_CreateTyped((Priority_Queue_Priority_t)42, true)) ) {
+        TEST_PRINTF("%s", "Test Failure - Created a Priority_Queue_t with an unknown Type.");
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < sizeof(Types) / sizeof(Types[0]); i++ ) {
+        Queue = Priority_Queue_CreateTyped(Types[i], (0 == (i % 2)));
+        if ( (NULL == Queue) || (!Priority_Queue_IsEmpty(Queue)) ||
+             (NULL != Priority_Queue_PeekTyped(Queue, NULL)) ) {
+            TEST_PRINTF("Test Failure - Failed to create typed Priority_Queue_t of Type (%d).",
+                        (int)Types[i]);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+        Priority_Queue_Release(Queue);
+    }
+
+    TEST_SUCCESSFUL;
+}
+
+int Test_Priority_Queue_Typed_Int(void) {
+
+    Priority_Queue_t *Queue = NULL;
+    int               Priority = 0, Previous = 0, i = 0, *Value = NULL, Direction = 0;
+
+    for ( Direction = 0; Direction < 2; Direction++ ) {
+
+        Queue = Priority_Queue_CreateTyped(Priority_Int, (1 == Direction));
+        if ( NULL == Queue ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to create typed Priority_Queue_t.");
+            TEST_FAILURE;
+        }
+
+        /* Both extremes are included, as the encoding must not overflow on either of them. */
+        for ( i = 0; i < 1000; i++ ) {
+            Priority = ((i * 7919) % 397) - 198;
+            if ( 0 == i ) {
+                Priority = INT_MIN;
+            } else if ( 1 == i ) {
+                Priority = INT_MAX;
+            }
+            if ( 0 != Priority_Queue_PushTyped(Queue, &Priority, &Priority, sizeof(Priority),
+                                               NULL) ) {
+                TEST_PRINTF("Test Failure - Failed to push Priority (%d).", Priority);
+                Priority_Queue_Release(Queue);
+                TEST_FAILURE;
+            }
+        }
+
+        for ( i = 0; i < 1000; i++ ) {
+            Value = (int *)Priority_Queue_PopTyped(Queue, &Priority);
+            if ( (NULL == Value) || (*Value != Priority) ||
+                 ((0 != i) && (Direction == 1) && (Priority > Previous)) ||
+                 ((0 != i) && (Direction == 0) && (Priority < Previous)) ) {
+                TEST_PRINTF("Test Failure - Priority (%d) popped out of order.", Priority);
+                free(Value);
+                Priority_Queue_Release(Queue);
+                TEST_FAILURE;
+            }
+            Previous = Priority;
+            free(Value);
+        }
+
+        if ( Previous != ((1 == Direction) ? INT_MIN : INT_MAX) ) {
+            TEST_PRINTF("Test Failure - Last Priority (%d) was not the extreme expected.",
+                        Previous);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+
+        Priority_Queue_Release(Queue);
+    }
+
+    TEST_SUCCESSFUL;
+}
+
+int Test_Priority_Queue_Typed_Int64(void) {
+
+    Priority_Queue_t *Queue = NULL;
+    int64_t           Priorities[6], Popped[6], Priority = 0;
+    int               i = 0;
+
+    /* Priorities beyond the range of an int, including both extremes of an int64_t. */
+    Priorities[0] = ((int64_t)1 << 40);
+    Priorities[1] = -((int64_t)1 << 40);
+    Priorities[2] = 0;
+    Priorities[3] = -(int64_t)(((uint64_t)1 << 63) - 1) - 1;
+    Priorities[4] = (int64_t)(((uint64_t)1 << 63) - 1);
+    Priorities[5] = ((int64_t)1 << 40) + 1;
+
+    Queue = Priority_Queue_CreateTyped(Priority_Int64, false);
+    if ( NULL == Queue ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create typed Priority_Queue_t.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 6; i++ ) {
+        if ( 0 != Priority_Queue_PushTyped(Queue, &Priorities[i], &Priorities[i], 0, NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to push Priority (%d).", i);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+    }
+
+    /* The Values are held by reference, each pointing at its own Priority. */
+    for ( i = 0; i < 6; i++ ) {
+        if ( (*(int64_t *)Priority_Queue_PeekTyped(Queue, &Priority) != Priority) ||
+             (*(int64_t *)Priority_Queue_PopTyped(Queue, NULL) != Priority) ) {
+            TEST_PRINTF("Test Failure - Popped item (%d) does not match its Priority.", i);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+        Popped[i] = Priority;
+    }
+
+    for ( i = 1; i < 6; i++ ) {
+        if ( Popped[i - 1] > Popped[i] ) {
+            TEST_PRINTF("Test Failure - Priority (%d) popped out of order.", i);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+    }
+
+    Priority_Queue_Release(Queue);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Priority_Queue_Typed_Double(void) {
+
+    Priority_Queue_t *Queue      = NULL;
+    double            Priorities[] = {1.5, -0.25, 1e300, -1e300, 0.0, 2.75, -3.5, 0.125};
+    double            Priority = 0, Previous = 0;
+    int               i = 0, Count = (int)(sizeof(Priorities) / sizeof(Priorities[0]));
+
+    Queue = Priority_Queue_CreateTyped(Priority_Double, true);
+    if ( NULL == Queue ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create typed Priority_Queue_t.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        if ( 0 != Priority_Queue_PushTyped(Queue, &Priorities[i], &Priorities[i],
+                                           sizeof(double), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to push Priority (%f).", Priorities[i]);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+    }
+
+    /* The highest Priority is returned first, as for Priority_Queue_Create(true). */
+    for ( i = 0; i < Count; i++ ) {
+        Priorities[i] = *(double *)Priority_Queue_PeekTyped(Queue, NULL);
+        Priority_Queue_Remove(Queue);
+        if ( (0 != i) && (Priorities[i] > Previous) ) {
+            TEST_PRINTF("Test Failure - Priority (%f) popped out of order.", Priorities[i]);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+        Previous = Priorities[i];
+    }
+
+    if ( (1e300 != Priorities[0]) || (-1e300 != Priorities[Count - 1]) ||
+         (NULL != Priority_Queue_PopTyped(Queue, &Priority)) ) {
+        TEST_PRINTF("%s", "Test Failure - Typed Priority_Queue_t did not drain as expected.");
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    Priority_Queue_Release(Queue);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Priority_Queue_Typed_Interface(void) {
+
+    Priority_Queue_t *    Queue = NULL;
+    Priority_Queue_Item_t Item  = {0, NULL};
+    int                   Priorities[64], i = 0, Previous = 0, Last = 0;
+    size_t                Visited = 0;
+
+    for ( i = 0; i < 64; i++ ) {
+        Priorities[i] = (i * 37) % 16;
+    }
+
+    Queue = Priority_Queue_CreateTyped(Priority_Double, false);
+    if ( NULL == Queue ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create typed Priority_Queue_t.");
+        TEST_FAILURE;
+    }
+
+    if ( NULL != Priority_Queue_PushHandle(Queue, 1, &i, sizeof(i), NULL) ) {
+        TEST_PRINTF("%s", "Test Failure - Typed Priority_Queue_t handed out a Handle.");
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    /* The int interface converts to and from the Type of the Queue. */
+    if ( (0 != Priority_Queue_PushN(Queue, Priorities, Priorities, sizeof(int), 48, NULL)) ||
+         (0 != Priority_Queue_PushN(Queue, &Priorities[48], &Priorities[48], sizeof(int), 8,
+                                    NULL)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to push batches onto typed Priority_Queue_t.");
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+    for ( i = 56; i < 64; i++ ) {
+        if ( 0 != Priority_Queue_Push(Queue, Priorities[i], &Priorities[i], sizeof(int), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to push item (%d).", i);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( (64 != Priority_Queue_Length(Queue)) ||
+         (0 != Priority_Queue_DoCallbackArg(Queue, TypedCountCallback, &Visited)) ||
+         (64 != Visited) ) {
+        TEST_PRINTF("Test Failure - Visited (%lu) of (%lu) items of typed Priority_Queue_t.",
+                    (unsigned long)Visited, (unsigned long)Priority_Queue_Length(Queue));
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 32; i++ ) {
+        Previous = Priority_Queue_Peek(Queue).Priority;
+        Item     = Priority_Queue_Pop(Queue);
+        if ( Previous != Item.Priority ) {
+            TEST_PRINTF("%s", "Test Failure - Peeked and Popped items do not match.");
+            free(Item.Value);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+        if ( (NULL == Item.Value) || (*(int *)Item.Value != Item.Priority) ||
+             ((0 != i) && (Item.Priority < Last)) ) {
+            TEST_PRINTF("Test Failure - Item (%d) popped out of order.", i);
+            free(Item.Value);
+            Priority_Queue_Release(Queue);
+            TEST_FAILURE;
+        }
+        Last = Item.Priority;
+        free(Item.Value);
+    }
+
+    if ( (0 != Priority_Queue_Clear(Queue)) || (!Priority_Queue_IsEmpty(Queue)) ||
+         (NULL != Priority_Queue_Pop(Queue).Value) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to clear typed Priority_Queue_t.");
+        Priority_Queue_Release(Queue);
+        TEST_FAILURE;
+    }
+
+    Priority_Queue_Release(Queue);
+    TEST_SUCCESSFUL;
+}
@@ -34,8 +34,10 @@ extern "C" {
 
 #define LIBCONTAINER_ENABLE_SET
 #define LIBCONTAINER_ENABLE_BINARY_TREE
+#define LIBCONTAINER_ENABLE_BTREE
 #include "../../../include/libcontainer.h"
 
+#include "../../tree/b-tree/include/btree.h"
 #include "../../tree/binary-tree/include/binary_tree.h"
 #include "../../iterator/include/iterator.h"
 
@@ -52,6 +54,13 @@ struct Set_t {
         required.
     */
     Binary_Tree_t* Contents;
+
+    /*
+        A Set created by Set_CreateBTree() is instead an interface over a
+        BTree_t, with Contents left as NULL. Exactly one of these two is
+        non-NULL for any Set.
+    */
+    BTree_t* BTreeContents;
 };
 
 #if defined(TESTING) || defined(DEBUGGER)
@@ -48,6 +48,8 @@ int Test_Set_DoCallback(void);
 int Test_Set_DoCallbackArgs(void);
 int Test_Set_Remove(void);
 int Test_Set_Clear(void);
+int Test_Set_BTree(void);
+int Test_Set_BuildFromSorted(void);
 
 #ifdef __cplusplus
 }
@@ -55,6 +55,63 @@ Set_t *Set_Create(CompareFunc_t *CompareFunc, size_t ValueSize, ReleaseFunc_t *R
     return Set;
 }
 
+Set_t *Set_CreateBTree(CompareFunc_t *CompareFunc, size_t ValueSize, ReleaseFunc_t *ReleaseFunc) {
+
+    Set_t *Set = NULL;
+
+    Set = (Set_t *)calloc(1, sizeof(Set_t));
+    if ( NULL == Set ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Set_t.");
+#endif
+        return NULL;
+    }
+
+    Set->BTreeContents = BTree_Create(CompareFunc, ValueSize, ReleaseFunc, Policy_Error);
+    if ( NULL == Set->BTreeContents ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to prepare internal data structure to implement Set_t.");
+#endif
+        free(Set);
+        return NULL;
+    }
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully created and initialized B+tree backed Set_t.");
+#endif
+    return Set;
+}
+
+Set_t *Set_BuildFromSorted(CompareFunc_t *CompareFunc, size_t ValueSize, ReleaseFunc_t *ReleaseFunc,
+                           void *Values, size_t Count) {
+
+    Set_t *Set = NULL;
+
+    Set = (Set_t *)calloc(1, sizeof(Set_t));
+    if ( NULL == Set ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Set_t.");
+#endif
+        return NULL;
+    }
+
+    Set->Contents = Binary_Tree_BuildFromSorted(CompareFunc, ValueSize, ReleaseFunc, Policy_Error,
+                                                Values, NULL, 0, NULL, Count);
+    if ( NULL == Set->Contents ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s",
+                     "Error: Failed to bulk-load internal data structure to implement Set_t.");
+#endif
+        free(Set);
+        return NULL;
+    }
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully created and bulk-loaded Set_t.");
+#endif
+    return Set;
+}
+
 size_t Set_Length(Set_t *Set) {
 
     if ( NULL == Set ) {
@@ -64,6 +121,10 @@ size_t Set_Length(Set_t *Set) {
         return 0;
     }
 
+    if ( NULL != Set->BTreeContents ) {
+        return BTree_Length(Set->BTreeContents);
+    }
+
     return Binary_Tree_Length(Set->Contents);
 }
 
@@ -76,6 +137,10 @@ int Set_Insert(Set_t *Set, void *Value, size_t ValueSize) {
         return 1;
     }
 
+    if ( NULL != Set->BTreeContents ) {
+        return BTree_Insert(Set->BTreeContents, Value, ValueSize, NULL, 0, NULL);
+    }
+
     return Binary_Tree_Insert(Set->Contents, Value, ValueSize, NULL, 0, NULL);
 }
 
@@ -88,6 +153,10 @@ bool Set_ValueExists(Set_t *Set, void *Value, size_t ValueSize) {
         return false;
     }
 
+    if ( NULL != Set->BTreeContents ) {
+        return BTree_KeyExists(Set->BTreeContents, Value, ValueSize);
+    }
+
     return Binary_Tree_KeyExists(Set->Contents, Value, ValueSize);
 }
 
@@ -100,6 +169,10 @@ void *Set_Next(Set_t *Set) {
         return NULL;
     }
 
+    if ( NULL != Set->BTreeContents ) {
+        return BTree_Next(Set->BTreeContents).Key;
+    }
+
     return Binary_Tree_Next(Set->Contents, Direction_InOrder).Key;
 }
 
@@ -115,7 +188,11 @@ int Set_DoCallback(Set_t *Set, CallbackFunc_t *Callback) {
         return -1;
     }
 
-    Iterator_Invalidate(&(Set->Contents->Iterator));
+    if ( NULL != Set->BTreeContents ) {
+        Iterator_Invalidate(&(Set->BTreeContents->Iterator));
+    } else {
+        Iterator_Invalidate(&(Set->Contents->Iterator));
+    }
 
     SET_FOREACH(Set, Value) {
         if ( 0 != Callback(Value) ) {
@@ -141,7 +218,11 @@ int Set_DoCallbackArgs(Set_t *Set, CallbackArgFunc_t *Callback, void *Args) {
         return -1;
     }
 
-    Iterator_Invalidate(&(Set->Contents->Iterator));
+    if ( NULL != Set->BTreeContents ) {
+        Iterator_Invalidate(&(Set->BTreeContents->Iterator));
+    } else {
+        Iterator_Invalidate(&(Set->Contents->Iterator));
+    }
 
     SET_FOREACH(Set, Value) {
         if ( 0 != Callback(Value, Args) ) {
@@ -164,6 +245,10 @@ int Set_Remove(Set_t *Set, void *Value, size_t ValueSize) {
         return 1;
     }
 
+    if ( NULL != Set->BTreeContents ) {
+        return BTree_Remove(Set->BTreeContents, Value, ValueSize);
+    }
+
     return Binary_Tree_Remove(Set->Contents, Value, ValueSize);
 }
 
@@ -176,6 +261,10 @@ int Set_Clear(Set_t *Set) {
         return 1;
     }
 
+    if ( NULL != Set->BTreeContents ) {
+        return BTree_Clear(Set->BTreeContents);
+    }
+
     return Binary_Tree_Clear(Set->Contents);
 }
 
@@ -188,7 +277,11 @@ void Set_Release(Set_t *Set) {
         return;
     }
 
-    Binary_Tree_Release(Set->Contents);
+    if ( NULL != Set->BTreeContents ) {
+        BTree_Release(Set->BTreeContents);
+    } else {
+        Binary_Tree_Release(Set->Contents);
+    }
 
     ZERO_CONTAINER(Set, Set_t);
     free(Set);
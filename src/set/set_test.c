@@ -79,6 +79,8 @@ int Test_set(void) {
     FailedTests += Test_Set_DoCallbackArgs();
     FailedTests += Test_Set_Remove();
     FailedTests += Test_Set_Clear();
+    FailedTests += Test_Set_BTree();
+    FailedTests += Test_Set_BuildFromSorted();
 
     return FailedTests;
 }
@@ -349,3 +351,133 @@ int Test_Set_Clear(void) {
     Set_Release(Set);
     TEST_SUCCESSFUL;
 }
+
+int Test_Set_BTree(void) {
+
+    Set_t *Set   = NULL;
+    int    Count = 256, i = 0, *CheckValue;
+
+    Set = Set_CreateBTree(CompareFunc_Int_Ascending, sizeof(int), NULL);
+    if ( NULL == Set ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Set_t for testing.");
+        TEST_FAILURE;
+    }
+
+    /* Insert in descending order, to check the Set still iterates in ascending order. */
+    for ( i = Count - 1; i >= 0; i-- ) {
+        if ( 0 != Set_Insert(Set, &i, sizeof(i)) ) {
+            TEST_PRINTF("Test Failure - Failed to insert item [ %d ] into Set_t.", i);
+            Set_Release(Set);
+            TEST_FAILURE;
+        }
+    }
+
+    i = 0;
+    if ( 0 <= Set_Insert(Set, &i, sizeof(i)) ) {
+        TEST_PRINTF("%s", "Test Failure - Duplicate item was inserted into Set_t.");
+        Set_Release(Set);
+        TEST_FAILURE;
+    }
+
+    i = 0;
+    SET_FOREACH(Set, CheckValue) {
+        if ( *CheckValue != i ) {
+            TEST_PRINTF("Test Failure - Retrieved value (%d) not equal to expectation (%d).",
+                        *CheckValue, i);
+            Set_Release(Set);
+            TEST_FAILURE;
+        }
+        i++;
+    }
+
+    if ( i != Count ) {
+        TEST_PRINTF("Test Failure - Set_t iterator only reached (%d) of (%d) items.", i, Count);
+        Set_Release(Set);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i += 2 ) {
+        if ( 0 != Set_Remove(Set, &i, sizeof(i)) ) {
+            TEST_PRINTF("Test Failure - Failed to remove item [ %d ] from Set_t.", i);
+            Set_Release(Set);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        if ( Set_ValueExists(Set, &i, sizeof(i)) != (1 == (i % 2)) ) {
+            TEST_PRINTF("Test Failure - Existence of item [ %d ] not equal to expectation.", i);
+            Set_Release(Set);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( 0 != Set_DoCallback(Set, CallbackFunc_Int) ) {
+        TEST_PRINTF("%s", "Test Failure - Callback function failed on B+tree backed Set_t.");
+        Set_Release(Set);
+        TEST_FAILURE;
+    }
+
+    if ( (0 != Set_Clear(Set)) || (0 != Set_Length(Set)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to clear Set_t.");
+        Set_Release(Set);
+        TEST_FAILURE;
+    }
+
+    Set_Release(Set);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Set_BuildFromSorted(void) {
+
+    Set_t *Set = NULL;
+    int    Values[100], Count = 100, i = 0, *CheckValue;
+
+    for ( i = 0; i < Count; i++ ) {
+        Values[i] = 3 * i;
+    }
+
+    Set = Set_BuildFromSorted(CompareFunc_Int_Ascending, sizeof(int), NULL, Values, (size_t)Count);
+    if ( NULL == Set ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to bulk-load Set_t for testing.");
+        TEST_FAILURE;
+    }
+
+    if ( (size_t)Count != Set_Length(Set) ) {
+        TEST_PRINTF("Test Failure - Set_t length (%lu) not equal to expectation (%d).",
+                    (unsigned long)Set_Length(Set), Count);
+        Set_Release(Set);
+        TEST_FAILURE;
+    }
+
+    i = 0;
+    SET_FOREACH(Set, CheckValue) {
+        if ( *CheckValue != Values[i] ) {
+            TEST_PRINTF("Test Failure - Retrieved value (%d) not equal to expectation (%d).",
+                        *CheckValue, Values[i]);
+            Set_Release(Set);
+            TEST_FAILURE;
+        }
+        i++;
+    }
+
+    /* The bulk-loaded Set must behave exactly as one built by Set_Insert(). */
+    i = 1;
+    if ( (0 != Set_Insert(Set, &i, sizeof(i))) || (0 <= Set_Insert(Set, &Values[7], sizeof(int))) ||
+         !Set_ValueExists(Set, &i, sizeof(i)) ) {
+        TEST_PRINTF("%s", "Test Failure - Bulk-loaded Set_t did not accept further insertions.");
+        Set_Release(Set);
+        TEST_FAILURE;
+    }
+    Set_Release(Set);
+
+    Values[Count / 2] = Values[(Count / 2) - 1];
+    Set = Set_BuildFromSorted(CompareFunc_Int_Ascending, sizeof(int), NULL, Values, (size_t)Count);
+    if ( NULL != Set ) {
+        TEST_PRINTF("%s", "Test Failure - Set_t was bulk-loaded from unsorted input.");
+        Set_Release(Set);
+        TEST_FAILURE;
+    }
+
+    TEST_SUCCESSFUL;
+}
@@ -0,0 +1,284 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef LIBCONTAINER_TIMER_WHEEL_H
+#define LIBCONTAINER_TIMER_WHEEL_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define LIBCONTAINER_ENABLE_TIMER_WHEEL
+#include "../../../include/libcontainer.h"
+
+#include "../../list/include/list_node.h"
+#include "../../pool/include/pool.h"
+
+/*
+    TIMER_WHEEL_SLOT_BITS
+
+    The number of bits of the Expiry each level of the Wheel resolves, such that
+    each level holds (1 << TIMER_WHEEL_SLOT_BITS) Slots. This is 6, so that the
+    occupancy of a level fits within a single uint64_t.
+*/
+#define TIMER_WHEEL_SLOT_BITS 6
+#define TIMER_WHEEL_SLOTS     (1 << TIMER_WHEEL_SLOT_BITS)
+
+/*
+    TIMER_WHEEL_LEVELS
+
+    The number of levels of the Wheel, enough for TIMER_WHEEL_SLOT_BITS per level
+    to cover the full 64 bits of an Expiry. Two further values are used as the Level
+    of a Timer outside of the levels: TIMER_WHEEL_DUE for one waiting to fire, and
+    TIMER_WHEEL_FIRING for one whose callback is running.
+*/
+#define TIMER_WHEEL_LEVELS ((64 + TIMER_WHEEL_SLOT_BITS - 1) / TIMER_WHEEL_SLOT_BITS)
+#define TIMER_WHEEL_DUE    TIMER_WHEEL_LEVELS
+#define TIMER_WHEEL_FIRING (TIMER_WHEEL_LEVELS + 1)
+
+struct TimerWheel_Timer_t {
+
+    /*
+        Node links the Timer into the list of its Slot, and holds the Value and its
+        ReleaseFunc. This must be the first member, so the Node of a Timer found by
+        walking a Slot can be converted back into the Timer.
+    */
+    List_Node_t Node;
+
+    /*
+        Expiry is the tick at which the Timer fires. Level and Slot record which list
+        the Timer is currently linked into, so it can be unlinked in O(1).
+    */
+    uint64_t Expiry;
+    size_t   Level;
+    size_t   Slot;
+};
+
+struct TimerWheel_t {
+
+    /*
+        Now is the current tick of the Wheel. Every Timer with an Expiry at or before
+        Now has either fired, or is waiting on the Due list to fire.
+    */
+    uint64_t Now;
+    size_t   Length;
+
+    /*
+        Slots holds the head of the list of Timers within each Slot of each level,
+        and Occupied has bit s of a level set exactly when Slot s of it is non-empty.
+
+        A Timer sits at the level of the highest TIMER_WHEEL_SLOT_BITS-wide digit at
+        which its Expiry differs from Now, in the Slot named by that digit of its Expiry.
+        Every occupied Slot is therefore strictly ahead of the matching digit of Now,
+        and the lowest occupied level always holds the next Timers to move.
+    */
+    List_Node_t* Slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+    uint64_t     Occupied[TIMER_WHEEL_LEVELS];
+
+    /*
+        Due holds the Timers which have expired, but not yet fired, in order of
+        Expiry. DueTail is its last Timer, as most Timers join at the end.
+    */
+    List_Node_t* Due;
+    List_Node_t* DueTail;
+
+    /*
+        TimerPool provides the memory for every Timer of the Wheel.
+    */
+    Pool_t* TimerPool;
+};
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+/*
+    TimerWheel_lowestBit
+
+    This function returns the index of the lowest set bit of a non-zero Bits.
+
+    Inputs:
+    Bits    -   The non-zero value to search.
+
+    Outputs:
+    size_t  -   The index of the least significant set bit of Bits.
+*/
+size_t TimerWheel_lowestBit(uint64_t Bits);
+
+/*
+    TimerWheel_highestBit
+
+    This function returns the index of the highest set bit of a non-zero Bits.
+
+    Inputs:
+    Bits    -   The non-zero value to search.
+
+    Outputs:
+    size_t  -   The index of the most significant set bit of Bits.
+*/
+size_t TimerWheel_highestBit(uint64_t Bits);
+
+/*
+    TimerWheel_listOf
+
+    This function returns the list a Timer is currently linked into.
+
+    Inputs:
+    Wheel   -   Pointer to the TimerWheel_t holding the Timer.
+    Timer   -   The Timer to find the list of. This must not be firing.
+
+    Outputs:
+    List_Node_t**   -   Pointer to the head of the list holding the Timer.
+*/
+List_Node_t** TimerWheel_listOf(TimerWheel_t* Wheel, TimerWheel_Timer_t* Timer);
+
+/*
+    TimerWheel_place
+
+    This function links an unlinked Timer into the Slot matching its Expiry
+    relative to the current tick of the Wheel, or onto the Due list if it has
+    already expired.
+
+    Inputs:
+    Wheel   -   Pointer to the TimerWheel_t to operate on.
+    Timer   -   The Timer to link into the Wheel.
+
+    Outputs:
+    None, the Timer is linked into the Wheel.
+*/
+void TimerWheel_place(TimerWheel_t* Wheel, TimerWheel_Timer_t* Timer);
+
+/*
+    TimerWheel_placeDue
+
+    This function links an unlinked, expired, Timer into the Due list, behind
+    every Timer with an Expiry at or before its own, so the Due list fires in
+    order of Expiry.
+
+    Inputs:
+    Wheel   -   Pointer to the TimerWheel_t to operate on.
+    Timer   -   The expired Timer to link onto the Due list.
+
+    Outputs:
+    None, the Timer is linked into the Due list.
+*/
+void TimerWheel_placeDue(TimerWheel_t* Wheel, TimerWheel_Timer_t* Timer);
+
+/*
+    TimerWheel_unlink
+
+    This function unlinks a Timer from whichever list of the Wheel it is in,
+    leaving the Timer and its Value intact.
+
+    Inputs:
+    Wheel   -   Pointer to the TimerWheel_t to operate on.
+    Timer   -   The Timer to unlink. This must not be firing.
+
+    Outputs:
+    None, the Timer is unlinked from the Wheel.
+*/
+void TimerWheel_unlink(TimerWheel_t* Wheel, TimerWheel_Timer_t* Timer);
+
+/*
+    TimerWheel_cascade
+
+    This function empties a single Slot, re-placing each of its Timers relative
+    to the current tick of the Wheel. Timers which expire at the current tick move
+    onto the Due list, and the rest move down to a lower level.
+
+    Inputs:
+    Wheel   -   Pointer to the TimerWheel_t to operate on.
+    Level   -   The level of the Slot to empty.
+    Slot    -   The index of the Slot within the level.
+
+    Outputs:
+    None, the Slot is emptied.
+*/
+void TimerWheel_cascade(TimerWheel_t* Wheel, size_t Level, size_t Slot);
+
+/*
+    TimerWheel_nextEvent
+
+    This function finds the next tick after the current tick of the Wheel at
+    which a Slot must be emptied, which is the start of the first occupied Slot
+    of the lowest occupied level.
+
+    Inputs:
+    Wheel   -   Pointer to the TimerWheel_t to operate on.
+    When    -   Pointer to where the tick of the next event is written.
+    Level   -   Pointer to where the level of the Slot to empty is written.
+
+    Outputs:
+    int     -   Returns 0 if an event was found, or non-zero if no Slot is occupied.
+*/
+int TimerWheel_nextEvent(TimerWheel_t* Wheel, uint64_t* When, size_t* Level);
+
+/*
+    TimerWheel_fire
+
+    This function fires every Timer on the Due list, including any scheduled onto
+    it by the callbacks themselves, then releases each of them.
+
+    Inputs:
+    Wheel       -   Pointer to the TimerWheel_t to operate on.
+    Callback    -   The function to call with each Value, or NULL.
+    Args        -   The additional argument to pass to each call of the Callback.
+
+    Outputs:
+    int     -   Returns 0 if every Callback succeeded, non-zero otherwise.
+*/
+int TimerWheel_fire(TimerWheel_t* Wheel, CallbackArgFunc_t* Callback, void* Args);
+
+/*
+    TimerWheel_releaseTimer
+
+    This function releases the Value held by an unlinked Timer, and returns the
+    Timer to the pool of the Wheel.
+
+    Inputs:
+    Wheel   -   Pointer to the TimerWheel_t owning the Timer.
+    Timer   -   The unlinked Timer to release.
+
+    Outputs:
+    None, the Timer and its Value are released.
+*/
+void TimerWheel_releaseTimer(TimerWheel_t* Wheel, TimerWheel_Timer_t* Timer);
+
+/* ---------- Private Functions ---------- */
+
+#if defined(TESTING) || defined(DEBUGGER)
+
+#include "timer_wheel_test.h"
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,462 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../logging/logging.h"
+#include "include/timer_wheel.h"
+
+TimerWheel_t *TimerWheel_Create(uint64_t Now) {
+
+    TimerWheel_t *Wheel = NULL;
+
+    Wheel = (TimerWheel_t *)calloc(1, sizeof(TimerWheel_t));
+    if ( NULL == Wheel ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for TimerWheel_t.");
+#endif
+        return NULL;
+    }
+
+    Wheel->TimerPool = Pool_Create(sizeof(TimerWheel_Timer_t));
+    if ( NULL == Wheel->TimerPool ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to create Pool_t for TimerWheel_t.");
+#endif
+        free(Wheel);
+        return NULL;
+    }
+
+    Wheel->Now = Now;
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully created TimerWheel_t.");
+#endif
+    return Wheel;
+}
+
+size_t TimerWheel_Length(TimerWheel_t *Wheel) {
+
+    if ( NULL == Wheel ) {
+        return 0;
+    }
+
+    return Wheel->Length;
+}
+
+bool TimerWheel_IsEmpty(TimerWheel_t *Wheel) {
+    return (0 == TimerWheel_Length(Wheel));
+}
+
+uint64_t TimerWheel_Now(TimerWheel_t *Wheel) {
+
+    if ( NULL == Wheel ) {
+        return 0;
+    }
+
+    return Wheel->Now;
+}
+
+TimerWheel_Timer_t *TimerWheel_Schedule(TimerWheel_t *Wheel, uint64_t Expiry, void *Value,
+                                        size_t ValueSize, ReleaseFunc_t *ReleaseFunc) {
+
+    TimerWheel_Timer_t *Timer = NULL;
+
+    if ( NULL == Wheel ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Wheel* provided.");
+#endif
+        return NULL;
+    }
+
+    Timer = (TimerWheel_Timer_t *)Pool_Alloc(Wheel->TimerPool);
+    if ( NULL == Timer ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate TimerWheel_Timer_t.");
+#endif
+        return NULL;
+    }
+
+    memset(Timer, 0, sizeof(TimerWheel_Timer_t));
+    Timer->Node.ReleaseFunc = free;
+    Timer->Expiry           = Expiry;
+
+    if ( NULL != Value ) {
+        if ( (0 == ValueSize) && (NULL == ReleaseFunc) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Warning: NULL ReleaseFunc* provided, defaulting to free().");
+#endif
+            ReleaseFunc = free;
+        }
+        if ( 0 != ListNode_UpdateValue(&Timer->Node, Value, ValueSize, ReleaseFunc) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to store Value of TimerWheel_Timer_t.");
+#endif
+            Pool_Free(Wheel->TimerPool, Timer);
+            return NULL;
+        }
+    }
+
+    TimerWheel_place(Wheel, Timer);
+    Wheel->Length++;
+
+    return Timer;
+}
+
+int TimerWheel_Cancel(TimerWheel_t *Wheel, TimerWheel_Timer_t *Timer) {
+
+    if ( (NULL == Wheel) || (NULL == Timer) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Wheel* or Timer* provided.");
+#endif
+        return 1;
+    }
+
+    if ( TIMER_WHEEL_FIRING == Timer->Level ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Cannot cancel a TimerWheel_Timer_t which is firing.");
+#endif
+        return 1;
+    }
+
+    TimerWheel_unlink(Wheel, Timer);
+    TimerWheel_releaseTimer(Wheel, Timer);
+    Wheel->Length--;
+
+    return 0;
+}
+
+int TimerWheel_Advance(TimerWheel_t *Wheel, uint64_t Now, CallbackArgFunc_t *Callback,
+                       void *Args) {
+
+    uint64_t When   = 0;
+    size_t   Level  = 0;
+    int      Result = 0;
+
+    if ( NULL == Wheel ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Wheel* provided.");
+#endif
+        return 1;
+    }
+
+    /* Timers scheduled at or before the current tick are waiting from before this call. */
+    if ( 0 != TimerWheel_fire(Wheel, Callback, Args) ) {
+        Result = 1;
+    }
+
+    /*
+        Jump straight from one occupied Slot to the next, so the cost depends only on the
+        Timers moved and fired, and not on the number of ticks skipped.
+    */
+    while ( Wheel->Now < Now ) {
+        if ( (0 != TimerWheel_nextEvent(Wheel, &When, &Level)) || (When > Now) ) {
+            Wheel->Now = Now;
+            break;
+        }
+
+        Wheel->Now = When;
+        TimerWheel_cascade(Wheel, Level,
+                           (size_t)(When >> (Level * TIMER_WHEEL_SLOT_BITS)) &
+                               (TIMER_WHEEL_SLOTS - 1));
+
+        if ( 0 != TimerWheel_fire(Wheel, Callback, Args) ) {
+            Result = 1;
+        }
+    }
+
+    return Result;
+}
+
+int TimerWheel_Clear(TimerWheel_t *Wheel) {
+
+    TimerWheel_Timer_t *Timer = NULL;
+    size_t              Level = 0, Slot = 0;
+
+    if ( NULL == Wheel ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Wheel* provided.");
+#endif
+        return 1;
+    }
+
+    for ( Level = 0; Level < TIMER_WHEEL_LEVELS; Level++ ) {
+        while ( 0 != Wheel->Occupied[Level] ) {
+            Slot = TimerWheel_lowestBit(Wheel->Occupied[Level]);
+            while ( NULL != Wheel->Slots[Level][Slot] ) {
+                Timer = (TimerWheel_Timer_t *)Wheel->Slots[Level][Slot];
+                TimerWheel_unlink(Wheel, Timer);
+                TimerWheel_releaseTimer(Wheel, Timer);
+                Wheel->Length--;
+            }
+        }
+    }
+
+    while ( NULL != Wheel->Due ) {
+        Timer = (TimerWheel_Timer_t *)Wheel->Due;
+        TimerWheel_unlink(Wheel, Timer);
+        TimerWheel_releaseTimer(Wheel, Timer);
+        Wheel->Length--;
+    }
+
+    return 0;
+}
+
+void TimerWheel_Release(TimerWheel_t *Wheel) {
+
+    if ( NULL == Wheel ) {
+        return;
+    }
+
+    TimerWheel_Clear(Wheel);
+    Pool_Release(Wheel->TimerPool);
+
+    ZERO_CONTAINER(Wheel, TimerWheel_t);
+    free(Wheel);
+
+    return;
+}
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+size_t TimerWheel_lowestBit(uint64_t Bits) {
+
+    size_t Index = 0;
+
+    if ( 0 == (Bits & 0xFFFFFFFFUL) ) {
+        Bits >>= 32;
+        Index += 32;
+    }
+    if ( 0 == (Bits & 0xFFFFUL) ) {
+        Bits >>= 16;
+        Index += 16;
+    }
+    if ( 0 == (Bits & 0xFFUL) ) {
+        Bits >>= 8;
+        Index += 8;
+    }
+    if ( 0 == (Bits & 0xFUL) ) {
+        Bits >>= 4;
+        Index += 4;
+    }
+    if ( 0 == (Bits & 0x3UL) ) {
+        Bits >>= 2;
+        Index += 2;
+    }
+    if ( 0 == (Bits & 0x1UL) ) {
+        Index += 1;
+    }
+
+    return Index;
+}
+
+size_t TimerWheel_highestBit(uint64_t Bits) {
+
+    size_t Index = 0;
+
+    if ( 0 != (Bits >> 32) ) {
+        Bits >>= 32;
+        Index += 32;
+    }
+    if ( 0 != (Bits >> 16) ) {
+        Bits >>= 16;
+        Index += 16;
+    }
+    if ( 0 != (Bits >> 8) ) {
+        Bits >>= 8;
+        Index += 8;
+    }
+    if ( 0 != (Bits >> 4) ) {
+        Bits >>= 4;
+        Index += 4;
+    }
+    if ( 0 != (Bits >> 2) ) {
+        Bits >>= 2;
+        Index += 2;
+    }
+    if ( 0 != (Bits >> 1) ) {
+        Index += 1;
+    }
+
+    return Index;
+}
+
+List_Node_t **TimerWheel_listOf(TimerWheel_t *Wheel, TimerWheel_Timer_t *Timer) {
+
+    if ( TIMER_WHEEL_DUE == Timer->Level ) {
+        return &(Wheel->Due);
+    }
+
+    return &(Wheel->Slots[Timer->Level][Timer->Slot]);
+}
+
+void TimerWheel_place(TimerWheel_t *Wheel, TimerWheel_Timer_t *Timer) {
+
+    List_Node_t **Head = NULL;
+
+    if ( Timer->Expiry <= Wheel->Now ) {
+        TimerWheel_placeDue(Wheel, Timer);
+        return;
+    }
+
+    Timer->Level = TimerWheel_highestBit(Timer->Expiry ^ Wheel->Now) / TIMER_WHEEL_SLOT_BITS;
+    Timer->Slot  = (size_t)(Timer->Expiry >> (Timer->Level * TIMER_WHEEL_SLOT_BITS)) &
+                  (TIMER_WHEEL_SLOTS - 1);
+    Wheel->Occupied[Timer->Level] |= ((uint64_t)1 << Timer->Slot);
+
+    Head = TimerWheel_listOf(Wheel, Timer);
+    if ( NULL != *Head ) {
+        ListNode_InsertBefore(*Head, &Timer->Node);
+    }
+    *Head = &Timer->Node;
+
+    return;
+}
+
+void TimerWheel_placeDue(TimerWheel_t *Wheel, TimerWheel_Timer_t *Timer) {
+
+    List_Node_t *Node = NULL;
+
+    Timer->Level = TIMER_WHEEL_DUE;
+    Timer->Slot  = 0;
+
+    /* Timers mostly fall due in order of Expiry, so these are appended in O(1). */
+    if ( NULL == Wheel->DueTail ) {
+        Wheel->Due     = &Timer->Node;
+        Wheel->DueTail = &Timer->Node;
+        return;
+    } else if ( ((TimerWheel_Timer_t *)Wheel->DueTail)->Expiry <= Timer->Expiry ) {
+        ListNode_InsertAfter(Wheel->DueTail, &Timer->Node);
+        Wheel->DueTail = &Timer->Node;
+        return;
+    }
+
+    /*
+        Otherwise the Timer goes ahead of the first one expiring after it. The Tail is known
+        to expire after it, so the walk always stops within the list.
+    */
+    Node = Wheel->Due;
+    while ( ((TimerWheel_Timer_t *)Node)->Expiry <= Timer->Expiry ) {
+        Node = Node->Next;
+    }
+
+    ListNode_InsertBefore(Node, &Timer->Node);
+    if ( Node == Wheel->Due ) {
+        Wheel->Due = &Timer->Node;
+    }
+
+    return;
+}
+
+void TimerWheel_unlink(TimerWheel_t *Wheel, TimerWheel_Timer_t *Timer) {
+
+    List_Node_t **Head = TimerWheel_listOf(Wheel, Timer);
+
+    if ( Wheel->DueTail == &Timer->Node ) {
+        Wheel->DueTail = Timer->Node.Previous;
+    }
+
+    if ( *Head == &Timer->Node ) {
+        *Head = Timer->Node.Next;
+        if ( (NULL == *Head) && (TIMER_WHEEL_DUE != Timer->Level) ) {
+            Wheel->Occupied[Timer->Level] &= ~((uint64_t)1 << Timer->Slot);
+        }
+    }
+
+    ListNode_Detach(&Timer->Node);
+
+    return;
+}
+
+void TimerWheel_cascade(TimerWheel_t *Wheel, size_t Level, size_t Slot) {
+
+    List_Node_t *Node = Wheel->Slots[Level][Slot], *Next = NULL;
+
+    Wheel->Slots[Level][Slot] = NULL;
+    Wheel->Occupied[Level] &= ~((uint64_t)1 << Slot);
+
+    for ( ; NULL != Node; Node = Next ) {
+        Next           = Node->Next;
+        Node->Next     = NULL;
+        Node->Previous = NULL;
+        TimerWheel_place(Wheel, (TimerWheel_Timer_t *)Node);
+    }
+
+    return;
+}
+
+int TimerWheel_nextEvent(TimerWheel_t *Wheel, uint64_t *When, size_t *Level) {
+
+    size_t Shift = 0;
+
+    for ( *Level = 0; *Level < TIMER_WHEEL_LEVELS; (*Level)++ ) {
+        if ( 0 == Wheel->Occupied[*Level] ) {
+            continue;
+        }
+
+        /* Keep the digits of Now above this level, and replace the rest with the Slot. */
+        Shift = (*Level + 1) * TIMER_WHEEL_SLOT_BITS;
+        *When = (Shift < 64) ? ((Wheel->Now >> Shift) << Shift) : 0;
+        *When |= (uint64_t)TimerWheel_lowestBit(Wheel->Occupied[*Level])
+                 << (*Level * TIMER_WHEEL_SLOT_BITS);
+        return 0;
+    }
+
+    return 1;
+}
+
+int TimerWheel_fire(TimerWheel_t *Wheel, CallbackArgFunc_t *Callback, void *Args) {
+
+    TimerWheel_Timer_t *Timer  = NULL;
+    int                 Result = 0;
+
+    /* Take one Timer at a time, as each Callback may cancel or schedule others. */
+    while ( NULL != Wheel->Due ) {
+        Timer = (TimerWheel_Timer_t *)Wheel->Due;
+        TimerWheel_unlink(Wheel, Timer);
+        Timer->Level = TIMER_WHEEL_FIRING;
+        Wheel->Length--;
+
+        if ( (NULL != Callback) && (0 != Callback(Timer->Node.Contents.ContentRaw, Args)) ) {
+            Result = 1;
+        }
+
+        TimerWheel_releaseTimer(Wheel, Timer);
+    }
+
+    return Result;
+}
+
+void TimerWheel_releaseTimer(TimerWheel_t *Wheel, TimerWheel_Timer_t *Timer) {
+
+    if ( (NULL != Timer->Node.Contents.ContentRaw) && (NULL != Timer->Node.ReleaseFunc) ) {
+        Timer->Node.ReleaseFunc(Timer->Node.Contents.ContentRaw);
+    }
+
+    ZERO_CONTAINER(Timer, TimerWheel_Timer_t);
+    Pool_Free(Wheel->TimerPool, Timer);
+
+    return;
+}
@@ -0,0 +1,421 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../logging/logging.h"
+#include "include/timer_wheel.h"
+
+/*
+    The state shared between a test and the callbacks of the timers it fires.
+*/
+typedef struct TimerWheel_TestState_t {
+    TimerWheel_t*       Wheel;
+    TimerWheel_Timer_t* Pending;
+    uint64_t            Before, Target, Previous;
+    size_t              Fired, Errors;
+} TimerWheel_TestState_t;
+
+static size_t ReleasedValues = 0;
+
+static uint64_t NextRandom(uint64_t *State) {
+
+    *State ^= *State << 13;
+    *State ^= *State >> 7;
+    *State ^= *State << 17;
+
+    return *State;
+}
+
+static void CountingRelease(void *Value) {
+    ReleasedValues++;
+    free(Value);
+}
+
+static int ExpiryCallback(void *Value, void *Args) {
+
+    TimerWheel_TestState_t *State  = (TimerWheel_TestState_t *)Args;
+    uint64_t                Expiry = *(uint64_t *)Value;
+
+    /* Each Timer fires in the Advance which first passes its Expiry, in order of Expiry. */
+    if ( (Expiry <= State->Before) || (Expiry > State->Target) || (Expiry < State->Previous) ) {
+        State->Errors++;
+    }
+
+    State->Previous = Expiry;
+    State->Fired++;
+    return 0;
+}
+
+static int MarkCallback(void *Value, void *Args) {
+
+    ((int *)Args)[*(int *)Value]++;
+    return 0;
+}
+
+static int PeriodicCallback(void *Value, void *Args) {
+
+    TimerWheel_TestState_t *State = (TimerWheel_TestState_t *)Args;
+    uint64_t                Next  = TimerWheel_Now(State->Wheel) + 10;
+
+    State->Fired++;
+
+    if ( 0 == *(int *)Value ) {
+        /* The Pending Timer is cancelled by the first period, so must never fire. */
+        if ( (NULL != State->Pending) && (0 != TimerWheel_Cancel(State->Wheel, State->Pending)) ) {
+            State->Errors++;
+        }
+        State->Pending = NULL;
+
+        if ( State->Fired < 100 ) {
+            TimerWheel_Schedule(State->Wheel, Next, Value, sizeof(int), NULL);
+        }
+        return 0;
+    }
+
+    /* Anything else was scheduled to fire immediately, and reports failure. */
+    return 1;
+}
+
+int Test_timer_wheel(void) {
+
+    int FailedTests = 0;
+
+    FailedTests += Test_TimerWheel_Create();
+    FailedTests += Test_TimerWheel_Order();
+    FailedTests += Test_TimerWheel_Due();
+    FailedTests += Test_TimerWheel_Cancel();
+    FailedTests += Test_TimerWheel_Callback();
+    FailedTests += Test_TimerWheel_Clear();
+
+    return FailedTests;
+}
+
+int Test_TimerWheel_Create(void) {
+
+    TimerWheel_t *Wheel = NULL;
+
+    if ( (0 == TimerWheel_Advance(NULL, 10, NULL, NULL)) ||
+         (NULL != TimerWheel_Schedule(NULL, 10, NULL, 0, NULL)) ||
+         (0 == TimerWheel_Cancel(NULL, NULL)) || (!TimerWheel_IsEmpty(NULL)) ) {
+        TEST_PRINTF("%s", "Test Failure - NULL TimerWheel_t accepted.");
+        TEST_FAILURE;
+    }
+
+    Wheel = TimerWheel_Create(12345);
+    if ( (NULL == Wheel) || (!TimerWheel_IsEmpty(Wheel)) || (12345 != TimerWheel_Now(Wheel)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create TimerWheel_t.");
+        TimerWheel_Release(Wheel);
+        TEST_FAILURE;
+    }
+
+    /* The clock never runs backwards. */
+    if ( (0 != TimerWheel_Advance(Wheel, 100000, NULL, NULL)) ||
+         (0 != TimerWheel_Advance(Wheel, 5, NULL, NULL)) || (100000 != TimerWheel_Now(Wheel)) ) {
+        TEST_PRINTF("%s", "Test Failure - Empty TimerWheel_t failed to advance.");
+        TimerWheel_Release(Wheel);
+        TEST_FAILURE;
+    }
+
+    TimerWheel_Release(Wheel);
+    TEST_SUCCESSFUL;
+}
+
+int Test_TimerWheel_Order(void) {
+
+    TimerWheel_TestState_t State  = {NULL, NULL, 0, 0, 0, 0, 0};
+    uint64_t               Random = 88172645463325252ULL, Expiry = 0, Step = 0;
+    size_t                 i      = 0;
+
+    State.Wheel = TimerWheel_Create(1000);
+    if ( NULL == State.Wheel ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create TimerWheel_t.");
+        TEST_FAILURE;
+    }
+
+    /* Spread the Expiries over every level, up to the very last tick of the clock. */
+    for ( i = 0; i < 2000; i++ ) {
+        Expiry = 1001 + (NextRandom(&Random) >> (i % 64));
+        if ( Expiry < 1001 ) {
+            Expiry = UINT64_MAX;
+        }
+        if ( NULL == TimerWheel_Schedule(State.Wheel, Expiry, &Expiry, sizeof(Expiry), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to schedule TimerWheel_Timer_t.");
+            TimerWheel_Release(State.Wheel);
+            TEST_FAILURE;
+        }
+    }
+
+    State.Before = 1000;
+    while ( State.Before < UINT64_MAX ) {
+        Step         = NextRandom(&Random) >> (NextRandom(&Random) % 64);
+        State.Target = (UINT64_MAX - State.Before < Step) ? UINT64_MAX : State.Before + Step;
+
+        if ( (0 != TimerWheel_Advance(State.Wheel, State.Target, ExpiryCallback, &State)) ||
+             (0 != State.Errors) ) {
+            TEST_PRINTF("Test Failure - Timer fired outside of Advance to (%lu).",
+                        (unsigned long)State.Target);
+            TimerWheel_Release(State.Wheel);
+            TEST_FAILURE;
+        }
+        State.Before = State.Target;
+    }
+
+    if ( (2000 != State.Fired) || (!TimerWheel_IsEmpty(State.Wheel)) ) {
+        TEST_PRINTF("Test Failure - Only (%lu) Timers fired.", (unsigned long)State.Fired);
+        TimerWheel_Release(State.Wheel);
+        TEST_FAILURE;
+    }
+
+    TimerWheel_Release(State.Wheel);
+    TEST_SUCCESSFUL;
+}
+
+int Test_TimerWheel_Due(void) {
+
+    TimerWheel_TestState_t State  = {NULL, NULL, 0, 0, 0, 0, 0};
+    TimerWheel_Timer_t *   Latest = NULL, *Earliest = NULL, *Timer = NULL;
+    uint64_t               Expiry = 0;
+    size_t                 i      = 0;
+
+    State.Wheel = TimerWheel_Create(1000);
+    if ( NULL == State.Wheel ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create TimerWheel_t.");
+        TEST_FAILURE;
+    }
+
+    /* Timers already past due are scheduled latest first, between Timers which are pending. */
+    for ( i = 0; i < 100; i++ ) {
+        Expiry = 1001 + i;
+        if ( NULL == TimerWheel_Schedule(State.Wheel, Expiry, &Expiry, sizeof(Expiry), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to schedule TimerWheel_Timer_t.");
+            TimerWheel_Release(State.Wheel);
+            TEST_FAILURE;
+        }
+
+        Expiry = 1000 - i;
+        Timer  = TimerWheel_Schedule(State.Wheel, Expiry, &Expiry, sizeof(Expiry), NULL);
+        if ( NULL == Timer ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to schedule TimerWheel_Timer_t.");
+            TimerWheel_Release(State.Wheel);
+            TEST_FAILURE;
+        }
+        Latest   = (0 == i) ? Timer : Latest;
+        Earliest = Timer;
+    }
+
+    /* Cancelling both ends of the past-due Timers, then scheduling amongst those left. */
+    if ( (0 != TimerWheel_Cancel(State.Wheel, Latest)) ||
+         (0 != TimerWheel_Cancel(State.Wheel, Earliest)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to cancel past-due TimerWheel_Timer_t.");
+        TimerWheel_Release(State.Wheel);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 20; i++ ) {
+        Expiry = 901 + ((i * 37) % 100);
+        if ( NULL == TimerWheel_Schedule(State.Wheel, Expiry, &Expiry, sizeof(Expiry), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to schedule TimerWheel_Timer_t.");
+            TimerWheel_Release(State.Wheel);
+            TEST_FAILURE;
+        }
+    }
+
+    State.Target = 1100;
+    if ( (0 != TimerWheel_Advance(State.Wheel, State.Target, ExpiryCallback, &State)) ||
+         (0 != State.Errors) ) {
+        TEST_PRINTF("%s", "Test Failure - Past-due Timers fired out of order of Expiry.");
+        TimerWheel_Release(State.Wheel);
+        TEST_FAILURE;
+    }
+
+    if ( (218 != State.Fired) || (!TimerWheel_IsEmpty(State.Wheel)) ) {
+        TEST_PRINTF("Test Failure - Only (%lu) Timers fired.", (unsigned long)State.Fired);
+        TimerWheel_Release(State.Wheel);
+        TEST_FAILURE;
+    }
+
+    TimerWheel_Release(State.Wheel);
+    TEST_SUCCESSFUL;
+}
+
+int Test_TimerWheel_Cancel(void) {
+
+    TimerWheel_t *      Wheel = NULL;
+    TimerWheel_Timer_t *Timers[1000];
+    int                 Fired[1000], i = 0;
+
+    Wheel = TimerWheel_Create(0);
+    if ( NULL == Wheel ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create TimerWheel_t.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 1000; i++ ) {
+        Fired[i]  = 0;
+        Timers[i] = TimerWheel_Schedule(Wheel, (uint64_t)(i * 7919 % 100000), &i, sizeof(i),
+                                        NULL);
+        if ( NULL == Timers[i] ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to schedule TimerWheel_Timer_t.");
+            TimerWheel_Release(Wheel);
+            TEST_FAILURE;
+        }
+    }
+
+    /* Cancel some Timers before they move, and the rest after they have cascaded down. */
+    for ( i = 0; i < 500; i++ ) {
+        if ( (0 != (i % 3)) && (0 != TimerWheel_Cancel(Wheel, Timers[i])) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to cancel TimerWheel_Timer_t.");
+            TimerWheel_Release(Wheel);
+            TEST_FAILURE;
+        }
+    }
+
+    TimerWheel_Advance(Wheel, 50000, MarkCallback, Fired);
+    for ( i = 500; i < 1000; i++ ) {
+        if ( (0 != (i % 3)) && (0 == Fired[i]) && (0 != TimerWheel_Cancel(Wheel, Timers[i])) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to cancel TimerWheel_Timer_t.");
+            TimerWheel_Release(Wheel);
+            TEST_FAILURE;
+        }
+    }
+    TimerWheel_Advance(Wheel, 100000, MarkCallback, Fired);
+
+    for ( i = 0; i < 1000; i++ ) {
+        if ( (i * 7919 % 100000 > 50000) && (Fired[i] != (0 == (i % 3))) ) {
+            TEST_PRINTF("Test Failure - Timer (%d) fired (%d) times.", i, Fired[i]);
+            TimerWheel_Release(Wheel);
+            TEST_FAILURE;
+        }
+        if ( (i < 500) && (Fired[i] != (0 == (i % 3))) ) {
+            TEST_PRINTF("Test Failure - Timer (%d) fired (%d) times.", i, Fired[i]);
+            TimerWheel_Release(Wheel);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( !TimerWheel_IsEmpty(Wheel) ) {
+        TEST_PRINTF("%s", "Test Failure - Cancelled Timers left in TimerWheel_t.");
+        TimerWheel_Release(Wheel);
+        TEST_FAILURE;
+    }
+
+    TimerWheel_Release(Wheel);
+    TEST_SUCCESSFUL;
+}
+
+int Test_TimerWheel_Callback(void) {
+
+    TimerWheel_TestState_t State    = {NULL, NULL, 0, 0, 0, 0, 0};
+    int                    Values[] = {0, 1};
+
+    State.Wheel = TimerWheel_Create(0);
+    if ( NULL == State.Wheel ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create TimerWheel_t.");
+        TEST_FAILURE;
+    }
+
+    /* A single periodic Timer, re-scheduled by its own callback every 10 ticks. */
+    State.Pending = TimerWheel_Schedule(State.Wheel, 500, &Values[1], sizeof(int), NULL);
+    if ( (NULL == State.Pending) ||
+         (NULL == TimerWheel_Schedule(State.Wheel, 10, &Values[0], sizeof(int), NULL)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to schedule TimerWheel_Timer_t.");
+        TimerWheel_Release(State.Wheel);
+        TEST_FAILURE;
+    }
+
+    if ( (0 != TimerWheel_Advance(State.Wheel, 5000, PeriodicCallback, &State)) ||
+         (100 != State.Fired) || (0 != State.Errors) || (!TimerWheel_IsEmpty(State.Wheel)) ) {
+        TEST_PRINTF("Test Failure - Periodic Timer fired (%lu) times.", (unsigned long)State.Fired);
+        TimerWheel_Release(State.Wheel);
+        TEST_FAILURE;
+    }
+
+    /* A Timer already due fires on the next Advance, even without the clock moving. */
+    if ( (NULL == TimerWheel_Schedule(State.Wheel, 0, &Values[1], sizeof(int), NULL)) ||
+         (0 == TimerWheel_Advance(State.Wheel, 5000, PeriodicCallback, &State)) ||
+         (101 != State.Fired) || (!TimerWheel_IsEmpty(State.Wheel)) ) {
+        TEST_PRINTF("%s", "Test Failure - Due Timer did not fire, or its failure was lost.");
+        TimerWheel_Release(State.Wheel);
+        TEST_FAILURE;
+    }
+
+    TimerWheel_Release(State.Wheel);
+    TEST_SUCCESSFUL;
+}
+
+int Test_TimerWheel_Clear(void) {
+
+    TimerWheel_t *Wheel = NULL;
+    size_t        i     = 0;
+    int *         Value = NULL;
+
+    ReleasedValues = 0;
+
+    Wheel = TimerWheel_Create(0);
+    if ( NULL == Wheel ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create TimerWheel_t.");
+        TEST_FAILURE;
+    }
+
+    /* Timers held by reference are released through their own ReleaseFunc. */
+    for ( i = 0; i < 300; i++ ) {
+        Value = (int *)malloc(sizeof(int));
+        if ( (NULL == Value) ||
+             (NULL == TimerWheel_Schedule(Wheel, i * i, Value, 0, CountingRelease)) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to schedule TimerWheel_Timer_t.");
+            free(Value);
+            TimerWheel_Release(Wheel);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( (0 != TimerWheel_Clear(Wheel)) || (!TimerWheel_IsEmpty(Wheel)) ||
+         (300 != ReleasedValues) || (0 != TimerWheel_Advance(Wheel, 1000000, NULL, NULL)) ) {
+        TEST_PRINTF("Test Failure - Clear released (%lu) Values.", (unsigned long)ReleasedValues);
+        TimerWheel_Release(Wheel);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 10; i++ ) {
+        Value = (int *)malloc(sizeof(int));
+        if ( (NULL == Value) ||
+             (NULL == TimerWheel_Schedule(Wheel, 1000000 + i, Value, 0, CountingRelease)) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to schedule TimerWheel_Timer_t.");
+            free(Value);
+            TimerWheel_Release(Wheel);
+            TEST_FAILURE;
+        }
+    }
+
+    TimerWheel_Release(Wheel);
+    if ( 310 != ReleasedValues ) {
+        TEST_PRINTF("Test Failure - Release released (%lu) Values.", (unsigned long)ReleasedValues);
+        TEST_FAILURE;
+    }
+
+    TEST_SUCCESSFUL;
+}
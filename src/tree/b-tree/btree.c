@@ -0,0 +1,601 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../logging/logging.h"
+#include "include/btree.h"
+#include "include/btree_node.h"
+
+BTree_t *BTree_Create(CompareFunc_t *KeyCompareFunc, size_t KeySize, ReleaseFunc_t *KeyReleaseFunc,
+                      Binary_Tree_DuplicatePolicy_t Policy) {
+
+    BTree_t *Tree = NULL;
+
+    if ( NULL == KeyReleaseFunc ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: NULL KeyReleaseFunc* provided, defaulting to free().");
+#endif
+        KeyReleaseFunc = free;
+    }
+
+    if ( NULL == KeyCompareFunc ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: NULL KeyCompareFunc provided, defaulting to memcmp().");
+#endif
+        KeyCompareFunc = memcmp;
+    }
+
+    if ( 0 == KeySize ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: 0 KeySize provided, creating BTree_t of variable-size Keys.");
+#endif
+    }
+
+    Tree = (BTree_t *)calloc(1, sizeof(BTree_t));
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for BTree_t.");
+#endif
+        return NULL;
+    }
+
+    Tree->KeyReleaseFunc  = KeyReleaseFunc;
+    Tree->KeyCompareFunc  = KeyCompareFunc;
+    Tree->Root            = NULL;
+    Tree->TreeSize        = 0;
+    Tree->KeySize         = KeySize;
+    Tree->SlotSize        = (0 != KeySize) ? KeySize : sizeof(BTree_Key_t);
+    Tree->DuplicatePolicy = Policy;
+
+    /* Size the Nodes such that a full leaf fits within LIBCONTAINER_BTREE_NODE_SIZE bytes. */
+    Tree->MaxKeys = 0;
+    if ( LIBCONTAINER_BTREE_NODE_SIZE > sizeof(BTree_Node_t) ) {
+        Tree->MaxKeys = (LIBCONTAINER_BTREE_NODE_SIZE - sizeof(BTree_Node_t)) /
+                        (Tree->SlotSize + sizeof(BTree_Value_t));
+    }
+    if ( Tree->MaxKeys < 4 ) {
+        Tree->MaxKeys = 4;
+    }
+
+#ifdef DEBUG
+    DEBUG_PRINTF("Successfully created new BTree_t with [ %lu ] Keys per Node.",
+                 (unsigned long)Tree->MaxKeys);
+#endif
+    return Tree;
+}
+
+size_t BTree_Length(BTree_t *Tree) {
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Warning: NULL Tree* provided, unable to report length.");
+#endif
+        return 0;
+    }
+
+    return Tree->TreeSize;
+}
+
+int BTree_Insert(BTree_t *Tree, void *Key, size_t KeySize, void *Value, size_t ValueSize,
+                 ReleaseFunc_t *ValueReleaseFunc) {
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Tree* provided, cannot insert new value.");
+#endif
+        return 1;
+    }
+
+    return BTree_insertEntry(Tree, Key, KeySize, Value, ValueSize, ValueReleaseFunc,
+                             Tree->DuplicatePolicy);
+}
+
+bool BTree_KeyExists(BTree_t *Tree, void *Key, size_t KeySize) {
+
+    size_t Index = 0;
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Tree* provided, cannot search for Key.");
+#endif
+        return false;
+    }
+
+    return (NULL != BTree_findLeaf(Tree, Key, KeySize, &Index));
+}
+
+void *BTree_Get(BTree_t *Tree, void *Key, size_t KeySize) {
+
+    BTree_Node_t *Leaf  = NULL;
+    size_t        Index = 0;
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Tree* provided, cannot search for Key.");
+#endif
+        return NULL;
+    }
+
+    Leaf = BTree_findLeaf(Tree, Key, KeySize, &Index);
+    if ( NULL == Leaf ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to find Key in Tree.");
+#endif
+        return NULL;
+    }
+
+    return Leaf->Values[Index].Value;
+}
+
+int BTree_Remove(BTree_t *Tree, void *Key, size_t KeySize) {
+
+    BTree_Node_t *Node = NULL, *Separator = NULL;
+    size_t        Index = 0, SeparatorIndex = 0;
+    bool          Found = false;
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Tree* provided, cannot remove Key.");
+#endif
+        return 1;
+    }
+
+    if ( NULL == Key ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Key* Provided.");
+#endif
+        return 1;
+    }
+
+    if ( (0 == KeySize) && (0 != Tree->KeySize) ) {
+        KeySize = Tree->KeySize;
+    }
+
+    if ( NULL == Tree->Root ) {
+        return 0;
+    }
+
+    Iterator_Invalidate(&(Tree->Iterator));
+
+    /*
+        Descend once from the Root, topping up each child to more than the minimum
+        number of Keys before stepping into it. This guarantees the leaf can lose an
+        entry without any fix-ups needing to propagate back up the Tree.
+    */
+    Node = Tree->Root;
+    while ( !Node->IsLeaf ) {
+
+        Index = BTree_childIndex(Tree, Node, Key, KeySize, &Found);
+        if ( Node->Children[Index]->KeyCount <= BTree_minKeys(Tree) ) {
+            BTree_fillChild(Tree, Node, Index);
+            if ( 0 == Node->KeyCount ) {
+                /* The Root lost its last separator, so the Tree shrinks by one level. */
+                Tree->Root = Node->Children[0];
+                free(Node);
+                Node = Tree->Root;
+                continue;
+            }
+            Index = BTree_childIndex(Tree, Node, Key, KeySize, &Found);
+        }
+
+        /*
+            If the Key is a separator here, it is the first Key of the leaf it lives in,
+            and this separator must be replaced by the next Key of that leaf.
+        */
+        if ( Found ) {
+            Separator      = Node;
+            SeparatorIndex = Index - 1;
+        }
+
+        Node = Node->Children[Index];
+    }
+
+    Index = BTree_Node_Search(Tree, Node, Key, KeySize, &Found);
+    if ( !Found ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: Key does not exist within Tree, nothing to remove.");
+#endif
+        return 0;
+    }
+
+    BTree_Node_ReleaseEntry(Tree, Node, Index);
+    BTree_Node_Shift(Tree, Node, Index + 1, false);
+    Node->KeyCount--;
+    Tree->TreeSize--;
+
+    if ( NULL != Separator ) {
+        memcpy(BTree_Node_Slot(Tree, Separator, SeparatorIndex), BTree_Node_Slot(Tree, Node, 0),
+               Tree->SlotSize);
+    }
+
+    if ( 0 == Tree->Root->KeyCount ) {
+        free(Tree->Root);
+        Tree->Root = NULL;
+    }
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully removed requested item from Tree.");
+#endif
+    return 0;
+}
+
+int BTree_Clear(BTree_t *Tree) {
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "NULL Tree* provided, nothing to clear.");
+#endif
+        return 0;
+    }
+
+    Iterator_Invalidate(&(Tree->Iterator));
+
+    BTree_Node_Release(Tree, Tree->Root);
+    Tree->Root     = NULL;
+    Tree->TreeSize = 0;
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully released all items from BTree_t.");
+#endif
+    return 0;
+}
+
+void BTree_Release(BTree_t *Tree) {
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Warning: NULL Tree* provided, nothing to release.");
+#endif
+        return;
+    }
+
+    Iterator_Invalidate(&(Tree->Iterator));
+    BTree_Node_Release(Tree, Tree->Root);
+
+    ZERO_CONTAINER(Tree, BTree_t);
+    free(Tree);
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully released BTree_t and all held values.");
+#endif
+    return;
+}
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+size_t BTree_minKeys(BTree_t *Tree) {
+    return (Tree->MaxKeys - 1) / 2;
+}
+
+size_t BTree_childIndex(BTree_t *Tree, BTree_Node_t *Node, void *Key, size_t KeySize,
+                        bool *Found) {
+
+    size_t Index = BTree_Node_Search(Tree, Node, Key, KeySize, Found);
+
+    return (*Found) ? (Index + 1) : Index;
+}
+
+BTree_Node_t *BTree_findLeaf(BTree_t *Tree, void *Key, size_t KeySize, size_t *Index) {
+
+    BTree_Node_t *Node  = NULL;
+    bool          Found = false;
+
+    if ( NULL == Key ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Key* Provided.");
+#endif
+        return NULL;
+    }
+
+    if ( (0 == KeySize) && (0 != Tree->KeySize) ) {
+        KeySize = Tree->KeySize;
+    }
+
+    Node = Tree->Root;
+    if ( NULL == Node ) {
+        return NULL;
+    }
+
+    while ( !Node->IsLeaf ) {
+        Node = Node->Children[BTree_childIndex(Tree, Node, Key, KeySize, &Found)];
+    }
+
+    *Index = BTree_Node_Search(Tree, Node, Key, KeySize, &Found);
+
+    return (Found) ? (Node) : (NULL);
+}
+
+int BTree_splitChild(BTree_t *Tree, BTree_Node_t *Parent, size_t Index) {
+
+    BTree_Node_t *Child = Parent->Children[Index], *Right = NULL;
+    uint8_t *     Promoted = NULL;
+    size_t        Middle   = Tree->MaxKeys / 2;
+
+    Right = BTree_Node_Create(Tree, Child->IsLeaf);
+    if ( NULL == Right ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to create new BTree_Node_t to split into.");
+#endif
+        return 1;
+    }
+
+    if ( Child->IsLeaf ) {
+        /* Leaves keep every entry, and the first Key of the right half becomes the separator. */
+        Right->KeyCount = Child->KeyCount - Middle;
+        memcpy(BTree_Node_Slot(Tree, Right, 0), BTree_Node_Slot(Tree, Child, Middle),
+               Right->KeyCount * Tree->SlotSize);
+        memcpy(Right->Values, &(Child->Values[Middle]), Right->KeyCount * sizeof(BTree_Value_t));
+        Right->Next = Child->Next;
+        Child->Next = Right;
+        Promoted    = BTree_Node_Slot(Tree, Right, 0);
+    } else {
+        /* Internal Nodes move their middle separator up into the Parent. */
+        Right->KeyCount = Child->KeyCount - Middle - 1;
+        memcpy(BTree_Node_Slot(Tree, Right, 0), BTree_Node_Slot(Tree, Child, Middle + 1),
+               Right->KeyCount * Tree->SlotSize);
+        memcpy(Right->Children, &(Child->Children[Middle + 1]),
+               (Right->KeyCount + 1) * sizeof(BTree_Node_t *));
+        Promoted = BTree_Node_Slot(Tree, Child, Middle);
+    }
+    Child->KeyCount = Middle;
+
+    BTree_Node_Shift(Tree, Parent, Index, true);
+    memmove(&(Parent->Children[Index + 2]), &(Parent->Children[Index + 1]),
+            (Parent->KeyCount - Index) * sizeof(BTree_Node_t *));
+    memcpy(BTree_Node_Slot(Tree, Parent, Index), Promoted, Tree->SlotSize);
+    Parent->Children[Index + 1] = Right;
+    Parent->KeyCount++;
+
+    return 0;
+}
+
+void BTree_fillChild(BTree_t *Tree, BTree_Node_t *Parent, size_t Index) {
+
+    BTree_Node_t *Child = Parent->Children[Index], *Sibling = NULL;
+
+    if ( (Index > 0) && (Parent->Children[Index - 1]->KeyCount > BTree_minKeys(Tree)) ) {
+        /* Borrow the largest entry of the left sibling. */
+        Sibling = Parent->Children[Index - 1];
+        BTree_Node_Shift(Tree, Child, 0, true);
+        if ( Child->IsLeaf ) {
+            memcpy(BTree_Node_Slot(Tree, Child, 0),
+                   BTree_Node_Slot(Tree, Sibling, Sibling->KeyCount - 1), Tree->SlotSize);
+            Child->Values[0] = Sibling->Values[Sibling->KeyCount - 1];
+            memcpy(BTree_Node_Slot(Tree, Parent, Index - 1), BTree_Node_Slot(Tree, Child, 0),
+                   Tree->SlotSize);
+        } else {
+            memmove(&(Child->Children[1]), &(Child->Children[0]),
+                    (Child->KeyCount + 1) * sizeof(BTree_Node_t *));
+            memcpy(BTree_Node_Slot(Tree, Child, 0), BTree_Node_Slot(Tree, Parent, Index - 1),
+                   Tree->SlotSize);
+            Child->Children[0] = Sibling->Children[Sibling->KeyCount];
+            memcpy(BTree_Node_Slot(Tree, Parent, Index - 1),
+                   BTree_Node_Slot(Tree, Sibling, Sibling->KeyCount - 1), Tree->SlotSize);
+        }
+        Child->KeyCount++;
+        Sibling->KeyCount--;
+        return;
+    }
+
+    if ( (Index < Parent->KeyCount) &&
+         (Parent->Children[Index + 1]->KeyCount > BTree_minKeys(Tree)) ) {
+        /* Borrow the smallest entry of the right sibling. */
+        Sibling = Parent->Children[Index + 1];
+        if ( Child->IsLeaf ) {
+            memcpy(BTree_Node_Slot(Tree, Child, Child->KeyCount), BTree_Node_Slot(Tree, Sibling, 0),
+                   Tree->SlotSize);
+            Child->Values[Child->KeyCount] = Sibling->Values[0];
+            BTree_Node_Shift(Tree, Sibling, 1, false);
+            memcpy(BTree_Node_Slot(Tree, Parent, Index), BTree_Node_Slot(Tree, Sibling, 0),
+                   Tree->SlotSize);
+        } else {
+            memcpy(BTree_Node_Slot(Tree, Child, Child->KeyCount),
+                   BTree_Node_Slot(Tree, Parent, Index), Tree->SlotSize);
+            Child->Children[Child->KeyCount + 1] = Sibling->Children[0];
+            memcpy(BTree_Node_Slot(Tree, Parent, Index), BTree_Node_Slot(Tree, Sibling, 0),
+                   Tree->SlotSize);
+            BTree_Node_Shift(Tree, Sibling, 1, false);
+            memmove(&(Sibling->Children[0]), &(Sibling->Children[1]),
+                    Sibling->KeyCount * sizeof(BTree_Node_t *));
+        }
+        Child->KeyCount++;
+        Sibling->KeyCount--;
+        return;
+    }
+
+    /* Neither sibling can spare an entry, so merge with one of them. */
+    if ( Index < Parent->KeyCount ) {
+        BTree_mergeChildren(Tree, Parent, Index);
+    } else {
+        BTree_mergeChildren(Tree, Parent, Index - 1);
+    }
+
+    return;
+}
+
+void BTree_mergeChildren(BTree_t *Tree, BTree_Node_t *Parent, size_t Index) {
+
+    BTree_Node_t *Left = Parent->Children[Index], *Right = Parent->Children[Index + 1];
+
+    if ( Left->IsLeaf ) {
+        memcpy(BTree_Node_Slot(Tree, Left, Left->KeyCount), BTree_Node_Slot(Tree, Right, 0),
+               Right->KeyCount * Tree->SlotSize);
+        memcpy(&(Left->Values[Left->KeyCount]), Right->Values,
+               Right->KeyCount * sizeof(BTree_Value_t));
+        Left->KeyCount += Right->KeyCount;
+        Left->Next = Right->Next;
+    } else {
+        /* The separator between the two internal Nodes moves down between their Keys. */
+        memcpy(BTree_Node_Slot(Tree, Left, Left->KeyCount), BTree_Node_Slot(Tree, Parent, Index),
+               Tree->SlotSize);
+        memcpy(BTree_Node_Slot(Tree, Left, Left->KeyCount + 1), BTree_Node_Slot(Tree, Right, 0),
+               Right->KeyCount * Tree->SlotSize);
+        memcpy(&(Left->Children[Left->KeyCount + 1]), Right->Children,
+               (Right->KeyCount + 1) * sizeof(BTree_Node_t *));
+        Left->KeyCount += Right->KeyCount + 1;
+    }
+
+    BTree_Node_Shift(Tree, Parent, Index + 1, false);
+    memmove(&(Parent->Children[Index + 1]), &(Parent->Children[Index + 2]),
+            (Parent->KeyCount - Index - 1) * sizeof(BTree_Node_t *));
+    Parent->KeyCount--;
+
+    free(Right);
+    return;
+}
+
+int BTree_insertEntry(BTree_t *Tree, void *Key, size_t KeySize, void *Value, size_t ValueSize,
+                      ReleaseFunc_t *ValueReleaseFunc, Binary_Tree_DuplicatePolicy_t Policy) {
+
+    BTree_Node_t * Node = NULL, *NewRoot = NULL;
+    BTree_Key_t *  Slot = NULL;
+    BTree_Value_t *Entry = NULL;
+    uint8_t *      KeyCopy = NULL, *ValueCopy = NULL;
+    size_t         Index = 0;
+    bool           Found = false;
+
+    if ( NULL == Key ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Key* Provided.");
+#endif
+        return 1;
+    }
+
+    if ( 0 != Tree->KeySize ) {
+        KeySize = Tree->KeySize;
+    }
+
+    if ( (NULL != Value) && (NULL == ValueReleaseFunc) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: NULL ValueReleaseFunc* provided, defaulting to free().");
+#endif
+        ValueReleaseFunc = free;
+    }
+
+    if ( NULL == Tree->Root ) {
+        Tree->Root = BTree_Node_Create(Tree, true);
+        if ( NULL == Tree->Root ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to create Root BTree_Node_t.");
+#endif
+            return 1;
+        }
+    }
+
+    if ( Tree->MaxKeys == Tree->Root->KeyCount ) {
+        NewRoot = BTree_Node_Create(Tree, false);
+        if ( NULL == NewRoot ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to create new Root BTree_Node_t.");
+#endif
+            return 1;
+        }
+        NewRoot->Children[0] = Tree->Root;
+        if ( 0 != BTree_splitChild(Tree, NewRoot, 0) ) {
+            free(NewRoot);
+            return 1;
+        }
+        Tree->Root = NewRoot;
+    }
+
+    /*
+        Any full Node met on the way down is split before stepping into it, so the
+        leaf at the bottom always has room, and no split has to propagate back up.
+    */
+    Node = Tree->Root;
+    while ( !Node->IsLeaf ) {
+        Index = BTree_childIndex(Tree, Node, Key, KeySize, &Found);
+        if ( Tree->MaxKeys == Node->Children[Index]->KeyCount ) {
+            if ( 0 != BTree_splitChild(Tree, Node, Index) ) {
+                return 1;
+            }
+            Index = BTree_childIndex(Tree, Node, Key, KeySize, &Found);
+        }
+        Node = Node->Children[Index];
+    }
+
+    Index = BTree_Node_Search(Tree, Node, Key, KeySize, &Found);
+    if ( Found && (Policy_Error == Policy) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Value with the given key already exists in the Tree!");
+#endif
+        return -1;
+    }
+
+    if ( (NULL != Value) && (0 != ValueSize) ) {
+        ValueCopy = (uint8_t *)calloc(ValueSize, sizeof(uint8_t));
+        if ( NULL == ValueCopy ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Value.");
+#endif
+            return 1;
+        }
+        memcpy(ValueCopy, Value, ValueSize);
+        Value = ValueCopy;
+    }
+
+    Iterator_Invalidate(&(Tree->Iterator));
+
+    if ( Found ) {
+        Entry = &(Node->Values[Index]);
+        if ( (NULL != Entry->Value) && (NULL != Entry->ValueReleaseFunc) ) {
+            Entry->ValueReleaseFunc(Entry->Value);
+        }
+        Entry->Value            = Value;
+        Entry->ValueReleaseFunc = ValueReleaseFunc;
+        return 0;
+    }
+
+    if ( (0 == Tree->KeySize) && (0 != KeySize) ) {
+        KeyCopy = (uint8_t *)calloc(KeySize, sizeof(uint8_t));
+        if ( NULL == KeyCopy ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Key.");
+#endif
+            free(ValueCopy);
+            return 1;
+        }
+        memcpy(KeyCopy, Key, KeySize);
+        Key = KeyCopy;
+    }
+
+    BTree_Node_Shift(Tree, Node, Index, true);
+    if ( 0 != Tree->KeySize ) {
+        memcpy(BTree_Node_Slot(Tree, Node, Index), Key, Tree->KeySize);
+    } else {
+        Slot          = (BTree_Key_t *)(void *)BTree_Node_Slot(Tree, Node, Index);
+        Slot->Key     = Key;
+        Slot->KeySize = KeySize;
+    }
+    Node->Values[Index].Value            = Value;
+    Node->Values[Index].ValueReleaseFunc = ValueReleaseFunc;
+    Node->KeyCount++;
+    Tree->TreeSize++;
+
+    return 0;
+}
+
+/* ---------- Private Functions ---------- */
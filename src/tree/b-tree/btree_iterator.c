@@ -0,0 +1,208 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+
+#define LIBCONTAINER_ENABLE_BTREE
+#include "../../../include/libcontainer.h"
+
+#include "../../iterator/include/iterator.h"
+#include "../../logging/logging.h"
+#include "include/btree.h"
+#include "include/btree_iterator.h"
+
+int Iterator_Initialize_BTree(BTree_t *Tree) {
+
+    Iterator_t *    Iterator = NULL;
+    BTree_Cursor_t *Cursor   = NULL;
+    BTree_Node_t *  Node     = NULL;
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Tree* provided.");
+#endif
+        return 1;
+    }
+
+    Iterator_Invalidate(&(Tree->Iterator));
+
+    if ( NULL == Tree->Root ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: Tree is empty, nothing to iterate over.");
+#endif
+        return 1;
+    }
+
+    Iterator = (Iterator_t *)calloc(1, sizeof(Iterator_t));
+    Cursor   = (BTree_Cursor_t *)calloc(1, sizeof(BTree_Cursor_t));
+    if ( (NULL == Iterator) || (NULL == Cursor) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory to initialize Iterator.");
+#endif
+        free(Iterator);
+        free(Cursor);
+        return 1;
+    }
+
+    for ( Node = Tree->Root; !Node->IsLeaf; Node = Node->Children[0] ) { ; }
+
+    Cursor->Leaf  = Node;
+    Cursor->Index = 0;
+
+    Iterator->Context        = Cursor;
+    Iterator->ReleaseContext = free;
+    Iterator->Type           = Iterator_BTree;
+
+    Tree->Iterator = Iterator;
+    return 0;
+}
+
+Binary_Tree_KeyValuePair_t BTree_Next(BTree_t *Tree) {
+
+    Binary_Tree_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    BTree_Cursor_t *           Cursor       = NULL;
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Tree* provided.");
+#endif
+        return KeyValuePair;
+    }
+
+    if ( (NULL == Tree->Iterator) || (Tree->Iterator->Type != Iterator_BTree) ) {
+        if ( 0 != Iterator_Initialize_BTree(Tree) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Note: Failed to initialize BTree_t Iterator.");
+#endif
+            return KeyValuePair;
+        }
+        Cursor = (BTree_Cursor_t *)Tree->Iterator->Context;
+    } else {
+        Cursor = (BTree_Cursor_t *)Tree->Iterator->Context;
+        Cursor->Index++;
+        if ( Cursor->Index >= Cursor->Leaf->KeyCount ) {
+            Cursor->Leaf  = Cursor->Leaf->Next;
+            Cursor->Index = 0;
+        }
+    }
+
+    if ( NULL == Cursor->Leaf ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: Iteration has reached the end of the Tree.");
+#endif
+        Iterator_Invalidate(&(Tree->Iterator));
+        return KeyValuePair;
+    }
+
+    KeyValuePair.Key   = BTree_Node_Key(Tree, Cursor->Leaf, Cursor->Index);
+    KeyValuePair.Value = Cursor->Leaf->Values[Cursor->Index].Value;
+
+    return KeyValuePair;
+}
+
+int BTree_DoCallback(BTree_t *Tree, CallbackFunc_t *Callback) {
+
+    Binary_Tree_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    BTree_Node_t *             Leaf         = NULL;
+    size_t                     i            = 0;
+    int                        RetVal       = 0;
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Tree* provided.");
+#endif
+        return -1;
+    }
+
+    if ( NULL == Callback ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: NULL Callback* provided, nothing to call.");
+#endif
+        return 0;
+    }
+
+    if ( NULL == Tree->Root ) {
+        return 0;
+    }
+
+    for ( Leaf = Tree->Root; !Leaf->IsLeaf; Leaf = Leaf->Children[0] ) { ; }
+
+    for ( ; NULL != Leaf; Leaf = Leaf->Next ) {
+        for ( i = 0; i < Leaf->KeyCount; i++ ) {
+            KeyValuePair.Key   = BTree_Node_Key(Tree, Leaf, i);
+            KeyValuePair.Value = Leaf->Values[i].Value;
+            if ( 0 != Callback(&KeyValuePair) ) {
+#ifdef DEBUG
+                DEBUG_PRINTF("%s", "Warning: Callback function returned non-zero");
+#endif
+                RetVal += 1;
+            }
+        }
+    }
+
+    return RetVal;
+}
+
+int BTree_DoCallbackArg(BTree_t *Tree, CallbackArgFunc_t *Callback, void *Args) {
+
+    Binary_Tree_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    BTree_Node_t *             Leaf         = NULL;
+    size_t                     i            = 0;
+    int                        RetVal       = 0;
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Tree* provided.");
+#endif
+        return -1;
+    }
+
+    if ( NULL == Callback ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: NULL Callback* provided, nothing to call.");
+#endif
+        return 0;
+    }
+
+    if ( NULL == Tree->Root ) {
+        return 0;
+    }
+
+    for ( Leaf = Tree->Root; !Leaf->IsLeaf; Leaf = Leaf->Children[0] ) { ; }
+
+    for ( ; NULL != Leaf; Leaf = Leaf->Next ) {
+        for ( i = 0; i < Leaf->KeyCount; i++ ) {
+            KeyValuePair.Key   = BTree_Node_Key(Tree, Leaf, i);
+            KeyValuePair.Value = Leaf->Values[i].Value;
+            if ( 0 != Callback(&KeyValuePair, Args) ) {
+#ifdef DEBUG
+                DEBUG_PRINTF("%s", "Warning: Callback function returned non-zero");
+#endif
+                RetVal += 1;
+            }
+        }
+    }
+
+    return RetVal;
+}
@@ -0,0 +1,145 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../logging/logging.h"
+#include "include/btree.h"
+#include "include/btree_iterator.h"
+
+static int SumKeysCallback(void *KeyValuePair, void *Args) {
+
+    Binary_Tree_KeyValuePair_t *Pair = (Binary_Tree_KeyValuePair_t *)KeyValuePair;
+
+    *(long *)Args += *(int *)Pair->Key;
+    return 0;
+}
+
+static int CheckValueCallback(void *KeyValuePair) {
+
+    Binary_Tree_KeyValuePair_t *Pair = (Binary_Tree_KeyValuePair_t *)KeyValuePair;
+
+    return (*(int *)Pair->Key != -*(int *)Pair->Value);
+}
+
+int Test_btree_iterator(void) {
+
+    int FailedTests = 0;
+
+    FailedTests += Test_BTree_Next();
+    FailedTests += Test_BTree_DoCallback();
+
+    return FailedTests;
+}
+
+int Test_BTree_Next(void) {
+
+    BTree_t *                  Tree  = NULL;
+    Binary_Tree_KeyValuePair_t Pair  = {NULL, NULL};
+    int                        Count = 2000, Key = 0, Expected = 0;
+
+    Tree = BTree_Create(CompareFunc_Int_Ascending, sizeof(Key), NULL, Policy_Error);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create BTree_t* for testing.");
+        TEST_FAILURE;
+    }
+
+    Pair = BTree_Next(Tree);
+    if ( NULL != Pair.Key ) {
+        TEST_PRINTF("%s", "Test Failure - Iteration over empty BTree_t returned an item.");
+        BTree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    for ( Key = Count - 1; Key >= 0; Key-- ) {
+        if ( 0 != BTree_Insert(Tree, &Key, sizeof(Key), &Key, sizeof(Key), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to insert Key (%d) into BTree_t.", Key);
+            BTree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    /* Iterate twice, to check the iteration restarts once it finishes. */
+    for ( Key = 0; Key < 2; Key++ ) {
+        Expected = 0;
+        BTREE_FOREACH(Tree, Pair) {
+            if ( (Expected != *(int *)Pair.Key) || (Expected != *(int *)Pair.Value) ) {
+                TEST_PRINTF("Test Failure - Iterated Key (%d) not equal to expectation (%d).",
+                            *(int *)Pair.Key, Expected);
+                BTree_Release(Tree);
+                TEST_FAILURE;
+            }
+            Expected++;
+        }
+
+        if ( Count != Expected ) {
+            TEST_PRINTF("Test Failure - Iteration only reached (%d) of (%d) items.", Expected,
+                        Count);
+            BTree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    BTree_Release(Tree);
+    TEST_SUCCESSFUL;
+}
+
+int Test_BTree_DoCallback(void) {
+
+    BTree_t *Tree  = NULL;
+    int      Count = 2000, Key = 0, Value = 0;
+    long     Sum   = 0;
+
+    Tree = BTree_Create(CompareFunc_Int_Ascending, sizeof(Key), NULL, Policy_Error);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create BTree_t* for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        Value = -Key;
+        if ( 0 != BTree_Insert(Tree, &Key, sizeof(Key), &Value, sizeof(Value), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to insert Key (%d) into BTree_t.", Key);
+            BTree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( 0 != BTree_DoCallback(Tree, CheckValueCallback) ) {
+        TEST_PRINTF("%s", "Test Failure - Callback reported mismatched Key-Value pairs.");
+        BTree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    if ( (0 != BTree_DoCallbackArg(Tree, SumKeysCallback, &Sum)) ||
+         (((long)Count * (Count - 1)) / 2 != Sum) ) {
+        TEST_PRINTF("Test Failure - Callback sum of Keys (%ld) not equal to expectation.", Sum);
+        BTree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    BTree_Release(Tree);
+    TEST_SUCCESSFUL;
+}
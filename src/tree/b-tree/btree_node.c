@@ -0,0 +1,182 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../logging/logging.h"
+#include "include/btree.h"
+#include "include/btree_node.h"
+
+BTree_Node_t *BTree_Node_Create(BTree_t *Tree, bool IsLeaf) {
+
+    BTree_Node_t *Node       = NULL;
+    size_t        HeaderSize = 0, SlotAreaSize = 0;
+
+    /*
+        The Node, its Children or Values, and its Keys share a single allocation.
+        The pointer-sized Children or Values come directly after the Node header,
+        keeping them aligned, while the Keys fill the remainder.
+    */
+    HeaderSize = sizeof(BTree_Node_t);
+    if ( IsLeaf ) {
+        SlotAreaSize = Tree->MaxKeys * sizeof(BTree_Value_t);
+    } else {
+        SlotAreaSize = (Tree->MaxKeys + 1) * sizeof(BTree_Node_t *);
+    }
+
+    Node = (BTree_Node_t *)calloc(1, HeaderSize + SlotAreaSize + (Tree->MaxKeys * Tree->SlotSize));
+    if ( NULL == Node ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for BTree_Node_t.");
+#endif
+        return NULL;
+    }
+
+    if ( IsLeaf ) {
+        Node->Values = (BTree_Value_t *)(void *)((uint8_t *)Node + HeaderSize);
+    } else {
+        Node->Children = (BTree_Node_t **)(void *)((uint8_t *)Node + HeaderSize);
+    }
+    Node->Keys     = (uint8_t *)Node + HeaderSize + SlotAreaSize;
+    Node->Next     = NULL;
+    Node->KeyCount = 0;
+    Node->IsLeaf   = IsLeaf;
+
+    return Node;
+}
+
+void BTree_Node_Release(BTree_t *Tree, BTree_Node_t *Node) {
+
+    size_t i = 0;
+
+    if ( NULL == Node ) {
+        return;
+    }
+
+    if ( Node->IsLeaf ) {
+        for ( i = 0; i < Node->KeyCount; i++ ) {
+            BTree_Node_ReleaseEntry(Tree, Node, i);
+        }
+    } else {
+        for ( i = 0; i <= Node->KeyCount; i++ ) {
+            BTree_Node_Release(Tree, Node->Children[i]);
+        }
+    }
+
+    free(Node);
+    return;
+}
+
+uint8_t *BTree_Node_Slot(BTree_t *Tree, BTree_Node_t *Node, size_t Index) {
+    return Node->Keys + (Index * Tree->SlotSize);
+}
+
+void *BTree_Node_Key(BTree_t *Tree, BTree_Node_t *Node, size_t Index) {
+
+    if ( 0 != Tree->KeySize ) {
+        return BTree_Node_Slot(Tree, Node, Index);
+    }
+
+    return ((BTree_Key_t *)(void *)BTree_Node_Slot(Tree, Node, Index))->Key;
+}
+
+size_t BTree_Node_Search(BTree_t *Tree, BTree_Node_t *Node, void *Key, size_t KeySize,
+                         bool *Found) {
+
+    size_t       Low = 0, High = Node->KeyCount, Middle = 0, MinKeySize = 0;
+    BTree_Key_t *Slot          = NULL;
+    int          CompareResult = 0;
+
+    *Found = false;
+
+    while ( Low < High ) {
+        Middle = Low + ((High - Low) / 2);
+        if ( 0 != Tree->KeySize ) {
+            CompareResult =
+                Tree->KeyCompareFunc(BTree_Node_Slot(Tree, Node, Middle), Key, Tree->KeySize);
+        } else {
+            Slot          = (BTree_Key_t *)(void *)BTree_Node_Slot(Tree, Node, Middle);
+            MinKeySize    = (Slot->KeySize > KeySize) ? KeySize : Slot->KeySize;
+            CompareResult = Tree->KeyCompareFunc(Slot->Key, Key, MinKeySize);
+        }
+
+        if ( 0 == CompareResult ) {
+            *Found = true;
+            return Middle;
+        } else if ( CompareResult < 0 ) {
+            Low = Middle + 1;
+        } else {
+            High = Middle;
+        }
+    }
+
+    return Low;
+}
+
+void BTree_Node_Shift(BTree_t *Tree, BTree_Node_t *Node, size_t Index, bool Right) {
+
+    size_t Count = 0;
+
+    if ( Right ) {
+        Count = Node->KeyCount - Index;
+        memmove(BTree_Node_Slot(Tree, Node, Index + 1), BTree_Node_Slot(Tree, Node, Index),
+                Count * Tree->SlotSize);
+        if ( Node->IsLeaf ) {
+            memmove(&(Node->Values[Index + 1]), &(Node->Values[Index]),
+                    Count * sizeof(BTree_Value_t));
+        }
+    } else {
+        Count = Node->KeyCount - Index;
+        memmove(BTree_Node_Slot(Tree, Node, Index - 1), BTree_Node_Slot(Tree, Node, Index),
+                Count * Tree->SlotSize);
+        if ( Node->IsLeaf ) {
+            memmove(&(Node->Values[Index - 1]), &(Node->Values[Index]),
+                    Count * sizeof(BTree_Value_t));
+        }
+    }
+
+    return;
+}
+
+void BTree_Node_ReleaseEntry(BTree_t *Tree, BTree_Node_t *Node, size_t Index) {
+
+    BTree_Key_t *  Slot  = NULL;
+    BTree_Value_t *Value = &(Node->Values[Index]);
+
+    if ( 0 == Tree->KeySize ) {
+        Slot = (BTree_Key_t *)(void *)BTree_Node_Slot(Tree, Node, Index);
+        if ( (NULL != Slot->Key) && (NULL != Tree->KeyReleaseFunc) ) {
+            Tree->KeyReleaseFunc(Slot->Key);
+        }
+        Slot->Key = NULL;
+    }
+
+    if ( (NULL != Value->Value) && (NULL != Value->ValueReleaseFunc) ) {
+        Value->ValueReleaseFunc(Value->Value);
+    }
+    Value->Value = NULL;
+
+    return;
+}
@@ -0,0 +1,415 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../logging/logging.h"
+#include "include/btree.h"
+
+static int BTree_compareSlots(BTree_t *Tree, BTree_Node_t *A, size_t i, BTree_Node_t *B, size_t j) {
+
+    BTree_Key_t *SlotA = NULL, *SlotB = NULL;
+
+    if ( 0 != Tree->KeySize ) {
+        return Tree->KeyCompareFunc(BTree_Node_Key(Tree, A, i), BTree_Node_Key(Tree, B, j),
+                                    Tree->KeySize);
+    }
+
+    SlotA = (BTree_Key_t *)(void *)BTree_Node_Slot(Tree, A, i);
+    SlotB = (BTree_Key_t *)(void *)BTree_Node_Slot(Tree, B, j);
+    return Tree->KeyCompareFunc(SlotA->Key, SlotB->Key,
+                                (SlotA->KeySize > SlotB->KeySize) ? SlotB->KeySize
+                                                                  : SlotA->KeySize);
+}
+
+static BTree_Node_t *BTree_leftmostLeaf(BTree_Node_t *Node) {
+    for ( ; !Node->IsLeaf; Node = Node->Children[0] ) { ; }
+    return Node;
+}
+
+/*
+    Validate the B+tree invariants of the (sub)tree below Node, returning the number
+    of violations found. Every separator must be the smallest Key of the subtree to
+    its right, every Node other than the Root must be at least half full, and every
+    leaf must be at the same depth.
+*/
+static int BTree_validate(BTree_t *Tree, BTree_Node_t *Node, size_t Depth, size_t *LeafDepth,
+                          size_t *Count) {
+
+    size_t i = 0;
+    int    Failures = 0;
+
+    if ( Node->KeyCount > Tree->MaxKeys ) {
+        Failures++;
+    }
+
+    if ( (Node != Tree->Root) && (Node->KeyCount < BTree_minKeys(Tree)) ) {
+        Failures++;
+    }
+
+    for ( i = 1; i < Node->KeyCount; i++ ) {
+        if ( BTree_compareSlots(Tree, Node, i - 1, Node, i) >= 0 ) {
+            Failures++;
+        }
+    }
+
+    if ( Node->IsLeaf ) {
+        if ( 0 == *LeafDepth ) {
+            *LeafDepth = Depth;
+        } else if ( Depth != *LeafDepth ) {
+            Failures++;
+        }
+        *Count += Node->KeyCount;
+        return Failures;
+    }
+
+    for ( i = 0; i < Node->KeyCount; i++ ) {
+        if ( 0 != BTree_compareSlots(Tree, Node, i, BTree_leftmostLeaf(Node->Children[i + 1]), 0) ) {
+            Failures++;
+        }
+    }
+
+    for ( i = 0; i <= Node->KeyCount; i++ ) {
+        Failures += BTree_validate(Tree, Node->Children[i], Depth + 1, LeafDepth, Count);
+    }
+
+    return Failures;
+}
+
+static int BTree_isValid(BTree_t *Tree) {
+
+    size_t LeafDepth = 0, Count = 0;
+
+    if ( NULL == Tree->Root ) {
+        return (0 == Tree->TreeSize);
+    }
+
+    if ( 0 != BTree_validate(Tree, Tree->Root, 1, &LeafDepth, &Count) ) {
+        return false;
+    }
+
+    return (Count == Tree->TreeSize);
+}
+
+int Test_btree(void) {
+
+    int FailedTests = 0;
+
+    FailedTests += Test_BTree_Create();
+    FailedTests += Test_BTree_Insert();
+    FailedTests += Test_BTree_Get();
+    FailedTests += Test_BTree_Remove();
+    FailedTests += Test_BTree_StringKey();
+    FailedTests += Test_BTree_Clear();
+
+    FailedTests += Test_btree_iterator();
+
+    return FailedTests;
+}
+
+int Test_BTree_Create(void) {
+
+    BTree_t *Tree = NULL;
+
+    Tree = BTree_Create(CompareFunc_Int_Ascending, sizeof(int), NULL, Policy_Overwrite);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create BTree_t* for testing.");
+        TEST_FAILURE;
+    }
+
+    if ( (Tree->MaxKeys < 4) || (0 != BTree_Length(Tree)) ) {
+        TEST_PRINTF("%s", "Test Failure - New BTree_t not initialized as expected.");
+        BTree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    BTree_Release(Tree);
+    TEST_SUCCESSFUL;
+}
+
+int Test_BTree_Insert(void) {
+
+    BTree_t *Tree  = NULL;
+    int      Count = 4096, Key = 0, Value = 0;
+
+    Tree = BTree_Create(CompareFunc_Int_Ascending, sizeof(Key), NULL, Policy_Error);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create BTree_t* for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        Value = Key * 2;
+        if ( 0 != BTree_Insert(Tree, &Key, sizeof(Key), &Value, sizeof(Value), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to insert Key (%d) into BTree_t.", Key);
+            BTree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( ((size_t)Count != BTree_Length(Tree)) || !BTree_isValid(Tree) ) {
+        TEST_PRINTF("%s", "Test Failure - BTree_t is malformed after insertions.");
+        BTree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    Key = Count / 2;
+    if ( 0 <= BTree_Insert(Tree, &Key, sizeof(Key), &Value, sizeof(Value), NULL) ) {
+        TEST_PRINTF("%s", "Test Failure - Duplicate Key did not honour Policy_Error.");
+        BTree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    BTree_Release(Tree);
+    TEST_SUCCESSFUL;
+}
+
+int Test_BTree_Get(void) {
+
+    BTree_t *Tree  = NULL;
+    int      Count = 4096, Key = 0, Value = 0, *Result = NULL;
+
+    Tree = BTree_Create(CompareFunc_Int_Ascending, sizeof(Key), NULL, Policy_Overwrite);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create BTree_t* for testing.");
+        TEST_FAILURE;
+    }
+
+    /* Insert a permutation of the Keys, then overwrite every Value once. */
+    for ( Key = 0; Key < Count; Key++ ) {
+        Value = (Key * 7919) % Count;
+        if ( 0 != BTree_Insert(Tree, &Value, sizeof(Value), &Key, sizeof(Key), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to insert Key (%d) into BTree_t.", Value);
+            BTree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        Value = -Key;
+        if ( 0 != BTree_Insert(Tree, &Key, sizeof(Key), &Value, sizeof(Value), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to overwrite Key (%d) in BTree_t.", Key);
+            BTree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        Result = (int *)BTree_Get(Tree, &Key, sizeof(Key));
+        if ( (NULL == Result) || (-Key != *Result) ) {
+            TEST_PRINTF("Test Failure - Value for Key (%d) not equal to expectation.", Key);
+            BTree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    Key = Count;
+    if ( (NULL != BTree_Get(Tree, &Key, sizeof(Key))) || BTree_KeyExists(Tree, &Key, 0) ) {
+        TEST_PRINTF("%s", "Test Failure - Found Key which was never inserted.");
+        BTree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    if ( ((size_t)Count != BTree_Length(Tree)) || !BTree_isValid(Tree) ) {
+        TEST_PRINTF("%s", "Test Failure - BTree_t is malformed after overwriting.");
+        BTree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    BTree_Release(Tree);
+    TEST_SUCCESSFUL;
+}
+
+int Test_BTree_Remove(void) {
+
+    BTree_t *Tree = NULL;
+    bool     Present[1024];
+    size_t   Expected = 0, OperationCount = 1 << 14, i = 0;
+    int      Key = 0;
+
+    Tree = BTree_Create(CompareFunc_Int_Ascending, sizeof(Key), NULL, Policy_Overwrite);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create BTree_t* for testing.");
+        TEST_FAILURE;
+    }
+
+    memset(Present, 0x00, sizeof(Present));
+
+    /* Mix random insertions and removals, checking the invariants against a reference. */
+    for ( i = 0; i < OperationCount; i++ ) {
+        Key = rand() % 1024;
+        if ( 0 == (rand() % 3) ) {
+            if ( 0 != BTree_Insert(Tree, &Key, sizeof(Key), &Key, sizeof(Key), NULL) ) {
+                TEST_PRINTF("Test Failure - Failed to insert Key (%d) into BTree_t.", Key);
+                BTree_Release(Tree);
+                TEST_FAILURE;
+            }
+            Expected += (Present[Key]) ? 0 : 1;
+            Present[Key] = true;
+        } else if ( 0 == (rand() % 2) ) {
+            if ( 0 != BTree_Remove(Tree, &Key, sizeof(Key)) ) {
+                TEST_PRINTF("Test Failure - Failed to remove Key (%d) from BTree_t.", Key);
+                BTree_Release(Tree);
+                TEST_FAILURE;
+            }
+            Expected -= (Present[Key]) ? 1 : 0;
+            Present[Key] = false;
+        } else {
+            if ( 0 != BTree_Insert(Tree, &Key, sizeof(Key), &Key, sizeof(Key), NULL) ) {
+                TEST_PRINTF("Test Failure - Failed to insert Key (%d) into BTree_t.", Key);
+                BTree_Release(Tree);
+                TEST_FAILURE;
+            }
+            Expected += (Present[Key]) ? 0 : 1;
+            Present[Key] = true;
+        }
+
+        if ( (Expected != BTree_Length(Tree)) || !BTree_isValid(Tree) ) {
+            TEST_PRINTF("Test Failure - BTree_t is malformed after operation #%lu.",
+                        (unsigned long)i);
+            BTree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( Key = 0; Key < 1024; Key++ ) {
+        if ( Present[Key] != BTree_KeyExists(Tree, &Key, sizeof(Key)) ) {
+            TEST_PRINTF("Test Failure - Existence of Key (%d) not equal to expectation.", Key);
+            BTree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    /* Drain the Tree completely, to check it collapses back down to empty. */
+    for ( Key = 0; Key < 1024; Key++ ) {
+        BTree_Remove(Tree, &Key, sizeof(Key));
+    }
+
+    if ( (0 != BTree_Length(Tree)) || (NULL != Tree->Root) ) {
+        TEST_PRINTF("%s", "Test Failure - BTree_t not empty after removing every Key.");
+        BTree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    BTree_Release(Tree);
+    TEST_SUCCESSFUL;
+}
+
+int Test_BTree_StringKey(void) {
+
+    BTree_t *Tree = NULL;
+    char     Key[32];
+    int      Count = 2048, i = 0, *Value = NULL;
+
+    Tree = BTree_Create(CompareFunc_String_Ascending, 0, NULL, Policy_Error);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create BTree_t* for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        sprintf(Key, "key-%d", (i * 7919) % Count);
+        if ( 0 != BTree_Insert(Tree, Key, strlen(Key) + 1, &i, sizeof(i), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to insert Key (%s) into BTree_t.", Key);
+            BTree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    /*
+        Remove every other Key, which exercises the replacement of separators
+        referring to Keys owned by the leaves.
+    */
+    for ( i = 0; i < Count; i += 2 ) {
+        sprintf(Key, "key-%d", i);
+        if ( 0 != BTree_Remove(Tree, Key, strlen(Key) + 1) ) {
+            TEST_PRINTF("Test Failure - Failed to remove Key (%s) from BTree_t.", Key);
+            BTree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( ((size_t)(Count / 2) != BTree_Length(Tree)) || !BTree_isValid(Tree) ) {
+        TEST_PRINTF("%s", "Test Failure - BTree_t is malformed after removals.");
+        BTree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        sprintf(Key, "key-%d", (i * 7919) % Count);
+        Value = (int *)BTree_Get(Tree, Key, strlen(Key) + 1);
+        if ( (0 == ((i * 7919) % Count) % 2) != (NULL == Value) ) {
+            TEST_PRINTF("Test Failure - Existence of Key (%s) not equal to expectation.", Key);
+            BTree_Release(Tree);
+            TEST_FAILURE;
+        }
+        if ( (NULL != Value) && (i != *Value) ) {
+            TEST_PRINTF("Test Failure - Value for Key (%s) not equal to expectation.", Key);
+            BTree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    BTree_Release(Tree);
+    TEST_SUCCESSFUL;
+}
+
+int Test_BTree_Clear(void) {
+
+    BTree_t *Tree  = NULL;
+    int      Count = 1024, Key = 0;
+
+    Tree = BTree_Create(CompareFunc_Int_Ascending, sizeof(Key), NULL, Policy_Overwrite);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create BTree_t* for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        if ( 0 != BTree_Insert(Tree, &Key, 0, NULL, 0, NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to insert Key (%d) into BTree_t.", Key);
+            BTree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( (0 != BTree_Clear(Tree)) || (0 != BTree_Length(Tree)) || (NULL != Tree->Root) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to clear BTree_t.");
+        BTree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    Key = 1;
+    if ( (0 != BTree_Insert(Tree, &Key, 0, NULL, 0, NULL)) || (1 != BTree_Length(Tree)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to re-use BTree_t after clearing.");
+        BTree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    BTree_Release(Tree);
+    TEST_SUCCESSFUL;
+}
@@ -0,0 +1,238 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef LIBCONTAINER_BTREE_H
+#define LIBCONTAINER_BTREE_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+#define LIBCONTAINER_ENABLE_BTREE
+#include "../../../../include/libcontainer.h"
+
+#include "../../../iterator/include/iterator.h"
+
+#include "btree_node.h"
+
+struct BTree_t {
+
+    /*
+        Root is the top-most Node of the B+tree. This is NULL for an empty tree,
+        a leaf while the tree fits within a single Node, and otherwise an
+        internal Node. All Key-Value pairs are held within the leaves, while
+        the internal Nodes only hold copies of (or references to) Keys, to route
+        searches down towards the correct leaf.
+    */
+    BTree_Node_t* Root;
+
+    /*
+        KeyReleaseFunc is a pointer to the function to call to safely release the
+        resources associated with a Key which is not held inline within the leaves.
+    */
+    ReleaseFunc_t* KeyReleaseFunc;
+
+    /*
+        KeyCompareFunc is the generalized comparison function to apply to determine
+        the ordering of the Keys within the Tree.
+    */
+    CompareFunc_t* KeyCompareFunc;
+
+    /*
+        Iterator is the struct containing the necessary information and context
+        to be able to single-step iterate over the leaves of the Tree.
+    */
+    Iterator_t* Iterator;
+
+    /*
+        The total number of elements in the tree. Allows O(1) checks of the
+        length or size of the tree.
+    */
+    size_t TreeSize;
+
+    /*
+        KeySize caches the size of the Keys held by this tree. If this is non-zero,
+        the Keys are copied inline into the Nodes themselves. If this is set to 0, the
+        Nodes hold a pointer to each Key, along with its size.
+    */
+    size_t KeySize;
+
+    /*
+        SlotSize is the number of bytes used by each Key within a Node, either the
+        KeySize of the tree, or the size of a BTree_Key_t.
+    */
+    size_t SlotSize;
+
+    /*
+        MaxKeys is the maximum number of Keys held within any single Node, chosen such
+        that a full Node fits within LIBCONTAINER_BTREE_NODE_SIZE bytes.
+    */
+    size_t MaxKeys;
+
+    /*
+        DuplicatePolicy notes how the tree will handle duplicate Keys.
+    */
+    Binary_Tree_DuplicatePolicy_t DuplicatePolicy;
+};
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+/*
+    BTree_minKeys
+
+    This function returns the minimum number of Keys every non-root Node of the
+    Tree must hold.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to operate on.
+
+    Outputs:
+    size_t  -   The minimum number of Keys for a non-root Node.
+*/
+size_t BTree_minKeys(BTree_t* Tree);
+
+/*
+    BTree_childIndex
+
+    This function returns the index of the child of an internal Node to descend
+    into when searching for the given Key.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to operate on.
+    Node    -   Pointer to the internal Node to search within.
+    Key     -   Pointer to the Key value to search for.
+    KeySize -   The size of the Key value.
+    Found   -   Out-parameter, set to true if the Key is one of the separators of the Node,
+                    in which case the returned child holds it as its minimum Key.
+
+    Outputs:
+    size_t  -   The index of the child covering the range containing the Key.
+*/
+size_t BTree_childIndex(BTree_t* Tree, BTree_Node_t* Node, void* Key, size_t KeySize, bool* Found);
+
+/*
+    BTree_findLeaf
+
+    This function descends the Tree to the leaf which would contain the given Key.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to operate on.
+    Key     -   Pointer to the Key value to search for.
+    KeySize -   The size of the Key value.
+    Index   -   Out-parameter for the index of the Key within the leaf.
+
+    Outputs:
+    BTree_Node_t*   -   Pointer to the leaf holding the Key, or NULL if it does not exist.
+*/
+BTree_Node_t* BTree_findLeaf(BTree_t* Tree, void* Key, size_t KeySize, size_t* Index);
+
+/*
+    BTree_splitChild
+
+    This function splits the full child at Index of the given Node in two, adding
+    the new right half and its separator Key to the Node.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to operate on.
+    Parent  -   Pointer to the (non-full) internal Node holding the child to split.
+    Index   -   The index of the child to split.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure.
+*/
+int BTree_splitChild(BTree_t* Tree, BTree_Node_t* Parent, size_t Index);
+
+/*
+    BTree_fillChild
+
+    This function ensures the child at Index of the given Node holds more than the
+    minimum number of Keys, by either borrowing a Key from one of its siblings, or
+    merging it with one of them.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to operate on.
+    Parent  -   Pointer to the internal Node holding the child to fill.
+    Index   -   The index of the child to fill.
+
+    Outputs:
+    None, the child covering the original range now holds more than the minimum number of Keys.
+*/
+void BTree_fillChild(BTree_t* Tree, BTree_Node_t* Parent, size_t Index);
+
+/*
+    BTree_mergeChildren
+
+    This function merges the child at Index + 1 of the given Node into the child at
+    Index, removing the separator between them from the Node.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to operate on.
+    Parent  -   Pointer to the internal Node holding the children to merge.
+    Index   -   The index of the left child of the pair to merge.
+
+    Outputs:
+    None, the children are merged and the now-empty right child is released.
+*/
+void BTree_mergeChildren(BTree_t* Tree, BTree_Node_t* Parent, size_t Index);
+
+/*
+    BTree_insertEntry
+
+    This function performs a single top-down descent of the Tree to find either the
+    entry holding the given Key, or the position in a leaf where it belongs. Full
+    Nodes are split on the way down, so the leaf always has room for a new entry.
+
+    Inputs:
+    Tree                -   Pointer to the Tree to operate on.
+    Key                 -   Pointer to the Key value to insert.
+    KeySize             -   The size of the Key value to be inserted.
+    Value               -   Pointer to the Value to insert.
+    ValueSize           -   The size of the Value to be inserted.
+    ValueReleaseFunc    -   Pointer to the function to call to release the Value.
+    Policy              -   How to treat an existing item with the same Key.
+
+    Outputs:
+    int     -   Returns 0 on success, positive on error, or negative if the Key already exists
+                    and the Policy is Policy_Error.
+*/
+int BTree_insertEntry(BTree_t* Tree, void* Key, size_t KeySize, void* Value, size_t ValueSize, ReleaseFunc_t* ValueReleaseFunc, Binary_Tree_DuplicatePolicy_t Policy);
+
+/* ---------- Private Functions ---------- */
+
+#if defined(TESTING) || defined(DEBUGGER)
+
+#include "btree_test.h"
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
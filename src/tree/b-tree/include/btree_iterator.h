@@ -0,0 +1,79 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef LIBCONTAINER_BTREE_ITERATOR_H
+#define LIBCONTAINER_BTREE_ITERATOR_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LIBCONTAINER_ENABLE_BTREE
+#include "../../../../include/libcontainer.h"
+
+#include "btree_node.h"
+
+/*
+    BTree_Cursor_t
+
+    This is the Context of the Iterator_t of a BTree_t, holding the position of
+    the most recently returned entry. Iteration only ever walks the leaves, using
+    the Next link of each leaf to move on to the following one.
+*/
+typedef struct BTree_Cursor_t {
+
+    /*
+        Leaf is the leaf holding the most recently returned entry.
+    */
+    BTree_Node_t* Leaf;
+
+    /*
+        Index is the position of the most recently returned entry within the Leaf.
+    */
+    size_t Index;
+
+} BTree_Cursor_t;
+
+/*
+    Iterator_Initialize_BTree
+
+    This function initializes the Iterator_t of a BTree_t, positioned on the
+    smallest Key of the Tree.
+
+    Inputs:
+    Tree    -   Pointer to the BTree_t to iterate over.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure or if the Tree is empty.
+*/
+int Iterator_Initialize_BTree(BTree_t* Tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
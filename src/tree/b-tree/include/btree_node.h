@@ -0,0 +1,257 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef LIBCONTAINER_BTREE_NODE_H
+#define LIBCONTAINER_BTREE_NODE_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define LIBCONTAINER_ENABLE_BTREE
+#include "../../../../include/libcontainer.h"
+
+#ifndef LIBCONTAINER_BTREE_NODE_SIZE
+/*
+    LIBCONTAINER_BTREE_NODE_SIZE
+
+    This macro defines the approximate size, in bytes, of a single full BTree_t Node.
+    The number of Keys held per Node is derived from this and the size of the Keys,
+    so that each Node spans a small, fixed number of cache lines. Larger Nodes make
+    for a shallower tree, at the cost of a longer search within each Node.
+
+    This is tunable during build-time be re-defining this macro
+    with the desired integer value. Every Node holds at least 4 Keys, regardless
+    of this value.
+*/
+#define LIBCONTAINER_BTREE_NODE_SIZE 512
+#endif
+
+typedef struct BTree_Node_t BTree_Node_t;
+
+/*
+    BTree_Key_t
+
+    This is the Key slot used by a BTree_t holding Keys of varying size, where the
+    Nodes only hold a pointer to each Key. Within the leaves, this pointer owns
+    the Key. Within the internal Nodes, this is only a reference to a Key which
+    is held by a leaf.
+*/
+typedef struct BTree_Key_t {
+
+    /*
+        Key is a pointer to the actual Key.
+    */
+    void* Key;
+
+    /*
+        KeySize is the size of the Key, or 0 if the Key is a reference-type.
+    */
+    size_t KeySize;
+
+} BTree_Key_t;
+
+/*
+    BTree_Value_t
+
+    This is the Value slot held alongside each Key within the leaves of a BTree_t.
+*/
+typedef struct BTree_Value_t {
+
+    /*
+        Value is the pointer to the Value owned by the Tree.
+    */
+    void* Value;
+
+    /*
+        ValueReleaseFunc is the function to call to release the Value.
+    */
+    ReleaseFunc_t* ValueReleaseFunc;
+
+} BTree_Value_t;
+
+struct BTree_Node_t {
+
+    /*
+        Keys is the array of Key slots held within this Node, in sorted order.
+        Each slot is Tree->SlotSize bytes, and the array lives within the same
+        allocation as the Node itself, so a search within a Node only touches
+        contiguous memory.
+    */
+    uint8_t* Keys;
+
+    /*
+        For an internal Node, Children holds the KeyCount + 1 subtrees of this
+        Node. Every Key of Children[i] is less than Keys[i], and Keys[i] is the
+        minimum Key held within Children[i + 1].
+    */
+    BTree_Node_t** Children;
+
+    /*
+        For a leaf Node, Values holds the Value associated with each of the Keys.
+    */
+    BTree_Value_t* Values;
+
+    /*
+        For a leaf Node, Next is the leaf holding the next larger Keys, or NULL
+        for the right-most leaf. This allows for range scans without revisiting
+        any of the internal Nodes.
+    */
+    BTree_Node_t* Next;
+
+    /*
+        The number of Keys currently held within this Node.
+    */
+    size_t KeyCount;
+
+    /*
+        IsLeaf indicates whether this Node is a leaf, holding Values rather than Children.
+    */
+    bool IsLeaf;
+};
+
+/*
+    BTree_Node_Create
+
+    This function allocates a new, empty Node for the given Tree, sized to hold
+    up to Tree->MaxKeys Keys.
+
+    Inputs:
+    Tree    -   Pointer to the Tree the Node will be part of.
+    IsLeaf  -   Whether the Node is a leaf or an internal Node.
+
+    Outputs:
+    BTree_Node_t*   -   Pointer to the new Node on success, NULL on failure.
+*/
+BTree_Node_t* BTree_Node_Create(BTree_t* Tree, bool IsLeaf);
+
+/*
+    BTree_Node_Release
+
+    This function releases the given Node, along with all of the Nodes below it
+    and every Key and Value held within its leaves.
+
+    Inputs:
+    Tree    -   Pointer to the Tree the Node is part of.
+    Node    -   Pointer to the Node to release. May be NULL.
+
+    Outputs:
+    None, the (sub)tree is released.
+*/
+void BTree_Node_Release(BTree_t* Tree, BTree_Node_t* Node);
+
+/*
+    BTree_Node_Slot
+
+    This function returns a pointer to the Key slot at the given Index of a Node.
+
+    Inputs:
+    Tree    -   Pointer to the Tree the Node is part of.
+    Node    -   Pointer to the Node to operate on.
+    Index   -   The index of the Key slot.
+
+    Outputs:
+    uint8_t*    -   Pointer to the raw Key slot.
+*/
+uint8_t* BTree_Node_Slot(BTree_t* Tree, BTree_Node_t* Node, size_t Index);
+
+/*
+    BTree_Node_Key
+
+    This function returns a pointer to the Key at the given Index of a Node.
+
+    Inputs:
+    Tree    -   Pointer to the Tree the Node is part of.
+    Node    -   Pointer to the Node to operate on.
+    Index   -   The index of the Key.
+
+    Outputs:
+    void*   -   Pointer to the Key, as given to the KeyCompareFunc of the Tree.
+*/
+void* BTree_Node_Key(BTree_t* Tree, BTree_Node_t* Node, size_t Index);
+
+/*
+    BTree_Node_Search
+
+    This function performs a binary search within a single Node for the given Key.
+
+    Inputs:
+    Tree    -   Pointer to the Tree the Node is part of.
+    Node    -   Pointer to the Node to search.
+    Key     -   Pointer to the Key value to search for.
+    KeySize -   The size of the Key value.
+    Found   -   Out-parameter, set to true if the Key exists at the returned index.
+
+    Outputs:
+    size_t  -   The index of the first Key within the Node which is not less than the given Key.
+*/
+size_t BTree_Node_Search(BTree_t* Tree, BTree_Node_t* Node, void* Key, size_t KeySize, bool* Found);
+
+/*
+    BTree_Node_Shift
+
+    This function moves the Key slots (and the Values, for a leaf) in the range
+    [Index, KeyCount) of a Node by one position. The KeyCount of the Node is not
+    modified, and the Children of an internal Node are not moved.
+
+    Inputs:
+    Tree    -   Pointer to the Tree the Node is part of.
+    Node    -   Pointer to the Node to operate on.
+    Index   -   The first index of the range to move.
+    Right   -   True to move the range up by one, opening a gap at Index. False to
+                    move the range down by one, overwriting the entry at Index - 1.
+
+    Outputs:
+    None, the entries are moved within the Node.
+*/
+void BTree_Node_Shift(BTree_t* Tree, BTree_Node_t* Node, size_t Index, bool Right);
+
+/*
+    BTree_Node_ReleaseEntry
+
+    This function releases the Key (if not held inline) and the Value at the
+    given Index of a leaf.
+
+    Inputs:
+    Tree    -   Pointer to the Tree the Node is part of.
+    Node    -   Pointer to the leaf to operate on.
+    Index   -   The index of the entry to release.
+
+    Outputs:
+    None, the resources held by the entry are released.
+*/
+void BTree_Node_ReleaseEntry(BTree_t* Tree, BTree_Node_t* Node, size_t Index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -27,13 +27,15 @@
 
 #include "../../logging/logging.h"
 #include "include/binary_tree.h"
+#include "include/binary_tree_iterator.h"
 #include "include/tree_rotations.h"
 
 Binary_Tree_t *Binary_Tree_Create(CompareFunc_t *KeyCompareFunc, size_t KeySize,
                                   ReleaseFunc_t *               KeyReleaseFunc,
                                   Binary_Tree_DuplicatePolicy_t Policy) {
 
-    Binary_Tree_t *Tree = NULL;
+    Binary_Tree_t *Tree       = NULL;
+    size_t         InlineSize = 0;
 
     if ( NULL == KeyReleaseFunc ) {
 #ifdef DEBUG
@@ -64,6 +66,20 @@ Binary_Tree_t *Binary_Tree_Create(CompareFunc_t *KeyCompareFunc, size_t KeySize,
         return NULL;
     }
 
+    /* Keys released by anything but free() must keep their own allocation. */
+    if ( (free == KeyReleaseFunc) && (KeySize <= LIBCONTAINER_POOL_INLINE_KEY_SIZE) ) {
+        InlineSize = KeySize;
+    }
+
+    Tree->NodePool = Pool_Create(sizeof(Binary_Tree_Node_t) + InlineSize);
+    if ( NULL == Tree->NodePool ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to create Node Pool_t for Binary_Tree_t.");
+#endif
+        free(Tree);
+        return NULL;
+    }
+
     Tree->KeyReleaseFunc  = KeyReleaseFunc;
     Tree->KeyCompareFunc  = KeyCompareFunc;
     Tree->Root            = NULL;
@@ -77,111 +93,124 @@ Binary_Tree_t *Binary_Tree_Create(CompareFunc_t *KeyCompareFunc, size_t KeySize,
     return Tree;
 }
 
-size_t Binary_Tree_Length(Binary_Tree_t *Tree) {
-
-    if ( NULL == Tree ) {
-#ifdef DEBUG
-        DEBUG_PRINTF("%s", "Warning: NULL Tree* provided, unable to report length.");
-#endif
-        return 0;
-    }
-
-    return Tree->TreeSize;
-}
-
-int Binary_Tree_Insert(Binary_Tree_t *Tree, void *Key, size_t KeySize, void *Value,
-                       size_t ValueSize, ReleaseFunc_t *ValueReleaseFunc) {
+Binary_Tree_t *Binary_Tree_BuildFromSorted(CompareFunc_t *KeyCompareFunc, size_t KeySize,
+                                          ReleaseFunc_t *               KeyReleaseFunc,
+                                          Binary_Tree_DuplicatePolicy_t Policy, void *Keys,
+                                          void *Values, size_t ValueSize,
+                                          ReleaseFunc_t *ValueReleaseFunc, size_t Count) {
 
-    Binary_Tree_Node_t *NewRoot = NULL, *NewNode = NULL;
-    bool                IncrementSize = false;
+    Binary_Tree_t *Tree = NULL;
+    size_t         i    = 0;
 
-    if ( NULL == Tree ) {
+    if ( (0 == KeySize) || ((NULL == Keys) && (0 != Count)) ) {
 #ifdef DEBUG
-        DEBUG_PRINTF("%s", "Error: NULL Tree* provided, cannot insert new value.");
+        DEBUG_PRINTF("%s",
+                     "Error: Bulk-loading a Binary_Tree_t requires an array of fixed-size Keys.");
 #endif
-        return 1;
+        return NULL;
     }
 
-    if ( NULL == Key ) {
+    Tree = Binary_Tree_Create(KeyCompareFunc, KeySize, KeyReleaseFunc, Policy);
+    if ( NULL == Tree ) {
 #ifdef DEBUG
-        DEBUG_PRINTF("%s", "Error: NULL Key* Provided.");
+        DEBUG_PRINTF("%s", "Error: Failed to create Binary_Tree_t to bulk-load.");
 #endif
-        return 1;
+        return NULL;
     }
 
-    if ( 0 == KeySize ) {
-        if ( 0 != Tree->KeySize ) {
-#ifdef DEBUG
-            DEBUG_PRINTF("Note: KeySize of 0 provided, using cached value from tree initialization "
-                         "of [ %lu ].",
-                         (unsigned long)Tree->KeySize);
-#endif
-            KeySize = Tree->KeySize;
-        } else {
+    /* The balanced shape is only a valid search tree if the Keys are strictly ascending. */
+    for ( i = 1; i < Count; i++ ) {
+        if ( Tree->KeyCompareFunc((uint8_t *)Keys + ((i - 1) * KeySize),
+                                  (uint8_t *)Keys + (i * KeySize), KeySize) >= 0 ) {
 #ifdef DEBUG
-            DEBUG_PRINTF("%s", "Note: KeySize of 0 provided, treating as reference type.");
+            DEBUG_PRINTF("Error: Keys are not strictly ascending at index [ %lu ].",
+                         (unsigned long)i);
 #endif
+            Binary_Tree_Release(Tree);
+            return NULL;
         }
     }
 
-    if ( NULL != Value ) {
-        if ( 0 == ValueSize ) {
+    if ( (NULL != Values) && (NULL == ValueReleaseFunc) ) {
 #ifdef DEBUG
-            DEBUG_PRINTF("%s", "Note: ValueSize of 0 provided, treating as reference type.");
+        DEBUG_PRINTF("%s", "Note: NULL ValueReleaseFunc* provided, defaulting to free().");
 #endif
-        }
+        ValueReleaseFunc = free;
+    }
 
-        if ( NULL == ValueReleaseFunc ) {
+    if ( 0 != Binary_Tree_buildSubtree(Tree, Keys, Values, ValueSize, ValueReleaseFunc, 0, Count,
+                                       &(Tree->Root)) ) {
 #ifdef DEBUG
-            DEBUG_PRINTF("%s", "Note: NULL ValueReleaseFunc* provided, defaulting to free().");
+        DEBUG_PRINTF("%s", "Error: Failed to build balanced Binary_Tree_t from sorted Keys.");
 #endif
-            ValueReleaseFunc = free;
-        }
+        Binary_Tree_Release(Tree);
+        return NULL;
     }
 
-    Iterator_Invalidate(&(Tree->Iterator));
+    Tree->TreeSize = Count;
 
-    if ( NULL == Value ) {
 #ifdef DEBUG
-        DEBUG_PRINTF("%s", "Note: NULL Value* provided, just inserting Key.");
+    DEBUG_PRINTF("Successfully bulk-loaded Binary_Tree_t with [ %lu ] items.",
+                 (unsigned long)Count);
 #endif
-    }
+    return Tree;
+}
 
-    IncrementSize = !(Binary_Tree_KeyExists(Tree, Key, KeySize));
+size_t Binary_Tree_Length(Binary_Tree_t *Tree) {
 
-    if ( !IncrementSize ) {
-        switch ( Tree->DuplicatePolicy ) {
-            case Policy_Error:
+    if ( NULL == Tree ) {
 #ifdef DEBUG
-                DEBUG_PRINTF("%s", "Error: Value with the given key already exists in the Tree!");
+        DEBUG_PRINTF("%s", "Warning: NULL Tree* provided, unable to report length.");
 #endif
-                return -1;
-            default: break;
-        }
+        return 0;
     }
 
-    /* Otherwise, this is a new Key, and must be added to the tree as a new Node. */
-    NewNode = Binary_Tree_Node_Create(Key, KeySize, Tree->KeyReleaseFunc, Value, ValueSize,
-                                      ValueReleaseFunc);
-    if ( NULL == NewNode ) {
+    return Tree->TreeSize;
+}
+
+int Binary_Tree_Insert(Binary_Tree_t *Tree, void *Key, size_t KeySize, void *Value,
+                       size_t ValueSize, ReleaseFunc_t *ValueReleaseFunc) {
+
+    Binary_Tree_Node_t *Node = NULL;
+
+    if ( NULL == Tree ) {
 #ifdef DEBUG
-        DEBUG_PRINTF("%s", "Error: Failed to create new Binary_Tree_Node_t");
+        DEBUG_PRINTF("%s", "Error: NULL Tree* provided, cannot insert new value.");
 #endif
         return 1;
     }
 
-    NewRoot = Binary_Tree_insertNode(Tree->Root, Tree->KeyCompareFunc, NewNode);
-    if ( NULL == NewRoot ) {
+    return Binary_Tree_insertKey(Tree, Key, KeySize, Value, ValueSize, ValueReleaseFunc,
+                                 Tree->DuplicatePolicy, &Node);
+}
+
+int Binary_Tree_Upsert(Binary_Tree_t *Tree, void *Key, size_t KeySize, void *Value,
+                       size_t ValueSize, ReleaseFunc_t *ValueReleaseFunc) {
+
+    Binary_Tree_Node_t *Node = NULL;
+
+    return Binary_Tree_insertKey(Tree, Key, KeySize, Value, ValueSize, ValueReleaseFunc,
+                                 Policy_Overwrite, &Node);
+}
+
+void *Binary_Tree_GetOrInsert(Binary_Tree_t *Tree, void *Key, size_t KeySize, void *Value,
+                              size_t ValueSize, ReleaseFunc_t *ValueReleaseFunc) {
+
+    Binary_Tree_Node_t *Node = NULL;
+
+    /*
+        Policy_Error leaves an existing item untouched, while still reporting the Node
+        which holds it.
+    */
+    if ( 0 < Binary_Tree_insertKey(Tree, Key, KeySize, Value, ValueSize, ValueReleaseFunc,
+                                   Policy_Error, &Node) ) {
 #ifdef DEBUG
-        DEBUG_PRINTF("%s", "Error: Failed to insert new Binary_Tree_Node_t");
+        DEBUG_PRINTF("%s", "Error: Failed to find or insert Key into Tree.");
 #endif
-        Binary_Tree_Node_Release(NewNode);
-        return 1;
+        return NULL;
     }
 
-    Tree->Root = NewRoot;
-    Tree->TreeSize += (1 && IncrementSize);
-    return 0;
+    return Node->Value.ValueRaw;
 }
 
 bool Binary_Tree_KeyExists(Binary_Tree_t *Tree, void *Key, size_t KeySize) {
@@ -249,6 +278,7 @@ Binary_Tree_KeyValuePair_t Binary_Tree_Pop(Binary_Tree_t *Tree, void *Key, size_
 
     Binary_Tree_Node_t *       Node         = NULL;
     Binary_Tree_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    bool                       KeyShared = false, ValueShared = false, KeyCopied = false;
 
     if ( NULL == Tree ) {
 #ifdef DEBUG
@@ -266,7 +296,13 @@ Binary_Tree_KeyValuePair_t Binary_Tree_Pop(Binary_Tree_t *Tree, void *Key, size_
 
     Iterator_Invalidate(&(Tree->Iterator));
 
-    Node = Binary_Tree_find(Tree->Root, Key, KeySize, Tree->KeyCompareFunc);
+    if ( 0 != Binary_Tree_ownPath(Tree, Key, KeySize, &Node) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to copy Binary_Tree_Node_t shared with a Snapshot.");
+#endif
+        return KeyValuePair;
+    }
+
     if ( NULL == Node ) {
 #ifdef DEBUG
         DEBUG_PRINTF("%s", "Error: Failed to find Key in Tree.");
@@ -274,12 +310,58 @@ Binary_Tree_KeyValuePair_t Binary_Tree_Pop(Binary_Tree_t *Tree, void *Key, size_
         return KeyValuePair;
     }
 
-    KeyValuePair.Key       = Node->Key.KeyRaw;
-    KeyValuePair.Value     = Node->Value.ValueRaw;
+    /*
+        A Key or Value still shared with a Snapshot stays behind for it, so the caller is
+        handed a copy instead. Reference-types cannot be copied, so these cannot be popped.
+    */
+    KeyShared   = (NULL != Node->KeyShares) && (1 < *(Node->KeyShares));
+    ValueShared = (NULL != Node->ValueShares) && (1 < *(Node->ValueShares));
+    if ( (KeyShared && (0 == Node->KeySize)) || (ValueShared && (0 == Node->ValueSize)) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Cannot pop a Reference-Type item still held by a Snapshot.");
+#endif
+        return KeyValuePair;
+    }
+
+    KeyValuePair.Key   = Node->Key.KeyRaw;
+    KeyValuePair.Value = Node->Value.ValueRaw;
+
+    /* An inline Key is recycled along with its Node, so the caller is handed a copy. */
+    if ( BINARY_TREE_NODE_KEY_IS_INLINE(Node) || KeyShared ) {
+        KeyValuePair.Key = malloc(Node->KeySize);
+        if ( NULL == KeyValuePair.Key ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to allocate memory to return popped Key.");
+#endif
+            KeyValuePair.Value = NULL;
+            return KeyValuePair;
+        }
+        memcpy(KeyValuePair.Key, Node->Key.KeyRaw, Node->KeySize);
+        KeyCopied = true;
+    }
+
+    if ( ValueShared ) {
+        KeyValuePair.Value = malloc(Node->ValueSize);
+        if ( NULL == KeyValuePair.Value ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to allocate memory to return popped Value.");
+#endif
+            if ( KeyCopied ) {
+                free(KeyValuePair.Key);
+            }
+            KeyValuePair.Key = NULL;
+            return KeyValuePair;
+        }
+        memcpy(KeyValuePair.Value, Node->Value.ValueRaw, Node->ValueSize);
+    }
+
+    /* With nothing left to release, this only drops the shares held by the Node. */
     Node->KeyReleaseFunc   = NULL;
     Node->ValueReleaseFunc = NULL;
+    Binary_Tree_Node_releaseKey(Node);
+    Binary_Tree_Node_releaseValue(Node);
 
-    Tree->Root = Binary_Tree_removeNode(Tree->Root, Key, KeySize, Tree->KeyCompareFunc);
+    Tree->Root = Binary_Tree_removeNode(Tree, Tree->Root, Key, KeySize);
 
 #ifdef DEBUG
     DEBUG_PRINTF("%s", "Successfully removed requested item from Tree.");
@@ -290,7 +372,7 @@ Binary_Tree_KeyValuePair_t Binary_Tree_Pop(Binary_Tree_t *Tree, void *Key, size_
 
 int Binary_Tree_Remove(Binary_Tree_t *Tree, void *Key, size_t KeySize) {
 
-    bool DecrementSize = false;
+    Binary_Tree_Node_t *Node = NULL;
 
     if ( NULL == Tree ) {
 #ifdef DEBUG
@@ -308,14 +390,21 @@ int Binary_Tree_Remove(Binary_Tree_t *Tree, void *Key, size_t KeySize) {
 
     Iterator_Invalidate(&(Tree->Iterator));
 
-    DecrementSize = Binary_Tree_KeyExists(Tree, Key, KeySize);
+    if ( 0 != Binary_Tree_ownPath(Tree, Key, KeySize, &Node) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to copy Binary_Tree_Node_t shared with a Snapshot.");
+#endif
+        return 1;
+    }
 
-    Tree->Root = Binary_Tree_removeNode(Tree->Root, Key, KeySize, Tree->KeyCompareFunc);
+    if ( NULL != Node ) {
+        Tree->Root = Binary_Tree_removeNode(Tree, Tree->Root, Key, KeySize);
+        Tree->TreeSize -= 1;
+    }
 
 #ifdef DEBUG
     DEBUG_PRINTF("%s", "Successfully removed requested item from Tree.");
 #endif
-    Tree->TreeSize -= (1 && DecrementSize);
     return 0;
 }
 
@@ -323,6 +412,7 @@ int Binary_Tree_DoCallback(Binary_Tree_t *Tree, Binary_Tree_Direction_t Directio
                            CallbackFunc_t *Callback) {
 
     Binary_Tree_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    Binary_Tree_Node_t *       Node         = NULL;
     int                        RetVal       = 0;
 
     if ( NULL == Tree ) {
@@ -357,7 +447,14 @@ int Binary_Tree_DoCallback(Binary_Tree_t *Tree, Binary_Tree_Direction_t Directio
             return -1;
     }
 
-    BINARY_TREE_FOREACH(Tree, KeyValuePair, Direction) {
+    /*
+        The walk steps between Nodes directly through their Parent pointers, leaving
+        the Iterator of the Tree alone and allocating nothing.
+    */
+    for ( Node = Binary_Tree_firstNode(Tree->Root, Direction, true); NULL != Node;
+          Node = Binary_Tree_nextNode(Node, Direction) ) {
+        KeyValuePair.Key   = Node->Key.KeyRaw;
+        KeyValuePair.Value = Node->Value.ValueRaw;
         if ( 0 != Callback(&(KeyValuePair)) ) {
 #ifdef DEBUG
             DEBUG_PRINTF("%s", "Warning: Callback function returned non-zero.");
@@ -373,6 +470,7 @@ int Binary_Tree_DoCallbackArg(Binary_Tree_t *Tree, Binary_Tree_Direction_t Direc
                               CallbackArgFunc_t *Callback, void *Args) {
 
     Binary_Tree_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    Binary_Tree_Node_t *       Node         = NULL;
     int                        RetVal       = 0;
 
     if ( NULL == Tree ) {
@@ -407,7 +505,83 @@ int Binary_Tree_DoCallbackArg(Binary_Tree_t *Tree, Binary_Tree_Direction_t Direc
             return -1;
     }
 
-    BINARY_TREE_FOREACH(Tree, KeyValuePair, Direction) {
+    /*
+        The walk steps between Nodes directly through their Parent pointers, leaving
+        the Iterator of the Tree alone and allocating nothing.
+    */
+    for ( Node = Binary_Tree_firstNode(Tree->Root, Direction, true); NULL != Node;
+          Node = Binary_Tree_nextNode(Node, Direction) ) {
+        KeyValuePair.Key   = Node->Key.KeyRaw;
+        KeyValuePair.Value = Node->Value.ValueRaw;
+        if ( 0 != Callback(&(KeyValuePair), Args) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Warning: Callback function returned non-zero.");
+#endif
+            RetVal += 1;
+        }
+    }
+
+    return RetVal;
+}
+
+Binary_Tree_KeyValuePair_t Binary_Tree_LowerBound(Binary_Tree_t *Tree, void *Key, size_t KeySize) {
+    return Binary_Tree_bound(Tree, Key, KeySize, true, true);
+}
+
+Binary_Tree_KeyValuePair_t Binary_Tree_UpperBound(Binary_Tree_t *Tree, void *Key, size_t KeySize) {
+    return Binary_Tree_bound(Tree, Key, KeySize, true, false);
+}
+
+Binary_Tree_KeyValuePair_t Binary_Tree_Floor(Binary_Tree_t *Tree, void *Key, size_t KeySize) {
+    return Binary_Tree_bound(Tree, Key, KeySize, false, true);
+}
+
+int Binary_Tree_RangeCallback(Binary_Tree_t *Tree, void *Lo, size_t LoSize, void *Hi,
+                              size_t HiSize, CallbackArgFunc_t *Callback, void *Args) {
+
+    Binary_Tree_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    Binary_Tree_Node_t *       Node         = NULL;
+    size_t                     MinKeySize   = 0;
+    int                        RetVal       = 0;
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Tree* provided.");
+#endif
+        return -1;
+    }
+
+    if ( NULL == Callback ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: NULL Callback* provided, nothing to call.");
+#endif
+        return 0;
+    }
+
+    if ( (0 == LoSize) && (0 != Tree->KeySize) ) {
+        LoSize = Tree->KeySize;
+    }
+
+    if ( (0 == HiSize) && (0 != Tree->KeySize) ) {
+        HiSize = Tree->KeySize;
+    }
+
+    if ( NULL == Lo ) {
+        Node = (NULL == Tree->Root) ? NULL : Binary_Tree_findMinimum(Tree->Root);
+    } else {
+        Node = Binary_Tree_seek(Tree->Root, Lo, LoSize, Tree->KeyCompareFunc, true, true);
+    }
+
+    for ( ; NULL != Node; Node = Binary_Tree_inOrderNext(Node) ) {
+        if ( NULL != Hi ) {
+            MinKeySize = (Node->KeySize > HiSize) ? HiSize : Node->KeySize;
+            if ( Tree->KeyCompareFunc(Node->Key.KeyRaw, Hi, MinKeySize) >= 0 ) {
+                break;
+            }
+        }
+
+        KeyValuePair.Key   = Node->Key.KeyRaw;
+        KeyValuePair.Value = Node->Value.ValueRaw;
         if ( 0 != Callback(&(KeyValuePair), Args) ) {
 #ifdef DEBUG
             DEBUG_PRINTF("%s", "Warning: Callback function returned non-zero.");
@@ -419,6 +593,83 @@ int Binary_Tree_DoCallbackArg(Binary_Tree_t *Tree, Binary_Tree_Direction_t Direc
     return RetVal;
 }
 
+size_t Binary_Tree_Rank(Binary_Tree_t *Tree, void *Key, size_t KeySize) {
+
+    Binary_Tree_Node_t *Node          = NULL;
+    size_t              Rank          = 0;
+    size_t              MinKeySize    = 0;
+    int                 CompareResult = 0;
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Tree* provided, cannot rank Key.");
+#endif
+        return 0;
+    }
+
+    if ( (0 == KeySize) && (0 != Tree->KeySize) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Note: Using cached KeySize of [ %lu ].", (unsigned long)Tree->KeySize);
+#endif
+        KeySize = Tree->KeySize;
+    }
+
+    /* Every time the descent goes right, the Node and its whole left subtree are below Key. */
+    for ( Node = Tree->Root; NULL != Node; ) {
+        MinKeySize    = (Node->KeySize > KeySize) ? KeySize : Node->KeySize;
+        CompareResult = Tree->KeyCompareFunc(Node->Key.KeyRaw, Key, MinKeySize);
+        if ( CompareResult < 0 ) {
+            Rank += 1 + Binary_Tree_Node_Size(Node->LeftChild);
+            Node = Node->RightChild;
+        } else if ( CompareResult > 0 ) {
+            Node = Node->LeftChild;
+        } else {
+            Rank += Binary_Tree_Node_Size(Node->LeftChild);
+            break;
+        }
+    }
+
+    return Rank;
+}
+
+Binary_Tree_KeyValuePair_t Binary_Tree_Select(Binary_Tree_t *Tree, size_t Index) {
+
+    Binary_Tree_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    Binary_Tree_Node_t *       Node         = NULL;
+    size_t                     LeftSize     = 0;
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Tree* provided, cannot select item.");
+#endif
+        return KeyValuePair;
+    }
+
+    if ( Index >= Tree->TreeSize ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Error: Index [ %lu ] is out of range for Tree of Length [ %lu ].",
+                     (unsigned long)Index, (unsigned long)Tree->TreeSize);
+#endif
+        return KeyValuePair;
+    }
+
+    for ( Node = Tree->Root; NULL != Node; ) {
+        LeftSize = Binary_Tree_Node_Size(Node->LeftChild);
+        if ( Index < LeftSize ) {
+            Node = Node->LeftChild;
+        } else if ( Index > LeftSize ) {
+            Index -= LeftSize + 1;
+            Node = Node->RightChild;
+        } else {
+            KeyValuePair.Key   = Node->Key.KeyRaw;
+            KeyValuePair.Value = Node->Value.ValueRaw;
+            break;
+        }
+    }
+
+    return KeyValuePair;
+}
+
 int Binary_Tree_Clear(Binary_Tree_t *Tree) {
 
     if ( NULL == Tree ) {
@@ -430,7 +681,16 @@ int Binary_Tree_Clear(Binary_Tree_t *Tree) {
 
     Iterator_Invalidate(&(Tree->Iterator));
 
-    Binary_Tree_Node_Release(Tree->Root);
+    /*
+        Every Node lives in the Pool, so only the Keys and Values need releasing one at a time.
+        While a Snapshot still holds the Pool, the Nodes it shares must be left in place.
+    */
+    if ( 1 == Tree->NodePool->References ) {
+        Binary_Tree_Node_ReleaseEntries(Tree->Root);
+        Pool_Reset(Tree->NodePool);
+    } else {
+        Binary_Tree_Node_Release(Tree->Root);
+    }
     Tree->Root     = NULL;
     Tree->TreeSize = 0;
 
@@ -449,7 +709,14 @@ void Binary_Tree_Release(Binary_Tree_t *Tree) {
         return;
     }
 
-    Binary_Tree_Node_Release(Tree->Root);
+    Iterator_Invalidate(&(Tree->Iterator));
+
+    if ( 1 == Tree->NodePool->References ) {
+        Binary_Tree_Node_ReleaseEntries(Tree->Root);
+    } else {
+        Binary_Tree_Node_Release(Tree->Root);
+    }
+    Pool_Release(Tree->NodePool);
 
     ZERO_CONTAINER(Tree, Binary_Tree_t);
     free(Tree);
@@ -460,73 +727,448 @@ void Binary_Tree_Release(Binary_Tree_t *Tree) {
     return;
 }
 
-/* ++++++++++ Private Functions ++++++++++ */
-
-Binary_Tree_Node_t *Binary_Tree_insertNode(Binary_Tree_Node_t *Root, CompareFunc_t *KeyCompareFunc,
-                                           Binary_Tree_Node_t *Node) {
+Binary_Tree_Snapshot_t *Binary_Tree_Snapshot(Binary_Tree_t *Tree) {
 
-    size_t MinKeySize    = 0;
-    int    CompareResult = 0;
+    Binary_Tree_Snapshot_t *Snapshot = NULL;
 
-    if ( NULL == Root ) {
-        return Node;
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Tree* provided, cannot take Snapshot.");
+#endif
+        return NULL;
     }
 
-    MinKeySize    = (Root->KeySize > Node->KeySize) ? Node->KeySize : Root->KeySize;
-    CompareResult = KeyCompareFunc(Root->Key.KeyRaw, Node->Key.KeyRaw, MinKeySize);
+    Snapshot = (Binary_Tree_Snapshot_t *)calloc(1, sizeof(Binary_Tree_Snapshot_t));
+    if ( NULL == Snapshot ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Binary_Tree_Snapshot_t.");
+#endif
+        return NULL;
+    }
 
-    if ( CompareResult > 0 ) {
-        Root->LeftChild         = Binary_Tree_insertNode(Root->LeftChild, KeyCompareFunc, Node);
-        Root->LeftChild->Parent = Root;
-    } else if ( CompareResult < 0 ) {
-        Root->RightChild         = Binary_Tree_insertNode(Root->RightChild, KeyCompareFunc, Node);
-        Root->RightChild->Parent = Root;
-    } else {
-        Binary_Tree_Node_UpdateValue(Root, Node->Value.ValueRaw, Node->ValueSize);
-        Binary_Tree_Node_Release(Node);
+    /*
+        Sharing the Root shares the whole Tree. From here on, the Tree copies each
+        shared Node it needs to modify, leaving the original to the Snapshot.
+    */
+    Snapshot->Root = Tree->Root;
+    if ( NULL != Snapshot->Root ) {
+        Snapshot->Root->RefCount++;
     }
 
-    return Binary_Tree_rebalance(Root);
-}
+    Snapshot->KeyCompareFunc = Tree->KeyCompareFunc;
+    Snapshot->KeySize        = Tree->KeySize;
+    Snapshot->TreeSize       = Tree->TreeSize;
+    Snapshot->NodePool       = Pool_Retain(Tree->NodePool);
 
-Binary_Tree_Node_t *Binary_Tree_removeNode(Binary_Tree_Node_t *Root, void *Key, size_t KeySize,
-                                           CompareFunc_t *KeyCompareFunc) {
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully took Snapshot of Binary_Tree_t.");
+#endif
+    return Snapshot;
+}
 
-    Binary_Tree_Node_t *Parent = NULL, *Child = NULL, *Successor = NULL;
-    size_t              MinKeySize;
-    int                 CompareResult;
+size_t Binary_Tree_Snapshot_Length(Binary_Tree_Snapshot_t *Snapshot) {
 
-    if ( NULL == Root ) {
+    if ( NULL == Snapshot ) {
 #ifdef DEBUG
-        DEBUG_PRINTF("%s", "Error: NULL Node* provided.");
+        DEBUG_PRINTF("%s", "Error: NULL Snapshot* provided.");
 #endif
-        return NULL;
+        return 0;
     }
 
-    MinKeySize    = (Root->KeySize > KeySize) ? KeySize : Root->KeySize;
-    CompareResult = KeyCompareFunc(Root->Key.KeyRaw, Key, MinKeySize);
+    return Snapshot->TreeSize;
+}
 
-    if ( CompareResult > 0 ) {
-        Root->LeftChild = Binary_Tree_removeNode(Root->LeftChild, Key, KeySize, KeyCompareFunc);
-    } else if ( CompareResult < 0 ) {
-        Root->RightChild = Binary_Tree_removeNode(Root->RightChild, Key, KeySize, KeyCompareFunc);
-    } else {
+bool Binary_Tree_Snapshot_KeyExists(Binary_Tree_Snapshot_t *Snapshot, void *Key, size_t KeySize) {
 
-        Parent = Root->Parent;
-        if ( (NULL != Root->LeftChild) && (NULL != Root->RightChild) ) {
-            /*
+    if ( NULL == Snapshot ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Snapshot* provided.");
+#endif
+        return false;
+    }
+
+    if ( (0 == KeySize) && (0 != Snapshot->KeySize) ) {
+        KeySize = Snapshot->KeySize;
+    }
+
+    return (NULL != Binary_Tree_find(Snapshot->Root, Key, KeySize, Snapshot->KeyCompareFunc));
+}
+
+void *Binary_Tree_Snapshot_Get(Binary_Tree_Snapshot_t *Snapshot, void *Key, size_t KeySize) {
+
+    Binary_Tree_Node_t *Node = NULL;
+
+    if ( NULL == Snapshot ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Snapshot* provided.");
+#endif
+        return NULL;
+    }
+
+    if ( (0 == KeySize) && (0 != Snapshot->KeySize) ) {
+        KeySize = Snapshot->KeySize;
+    }
+
+    Node = Binary_Tree_find(Snapshot->Root, Key, KeySize, Snapshot->KeyCompareFunc);
+    if ( NULL == Node ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to find Key in Snapshot.");
+#endif
+        return NULL;
+    }
+
+    return Node->Value.ValueRaw;
+}
+
+int Binary_Tree_Snapshot_DoCallbackArg(Binary_Tree_Snapshot_t *Snapshot,
+                                       CallbackArgFunc_t *Callback, void *Args) {
+
+    Binary_Tree_Node_t **      Stack        = NULL;
+    Binary_Tree_Node_t *       Node         = NULL;
+    Binary_Tree_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    size_t                     Depth        = 0;
+    int                        RetVal       = 0;
+
+    if ( NULL == Snapshot ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Snapshot* provided.");
+#endif
+        return -1;
+    }
+
+    if ( (NULL == Snapshot->Root) || (NULL == Callback) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: Snapshot is empty or NULL Callback* provided, nothing to call.");
+#endif
+        return 0;
+    }
+
+    /*
+        The Parent pointers of shared Nodes follow the Tree rather than the Snapshot,
+        so the walk keeps its own stack, which never holds more than a full path.
+    */
+    Stack = (Binary_Tree_Node_t **)calloc(Snapshot->Root->Height, sizeof(Binary_Tree_Node_t *));
+    if ( NULL == Stack ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Snapshot traversal.");
+#endif
+        return -1;
+    }
+
+    for ( Node = Snapshot->Root; (NULL != Node) || (0 != Depth); Node = Node->RightChild ) {
+        for ( ; NULL != Node; Node = Node->LeftChild ) { Stack[Depth++] = Node; }
+        Node = Stack[--Depth];
+
+        KeyValuePair.Key   = Node->Key.KeyRaw;
+        KeyValuePair.Value = Node->Value.ValueRaw;
+        if ( 0 != Callback(&(KeyValuePair), Args) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Warning: Callback function returned non-zero.");
+#endif
+            RetVal += 1;
+        }
+    }
+
+    free(Stack);
+    return RetVal;
+}
+
+void Binary_Tree_Snapshot_Release(Binary_Tree_Snapshot_t *Snapshot) {
+
+    if ( NULL == Snapshot ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Warning: NULL Snapshot* provided, nothing to release.");
+#endif
+        return;
+    }
+
+    /* Only the Nodes no longer shared with the Tree, or another Snapshot, are released. */
+    Binary_Tree_Node_Release(Snapshot->Root);
+    Pool_Release(Snapshot->NodePool);
+
+    ZERO_CONTAINER(Snapshot, Binary_Tree_Snapshot_t);
+    free(Snapshot);
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully released Binary_Tree_Snapshot_t.");
+#endif
+    return;
+}
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+int Binary_Tree_insertKey(Binary_Tree_t *Tree, void *Key, size_t KeySize, void *Value,
+                          size_t ValueSize, ReleaseFunc_t *ValueReleaseFunc,
+                          Binary_Tree_DuplicatePolicy_t Policy, Binary_Tree_Node_t **Node) {
+
+    Binary_Tree_Node_t *Current = NULL, *Parent = NULL, *NewNode = NULL;
+    size_t              MinKeySize    = 0;
+    int                 CompareResult = 0;
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Tree* provided, cannot insert new value.");
+#endif
+        return 1;
+    }
+
+    if ( NULL == Key ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Key* Provided.");
+#endif
+        return 1;
+    }
+
+    if ( 0 == KeySize ) {
+        if ( 0 != Tree->KeySize ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("Note: KeySize of 0 provided, using cached value from tree initialization "
+                         "of [ %lu ].",
+                         (unsigned long)Tree->KeySize);
+#endif
+            KeySize = Tree->KeySize;
+        } else {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Note: KeySize of 0 provided, treating as reference type.");
+#endif
+        }
+    }
+
+    if ( NULL != Value ) {
+        if ( 0 == ValueSize ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Note: ValueSize of 0 provided, treating as reference type.");
+#endif
+        }
+
+        if ( NULL == ValueReleaseFunc ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Note: NULL ValueReleaseFunc* provided, defaulting to free().");
+#endif
+            ValueReleaseFunc = free;
+        }
+    } else {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: NULL Value* provided, just inserting Key.");
+#endif
+    }
+
+    /*
+        Descend once from the Root, stopping either at the Node which already holds
+        this Key, or at the empty slot below Parent where the Key belongs. Any Node
+        on this path may be modified, so none of them may stay shared with a Snapshot.
+    */
+    for ( Current = Tree->Root; NULL != Current; ) {
+        Current = Binary_Tree_ownNode(Tree, Current);
+        if ( NULL == Current ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to copy Binary_Tree_Node_t shared with a Snapshot.");
+#endif
+            return 1;
+        }
+        MinKeySize    = (Current->KeySize > KeySize) ? KeySize : Current->KeySize;
+        CompareResult = Tree->KeyCompareFunc(Current->Key.KeyRaw, Key, MinKeySize);
+        if ( 0 == CompareResult ) {
+            break;
+        }
+        Parent  = Current;
+        Current = (CompareResult > 0) ? (Current->LeftChild) : (Current->RightChild);
+    }
+
+    if ( NULL != Current ) {
+        *Node = Current;
+        if ( Policy_Error == Policy ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Value with the given key already exists in the Tree!");
+#endif
+            return -1;
+        }
+
+        if ( 0 != Binary_Tree_Node_UpdateValue(Current, Value, ValueSize) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Error: Failed to update Value of existing Binary_Tree_Node_t.");
+#endif
+            return 1;
+        }
+        Current->ValueReleaseFunc = ValueReleaseFunc;
+        Iterator_Invalidate(&(Tree->Iterator));
+        return 0;
+    }
+
+    /* Otherwise, this is a new Key, and must be added to the tree as a new Node. */
+    NewNode = Binary_Tree_Node_Create(Tree->NodePool, Key, KeySize, Tree->KeyReleaseFunc, Value,
+                                      ValueSize, ValueReleaseFunc);
+    if ( NULL == NewNode ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to create new Binary_Tree_Node_t");
+#endif
+        return 1;
+    }
+
+    NewNode->Parent = Parent;
+    if ( NULL == Parent ) {
+        Tree->Root = NewNode;
+    } else if ( CompareResult > 0 ) {
+        Parent->LeftChild = NewNode;
+    } else {
+        Parent->RightChild = NewNode;
+    }
+
+    Binary_Tree_retrace(Tree, Parent);
+    Iterator_Invalidate(&(Tree->Iterator));
+
+    Tree->TreeSize++;
+    *Node = NewNode;
+    return 0;
+}
+
+int Binary_Tree_buildSubtree(Binary_Tree_t *Tree, void *Keys, void *Values, size_t ValueSize,
+                             ReleaseFunc_t *ValueReleaseFunc, size_t Start, size_t End,
+                             Binary_Tree_Node_t **Subtree) {
+
+    Binary_Tree_Node_t *Node   = NULL;
+    void *              Value  = NULL;
+    size_t              Middle = Start + ((End - Start) / 2);
+
+    *Subtree = NULL;
+    if ( Start >= End ) {
+        return 0;
+    }
+
+    if ( NULL != Values ) {
+        Value = (0 == ValueSize) ? ((void **)Values)[Middle]
+                                 : (void *)((uint8_t *)Values + (Middle * ValueSize));
+    }
+
+    Node = Binary_Tree_Node_Create(Tree->NodePool, (uint8_t *)Keys + (Middle * Tree->KeySize),
+                                   Tree->KeySize, Tree->KeyReleaseFunc, Value, ValueSize,
+                                   ValueReleaseFunc);
+    if ( NULL == Node ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to create new Binary_Tree_Node_t");
+#endif
+        return 1;
+    }
+
+    /*
+        Splitting each range at its middle leaves the two halves differing in size by
+        at most one, so every Node is balanced and no rotations are ever needed.
+    */
+    if ( (0 != Binary_Tree_buildSubtree(Tree, Keys, Values, ValueSize, ValueReleaseFunc, Start,
+                                        Middle, &(Node->LeftChild))) ||
+         (0 != Binary_Tree_buildSubtree(Tree, Keys, Values, ValueSize, ValueReleaseFunc,
+                                        Middle + 1, End, &(Node->RightChild))) ) {
+        Binary_Tree_Node_Release(Node);
+        return 1;
+    }
+
+    if ( NULL != Node->LeftChild ) {
+        Node->LeftChild->Parent = Node;
+    }
+    if ( NULL != Node->RightChild ) {
+        Node->RightChild->Parent = Node;
+    }
+    Binary_Tree_updateNode(Node);
+
+    *Subtree = Node;
+    return 0;
+}
+
+void Binary_Tree_retrace(Binary_Tree_t *Tree, Binary_Tree_Node_t *Node) {
+
+    Binary_Tree_Node_t *Parent = NULL, *Subtree = NULL;
+    size_t              OriginalHeight = 0;
+    bool                Balanced       = false;
+
+    for ( ; NULL != Node; Node = Parent ) {
+
+        Parent = Node->Parent;
+
+        /* Once a subtree keeps its original height, only the Sizes above it can change. */
+        if ( Balanced ) {
+            Binary_Tree_updateNode(Node);
+            continue;
+        }
+
+        OriginalHeight = Node->Height;
+        if ( 0 == Binary_Tree_ownRotation(Tree, Node) ) {
+            Subtree = Binary_Tree_rebalance(Node);
+        } else {
+            /* Without copies of the Nodes to rotate, the subtree is left valid, if unbalanced. */
+            Binary_Tree_updateNode(Node);
+            Subtree = Node;
+        }
+
+        if ( NULL == Parent ) {
+            Tree->Root = Subtree;
+        } else if ( Node == Parent->LeftChild ) {
+            Parent->LeftChild = Subtree;
+        } else {
+            Parent->RightChild = Subtree;
+        }
+
+        Balanced = (OriginalHeight == Subtree->Height);
+    }
+
+    return;
+}
+
+Binary_Tree_Node_t *Binary_Tree_removeNode(Binary_Tree_t *Tree, Binary_Tree_Node_t *Root, void *Key,
+                                           size_t KeySize) {
+
+    Binary_Tree_Node_t *Parent = NULL, *Child = NULL, *Successor = NULL;
+    size_t              MinKeySize;
+    int                 CompareResult;
+
+    if ( NULL == Root ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Node* provided.");
+#endif
+        return NULL;
+    }
+
+    MinKeySize    = (Root->KeySize > KeySize) ? KeySize : Root->KeySize;
+    CompareResult = Tree->KeyCompareFunc(Root->Key.KeyRaw, Key, MinKeySize);
+
+    if ( CompareResult > 0 ) {
+        Root->LeftChild = Binary_Tree_removeNode(Tree, Root->LeftChild, Key, KeySize);
+    } else if ( CompareResult < 0 ) {
+        Root->RightChild = Binary_Tree_removeNode(Tree, Root->RightChild, Key, KeySize);
+    } else {
+
+        Parent = Root->Parent;
+        if ( (NULL != Root->LeftChild) && (NULL != Root->RightChild) ) {
+            /*
                 The node has 2 children.
 
-                Replace the node with it's in-order successor, then remove the in-order successor
-                with a recursive call to this function.
+                Move the Key and Value of the in-order successor into the node, then remove the
+                in-order successor with a recursive call to this function. The successor keeps
+                its Key to be found by, but no longer releases (or shares) anything.
             */
             Successor = Binary_Tree_findMinimum(Root->RightChild);
-            Binary_Tree_Node_UpdateKey(Root, Successor->Key.KeyRaw, Successor->KeySize);
-            Binary_Tree_Node_UpdateValue(Root, Successor->Value.ValueRaw, Successor->ValueSize);
+            Binary_Tree_Node_releaseKey(Root);
+            Binary_Tree_Node_releaseValue(Root);
+
+            if ( BINARY_TREE_NODE_KEY_IS_INLINE(Successor) ) {
+                Root->Key.KeyBytes = (uint8_t *)(Root + 1);
+                memcpy(Root->Key.KeyBytes, Successor->Key.KeyBytes, Successor->KeySize);
+            } else {
+                Root->Key.KeyBytes = Successor->Key.KeyBytes;
+            }
+            Root->KeySize          = Successor->KeySize;
+            Root->KeyShares        = Successor->KeyShares;
             Root->KeyReleaseFunc   = Successor->KeyReleaseFunc;
+            Root->Value            = Successor->Value;
+            Root->ValueSize        = Successor->ValueSize;
+            Root->ValueShares      = Successor->ValueShares;
             Root->ValueReleaseFunc = Successor->ValueReleaseFunc;
-            Root->RightChild       = Binary_Tree_removeNode(Root->RightChild, Successor->Key.KeyRaw,
-                                                      Successor->KeySize, KeyCompareFunc);
+
+            Successor->KeyShares        = NULL;
+            Successor->ValueShares      = NULL;
+            Successor->KeyReleaseFunc   = NULL;
+            Successor->ValueReleaseFunc = NULL;
+            Root->RightChild =
+                Binary_Tree_removeNode(Tree, Root->RightChild, Root->Key.KeyRaw, Root->KeySize);
 
         } else if ( (NULL != Root->LeftChild) && (NULL == Root->RightChild) ) {
             /*
@@ -581,9 +1223,105 @@ Binary_Tree_Node_t *Binary_Tree_removeNode(Binary_Tree_Node_t *Root, void *Key,
         }
     }
 
+    if ( (NULL != Root) && (0 != Binary_Tree_ownRotation(Tree, Root)) ) {
+        /* Without copies of the Nodes to rotate, the subtree is left valid, if unbalanced. */
+        Binary_Tree_updateNode(Root);
+        return Root;
+    }
+
     return Binary_Tree_rebalance(Root);
 }
 
+Binary_Tree_Node_t *Binary_Tree_ownNode(Binary_Tree_t *Tree, Binary_Tree_Node_t *Node) {
+
+    Binary_Tree_Node_t *Copy = NULL, *Parent = NULL;
+
+    if ( (NULL == Node) || (1 == Node->RefCount) ) {
+        return Node;
+    }
+
+    Copy = Binary_Tree_Node_Copy(Node);
+    if ( NULL == Copy ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to copy Binary_Tree_Node_t shared with a Snapshot.");
+#endif
+        return NULL;
+    }
+
+    /* The original stays behind, still referenced by the Snapshots sharing it. */
+    Parent = Node->Parent;
+    if ( NULL == Parent ) {
+        Tree->Root = Copy;
+    } else if ( Node == Parent->LeftChild ) {
+        Parent->LeftChild = Copy;
+    } else {
+        Parent->RightChild = Copy;
+    }
+    Node->RefCount--;
+
+    return Copy;
+}
+
+int Binary_Tree_ownPath(Binary_Tree_t *Tree, void *Key, size_t KeySize, Binary_Tree_Node_t **Node) {
+
+    Binary_Tree_Node_t *Current       = NULL;
+    size_t              MinKeySize    = 0;
+    int                 CompareResult = 0;
+
+    *Node = NULL;
+    for ( Current = Tree->Root; NULL != Current; ) {
+        Current = Binary_Tree_ownNode(Tree, Current);
+        if ( NULL == Current ) {
+            return 1;
+        }
+        MinKeySize    = (Current->KeySize > KeySize) ? KeySize : Current->KeySize;
+        CompareResult = Tree->KeyCompareFunc(Current->Key.KeyRaw, Key, MinKeySize);
+        if ( 0 == CompareResult ) {
+            break;
+        }
+        Current = (CompareResult > 0) ? (Current->LeftChild) : (Current->RightChild);
+    }
+
+    if ( NULL == Current ) {
+        return 0;
+    }
+    *Node = Current;
+
+    if ( (NULL != Current->LeftChild) && (NULL != Current->RightChild) ) {
+        for ( Current = Current->RightChild; NULL != Current; Current = Current->LeftChild ) {
+            Current = Binary_Tree_ownNode(Tree, Current);
+            if ( NULL == Current ) {
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+int Binary_Tree_ownRotation(Binary_Tree_t *Tree, Binary_Tree_Node_t *Root) {
+
+    Binary_Tree_Node_t *Child         = NULL;
+    int                 BalanceFactor = Binary_Tree_balanceFactor(Root);
+
+    /* These mirror the choice of rotations made by Binary_Tree_rebalance(). */
+    if ( 2 <= BalanceFactor ) {
+        Child = Binary_Tree_ownNode(Tree, Root->RightChild);
+        if ( (NULL == Child) || ((0 > Binary_Tree_balanceFactor(Child)) &&
+                                 (NULL == Binary_Tree_ownNode(Tree, Child->LeftChild))) ) {
+            return 1;
+        }
+    } else if ( -2 >= BalanceFactor ) {
+        Child = Binary_Tree_ownNode(Tree, Root->LeftChild);
+        if ( (NULL == Child) || ((0 < Binary_Tree_balanceFactor(Child)) &&
+                                 (NULL == Binary_Tree_ownNode(Tree, Child->RightChild))) ) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
 Binary_Tree_Node_t *Binary_Tree_find(Binary_Tree_Node_t *Root, void *Key, size_t KeySize,
                                      CompareFunc_t *KeyCompareFunc) {
 
@@ -617,9 +1355,78 @@ Binary_Tree_Node_t *Binary_Tree_findMinimum(Binary_Tree_Node_t *Root) {
     return Root;
 }
 
+Binary_Tree_Node_t *Binary_Tree_seek(Binary_Tree_Node_t *Root, void *Key, size_t KeySize,
+                                     CompareFunc_t *KeyCompareFunc, bool Above, bool Inclusive) {
+
+    Binary_Tree_Node_t *Best          = NULL;
+    size_t              MinKeySize    = 0;
+    int                 CompareResult = 0;
+
+    while ( NULL != Root ) {
+        MinKeySize    = (Root->KeySize > KeySize) ? KeySize : Root->KeySize;
+        CompareResult = KeyCompareFunc(Root->Key.KeyRaw, Key, MinKeySize);
+
+        if ( (0 == CompareResult) && Inclusive ) {
+            return Root;
+        }
+
+        if ( Above ) {
+            if ( CompareResult > 0 ) {
+                Best = Root;
+                Root = Root->LeftChild;
+            } else {
+                Root = Root->RightChild;
+            }
+        } else {
+            if ( CompareResult < 0 ) {
+                Best = Root;
+                Root = Root->RightChild;
+            } else {
+                Root = Root->LeftChild;
+            }
+        }
+    }
+
+    return Best;
+}
+
+Binary_Tree_KeyValuePair_t Binary_Tree_bound(Binary_Tree_t *Tree, void *Key, size_t KeySize,
+                                             bool Above, bool Inclusive) {
+
+    Binary_Tree_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    Binary_Tree_Node_t *       Node         = NULL;
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Tree* provided, cannot search for Key.");
+#endif
+        return KeyValuePair;
+    }
+
+    if ( (0 == KeySize) && (0 != Tree->KeySize) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("Note: Using cached KeySize of [ %lu ].", (unsigned long)Tree->KeySize);
+#endif
+        KeySize = Tree->KeySize;
+    }
+
+    Node = Binary_Tree_seek(Tree->Root, Key, KeySize, Tree->KeyCompareFunc, Above, Inclusive);
+    if ( NULL == Node ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: No Key in the Tree satisfies the requested bound.");
+#endif
+        return KeyValuePair;
+    }
+
+    KeyValuePair.Key   = Node->Key.KeyRaw;
+    KeyValuePair.Value = Node->Value.ValueRaw;
+    return KeyValuePair;
+}
+
 bool Binary_Tree_isAVLTree(Binary_Tree_Node_t *Root) {
 
-    int BalanceFactor = 0;
+    int    BalanceFactor = 0;
+    size_t LeftHeight = 0, RightHeight = 0;
 
     if ( NULL == Root ) {
         return true;
@@ -631,6 +1438,19 @@ bool Binary_Tree_isAVLTree(Binary_Tree_Node_t *Root) {
         return false;
     }
 
+    /* The cached Height must agree with the Heights of the children. */
+    LeftHeight  = Binary_Tree_Node_Height(Root->LeftChild);
+    RightHeight = Binary_Tree_Node_Height(Root->RightChild);
+    if ( Root->Height != 1 + ((LeftHeight > RightHeight) ? (LeftHeight) : RightHeight) ) {
+        return false;
+    }
+
+    /* As must the cached Size with the Sizes of the children. */
+    if ( Root->Size != 1 + Binary_Tree_Node_Size(Root->LeftChild) +
+                           Binary_Tree_Node_Size(Root->RightChild) ) {
+        return false;
+    }
+
     return Binary_Tree_isAVLTree(Root->LeftChild) && Binary_Tree_isAVLTree(Root->RightChild);
 }
 
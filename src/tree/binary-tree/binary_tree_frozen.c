@@ -0,0 +1,322 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../logging/logging.h"
+#include "include/binary_tree_frozen.h"
+#include "include/binary_tree_iterator.h"
+
+Binary_Tree_Frozen_t *Binary_Tree_Freeze(Binary_Tree_t *Tree) {
+
+    Binary_Tree_Frozen_t *Frozen = NULL;
+    Binary_Tree_Node_t *  Node   = NULL;
+    size_t                Index = 0, KeySize = 0;
+
+    if ( NULL == Tree ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Tree* provided, nothing to freeze.");
+#endif
+        return NULL;
+    }
+
+    if ( 0 == Tree->KeySize ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Cannot freeze Binary_Tree_t of Reference-Type Keys.");
+#endif
+        return NULL;
+    }
+
+    Frozen = (Binary_Tree_Frozen_t *)calloc(1, sizeof(Binary_Tree_Frozen_t));
+    if ( NULL == Frozen ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Binary_Tree_Frozen_t.");
+#endif
+        return NULL;
+    }
+
+    Frozen->Count          = Tree->TreeSize;
+    Frozen->KeySize        = Tree->KeySize;
+    Frozen->KeyCompareFunc = Tree->KeyCompareFunc;
+    Frozen->Keys           = (uint8_t *)calloc(Frozen->Count + 1, Frozen->KeySize);
+    Frozen->Values         = (void **)calloc(Frozen->Count + 1, sizeof(void *));
+    Frozen->Snapshot       = Binary_Tree_Snapshot(Tree);
+    if ( (NULL == Frozen->Keys) || (NULL == Frozen->Values) || (NULL == Frozen->Snapshot) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Binary_Tree_Frozen_t contents.");
+#endif
+        Binary_Tree_FrozenRelease(Frozen);
+        return NULL;
+    }
+
+    /* Walking the Tree in order visits the Eytzinger slots in their own in-order sequence. */
+    Index = Binary_Tree_frozenFirst(Frozen);
+    Node  = (NULL == Tree->Root) ? NULL : Binary_Tree_findMinimum(Tree->Root);
+    for ( ; NULL != Node; Node = Binary_Tree_inOrderNext(Node) ) {
+        KeySize = (Node->KeySize < Frozen->KeySize) ? Node->KeySize : Frozen->KeySize;
+        memcpy(Frozen->Keys + (Index * Frozen->KeySize), Node->Key.KeyRaw, KeySize);
+        Frozen->Values[Index] = Node->Value.ValueRaw;
+        Index                 = Binary_Tree_frozenNext(Frozen, Index);
+    }
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully froze Binary_Tree_t.");
+#endif
+    return Frozen;
+}
+
+size_t Binary_Tree_FrozenLength(Binary_Tree_Frozen_t *Frozen) {
+
+    if ( NULL == Frozen ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Frozen* provided.");
+#endif
+        return 0;
+    }
+
+    return Frozen->Count;
+}
+
+bool Binary_Tree_FrozenKeyExists(Binary_Tree_Frozen_t *Frozen, void *Key, size_t KeySize) {
+
+    if ( (NULL == Frozen) || (NULL == Key) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Frozen* or Key* provided.");
+#endif
+        return false;
+    }
+
+    return (0 != Binary_Tree_frozenFind(Frozen, Key, KeySize));
+}
+
+void *Binary_Tree_FrozenGet(Binary_Tree_Frozen_t *Frozen, void *Key, size_t KeySize) {
+
+    size_t Index = 0;
+
+    if ( (NULL == Frozen) || (NULL == Key) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Frozen* or Key* provided.");
+#endif
+        return NULL;
+    }
+
+    Index = Binary_Tree_frozenFind(Frozen, Key, KeySize);
+    if ( 0 == Index ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to find Key in Frozen tree.");
+#endif
+        return NULL;
+    }
+
+    return Frozen->Values[Index];
+}
+
+Binary_Tree_KeyValuePair_t Binary_Tree_FrozenLowerBound(Binary_Tree_Frozen_t *Frozen, void *Key,
+                                                        size_t KeySize) {
+
+    Binary_Tree_KeyValuePair_t KeyValuePair = {NULL, NULL};
+
+    if ( (NULL == Frozen) || (NULL == Key) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Frozen* or Key* provided.");
+#endif
+        return KeyValuePair;
+    }
+
+    return Binary_Tree_frozenPair(Frozen, Binary_Tree_frozenSearch(Frozen, Key, KeySize, true));
+}
+
+Binary_Tree_KeyValuePair_t Binary_Tree_FrozenUpperBound(Binary_Tree_Frozen_t *Frozen, void *Key,
+                                                        size_t KeySize) {
+
+    Binary_Tree_KeyValuePair_t KeyValuePair = {NULL, NULL};
+
+    if ( (NULL == Frozen) || (NULL == Key) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Frozen* or Key* provided.");
+#endif
+        return KeyValuePair;
+    }
+
+    return Binary_Tree_frozenPair(Frozen, Binary_Tree_frozenSearch(Frozen, Key, KeySize, false));
+}
+
+int Binary_Tree_FrozenRangeCallback(Binary_Tree_Frozen_t *Frozen, void *Lo, size_t LoSize,
+                                    void *Hi, size_t HiSize, CallbackArgFunc_t *Callback,
+                                    void *Args) {
+
+    Binary_Tree_KeyValuePair_t KeyValuePair = {NULL, NULL};
+    size_t                     Index        = 0;
+    int                        RetVal       = 0;
+
+    if ( NULL == Frozen ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Frozen* provided.");
+#endif
+        return -1;
+    }
+
+    if ( NULL == Callback ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: NULL Callback* provided, nothing to call.");
+#endif
+        return 0;
+    }
+
+    if ( (0 == HiSize) || (HiSize > Frozen->KeySize) ) {
+        HiSize = Frozen->KeySize;
+    }
+
+    Index = (NULL == Lo) ? Binary_Tree_frozenFirst(Frozen)
+                         : Binary_Tree_frozenSearch(Frozen, Lo, LoSize, true);
+    for ( ; 0 != Index; Index = Binary_Tree_frozenNext(Frozen, Index) ) {
+        KeyValuePair = Binary_Tree_frozenPair(Frozen, Index);
+        if ( (NULL != Hi) && (0 <= Frozen->KeyCompareFunc(KeyValuePair.Key, Hi, HiSize)) ) {
+            break;
+        }
+
+        if ( 0 != Callback(&(KeyValuePair), Args) ) {
+#ifdef DEBUG
+            DEBUG_PRINTF("%s", "Warning: Callback function returned non-zero.");
+#endif
+            RetVal += 1;
+        }
+    }
+
+    return RetVal;
+}
+
+void Binary_Tree_FrozenRelease(Binary_Tree_Frozen_t *Frozen) {
+
+    if ( NULL == Frozen ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Warning: NULL Frozen* provided, nothing to release.");
+#endif
+        return;
+    }
+
+    free(Frozen->Keys);
+    free(Frozen->Values);
+    Binary_Tree_Snapshot_Release(Frozen->Snapshot);
+
+    ZERO_CONTAINER(Frozen, Binary_Tree_Frozen_t);
+    free(Frozen);
+
+#ifdef DEBUG
+    DEBUG_PRINTF("%s", "Successfully released Binary_Tree_Frozen_t.");
+#endif
+    return;
+}
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+size_t Binary_Tree_frozenSearch(Binary_Tree_Frozen_t *Frozen, void *Key, size_t KeySize,
+                                bool Inclusive) {
+
+    size_t Index = 1;
+    int    Bias  = (Inclusive) ? 0 : 1;
+
+    if ( (0 == KeySize) || (KeySize > Frozen->KeySize) ) {
+        KeySize = Frozen->KeySize;
+    }
+
+    /*
+        Each step moves to the left (2i) or right (2i + 1) child by adding the outcome
+        of the comparison, rather than branching on it. The sixteen Keys four levels
+        down are contiguous, so their cache lines are requested well ahead of use.
+    */
+    while ( Index <= Frozen->Count ) {
+        if ( (16 * Index) <= Frozen->Count ) {
+            BINARY_TREE_FROZEN_PREFETCH(Frozen->Keys + (16 * Index * Frozen->KeySize));
+        }
+        Index = (2 * Index) +
+                (size_t)(Frozen->KeyCompareFunc(Frozen->Keys + (Index * Frozen->KeySize), Key,
+                                                KeySize) < Bias);
+    }
+
+    /* The bound is where the search last went left, so undo the right turns after it. */
+    while ( 0 != (Index & 1) ) {
+        Index >>= 1;
+    }
+
+    return (Index >> 1);
+}
+
+size_t Binary_Tree_frozenFind(Binary_Tree_Frozen_t *Frozen, void *Key, size_t KeySize) {
+
+    size_t Index = Binary_Tree_frozenSearch(Frozen, Key, KeySize, true);
+
+    if ( (0 == KeySize) || (KeySize > Frozen->KeySize) ) {
+        KeySize = Frozen->KeySize;
+    }
+
+    if ( (0 == Index) ||
+         (0 != Frozen->KeyCompareFunc(Frozen->Keys + (Index * Frozen->KeySize), Key, KeySize)) ) {
+        return 0;
+    }
+
+    return Index;
+}
+
+size_t Binary_Tree_frozenFirst(Binary_Tree_Frozen_t *Frozen) {
+
+    size_t Index = 0;
+
+    if ( 0 == Frozen->Count ) {
+        return 0;
+    }
+
+    for ( Index = 1; (2 * Index) <= Frozen->Count; Index *= 2 ) { ; }
+
+    return Index;
+}
+
+size_t Binary_Tree_frozenNext(Binary_Tree_Frozen_t *Frozen, size_t Index) {
+
+    /* With a right subtree, the successor is its left-most Key. */
+    if ( ((2 * Index) + 1) <= Frozen->Count ) {
+        for ( Index = (2 * Index) + 1; (2 * Index) <= Frozen->Count; Index *= 2 ) { ; }
+        return Index;
+    }
+
+    /* Otherwise climb past every right child, to the Parent of the first left child. */
+    while ( 0 != (Index & 1) ) {
+        Index >>= 1;
+    }
+
+    return (Index >> 1);
+}
+
+Binary_Tree_KeyValuePair_t Binary_Tree_frozenPair(Binary_Tree_Frozen_t *Frozen, size_t Index) {
+
+    Binary_Tree_KeyValuePair_t KeyValuePair = {NULL, NULL};
+
+    if ( 0 != Index ) {
+        KeyValuePair.Key   = Frozen->Keys + (Index * Frozen->KeySize);
+        KeyValuePair.Value = Frozen->Values[Index];
+    }
+
+    return KeyValuePair;
+}
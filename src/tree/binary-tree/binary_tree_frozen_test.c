@@ -0,0 +1,200 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../logging/logging.h"
+#include "include/binary_tree_frozen.h"
+
+static int FrozenRangeCounter(void *KeyValuePair, void *Args) {
+
+    Binary_Tree_KeyValuePair_t Pair  = *(Binary_Tree_KeyValuePair_t *)KeyValuePair;
+    int *                      State = (int *)Args;
+
+    /* State holds { Count, Previous Key }, keys must arrive in ascending order. */
+    if ( (0 != State[0]) && (*(int *)Pair.Key <= State[1]) ) {
+        return 1;
+    }
+
+    State[0]++;
+    State[1] = *(int *)Pair.Key;
+
+    return 0;
+}
+
+int Test_binary_tree_frozen(void) {
+
+    int FailedTests = 0;
+
+    FailedTests += Test_Binary_Tree_Freeze();
+    FailedTests += Test_Binary_Tree_FrozenBounds();
+
+    return FailedTests;
+}
+
+int Test_Binary_Tree_Freeze(void) {
+
+    Binary_Tree_t *       Tree   = NULL;
+    Binary_Tree_Frozen_t *Frozen = NULL;
+    int                   Count = 0, i = 0, Key = 0, Value = 0, *Found = NULL;
+    int                   State[2] = {0, 0};
+
+    /* Cover an empty tree, complete trees, and partially filled last levels. */
+    for ( Count = 0; Count <= 130; Count += 13 ) {
+
+        Tree = Binary_Tree_Create(CompareFunc_Int_Ascending, sizeof(Key), NULL, Policy_Error);
+        if ( NULL == Tree ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to create Binary_Tree_t* for testing.");
+            TEST_FAILURE;
+        }
+
+        for ( i = 0; i < Count; i++ ) {
+            Key   = 2 * ((i * 37) % Count);
+            Value = Key + 1;
+            Binary_Tree_Insert(Tree, &Key, sizeof(Key), &Value, sizeof(Value), NULL);
+        }
+
+        Frozen = Binary_Tree_Freeze(Tree);
+        if ( (NULL == Frozen) || ((size_t)Count != Binary_Tree_FrozenLength(Frozen)) ) {
+            TEST_PRINTF("Test Failure - Failed to freeze Binary_Tree_t of (%d) items.", Count);
+            Binary_Tree_FrozenRelease(Frozen);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+
+        /* The Frozen copy is independent of the Tree, so both may change or go away. */
+        Binary_Tree_Clear(Tree);
+        Binary_Tree_Release(Tree);
+
+        for ( Key = -1; Key <= 2 * Count; Key++ ) {
+            Found = (int *)Binary_Tree_FrozenGet(Frozen, &Key, sizeof(Key));
+            if ( (0 == (Key % 2)) && (Key < 2 * Count) && (Key >= 0) ) {
+                if ( (NULL == Found) || ((Key + 1) != *Found) ) {
+                    TEST_PRINTF("Test Failure - Frozen tree lost Key (%d).", Key);
+                    Binary_Tree_FrozenRelease(Frozen);
+                    TEST_FAILURE;
+                }
+            } else if ( Binary_Tree_FrozenKeyExists(Frozen, &Key, sizeof(Key)) ) {
+                TEST_PRINTF("Test Failure - Frozen tree found missing Key (%d).", Key);
+                Binary_Tree_FrozenRelease(Frozen);
+                TEST_FAILURE;
+            }
+        }
+
+        State[0] = 0;
+        if ( (0 != Binary_Tree_FrozenRangeCallback(Frozen, NULL, 0, NULL, 0, FrozenRangeCounter,
+                                                    State)) ||
+             (Count != State[0]) ) {
+            TEST_PRINTF("Test Failure - Frozen tree of (%d) items did not scan in order.", Count);
+            Binary_Tree_FrozenRelease(Frozen);
+            TEST_FAILURE;
+        }
+
+        Binary_Tree_FrozenRelease(Frozen);
+    }
+
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Tree_FrozenBounds(void) {
+
+    Binary_Tree_t *            Tree   = NULL;
+    Binary_Tree_Frozen_t *     Frozen = NULL;
+    Binary_Tree_KeyValuePair_t Expected = {NULL, NULL}, Actual = {NULL, NULL};
+    int                        Count = 100, i = 0, Key = 0, Lo = 0, Hi = 0;
+    int                        State[2] = {0, 0};
+
+    Tree = Binary_Tree_Create(CompareFunc_Int_Ascending, sizeof(Key), NULL, Policy_Error);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Binary_Tree_t* for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        Key = 3 * i;
+        Binary_Tree_Insert(Tree, &Key, sizeof(Key), NULL, 0, NULL);
+    }
+
+    Frozen = Binary_Tree_Freeze(Tree);
+    if ( NULL == Frozen ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to freeze Binary_Tree_t.");
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    /* Every bound must agree with the same seek on the Tree it was frozen from. */
+    for ( Key = -2; Key <= 3 * Count; Key++ ) {
+        Expected = Binary_Tree_LowerBound(Tree, &Key, sizeof(Key));
+        Actual   = Binary_Tree_FrozenLowerBound(Frozen, &Key, sizeof(Key));
+        if ( (NULL == Expected.Key) != (NULL == Actual.Key) ||
+             ((NULL != Actual.Key) && (*(int *)Expected.Key != *(int *)Actual.Key)) ) {
+            TEST_PRINTF("Test Failure - Frozen LowerBound of (%d) does not match the Tree.", Key);
+            Binary_Tree_FrozenRelease(Frozen);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+
+        Expected = Binary_Tree_UpperBound(Tree, &Key, sizeof(Key));
+        Actual   = Binary_Tree_FrozenUpperBound(Frozen, &Key, sizeof(Key));
+        if ( (NULL == Expected.Key) != (NULL == Actual.Key) ||
+             ((NULL != Actual.Key) && (*(int *)Expected.Key != *(int *)Actual.Key)) ) {
+            TEST_PRINTF("Test Failure - Frozen UpperBound of (%d) does not match the Tree.", Key);
+            Binary_Tree_FrozenRelease(Frozen);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( Lo = -3; Lo <= 3 * Count; Lo += 7 ) {
+        for ( Hi = Lo; Hi <= 3 * Count + 3; Hi += 11 ) {
+            State[0] = 0;
+            if ( 0 != Binary_Tree_FrozenRangeCallback(Frozen, &Lo, sizeof(Lo), &Hi, sizeof(Hi),
+                                                       FrozenRangeCounter, State) ) {
+                TEST_PRINTF("Test Failure - Range [ %d, %d ) visited an out of order item.", Lo,
+                            Hi);
+                Binary_Tree_FrozenRelease(Frozen);
+                Binary_Tree_Release(Tree);
+                TEST_FAILURE;
+            }
+
+            /* The multiples of 3 in [ Lo, Hi ), clamped to the Keys present. */
+            Key = 0;
+            for ( i = 0; i < Count; i++ ) {
+                Key += ((3 * i) >= Lo) && ((3 * i) < Hi);
+            }
+            if ( Key != State[0] ) {
+                TEST_PRINTF("Test Failure - Range [ %d, %d ) visited (%d) items, expected (%d).",
+                            Lo, Hi, State[0], Key);
+                Binary_Tree_FrozenRelease(Frozen);
+                Binary_Tree_Release(Tree);
+                TEST_FAILURE;
+            }
+        }
+    }
+
+    Binary_Tree_FrozenRelease(Frozen);
+    Binary_Tree_Release(Tree);
+    TEST_SUCCESSFUL;
+}
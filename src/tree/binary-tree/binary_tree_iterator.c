@@ -55,39 +55,13 @@ int Iterator_Initialize_Binary_Tree(Binary_Tree_t *Tree, Binary_Tree_Direction_t
         return 1;
     }
 
-    Node = Tree->Root;
-    switch ( Direction ) {
-        case Direction_InOrder:
-            if ( Forward ) {
-                for ( ; NULL != Node->LeftChild; Node = Node->LeftChild ) { ; }
-            } else {
-                for ( ; NULL != Node->RightChild; Node = Node->RightChild ) { ; }
-            }
-            break;
-        case Direction_PreOrder:
-            if ( !Forward ) {
-                for ( ; NULL != Node->RightChild; Node = Node->RightChild ) { ; }
-            }
-            break;
-        case Direction_PostOrder:
-            if ( Forward ) {
-                Node = Binary_Tree_leftmostLeaf(Tree->Root);
-                if ( NULL == Node ) {
-#ifdef DEBUG
-                    DEBUG_PRINTF(
-                        "%s",
-                        "Error: Failed to find Left-most leaf of Binary Tree to start Iterator.");
-#endif
-                    free(Iterator);
-                    return 1;
-                }
-            }
-            break;
-        default:
+    Node = Binary_Tree_firstNode(Tree->Root, Direction, Forward);
+    if ( NULL == Node ) {
 #ifdef DEBUG
-            DEBUG_PRINTF("%s", "Error: Unknown traversal direction specified.");
+        DEBUG_PRINTF("%s", "Error: Failed to find the first Node of the Tree to start Iterator.");
 #endif
-            return 1;
+        free(Iterator);
+        return 1;
     }
 
     Iterator->Context        = Node;
@@ -248,7 +222,11 @@ Binary_Tree_Node_t *Binary_Tree_preOrderNext(Binary_Tree_Node_t *Current) {
         return Current->RightChild;
     }
 
-    while ( NODE_IS_RIGHT_CHILD(Current) ) { Current = Current->Parent; }
+    /* Climb to the nearest Node entered from its left which still has a right sub-tree to visit. */
+    while ( (NULL != Current->Parent) &&
+            (NODE_IS_RIGHT_CHILD(Current) || (NULL == Current->Parent->RightChild)) ) {
+        Current = Current->Parent;
+    }
 
     if ( NULL == Current->Parent ) {
         return NULL;
@@ -315,9 +293,12 @@ Binary_Tree_Node_t *Binary_Tree_preOrderPrevious(Binary_Tree_Node_t *Current) {
         return NULL;
     }
 
+    /* The last Node of the left sibling's sub-tree, preferring right over left on the way down. */
     if ( (!NODE_IS_LEFT_CHILD(Current)) && (NULL != Current->Parent->LeftChild) ) {
         Current = Current->Parent->LeftChild;
-        for ( ; NULL != Current->RightChild; Current = Current->RightChild ) { ; }
+        while ( (NULL != Current->LeftChild) || (NULL != Current->RightChild) ) {
+            Current = (NULL != Current->RightChild) ? Current->RightChild : Current->LeftChild;
+        }
         return Current;
     }
 
@@ -339,14 +320,10 @@ Binary_Tree_Node_t *Binary_Tree_postOrderPrevious(Binary_Tree_Node_t *Current) {
         return Current->LeftChild;
     }
 
-    if ( !NODE_IS_LEFT_CHILD(Current) && (NULL != Current->Parent->LeftChild) ) {
-        return Current->Parent->LeftChild;
-    }
-
+    /* Climb to the nearest right child with a left sibling, which is visited just before it. */
     while ( NULL != Current->Parent ) {
-        if ( NODE_IS_RIGHT_CHILD(Current->Parent) && (NULL != Current->Parent->Parent) &&
-             (NULL != Current->Parent->Parent->LeftChild) ) {
-            return Current->Parent->Parent->LeftChild;
+        if ( NODE_IS_RIGHT_CHILD(Current) && (NULL != Current->Parent->LeftChild) ) {
+            return Current->Parent->LeftChild;
         }
         Current = Current->Parent;
     }
@@ -363,13 +340,59 @@ Binary_Tree_Node_t *Binary_Tree_leftmostLeaf(Binary_Tree_Node_t *Root) {
         return NULL;
     }
 
-    if ( NULL != Root->LeftChild ) {
-        return Binary_Tree_leftmostLeaf(Root->LeftChild);
-    } else if ( NULL != Root->RightChild ) {
-        return Binary_Tree_leftmostLeaf(Root->RightChild);
-    } else {
+    while ( (NULL != Root->LeftChild) || (NULL != Root->RightChild) ) {
+        Root = (NULL != Root->LeftChild) ? Root->LeftChild : Root->RightChild;
+    }
+
+    return Root;
+}
 
-        return Root;
+Binary_Tree_Node_t *Binary_Tree_firstNode(Binary_Tree_Node_t *    Root,
+                                          Binary_Tree_Direction_t Direction, bool Forward) {
+
+    if ( NULL == Root ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Note: NULL Root* provided, no first Node to find.");
+#endif
+        return NULL;
+    }
+
+    switch ( Direction ) {
+        case Direction_InOrder:
+            if ( Forward ) {
+                for ( ; NULL != Root->LeftChild; Root = Root->LeftChild ) { ; }
+            } else {
+                for ( ; NULL != Root->RightChild; Root = Root->RightChild ) { ; }
+            }
+            return Root;
+        case Direction_PreOrder:
+            if ( !Forward ) {
+                while ( (NULL != Root->LeftChild) || (NULL != Root->RightChild) ) {
+                    Root = (NULL != Root->RightChild) ? Root->RightChild : Root->LeftChild;
+                }
+            }
+            return Root;
+        case Direction_PostOrder: return (Forward) ? Binary_Tree_leftmostLeaf(Root) : Root;
+        default:
+#ifdef DEBUG
+            DEBUG_PRINTF("Error: Unknown traversal direction [ %d ] specified.", Direction);
+#endif
+            return NULL;
+    }
+}
+
+Binary_Tree_Node_t *Binary_Tree_nextNode(Binary_Tree_Node_t *    Current,
+                                         Binary_Tree_Direction_t Direction) {
+
+    switch ( Direction ) {
+        case Direction_InOrder: return Binary_Tree_inOrderNext(Current);
+        case Direction_PreOrder: return Binary_Tree_preOrderNext(Current);
+        case Direction_PostOrder: return Binary_Tree_postOrderNext(Current);
+        default:
+#ifdef DEBUG
+            DEBUG_PRINTF("Error: Unknown traversal direction [ %d ] specified.", Direction);
+#endif
+            return NULL;
     }
 }
 
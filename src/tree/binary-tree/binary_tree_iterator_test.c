@@ -64,12 +64,57 @@ static int CompareFunc_Size_t(const void *A, const void *B, __attribute__((unuse
     return 0;
 }
 
+typedef struct Walk_Record_t {
+    size_t Values[16];
+    size_t Count;
+} Walk_Record_t;
+
+static int RecordWalkCallback(void *KeyValuePair, void *Args) {
+
+    Walk_Record_t *             Record = (Walk_Record_t *)Args;
+    Binary_Tree_KeyValuePair_t *Pair   = (Binary_Tree_KeyValuePair_t *)KeyValuePair;
+
+    if ( Record->Count >= sizeof(Record->Values) / sizeof(Record->Values[0]) ) {
+        return 1;
+    }
+
+    Record->Values[Record->Count++] = *(size_t *)Pair->Value;
+    return 0;
+}
+
+static int CountWalkCallback(__attribute__((unused)) void *KeyValuePair, void *Args) {
+    (*(size_t *)Args)++;
+    return 0;
+}
+
+static void ReferenceWalk(Binary_Tree_Node_t *Node, Binary_Tree_Direction_t Direction,
+                          size_t *Values, size_t *Count) {
+
+    if ( NULL == Node ) {
+        return;
+    }
+
+    if ( Direction_PreOrder == Direction ) {
+        Values[(*Count)++] = *(size_t *)Node->Value.ValueRaw;
+    }
+    ReferenceWalk(Node->LeftChild, Direction, Values, Count);
+    if ( Direction_InOrder == Direction ) {
+        Values[(*Count)++] = *(size_t *)Node->Value.ValueRaw;
+    }
+    ReferenceWalk(Node->RightChild, Direction, Values, Count);
+    if ( Direction_PostOrder == Direction ) {
+        Values[(*Count)++] = *(size_t *)Node->Value.ValueRaw;
+    }
+}
+
 int Test_binary_tree_iterator(void) {
 
     int FailedTests = 0;
 
     FailedTests += Test_Binary_Tree_Iterate_Next();
     FailedTests += Test_Binary_Tree_Iterate_Previous();
+    FailedTests += Test_Binary_Tree_Iterate_Callback();
+    FailedTests += Test_Binary_Tree_Iterate_Irregular();
 
     return FailedTests;
 }
@@ -364,3 +409,172 @@ int Test_Binary_Tree_Iterate_Previous_PostOrder(void) {
     Binary_Tree_Release(Tree);
     TEST_SUCCESSFUL;
 }
+
+int Test_Binary_Tree_Iterate_Callback(void) {
+
+    Binary_Tree_t *            Tree      = NULL;
+    size_t                     ItemCount = 16, i = 0, j = 0;
+    Binary_Tree_KeyValuePair_t KeyValuePair = {0, NULL};
+    Walk_Record_t              Record;
+    Binary_Tree_Direction_t    Directions[] = {Direction_InOrder, Direction_PreOrder,
+                                            Direction_PostOrder};
+    size_t                     Expected[][16] = {
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+        {7, 3, 1, 0, 2, 5, 4, 6, 11, 9, 8, 10, 13, 12, 14, 15},
+        {0, 2, 1, 4, 6, 5, 3, 8, 10, 9, 12, 15, 14, 13, 11, 7}};
+
+    Tree = Binary_Tree_Create((CompareFunc_t *)CompareFunc_Size_t, sizeof(size_t), NULL,
+                              Policy_Overwrite);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Binary Tree for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < ItemCount; i++ ) {
+        if ( 0 != Binary_Tree_Insert(Tree, &i, sizeof(i), &i, sizeof(i), NULL) ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to insert item.");
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    /* A walk through DoCallbackArg() must not disturb an iteration already in progress. */
+    KeyValuePair = Binary_Tree_Next(Tree, Direction_InOrder);
+    if ( (NULL == KeyValuePair.Value) || (0 != *(size_t *)KeyValuePair.Value) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to start In-Order iteration.");
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    for ( j = 0; j < sizeof(Directions) / sizeof(Directions[0]); j++ ) {
+        Record.Count = 0;
+        if ( 0 != Binary_Tree_DoCallbackArg(Tree, Directions[j], RecordWalkCallback, &Record) ) {
+            TEST_PRINTF("Test Failure - Failed to walk Tree in direction (%d).",
+                        (int)Directions[j]);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+
+        if ( Record.Count != ItemCount ) {
+            TEST_PRINTF("Test Failure - Walk in direction (%d) visited (%lu) of (%lu) items.",
+                        (int)Directions[j], (unsigned long)Record.Count, (unsigned long)ItemCount);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+
+        for ( i = 0; i < ItemCount; i++ ) {
+            if ( Record.Values[i] != Expected[j][i] ) {
+                TEST_PRINTF("Test Failure - Walk Value (%lu) not equal to expectation (%lu).",
+                            (unsigned long)Record.Values[i], (unsigned long)Expected[j][i]);
+                Binary_Tree_Release(Tree);
+                TEST_FAILURE;
+            }
+        }
+    }
+
+    KeyValuePair = Binary_Tree_Next(Tree, Direction_InOrder);
+    if ( (NULL == KeyValuePair.Value) || (1 != *(size_t *)KeyValuePair.Value) ) {
+        TEST_PRINTF("%s", "Test Failure - In-Order iteration was disturbed by DoCallbackArg().");
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    Binary_Tree_Release(Tree);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Tree_Iterate_Irregular(void) {
+
+    Binary_Tree_t *            Tree         = NULL;
+    Binary_Tree_KeyValuePair_t KeyValuePair = {0, NULL};
+    Binary_Tree_Direction_t    Directions[] = {Direction_InOrder, Direction_PreOrder,
+                                            Direction_PostOrder};
+    size_t                     Keys[] = {4, 2, 5, 1}, Expected[256];
+    size_t                     Trial = 0, Count = 0, Visited = 0, Key = 0, i = 0, j = 0;
+    unsigned long              Random = 2463534242UL;
+
+    /*
+        Neither {4, 2, 5, 1} nor a Tree of random Keys is perfectly balanced, so some left
+        sub-trees have no right sibling and some Nodes have a single child on either side.
+    */
+    for ( Trial = 0; Trial < 2; Trial++ ) {
+        Tree = Binary_Tree_Create((CompareFunc_t *)CompareFunc_Size_t, sizeof(size_t), NULL,
+                                  Policy_Overwrite);
+        if ( NULL == Tree ) {
+            TEST_PRINTF("%s", "Test Failure - Failed to create Binary Tree for testing.");
+            TEST_FAILURE;
+        }
+
+        for ( i = 0; i < ((0 == Trial) ? 4 : 187); i++ ) {
+            if ( 0 == Trial ) {
+                Key = Keys[i];
+            } else {
+                Random ^= (Random << 13) & 0xFFFFFFFFUL;
+                Random ^= Random >> 17;
+                Random ^= (Random << 5) & 0xFFFFFFFFUL;
+                Key = (size_t)(Random % 1000);
+            }
+            if ( 0 != Binary_Tree_Insert(Tree, &Key, sizeof(Key), &Key, sizeof(Key), NULL) ) {
+                TEST_PRINTF("%s", "Test Failure - Failed to insert item.");
+                Binary_Tree_Release(Tree);
+                TEST_FAILURE;
+            }
+        }
+
+        for ( j = 0; j < sizeof(Directions) / sizeof(Directions[0]); j++ ) {
+            Count = 0;
+            ReferenceWalk(Tree->Root, Directions[j], Expected, &Count);
+
+            for ( Visited = 0, KeyValuePair = Binary_Tree_Next(Tree, Directions[j]);
+                  NULL != KeyValuePair.Value;
+                  Visited++, KeyValuePair = Binary_Tree_Next(Tree, Directions[j]) ) {
+                if ( (Visited >= Count) || (*(size_t *)KeyValuePair.Value != Expected[Visited]) ) {
+                    TEST_PRINTF("Test Failure - Forward walk in direction (%d) out of order.",
+                                (int)Directions[j]);
+                    Binary_Tree_Release(Tree);
+                    TEST_FAILURE;
+                }
+            }
+
+            if ( Visited != Count ) {
+                TEST_PRINTF("Test Failure - Forward walk in direction (%d) visited (%lu) of (%lu).",
+                            (int)Directions[j], (unsigned long)Visited, (unsigned long)Count);
+                Binary_Tree_Release(Tree);
+                TEST_FAILURE;
+            }
+
+            for ( Visited = 0, KeyValuePair = Binary_Tree_Previous(Tree, Directions[j]);
+                  NULL != KeyValuePair.Value;
+                  Visited++, KeyValuePair = Binary_Tree_Previous(Tree, Directions[j]) ) {
+                if ( (Visited >= Count) ||
+                     (*(size_t *)KeyValuePair.Value != Expected[Count - 1 - Visited]) ) {
+                    TEST_PRINTF("Test Failure - Reverse walk in direction (%d) out of order.",
+                                (int)Directions[j]);
+                    Binary_Tree_Release(Tree);
+                    TEST_FAILURE;
+                }
+            }
+
+            if ( Visited != Count ) {
+                TEST_PRINTF("Test Failure - Reverse walk in direction (%d) visited (%lu) of (%lu).",
+                            (int)Directions[j], (unsigned long)Visited, (unsigned long)Count);
+                Binary_Tree_Release(Tree);
+                TEST_FAILURE;
+            }
+
+            Visited = 0;
+            if ( (0 != Binary_Tree_DoCallbackArg(Tree, Directions[j], CountWalkCallback,
+                                                 &Visited)) ||
+                 (Visited != Count) ) {
+                TEST_PRINTF("Test Failure - Callback in direction (%d) visited (%lu) of (%lu).",
+                            (int)Directions[j], (unsigned long)Visited, (unsigned long)Count);
+                Binary_Tree_Release(Tree);
+                TEST_FAILURE;
+            }
+        }
+
+        Binary_Tree_Release(Tree);
+    }
+
+    TEST_SUCCESSFUL;
+}
@@ -26,9 +26,11 @@
 #include <string.h>
 
 #include "../../logging/logging.h"
+#include "include/binary_tree.h"
+#include "include/binary_tree_iterator.h"
 #include "include/binary_tree_node.h"
 
-Binary_Tree_Node_t *Binary_Tree_Node_Create(void *Key, size_t KeySize,
+Binary_Tree_Node_t *Binary_Tree_Node_Create(Pool_t *Pool, void *Key, size_t KeySize,
                                             ReleaseFunc_t *KeyReleaseFunc, void *Value,
                                             size_t ValueSize, ReleaseFunc_t *ValueReleaseFunc) {
 
@@ -50,23 +52,36 @@ Binary_Tree_Node_t *Binary_Tree_Node_Create(void *Key, size_t KeySize,
         ValueReleaseFunc = free;
     }
 
-    Node = (Binary_Tree_Node_t *)calloc(1, sizeof(Binary_Tree_Node_t));
+    if ( NULL == Pool ) {
+        Node = (Binary_Tree_Node_t *)calloc(1, sizeof(Binary_Tree_Node_t));
+    } else {
+        Node = (Binary_Tree_Node_t *)Pool_Alloc(Pool);
+    }
     if ( NULL == Node ) {
 #ifdef DEBUG
         DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Binary_Tree_Node_t.");
 #endif
         return NULL;
     }
+    Node->Pool = Pool;
 
     if ( KeySize == 0 ) {
         KeyContents = (uint8_t *)Key;
+    } else if ( (NULL != Pool) && (free == KeyReleaseFunc) &&
+                (KeySize <= (Pool->ObjectSize - sizeof(Binary_Tree_Node_t))) ) {
+        KeyContents = (uint8_t *)(Node + 1);
+        memcpy(KeyContents, Key, KeySize);
     } else {
         KeyContents = (uint8_t *)calloc(KeySize, sizeof(uint8_t));
         if ( NULL == KeyContents ) {
 #ifdef DEBUG
             DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Binary_Tree_Node_t Key.");
 #endif
-            free(Node);
+            if ( NULL == Pool ) {
+                free(Node);
+            } else {
+                Pool_Free(Pool, Node);
+            }
             return NULL;
         }
         memcpy(KeyContents, Key, KeySize);
@@ -80,8 +95,14 @@ Binary_Tree_Node_t *Binary_Tree_Node_Create(void *Key, size_t KeySize,
 #ifdef DEBUG
             DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Binary_Tree_Node_t contents.");
 #endif
-            free(Node);
-            free(KeyContents);
+            if ( (0 != KeySize) && (KeyContents != (uint8_t *)(Node + 1)) ) {
+                free(KeyContents);
+            }
+            if ( NULL == Pool ) {
+                free(Node);
+            } else {
+                Pool_Free(Pool, Node);
+            }
             return NULL;
         }
         memcpy(ValueContents, Value, ValueSize);
@@ -98,6 +119,9 @@ Binary_Tree_Node_t *Binary_Tree_Node_Create(void *Key, size_t KeySize,
     Node->Parent     = NULL;
     Node->LeftChild  = NULL;
     Node->RightChild = NULL;
+    Node->Height     = 1;
+    Node->Size       = 1;
+    Node->RefCount   = 1;
 
 #ifdef DEBUG
     DEBUG_PRINTF("%s", "Successfully created Binary_Tree_Node_t.");
@@ -105,24 +129,114 @@ Binary_Tree_Node_t *Binary_Tree_Node_Create(void *Key, size_t KeySize,
     return Node;
 }
 
-size_t Binary_Tree_Node_Height(Binary_Tree_Node_t *Root) {
+Binary_Tree_Node_t *Binary_Tree_Node_Copy(Binary_Tree_Node_t *Node) {
+
+    Binary_Tree_Node_t *Copy      = NULL;
+    size_t *            KeyShares = NULL, *ValueShares = NULL;
+    bool                KeyCreated = false, ValueCreated = false;
+
+    if ( NULL == Node ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: NULL Node* provided, nothing to copy.");
+#endif
+        return NULL;
+    }
 
-    size_t LeftHeight = 0, RightHeight = 0;
+    /* An inline Key is simply copied along with the Node, so it is never shared. */
+    if ( (NULL != Node->Key.KeyRaw) && !BINARY_TREE_NODE_KEY_IS_INLINE(Node) ) {
+        KeyShares = Binary_Tree_Node_shareCount(Node->KeyShares, &KeyCreated);
+        if ( NULL == KeyShares ) {
+            return NULL;
+        }
+    }
+
+    if ( NULL != Node->Value.ValueRaw ) {
+        ValueShares = Binary_Tree_Node_shareCount(Node->ValueShares, &ValueCreated);
+        if ( NULL == ValueShares ) {
+            if ( KeyCreated ) {
+                free(KeyShares);
+            }
+            return NULL;
+        }
+    }
+
+    if ( NULL == Node->Pool ) {
+        Copy = (Binary_Tree_Node_t *)calloc(1, sizeof(Binary_Tree_Node_t));
+    } else {
+        Copy = (Binary_Tree_Node_t *)Pool_Alloc(Node->Pool);
+    }
+    if ( NULL == Copy ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for Binary_Tree_Node_t copy.");
+#endif
+        if ( KeyCreated ) {
+            free(KeyShares);
+        }
+        if ( ValueCreated ) {
+            free(ValueShares);
+        }
+        return NULL;
+    }
+
+    *Copy          = *Node;
+    Copy->RefCount = 1;
+
+    if ( BINARY_TREE_NODE_KEY_IS_INLINE(Node) ) {
+        Copy->Key.KeyBytes = (uint8_t *)(Copy + 1);
+        memcpy(Copy->Key.KeyBytes, Node->Key.KeyBytes, Node->KeySize);
+    } else if ( NULL != KeyShares ) {
+        (*KeyShares)++;
+        Node->KeyShares = Copy->KeyShares = KeyShares;
+    }
+
+    if ( NULL != ValueShares ) {
+        (*ValueShares)++;
+        Node->ValueShares = Copy->ValueShares = ValueShares;
+    }
+
+    /* The copy takes over from the original as the Parent the Tree sees, for both subtrees. */
+    if ( NULL != Copy->LeftChild ) {
+        Copy->LeftChild->RefCount++;
+        Copy->LeftChild->Parent = Copy;
+    }
+    if ( NULL != Copy->RightChild ) {
+        Copy->RightChild->RefCount++;
+        Copy->RightChild->Parent = Copy;
+    }
+
+    return Copy;
+}
+
+size_t Binary_Tree_Node_Height(Binary_Tree_Node_t *Root) {
 
     if ( NULL == Root ) {
         return 0;
     }
 
-    LeftHeight  = Binary_Tree_Node_Height(Root->LeftChild);
-    RightHeight = Binary_Tree_Node_Height(Root->RightChild);
+    return Root->Height;
+}
+
+size_t Binary_Tree_Node_Size(Binary_Tree_Node_t *Root) {
+
+    if ( NULL == Root ) {
+        return 0;
+    }
 
-    return 1 + ((LeftHeight > RightHeight) ? (LeftHeight) : RightHeight);
+    return Root->Size;
 }
 
 int Binary_Tree_Node_UpdateKey(Binary_Tree_Node_t *Node, void *NewKey, size_t KeySize) {
 
     uint8_t *TempKey = NULL;
 
+    /* An inline Key is simply overwritten in place, as long as the new Key still fits. */
+    if ( BINARY_TREE_NODE_KEY_IS_INLINE(Node) && (NULL != NewKey) && (0 != KeySize) &&
+         (KeySize <= (Node->Pool->ObjectSize - sizeof(Binary_Tree_Node_t))) ) {
+        memmove(Node->Key.KeyBytes, NewKey, KeySize);
+        Node->KeySize = KeySize;
+        return 0;
+    }
+
     if ( (NULL == NewKey) || (0 == KeySize) ) {
         TempKey = (uint8_t *)NewKey;
     } else {
@@ -136,12 +250,7 @@ int Binary_Tree_Node_UpdateKey(Binary_Tree_Node_t *Node, void *NewKey, size_t Ke
         memcpy(TempKey, NewKey, KeySize);
     }
 
-    if ( (Node->Key.KeyRaw != NULL) && (NULL != Node->KeyReleaseFunc) ) {
-#ifdef DEBUG
-        DEBUG_PRINTF("%s", "Binary_Tree_Node_t has non-NULL Key, releasing.");
-#endif
-        Node->KeyReleaseFunc(Node->Key.KeyRaw);
-    }
+    Binary_Tree_Node_releaseKey(Node);
 
 #ifdef DEBUG
     DEBUG_PRINTF("%s", "Successfully updated Key of Binary_Tree_Node_t.");
@@ -168,12 +277,7 @@ int Binary_Tree_Node_UpdateValue(Binary_Tree_Node_t *Node, void *NewValue, size_
         memcpy(TempValue, NewValue, ValueSize);
     }
 
-    if ( (Node->Value.ValueRaw != NULL) && (NULL != Node->ValueReleaseFunc) ) {
-#ifdef DEBUG
-        DEBUG_PRINTF("%s", "Binary_Tree_Node_t has non-NULL value, releasing.");
-#endif
-        Node->ValueReleaseFunc(Node->Value.ValueRaw);
-    }
+    Binary_Tree_Node_releaseValue(Node);
 
 #ifdef DEBUG
     DEBUG_PRINTF("%s", "Successfully updated value of Binary_Tree_Node_t.");
@@ -185,41 +289,157 @@ int Binary_Tree_Node_UpdateValue(Binary_Tree_Node_t *Node, void *NewValue, size_
 
 void Binary_Tree_Node_Release(Binary_Tree_Node_t *Node) {
 
-    Binary_Tree_Node_t *Parent = NULL;
+    Binary_Tree_Node_t *Left = NULL;
+    Binary_Tree_Node_t *Next = NULL;
+    Pool_t *            Pool = NULL;
 
     if ( NULL == Node ) {
         return;
     }
 
-    Binary_Tree_Node_Release(Node->LeftChild);
-    Binary_Tree_Node_Release(Node->RightChild);
-
-    if ( (NULL != Node->Key.KeyRaw) && (NULL != Node->KeyReleaseFunc) ) {
-        Node->KeyReleaseFunc(Node->Key.KeyRaw);
+    /*
+        A Node still referenced from elsewhere stays alive. The Parent of a shared Node
+        may belong to another version of the Tree, so it is never followed from here.
+    */
+    if ( 1 < Node->RefCount ) {
+        Node->RefCount--;
+        return;
     }
 
-    if ( (NULL != Node->Value.ValueRaw) && (NULL != Node->ValueReleaseFunc) ) {
-        Node->ValueReleaseFunc(Node->Value.ValueRaw);
-    }
+    /*
+        Without usable Parent pointers, the subtree is torn down by rotating every Left
+        child up above its Parent. This flattens the Nodes into a list along the Right
+        children, releasing each one as the Left spine empties, in linear time and with
+        neither recursion nor an explicit stack. Only Nodes owned solely by this subtree
+        are ever rotated, shared subtrees simply drop the one reference held from here.
+    */
+    while ( NULL != Node ) {
+        Left = Node->LeftChild;
+        if ( NULL != Left ) {
+            if ( 1 < Left->RefCount ) {
+                Left->RefCount--;
+                Node->LeftChild = NULL;
+            } else {
+                Node->LeftChild  = Left->RightChild;
+                Left->RightChild = Node;
+                Node             = Left;
+            }
+            continue;
+        }
+
+        Next = Node->RightChild;
+        if ( (NULL != Next) && (1 < Next->RefCount) ) {
+            Next->RefCount--;
+            Next = NULL;
+        }
 
-    Parent = Node->Parent;
-    if ( NULL != Parent ) {
-        if ( Node == Parent->LeftChild ) {
-            Parent->LeftChild = NULL;
-        } else if ( Node == Parent->RightChild ) {
-            Parent->RightChild = NULL;
+        Binary_Tree_Node_releaseKey(Node);
+        Binary_Tree_Node_releaseValue(Node);
+
+        Pool = Node->Pool;
+        ZERO_CONTAINER(Node, Binary_Tree_Node_t);
+        if ( NULL == Pool ) {
+            free(Node);
         } else {
+            Pool_Free(Pool, Node);
+        }
+
+        Node = Next;
+    }
+
 #ifdef DEBUG
-            DEBUG_PRINTF("%s", "Error: Node* is not a child of its Parent!");
+    DEBUG_PRINTF("%s", "Successfully release Binary_Tree_Node_t.");
 #endif
+    return;
+}
+
+void Binary_Tree_Node_ReleaseEntries(Binary_Tree_Node_t *Root) {
+
+    Binary_Tree_Node_t *Node = NULL;
+    Binary_Tree_Node_t *Next = NULL;
+
+    if ( NULL == Root ) {
+        return;
+    }
+
+    /*
+        The Nodes themselves are left in place, so the Parent pointers stay valid
+        and a plain Post-Order walk visits every Node without recursing.
+    */
+    Node = Binary_Tree_leftmostLeaf(Root);
+    while ( NULL != Node ) {
+        Next = (Root == Node) ? NULL : Binary_Tree_postOrderNext(Node);
+
+        Binary_Tree_Node_releaseKey(Node);
+        Binary_Tree_Node_releaseValue(Node);
+
+        Node = Next;
+    }
+
+    return;
+}
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+void Binary_Tree_Node_releaseKey(Binary_Tree_Node_t *Node) {
+
+    if ( NULL != Node->KeyShares ) {
+        if ( 0 != --(*Node->KeyShares) ) {
+            Node->KeyShares = NULL;
+            return;
         }
+        free(Node->KeyShares);
+        Node->KeyShares = NULL;
     }
 
-    ZERO_CONTAINER(Node, Binary_Tree_Node_t);
-    free(Node);
+    if ( (NULL != Node->Key.KeyRaw) && (NULL != Node->KeyReleaseFunc) &&
+         !BINARY_TREE_NODE_KEY_IS_INLINE(Node) ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Binary_Tree_Node_t has non-NULL Key, releasing.");
+#endif
+        Node->KeyReleaseFunc(Node->Key.KeyRaw);
+    }
 
+    return;
+}
+
+void Binary_Tree_Node_releaseValue(Binary_Tree_Node_t *Node) {
+
+    if ( NULL != Node->ValueShares ) {
+        if ( 0 != --(*Node->ValueShares) ) {
+            Node->ValueShares = NULL;
+            return;
+        }
+        free(Node->ValueShares);
+        Node->ValueShares = NULL;
+    }
+
+    if ( (NULL != Node->Value.ValueRaw) && (NULL != Node->ValueReleaseFunc) ) {
 #ifdef DEBUG
-    DEBUG_PRINTF("%s", "Successfully release Binary_Tree_Node_t.");
+        DEBUG_PRINTF("%s", "Binary_Tree_Node_t has non-NULL value, releasing.");
 #endif
+        Node->ValueReleaseFunc(Node->Value.ValueRaw);
+    }
+
     return;
 }
+
+size_t *Binary_Tree_Node_shareCount(size_t *Shares, bool *Created) {
+
+    *Created = false;
+    if ( NULL != Shares ) {
+        return Shares;
+    }
+
+    Shares = (size_t *)malloc(sizeof(size_t));
+    if ( NULL == Shares ) {
+#ifdef DEBUG
+        DEBUG_PRINTF("%s", "Error: Failed to allocate memory for share count.");
+#endif
+        return NULL;
+    }
+
+    *Shares  = 1;
+    *Created = true;
+    return Shares;
+}
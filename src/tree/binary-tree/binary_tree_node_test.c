@@ -36,6 +36,7 @@ int Test_binary_tree_node(void) {
     FailedTests += Test_Binary_Tree_Node_Create();
     FailedTests += Test_Binary_Tree_Node_UpdateKey();
     FailedTests += Test_Binary_Tree_Node_UpdateValue();
+    FailedTests += Test_Binary_Tree_Node_Pooled();
 
     return FailedTests;
 }
@@ -45,7 +46,7 @@ int Test_Binary_Tree_Node_Create(void) {
     Binary_Tree_Node_t *Node = NULL;
     int                 Key = 0xBEEF, Value = 0xCAFE;
 
-    Node = Binary_Tree_Node_Create(&Key, sizeof(Value), NULL, &Value, sizeof(Value), NULL);
+    Node = Binary_Tree_Node_Create(NULL, &Key, sizeof(Value), NULL, &Value, sizeof(Value), NULL);
     if ( NULL == Node ) {
         TEST_PRINTF("%s", "Test Failure - Failed to create new Binary_Tree_Node_t for testing.");
         TEST_FAILURE;
@@ -60,7 +61,7 @@ int Test_Binary_Tree_Node_UpdateKey(void) {
     Binary_Tree_Node_t *Node = NULL;
     int                 Key = 0xBEEF, Value = 0xCAFE, NewKey = 0xBABE;
 
-    Node = Binary_Tree_Node_Create(&Key, sizeof(Key), NULL, &Value, sizeof(Value), NULL);
+    Node = Binary_Tree_Node_Create(NULL, &Key, sizeof(Key), NULL, &Value, sizeof(Value), NULL);
     if ( NULL == Node ) {
         TEST_PRINTF("%s", "Test Failure - Failed to create new Binary_Tree_Node_t for testing.");
         TEST_FAILURE;
@@ -88,7 +89,7 @@ int Test_Binary_Tree_Node_UpdateValue(void) {
     Binary_Tree_Node_t *Node = NULL;
     int                 Key = 0xBEEF, Value = 0xCAFE, NewValue = 0xBABE;
 
-    Node = Binary_Tree_Node_Create(&Key, sizeof(Key), NULL, &Value, sizeof(Value), NULL);
+    Node = Binary_Tree_Node_Create(NULL, &Key, sizeof(Key), NULL, &Value, sizeof(Value), NULL);
     if ( NULL == Node ) {
         TEST_PRINTF("%s", "Test Failure - Failed to create new Binary_Tree_Node_t for testing.");
         TEST_FAILURE;
@@ -110,3 +111,54 @@ int Test_Binary_Tree_Node_UpdateValue(void) {
     Binary_Tree_Node_Release(Node);
     TEST_SUCCESSFUL;
 }
+
+int Test_Binary_Tree_Node_Pooled(void) {
+
+    Binary_Tree_Node_t *Node = NULL;
+    Pool_t *            Pool = NULL;
+    int                 Key = 0xBEEF, NewKey = 0xDEAD, Value = 0xCAFE;
+    char                LongKey[64];
+
+    Pool = Pool_Create(sizeof(Binary_Tree_Node_t) + sizeof(Key));
+    if ( NULL == Pool ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Pool_t for testing.");
+        TEST_FAILURE;
+    }
+
+    Node = Binary_Tree_Node_Create(Pool, &Key, sizeof(Key), NULL, &Value, sizeof(Value), NULL);
+    if ( (NULL == Node) || !BINARY_TREE_NODE_KEY_IS_INLINE(Node) ||
+         (Key != *(int *)Node->Key.KeyRaw) ) {
+        TEST_PRINTF("%s", "Test Failure - Pooled Binary_Tree_Node_t did not hold its Key inline.");
+        Binary_Tree_Node_Release(Node);
+        Pool_Release(Pool);
+        TEST_FAILURE;
+    }
+
+    if ( (0 != Binary_Tree_Node_UpdateKey(Node, &NewKey, sizeof(NewKey))) ||
+         !BINARY_TREE_NODE_KEY_IS_INLINE(Node) || (NewKey != *(int *)Node->Key.KeyRaw) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to update inline Key in place.");
+        Binary_Tree_Node_Release(Node);
+        Pool_Release(Pool);
+        TEST_FAILURE;
+    }
+
+    /* A Key too large for the inline space moves out to its own allocation. */
+    memset(LongKey, 'x', sizeof(LongKey));
+    if ( (0 != Binary_Tree_Node_UpdateKey(Node, LongKey, sizeof(LongKey))) ||
+         BINARY_TREE_NODE_KEY_IS_INLINE(Node) || (0 != memcmp(LongKey, Node->Key.KeyRaw, 64)) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to update inline Key to a larger Key.");
+        Binary_Tree_Node_Release(Node);
+        Pool_Release(Pool);
+        TEST_FAILURE;
+    }
+
+    Binary_Tree_Node_Release(Node);
+    if ( 0 != Pool->InUse ) {
+        TEST_PRINTF("%s", "Test Failure - Released Node was not returned to its Pool.");
+        Pool_Release(Pool);
+        TEST_FAILURE;
+    }
+
+    Pool_Release(Pool);
+    TEST_SUCCESSFUL;
+}
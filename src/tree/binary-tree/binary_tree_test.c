@@ -29,6 +29,7 @@
 
 #include "../../logging/logging.h"
 #include "include/binary_tree.h"
+#include "include/binary_tree_frozen.h"
 #include "include/binary_tree_iterator.h"
 #include "include/tree_rotations.h"
 
@@ -122,6 +123,23 @@ static int PrintBinaryTreeCallbackArgs(void *KeyValuePair, void *Args) {
     return 0;
 }
 
+static int RangeCallbackCounter(void *KeyValuePair, void *Args) {
+
+    Binary_Tree_KeyValuePair_t Pair  = *(Binary_Tree_KeyValuePair_t *)KeyValuePair;
+    int *                      State = (int *)Args;
+
+    /* State holds { Count, Previous Key, Lo, Hi }, keys must arrive ascending within [Lo, Hi). */
+    if ( (*(int *)Pair.Key < State[2]) || (*(int *)Pair.Key >= State[3]) ||
+         ((0 != State[0]) && (*(int *)Pair.Key <= State[1])) ) {
+        return 1;
+    }
+
+    State[0]++;
+    State[1] = *(int *)Pair.Key;
+
+    return 0;
+}
+
 static int Binary_Tree_Validate_Parents(Binary_Tree_Node_t *Root) {
 
     if ( NULL == Root ) {
@@ -148,15 +166,24 @@ int Test_binary_tree(void) {
 
     FailedTests += Test_Binary_Tree_Create();
     FailedTests += Test_Binary_Tree_Insert();
+    FailedTests += Test_Binary_Tree_Upsert();
+    FailedTests += Test_Binary_Tree_GetOrInsert();
     FailedTests += Test_Binary_Tree_Get();
     FailedTests += Test_Binary_Tree_Pop();
     FailedTests += Test_Binary_Tree_DoCallback();
     FailedTests += Test_Binary_Tree_DoCallbackArg();
+    FailedTests += Test_Binary_Tree_Bounds();
+    FailedTests += Test_Binary_Tree_RangeCallback();
+    FailedTests += Test_Binary_Tree_RankSelect();
+    FailedTests += Test_Binary_Tree_BuildFromSorted();
+    FailedTests += Test_Binary_Tree_NodePool();
+    FailedTests += Test_Binary_Tree_Snapshot();
     FailedTests += Test_Binary_Tree_Remove();
     FailedTests += Test_Binary_Tree_Balancing();
     FailedTests += Test_Binary_Tree_Clear();
 
     FailedTests += Test_binary_tree_iterator();
+    FailedTests += Test_binary_tree_frozen();
 
     return FailedTests;
 }
@@ -215,6 +242,114 @@ int Test_Binary_Tree_Insert() {
     TEST_SUCCESSFUL;
 }
 
+int Test_Binary_Tree_Upsert() {
+
+    Binary_Tree_t *Tree  = NULL;
+    size_t         Count = 64, i = 0;
+    int            Key = 0, Value = 0;
+
+    Tree = Binary_Tree_Create(CompareFunc_Int_Ascending, sizeof(Value), NULL, Policy_Error);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Binary_Tree_t* for testing.");
+        TEST_FAILURE;
+    }
+
+    /* Upsert each key twice, the second time overriding the Policy_Error of the Tree. */
+    for ( i = 0; i < 2 * Count; i++ ) {
+        Key   = (int)(i % Count);
+        Value = (int)i;
+        if ( 0 != Binary_Tree_Upsert(Tree, &Key, sizeof(Key), &Value, sizeof(Value), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to upsert Key (%d) into Tree.", Key);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( Count != Binary_Tree_Length(Tree) ) {
+        TEST_PRINTF("Test Failure - Tree length (%lu) not equal to expectation (%lu).",
+                    (unsigned long)Binary_Tree_Length(Tree), (unsigned long)Count);
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        Key = (int)i;
+        if ( (int)(i + Count) != *(int *)Binary_Tree_Get(Tree, &Key, sizeof(Key)) ) {
+            TEST_PRINTF("Test Failure - Value for Key (%d) was not updated by upsert.", Key);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( (0 != Binary_Tree_Validate_Parents(Tree->Root)) || !Binary_Tree_isAVLTree(Tree->Root) ) {
+        TEST_PRINTF("%s", "Test Failure - Tree is malformed after upserts.");
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    Key = 0;
+    if ( 0 > Binary_Tree_Insert(Tree, &Key, sizeof(Key), &Value, sizeof(Value), NULL) ) {
+        Binary_Tree_Release(Tree);
+        TEST_SUCCESSFUL;
+    }
+
+    TEST_PRINTF("%s", "Test Failure - Insert of duplicate Key did not honour Policy_Error.");
+    Binary_Tree_Release(Tree);
+    TEST_FAILURE;
+}
+
+int Test_Binary_Tree_GetOrInsert() {
+
+    Binary_Tree_t *Tree  = NULL;
+    size_t         Count = 64, i = 0;
+    int            Key = 0, Value = 0, *Counter = NULL;
+
+    Tree = Binary_Tree_Create(CompareFunc_Int_Ascending, sizeof(Key), NULL, Policy_Overwrite);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Binary_Tree_t* for testing.");
+        TEST_FAILURE;
+    }
+
+    /* Count the occurrences of each key in place, as an ordered index would. */
+    for ( i = 0; i < 4 * Count; i++ ) {
+        Key     = (int)(i % Count);
+        Value   = 0;
+        Counter = (int *)Binary_Tree_GetOrInsert(Tree, &Key, sizeof(Key), &Value, sizeof(Value),
+                                                 NULL);
+        if ( NULL == Counter ) {
+            TEST_PRINTF("Test Failure - Failed to get or insert Key (%d).", Key);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+        (*Counter)++;
+    }
+
+    if ( Count != Binary_Tree_Length(Tree) ) {
+        TEST_PRINTF("Test Failure - Tree length (%lu) not equal to expectation (%lu).",
+                    (unsigned long)Binary_Tree_Length(Tree), (unsigned long)Count);
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        Key = (int)i;
+        if ( 4 != *(int *)Binary_Tree_Get(Tree, &Key, sizeof(Key)) ) {
+            TEST_PRINTF("Test Failure - Counter for Key (%d) not equal to expectation.", Key);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( (0 != Binary_Tree_Validate_Parents(Tree->Root)) || !Binary_Tree_isAVLTree(Tree->Root) ) {
+        TEST_PRINTF("%s", "Test Failure - Tree is malformed after insertions.");
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    Binary_Tree_Release(Tree);
+    TEST_SUCCESSFUL;
+}
+
 int Test_Binary_Tree_Get() {
 
     Binary_Tree_t *Tree       = NULL;
@@ -438,6 +573,489 @@ int Test_Binary_Tree_DoCallbackArg() {
     TEST_SUCCESSFUL;
 }
 
+int Test_Binary_Tree_Bounds() {
+
+    Binary_Tree_t *            Tree  = NULL;
+    Binary_Tree_KeyValuePair_t Pair  = {NULL, NULL};
+    int                        Count = 64, i = 0, Key = 0, Expected = 0;
+
+    Tree = Binary_Tree_Create(CompareFunc_Int_Ascending, sizeof(Key), NULL, Policy_Error);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Binary_Tree_t* for testing.");
+        TEST_FAILURE;
+    }
+
+    Key  = 0;
+    Pair = Binary_Tree_LowerBound(Tree, &Key, sizeof(Key));
+    if ( NULL != Pair.Key ) {
+        TEST_PRINTF("%s", "Test Failure - LowerBound of an empty Tree returned an item.");
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    /* Only even Keys are present, so every odd Key probes the gap between two items. */
+    for ( i = 0; i < Count; i++ ) {
+        Key = 2 * ((i * 37) % Count);
+        if ( 0 != Binary_Tree_Insert(Tree, &Key, sizeof(Key), &Key, sizeof(Key), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to insert Key (%d) into Tree.", Key);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( Key = -2; Key <= 2 * Count; Key++ ) {
+
+        Expected = (Key < 0) ? 0 : (Key + (Key & 1));
+        Pair     = Binary_Tree_LowerBound(Tree, &Key, sizeof(Key));
+        if ( (Expected > 2 * (Count - 1)) ? (NULL != Pair.Key)
+                                          : ((NULL == Pair.Key) || (Expected != *(int *)Pair.Key)) ) {
+            TEST_PRINTF("Test Failure - LowerBound of Key (%d) not equal to expectation.", Key);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+
+        Expected = (Key < 0) ? 0 : (Key + 2 - (Key & 1));
+        Pair     = Binary_Tree_UpperBound(Tree, &Key, sizeof(Key));
+        if ( (Expected > 2 * (Count - 1)) ? (NULL != Pair.Key)
+                                          : ((NULL == Pair.Key) || (Expected != *(int *)Pair.Key)) ) {
+            TEST_PRINTF("Test Failure - UpperBound of Key (%d) not equal to expectation.", Key);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+
+        Expected = (Key > 2 * (Count - 1)) ? 2 * (Count - 1) : (Key - (Key & 1));
+        Pair     = Binary_Tree_Floor(Tree, &Key, sizeof(Key));
+        if ( (Expected < 0) ? (NULL != Pair.Key)
+                            : ((NULL == Pair.Key) || (Expected != *(int *)Pair.Key)) ) {
+            TEST_PRINTF("Test Failure - Floor of Key (%d) not equal to expectation.", Key);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    Binary_Tree_Release(Tree);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Tree_RangeCallback() {
+
+    Binary_Tree_t *Tree  = NULL;
+    int            Count = 100, i = 0, Key = 0, Lo = 0, Hi = 0, Expected = 0;
+    int            State[4] = {0, 0, 0, 0};
+
+    Tree = Binary_Tree_Create(CompareFunc_Int_Ascending, sizeof(Key), NULL, Policy_Error);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Binary_Tree_t* for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        Key = 2 * ((i * 37) % Count);
+        if ( 0 != Binary_Tree_Insert(Tree, &Key, sizeof(Key), &Key, sizeof(Key), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to insert Key (%d) into Tree.", Key);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    for ( Lo = -3; Lo <= 2 * Count; Lo += 7 ) {
+        for ( Hi = Lo; Hi <= 2 * Count + 3; Hi += 5 ) {
+
+            State[0] = 0;
+            State[2] = Lo;
+            State[3] = Hi;
+            for ( Expected = 0, Key = 0; Key < 2 * Count; Key += 2 ) {
+                Expected += ((Key >= Lo) && (Key < Hi));
+            }
+
+            if ( 0 != Binary_Tree_RangeCallback(Tree, &Lo, sizeof(Lo), &Hi, sizeof(Hi),
+                                                RangeCallbackCounter, State) ) {
+                TEST_PRINTF("Test Failure - Range [ %d, %d ) visited an out of order item.", Lo,
+                            Hi);
+                Binary_Tree_Release(Tree);
+                TEST_FAILURE;
+            }
+
+            if ( Expected != State[0] ) {
+                TEST_PRINTF("Test Failure - Range [ %d, %d ) visited (%d) items, expected (%d).",
+                            Lo, Hi, State[0], Expected);
+                Binary_Tree_Release(Tree);
+                TEST_FAILURE;
+            }
+        }
+    }
+
+    State[0] = 0;
+    State[2] = -1;
+    State[3] = 2 * Count;
+    if ( (0 != Binary_Tree_RangeCallback(Tree, NULL, 0, NULL, 0, RangeCallbackCounter, State)) ||
+         (Count != State[0]) ) {
+        TEST_PRINTF("%s", "Test Failure - Unbounded range did not visit every item in order.");
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    Binary_Tree_Release(Tree);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Tree_RankSelect() {
+
+    Binary_Tree_t *            Tree  = NULL;
+    Binary_Tree_KeyValuePair_t Pair  = {NULL, NULL};
+    int                        Count = 128, i = 0, Key = 0;
+
+    Tree = Binary_Tree_Create(CompareFunc_Int_Ascending, sizeof(Key), NULL, Policy_Error);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Binary_Tree_t* for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        Key = 2 * ((i * 37) % Count);
+        if ( 0 != Binary_Tree_Insert(Tree, &Key, sizeof(Key), &Key, sizeof(Key), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to insert Key (%d) into Tree.", Key);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    /* Remove every fourth Key, so the Sizes must also survive removals and their rotations. */
+    for ( Key = 0; Key < 2 * Count; Key += 8 ) {
+        if ( 0 != Binary_Tree_Remove(Tree, &Key, sizeof(Key)) ) {
+            TEST_PRINTF("Test Failure - Failed to remove Key (%d) from Tree.", Key);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( !Binary_Tree_isAVLTree(Tree->Root) ||
+         (Binary_Tree_Length(Tree) != Binary_Tree_Node_Size(Tree->Root)) ) {
+        TEST_PRINTF("%s", "Test Failure - Cached subtree Sizes are inconsistent.");
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < (int)Binary_Tree_Length(Tree); i++ ) {
+        /* The i'th surviving Key skips every Key divisible by 8. */
+        Key  = 2 * (i + (i / 3) + 1);
+        Pair = Binary_Tree_Select(Tree, (size_t)i);
+        if ( (NULL == Pair.Key) || (Key != *(int *)Pair.Key) ) {
+            TEST_PRINTF("Test Failure - Select (%d) not equal to expectation (%d).", i, Key);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+
+        if ( (size_t)i != Binary_Tree_Rank(Tree, &Key, sizeof(Key)) ) {
+            TEST_PRINTF("Test Failure - Rank of Key (%d) not equal to expectation (%d).", Key, i);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+
+        Key++;
+        if ( (size_t)(i + 1) != Binary_Tree_Rank(Tree, &Key, sizeof(Key)) ) {
+            TEST_PRINTF("Test Failure - Rank of absent Key (%d) not equal to expectation.", Key);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    Pair = Binary_Tree_Select(Tree, Binary_Tree_Length(Tree));
+    if ( NULL != Pair.Key ) {
+        TEST_PRINTF("%s", "Test Failure - Select past the end of the Tree returned an item.");
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    Binary_Tree_Release(Tree);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Tree_BuildFromSorted() {
+
+    Binary_Tree_t *Tree = NULL;
+    size_t         Count = 0, i = 0;
+    int *          Keys = NULL, *Values = NULL, Key = 0;
+
+    Keys   = (int *)calloc(1000, sizeof(int));
+    Values = (int *)calloc(1000, sizeof(int));
+    if ( (NULL == Keys) || (NULL == Values) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to allocate Keys for testing.");
+        free(Keys);
+        free(Values);
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < 1000; i++ ) {
+        Keys[i]   = 2 * (int)i;
+        Values[i] = -(int)i;
+    }
+
+    /* Cover the empty Tree, and both complete and ragged final levels. */
+    for ( Count = 0; Count <= 1000; Count += (Count < 20) ? 1 : 327 ) {
+
+        Tree = Binary_Tree_BuildFromSorted(CompareFunc_Int_Ascending, sizeof(int), NULL,
+                                           Policy_Error, Keys, Values, sizeof(int), NULL, Count);
+        if ( NULL == Tree ) {
+            TEST_PRINTF("Test Failure - Failed to bulk-load Tree of (%lu) items.",
+                        (unsigned long)Count);
+            free(Keys);
+            free(Values);
+            TEST_FAILURE;
+        }
+
+        if ( (Count != Binary_Tree_Length(Tree)) ||
+             (0 != Binary_Tree_Validate_Parents(Tree->Root)) ||
+             !Binary_Tree_isAVLTree(Tree->Root) ) {
+            TEST_PRINTF("Test Failure - Bulk-loaded Tree of (%lu) items is malformed.",
+                        (unsigned long)Count);
+            Binary_Tree_Release(Tree);
+            free(Keys);
+            free(Values);
+            TEST_FAILURE;
+        }
+
+        for ( i = 0; i < Count; i++ ) {
+            if ( (NULL == Binary_Tree_Get(Tree, &Keys[i], sizeof(int))) ||
+                 (Values[i] != *(int *)Binary_Tree_Get(Tree, &Keys[i], sizeof(int))) ) {
+                TEST_PRINTF("Test Failure - Value of Key (%d) not equal to expectation.", Keys[i]);
+                Binary_Tree_Release(Tree);
+                free(Keys);
+                free(Values);
+                TEST_FAILURE;
+            }
+        }
+
+        /* Later insertions and removals must rebalance from the bulk-loaded shape. */
+        for ( Key = 1; Key < 2 * (int)Count; Key += 4 ) {
+            Binary_Tree_Insert(Tree, &Key, sizeof(Key), &Key, sizeof(Key), NULL);
+            Binary_Tree_Remove(Tree, &Keys[Key / 2], sizeof(int));
+        }
+
+        if ( (Count != Binary_Tree_Length(Tree)) ||
+             (0 != Binary_Tree_Validate_Parents(Tree->Root)) ||
+             !Binary_Tree_isAVLTree(Tree->Root) ) {
+            TEST_PRINTF("Test Failure - Bulk-loaded Tree of (%lu) items malformed after updates.",
+                        (unsigned long)Count);
+            Binary_Tree_Release(Tree);
+            free(Keys);
+            free(Values);
+            TEST_FAILURE;
+        }
+
+        Binary_Tree_Release(Tree);
+    }
+
+    Keys[500] = Keys[499];
+    Tree      = Binary_Tree_BuildFromSorted(CompareFunc_Int_Ascending, sizeof(int), NULL,
+                                       Policy_Error, Keys, NULL, 0, NULL, 1000);
+    free(Keys);
+    free(Values);
+    if ( NULL != Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Tree was bulk-loaded from unsorted Keys.");
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Tree_NodePool() {
+
+    Binary_Tree_t *            Tree  = NULL;
+    Binary_Tree_KeyValuePair_t Pair  = {NULL, NULL};
+    int                        Count = 1000, i = 0, Key = 0;
+
+    Tree = Binary_Tree_Create(CompareFunc_Int_Ascending, sizeof(Key), NULL, Policy_Error);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Binary_Tree_t* for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        Key = (i * 37) % Count;
+        if ( 0 != Binary_Tree_Insert(Tree, &Key, sizeof(Key), &Key, sizeof(Key), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to insert Key (%d) into Tree.", Key);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    if ( ((size_t)Count != Tree->NodePool->InUse) || !BINARY_TREE_NODE_KEY_IS_INLINE(Tree->Root) ) {
+        TEST_PRINTF("%s", "Test Failure - Tree Nodes were not pooled with inline Keys.");
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    /* The Root has two children, so popping it recycles its Node for its successor. */
+    Key  = *(int *)Tree->Root->Key.KeyRaw;
+    Pair = Binary_Tree_Pop(Tree, &Key, sizeof(Key));
+    if ( (NULL == Pair.Key) || (Key != *(int *)Pair.Key) || (Key != *(int *)Pair.Value) ) {
+        TEST_PRINTF("%s", "Test Failure - Popped Key not equal to expectation.");
+        free(Pair.Key);
+        free(Pair.Value);
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+    free(Pair.Key);
+    free(Pair.Value);
+
+    for ( Key = 0; Key < Count; Key += 2 ) { Binary_Tree_Remove(Tree, &Key, sizeof(Key)); }
+
+    if ( (Binary_Tree_Length(Tree) != Tree->NodePool->InUse) ||
+         !Binary_Tree_isAVLTree(Tree->Root) ) {
+        TEST_PRINTF("%s", "Test Failure - Removed Nodes were not returned to the Tree Pool.");
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    if ( (0 != Binary_Tree_Clear(Tree)) || (0 != Tree->NodePool->InUse) ||
+         (NULL != Tree->NodePool->Slabs) ) {
+        TEST_PRINTF("%s", "Test Failure - Tree Pool still holds memory after Clear().");
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    Key = 7;
+    if ( (0 != Binary_Tree_Insert(Tree, &Key, sizeof(Key), &Key, sizeof(Key), NULL)) ||
+         (7 != *(int *)Binary_Tree_Get(Tree, &Key, sizeof(Key))) ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to re-use Tree after Clear().");
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    Binary_Tree_Release(Tree);
+    TEST_SUCCESSFUL;
+}
+
+int Test_Binary_Tree_Snapshot() {
+
+    Binary_Tree_t *            Tree     = NULL;
+    Binary_Tree_Snapshot_t *   Snapshot = NULL, *Later = NULL;
+    Binary_Tree_KeyValuePair_t Pair     = {NULL, NULL};
+    int                        Count = 500, Remaining = 0, i = 0, Key = 0, Value = 0;
+    int *                      Found    = NULL;
+    int                        State[4] = {0, 0, 0, 0};
+
+    Tree = Binary_Tree_Create(CompareFunc_Int_Ascending, sizeof(Key), NULL, Policy_Overwrite);
+    if ( NULL == Tree ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to create Binary_Tree_t* for testing.");
+        TEST_FAILURE;
+    }
+
+    for ( i = 0; i < Count; i++ ) {
+        Key   = (i * 37) % Count;
+        Value = Key * 2;
+        if ( 0 != Binary_Tree_Insert(Tree, &Key, sizeof(Key), &Value, sizeof(Value), NULL) ) {
+            TEST_PRINTF("Test Failure - Failed to insert Key (%d) into Tree.", Key);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    Snapshot = Binary_Tree_Snapshot(Tree);
+    if ( NULL == Snapshot ) {
+        TEST_PRINTF("%s", "Test Failure - Failed to take Snapshot of Binary_Tree_t.");
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    /* Overwrite, remove, insert and pop items out from under the Snapshot. */
+    Value = -1;
+    for ( Key = 0; Key < Count; Key += 2 ) {
+        Binary_Tree_Upsert(Tree, &Key, sizeof(Key), &Value, sizeof(Value), NULL);
+    }
+    for ( Key = 0; Key < Count; Key += 3 ) { Binary_Tree_Remove(Tree, &Key, sizeof(Key)); }
+    for ( Key = Count; Key < 2 * Count; Key++ ) {
+        Value = Key * 2;
+        Binary_Tree_Insert(Tree, &Key, sizeof(Key), &Value, sizeof(Value), NULL);
+    }
+
+    Key  = 1;
+    Pair = Binary_Tree_Pop(Tree, &Key, sizeof(Key));
+    if ( (NULL == Pair.Key) || (1 != *(int *)Pair.Key) || (2 != *(int *)Pair.Value) ) {
+        TEST_PRINTF("%s", "Test Failure - Popped Key not equal to expectation.");
+        free(Pair.Key);
+        free(Pair.Value);
+        Binary_Tree_Snapshot_Release(Snapshot);
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+    free(Pair.Key);
+    free(Pair.Value);
+
+    /* The Snapshot still holds every item exactly as it was taken. */
+    if ( (size_t)Count != Binary_Tree_Snapshot_Length(Snapshot) ) {
+        TEST_PRINTF("%s", "Test Failure - Snapshot Length changed with the Tree.");
+        Binary_Tree_Snapshot_Release(Snapshot);
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    for ( Key = 0; Key < Count; Key++ ) {
+        Found = (int *)Binary_Tree_Snapshot_Get(Snapshot, &Key, sizeof(Key));
+        if ( (NULL == Found) || ((Key * 2) != *Found) ) {
+            TEST_PRINTF("Test Failure - Snapshot does not hold the original Value of Key (%d).",
+                        Key);
+            Binary_Tree_Snapshot_Release(Snapshot);
+            Binary_Tree_Release(Tree);
+            TEST_FAILURE;
+        }
+    }
+
+    Key      = Count;
+    State[3] = 2 * Count;
+    if ( Binary_Tree_Snapshot_KeyExists(Snapshot, &Key, sizeof(Key)) ||
+         (0 != Binary_Tree_Snapshot_DoCallbackArg(Snapshot, RangeCallbackCounter, State)) ||
+         (Count != State[0]) ) {
+        TEST_PRINTF("%s", "Test Failure - Snapshot traversal did not match the original Tree.");
+        Binary_Tree_Snapshot_Release(Snapshot);
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    /* While the Tree itself has moved on, and is still a valid AVL tree. */
+    Remaining = Count - (((Count - 1) / 3) + 1) - 1 + Count;
+    State[0]  = 0;
+    Key       = 2;
+    Found     = (int *)Binary_Tree_Get(Tree, &Key, sizeof(Key));
+    if ( ((size_t)Remaining != Binary_Tree_Length(Tree)) || !Binary_Tree_isAVLTree(Tree->Root) ||
+         (0 != Binary_Tree_DoCallbackArg(Tree, Direction_InOrder, RangeCallbackCounter, State)) ||
+         (Remaining != State[0]) || (NULL == Found) || (-1 != *Found) ) {
+        TEST_PRINTF("%s", "Test Failure - Tree does not hold the expected items after Snapshot.");
+        Binary_Tree_Snapshot_Release(Snapshot);
+        Binary_Tree_Release(Tree);
+        TEST_FAILURE;
+    }
+
+    /* A Snapshot outlives both the clearing and the release of its Tree. */
+    Later = Binary_Tree_Snapshot(Tree);
+    Binary_Tree_Clear(Tree);
+    Binary_Tree_Release(Tree);
+
+    Key   = 4;
+    Found = (int *)Binary_Tree_Snapshot_Get(Later, &Key, sizeof(Key));
+    if ( ((size_t)Remaining != Binary_Tree_Snapshot_Length(Later)) || (NULL == Found) ||
+         (-1 != *Found) ) {
+        TEST_PRINTF("%s", "Test Failure - Snapshot did not outlive its Tree.");
+        Binary_Tree_Snapshot_Release(Snapshot);
+        Binary_Tree_Snapshot_Release(Later);
+        TEST_FAILURE;
+    }
+
+    Found = (int *)Binary_Tree_Snapshot_Get(Snapshot, &Key, sizeof(Key));
+    if ( (NULL == Found) || (8 != *Found) ) {
+        TEST_PRINTF("%s", "Test Failure - Snapshot did not outlive its Tree.");
+        Binary_Tree_Snapshot_Release(Snapshot);
+        Binary_Tree_Snapshot_Release(Later);
+        TEST_FAILURE;
+    }
+
+    Binary_Tree_Snapshot_Release(Snapshot);
+    Binary_Tree_Snapshot_Release(Later);
+    TEST_SUCCESSFUL;
+}
+
 int Test_Binary_Tree_Remove() {
 
     Binary_Tree_t *Tree  = NULL;
@@ -38,6 +38,7 @@ extern "C" {
 #include "../../../../include/libcontainer.h"
 
 #include "../../../iterator/include/iterator.h"
+#include "../../../pool/include/pool.h"
 
 #include "binary_tree_node.h"
 #include "tree_rotations.h"
@@ -90,12 +91,45 @@ struct Binary_Tree_t {
     */
     size_t KeySize;
 
+    /*
+        NodePool is the slab allocator every Node of this tree is allocated from,
+        sized to also hold small fixed-size Keys inline. This lets Clear and
+        Release drop all of the Nodes at once.
+    */
+    Pool_t* NodePool;
+
     /*
         DuplicatePolicy notes how the tree will handle duplicate Keys.
     */
     Binary_Tree_DuplicatePolicy_t DuplicatePolicy;
 };
 
+struct Binary_Tree_Snapshot_t {
+
+    /*
+        Root is the Root of the Tree at the moment the Snapshot was taken. The
+        Nodes below it are shared with the Tree, and never modified while shared.
+    */
+    Binary_Tree_Node_t* Root;
+
+    /*
+        KeyCompareFunc and KeySize are those of the Tree the Snapshot was taken from.
+    */
+    CompareFunc_t* KeyCompareFunc;
+    size_t         KeySize;
+
+    /*
+        The number of elements in the Tree when the Snapshot was taken.
+    */
+    size_t TreeSize;
+
+    /*
+        NodePool is retained by the Snapshot, as its Nodes are returned there
+        even if the Tree has since been released.
+    */
+    Pool_t* NodePool;
+};
+
 /* ++++++++++ Private Functions ++++++++++ */
 
 /*
@@ -132,26 +166,112 @@ Binary_Tree_Node_t* Binary_Tree_find(Binary_Tree_Node_t* Root, void* Key, size_t
 Binary_Tree_Node_t* Binary_Tree_findMinimum(Binary_Tree_Node_t* Root);
 
 /*
-    Binary_Tree_insertNode
+    Binary_Tree_seek
 
-    This function inserts a given Node into a (sub)tree, recursively descending
-    to ensure it is placed correctly for its Key.
+    This function performs a single iterative descent of a (sub)tree to find the
+    Node nearest to the given Key in the requested direction, without requiring
+    the Key itself to be present.
 
     Inputs:
-    Root    -   Pointer to the current (sub)tree root node.
-    Node    -   Pointer to the Node to be added to the tree.
+    Root            -   Pointer to the current (sub)tree root node.
+    Key             -   Key value to seek to.
+    KeySize         -   The size of the Key value.
+    KeyCompareFunc  -   The comparison function defining the ordering of the Keys.
+    Above           -   Seek to the smallest Key above the given Key if true,
+                            or the largest Key below it if false.
+    Inclusive       -   Whether a Node with a Key equal to the given Key satisfies the seek.
 
     Outputs:
-    Binary_Tree_Node_t* -   Pointer to the (possibly updated) Root node of the
-                                sub-tree the node was inserted into.
+    Binary_Tree_Node_t* -   Pointer to the nearest Node, or NULL if no Key in the
+                                (sub)tree satisfies the seek.
+*/
+Binary_Tree_Node_t* Binary_Tree_seek(Binary_Tree_Node_t* Root, void* Key, size_t KeySize, CompareFunc_t* KeyCompareFunc, bool Above, bool Inclusive);
+
+/*
+    Binary_Tree_bound
+
+    This function implements the shared validation for the public bound seeks,
+    LowerBound, UpperBound and Floor.
+
+    Inputs:
+    Tree        -   Pointer to the Tree to search.
+    Key         -   Key value to seek to.
+    KeySize     -   The size of the Key value.
+    Above       -   See Binary_Tree_seek().
+    Inclusive   -   See Binary_Tree_seek().
+
+    Outputs:
+    Binary_Tree_KeyValuePair_t  -   The Key-Value pair of the nearest Node, or a pair of
+                                        NULL pointers if no such Node exists.
+*/
+Binary_Tree_KeyValuePair_t Binary_Tree_bound(Binary_Tree_t* Tree, void* Key, size_t KeySize, bool Above, bool Inclusive);
+
+/*
+    Binary_Tree_insertKey
+
+    This function performs a single iterative descent of the Tree to find either the
+    Node holding the given Key, or the empty slot where a new Node with this Key
+    belongs. A new Node is only allocated if the Key is not already present.
+
+    Inputs:
+    Tree                -   Pointer to the Tree to operate on.
+    Key                 -   Pointer to the Key value to insert.
+    KeySize             -   The size of the Key value to be inserted.
+    Value               -   Pointer to the Value to insert.
+    ValueSize           -   The size of the Value to be inserted.
+    ValueReleaseFunc    -   Pointer to the function to call to release the Value.
+    Policy              -   How to treat an existing item with the same Key. Policy_Overwrite
+                                replaces its Value in place, Policy_Error leaves it untouched.
+    Node                -   Out-parameter for the Node holding the Key after the call.
+
+    Outputs:
+    int     -   Returns 0 on success, positive on error, or negative if the Key already exists
+                    and the Policy is Policy_Error. On success or a negative return, Node is
+                    set to the Node holding the Key.
+*/
+int Binary_Tree_insertKey(Binary_Tree_t* Tree, void* Key, size_t KeySize, void* Value, size_t ValueSize, ReleaseFunc_t* ValueReleaseFunc, Binary_Tree_DuplicatePolicy_t Policy, Binary_Tree_Node_t** Node);
+
+/*
+    Binary_Tree_buildSubtree
+
+    This function recursively builds a perfectly balanced (sub)tree directly from a
+    strictly ascending range of Keys, with the middle Key of the range as its root.
+
+    Inputs:
+    Tree                -   Pointer to the Tree being built, providing the KeySize and KeyReleaseFunc.
+    Keys                -   Pointer to the contiguous array of Keys, each of Tree->KeySize bytes.
+    Values              -   Pointer to the array of Values, parallel to Keys. May be NULL.
+    ValueSize           -   The size of each Value, or 0 if Values is an array of pointers.
+    ValueReleaseFunc    -   Pointer to the function to call to release each Value.
+    Start               -   The index of the first Key of the range.
+    End                 -   The index one past the last Key of the range.
+    Subtree             -   Out-parameter for the root of the built (sub)tree, NULL for an empty range.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero on failure. On failure, nothing built by this
+                    call is left allocated.
+*/
+int Binary_Tree_buildSubtree(Binary_Tree_t* Tree, void* Keys, void* Values, size_t ValueSize, ReleaseFunc_t* ValueReleaseFunc, size_t Start, size_t End, Binary_Tree_Node_t** Subtree);
+
+/*
+    Binary_Tree_retrace
+
+    This function walks from the given Node up towards the Root following the Parent
+    pointers, updating the cached heights and sizes, rebalancing each subtree, and
+    re-linking the (possibly rotated) subtree into its Parent.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to operate on, to update the Root if it changes.
+    Node    -   The lowest Node whose subtree has changed. May be NULL.
+
+    Outputs:
+    None, the Tree is rebalanced to satisfy the AVL invariant.
 
     Note:
-    The binary tree implemented by this library is an AVL tree. As such,
-    when inserting new items, this may involve some number of tree rotations.
-    This can shift which node is the Root of a given sub-tree, which is why
-    this returns a pointer to a Node.
+    Once a subtree keeps its original height, the Nodes above it need no further
+    rebalancing, and only have their cached Size refreshed.
 */
-Binary_Tree_Node_t* Binary_Tree_insertNode(Binary_Tree_Node_t* Root, CompareFunc_t* KeyCompareFunc, Binary_Tree_Node_t* Node);
+void Binary_Tree_retrace(Binary_Tree_t* Tree, Binary_Tree_Node_t* Node);
 
 /*
     Binary_Tree_removeNode
@@ -160,8 +280,10 @@ Binary_Tree_Node_t* Binary_Tree_insertNode(Binary_Tree_Node_t* Root, CompareFunc
     recursively descending to find the necessary Node.
 
     Inputs:
+    Tree    -   Pointer to the Tree being operated on.
     Root    -   Pointer to the current (sub)tree root node.
     Key     -   Key value of the Node to remove.
+    KeySize -   The size of the Key value.
 
     Binary_Tree_Node_t* -   Pointer to the (possibly updated) Root node of the
                                 sub-tree the node was inserted into.
@@ -171,8 +293,60 @@ Binary_Tree_Node_t* Binary_Tree_insertNode(Binary_Tree_Node_t* Root, CompareFunc
     when removing items, this may involve some number of tree rotations.
     This can shift which node is the Root of a given sub-tree, which is why
     this returns a pointer to a Node.
+
+    The path to the Node, and on to its in-order successor, must already be
+    owned by the Tree. See Binary_Tree_ownPath().
+*/
+Binary_Tree_Node_t* Binary_Tree_removeNode(Binary_Tree_t* Tree, Binary_Tree_Node_t *Root, void* Key, size_t KeySize);
+
+/*
+    Binary_Tree_ownNode
+
+    This function ensures a Node of the Tree is not shared with any Snapshot, copying
+    it in place of the original if it is. The Parent of the Node must already be owned.
+
+    Inputs:
+    Tree    -   Pointer to the Tree the Node belongs to.
+    Node    -   Pointer to the Node to take ownership of.
+
+    Outputs:
+    Binary_Tree_Node_t* -   Pointer to the Node now owned by the Tree, which may be
+                                a copy, or NULL if the copy could not be made.
+*/
+Binary_Tree_Node_t* Binary_Tree_ownNode(Binary_Tree_t* Tree, Binary_Tree_Node_t* Node);
+
+/*
+    Binary_Tree_ownPath
+
+    This function descends from the Root towards the given Key, taking ownership of
+    each Node on the way. If the Key is found with two children, this continues on
+    to its in-order successor, which is what removing the Key would modify.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to operate on.
+    Key     -   Key value to descend towards.
+    KeySize -   The size of the Key value.
+    Node    -   Out-parameter for the Node holding the Key, or NULL if it is not present.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero if a Node could not be copied.
+*/
+int Binary_Tree_ownPath(Binary_Tree_t* Tree, void* Key, size_t KeySize, Binary_Tree_Node_t** Node);
+
+/*
+    Binary_Tree_ownRotation
+
+    This function takes ownership of the children of an owned Node which will be
+    moved by rebalancing it, before Binary_Tree_rebalance() is called.
+
+    Inputs:
+    Tree    -   Pointer to the Tree to operate on.
+    Root    -   Pointer to the owned Node about to be rebalanced.
+
+    Outputs:
+    int     -   Returns 0 on success, non-zero if a Node could not be copied.
 */
-Binary_Tree_Node_t* Binary_Tree_removeNode(Binary_Tree_Node_t *Root, void* Key, size_t KeySize, CompareFunc_t* KeyCompareFunc);
+int Binary_Tree_ownRotation(Binary_Tree_t* Tree, Binary_Tree_Node_t* Root);
 
 /*
     Binary_Tree_leftmostLeaf
@@ -0,0 +1,173 @@
+/*
+    MIT License
+
+    Copyright (c) 2021 Bearnie-H
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef LIBCONTAINER_BINARY_TREE_FROZEN_H
+#define LIBCONTAINER_BINARY_TREE_FROZEN_H
+
+/*
+    If this header should export C-compatible symbols, rearrange these ifdefs as appropriate
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define LIBCONTAINER_ENABLE_BINARY_TREE
+#include "../../../../include/libcontainer.h"
+
+#include "binary_tree.h"
+
+/*
+    BINARY_TREE_FROZEN_PREFETCH
+
+    Hint that the given address will be read soon, where the compiler supports it.
+*/
+#if defined(__GNUC__)
+#define BINARY_TREE_FROZEN_PREFETCH(Address) __builtin_prefetch(Address)
+#else
+#define BINARY_TREE_FROZEN_PREFETCH(Address)
+#endif
+
+struct Binary_Tree_Frozen_t {
+
+    /*
+        Keys holds a copy of every Key of the Tree, in Eytzinger (breadth-first) order:
+        the Key at index i has its children at 2i and 2i + 1, with index 0 unused. The
+        first levels of every search therefore share the same few cache lines, and
+        the Keys a search can visit next are adjacent, ready to be prefetched.
+    */
+    uint8_t* Keys;
+
+    /*
+        Values holds the Value of each Key, at the same index.
+    */
+    void** Values;
+
+    /*
+        Count is the number of items, and KeySize the fixed size of each Key.
+    */
+    size_t Count;
+    size_t KeySize;
+
+    /*
+        KeyCompareFunc is the comparison function of the Tree this was frozen from.
+    */
+    CompareFunc_t* KeyCompareFunc;
+
+    /*
+        Snapshot keeps the Values alive, even as the Tree is modified or released.
+    */
+    Binary_Tree_Snapshot_t* Snapshot;
+};
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+/*
+    Binary_Tree_frozenSearch
+
+    This function performs a branch-free descent of the Eytzinger ordered Keys, finding
+    the first Key not less than (or, if not Inclusive, greater than) the given Key.
+
+    Inputs:
+    Frozen      -   Pointer to the Frozen tree to search.
+    Key         -   Pointer to the Key to search for.
+    KeySize     -   The size of the Key.
+    Inclusive   -   Whether a Key equal to the given Key satisfies the search.
+
+    Outputs:
+    size_t  -   The index of the Key found, or 0 if every Key falls before the given Key.
+*/
+size_t Binary_Tree_frozenSearch(Binary_Tree_Frozen_t* Frozen, void* Key, size_t KeySize, bool Inclusive);
+
+/*
+    Binary_Tree_frozenFind
+
+    This function finds the index of the Key equal to the given Key.
+
+    Inputs:
+    Frozen      -   Pointer to the Frozen tree to search.
+    Key         -   Pointer to the Key to search for.
+    KeySize     -   The size of the Key.
+
+    Outputs:
+    size_t  -   The index of the matching Key, or 0 if it is not present.
+*/
+size_t Binary_Tree_frozenFind(Binary_Tree_Frozen_t* Frozen, void* Key, size_t KeySize);
+
+/*
+    Binary_Tree_frozenFirst
+
+    This function returns the index of the smallest Key.
+
+    Inputs:
+    Frozen  -   Pointer to the Frozen tree to operate on.
+
+    Outputs:
+    size_t  -   The index of the smallest Key, or 0 if there are no Keys.
+*/
+size_t Binary_Tree_frozenFirst(Binary_Tree_Frozen_t* Frozen);
+
+/*
+    Binary_Tree_frozenNext
+
+    This function returns the index of the in-order successor of the given index.
+
+    Inputs:
+    Frozen  -   Pointer to the Frozen tree to operate on.
+    Index   -   The index to find the successor of.
+
+    Outputs:
+    size_t  -   The index of the next larger Key, or 0 if there is none.
+*/
+size_t Binary_Tree_frozenNext(Binary_Tree_Frozen_t* Frozen, size_t Index);
+
+/*
+    Binary_Tree_frozenPair
+
+    This function returns the Key-Value pair at the given index.
+
+    Inputs:
+    Frozen  -   Pointer to the Frozen tree to operate on.
+    Index   -   The index of the item, where 0 denotes no item.
+
+    Outputs:
+    Binary_Tree_KeyValuePair_t  -   The Key-Value pair, or a pair of NULL pointers for index 0.
+*/
+Binary_Tree_KeyValuePair_t Binary_Tree_frozenPair(Binary_Tree_Frozen_t* Frozen, size_t Index);
+
+/* ---------- Private Functions ---------- */
+
+#if defined(TESTING) || defined(DEBUGGER)
+
+#include "binary_tree_frozen_test.h"
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -156,6 +156,41 @@ Binary_Tree_Node_t* Binary_Tree_preOrderPrevious(Binary_Tree_Node_t* Current);
 */
 Binary_Tree_Node_t* Binary_Tree_postOrderPrevious(Binary_Tree_Node_t* Current);
 
+/*
+    Binary_Tree_firstNode
+
+    This function returns the first Node visited when traversing the given (sub)tree
+    in the requested direction.
+
+    Inputs:
+    Root        -   Pointer to the root of the (sub)tree to traverse.
+    Direction   -   The tree traversal direction to start.
+    Forward     -   Boolean toggling forward or reverse order traversal.
+
+    Outputs:
+    Binary_Tree_Node_t* -   Pointer to the first Node, or NULL if Root is NULL or
+                                the Direction is unknown.
+*/
+Binary_Tree_Node_t* Binary_Tree_firstNode(Binary_Tree_Node_t* Root, Binary_Tree_Direction_t Direction, bool Forward);
+
+/*
+    Binary_Tree_nextNode
+
+    This function returns the successor of the given Node in the requested direction.
+
+    Inputs:
+    Current     -   Pointer to the most recent Node visited.
+    Direction   -   The tree traversal direction to step in.
+
+    Outputs:
+    Binary_Tree_Node_t* -   Pointer to the next Node, or NULL when the traversal is finished.
+
+    Note:
+    Together with Binary_Tree_firstNode(), this walks the Tree through the Parent
+    pointers alone, without touching or allocating the Iterator of the Tree.
+*/
+Binary_Tree_Node_t* Binary_Tree_nextNode(Binary_Tree_Node_t* Current, Binary_Tree_Direction_t Direction);
+
 #if defined(TESTING) || defined(DEBUGGER)
 
 #include "binary_tree_iterator_test.h"
@@ -45,6 +45,8 @@ int Test_Binary_Tree_Iterate_Next_PostOrder(void);
 int Test_Binary_Tree_Iterate_Previous_InOrder(void);
 int Test_Binary_Tree_Iterate_Previous_PreOrder(void);
 int Test_Binary_Tree_Iterate_Previous_PostOrder(void);
+int Test_Binary_Tree_Iterate_Callback(void);
+int Test_Binary_Tree_Iterate_Irregular(void);
 
 #ifdef __cplusplus
 }
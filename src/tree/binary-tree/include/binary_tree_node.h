@@ -35,6 +35,14 @@ extern "C" {
 #include <stdint.h>
 #include "../../../../include/libcontainer.h"
 
+#include "../../../pool/include/pool.h"
+
+/*
+    A Node allocated from a Pool_t with room to spare after the Node itself holds
+    its Key inline in that space, rather than in a separate allocation.
+*/
+#define BINARY_TREE_NODE_KEY_IS_INLINE(Node) ((NULL != (Node)->Pool) && ((Node)->Key.KeyBytes == (uint8_t*)((Node) + 1)))
+
 /*
     Binary_Tree_Node_t
 
@@ -105,6 +113,41 @@ struct Binary_Tree_Node_t {
         is owned by something else.
     */
     size_t KeySize;
+
+    /*
+        Height caches the height of the (sub)tree rooted at this Node, with a leaf
+        having a height of 1. This is kept up to date by the tree rotations, so the
+        AVL balance factor of a Node can be computed without walking its subtrees.
+    */
+    size_t Height;
+
+    /*
+        Size caches the number of Nodes in the (sub)tree rooted at this Node, including
+        itself. This is maintained alongside the Height, and allows for order-statistic
+        queries (rank and select) in O(log n) time.
+    */
+    size_t Size;
+
+    /*
+        Pool is the Pool_t this Node was allocated from, and must be returned to,
+        or NULL if the Node was allocated on its own.
+    */
+    Pool_t* Pool;
+
+    /*
+        RefCount is the number of Parents (or Tree Roots) which reference this Node.
+        This is 1, unless the Node is shared between a Tree and its Snapshots, in
+        which case the Node must be copied before it can be modified.
+    */
+    size_t RefCount;
+
+    /*
+        KeyShares and ValueShares count the Nodes sharing this Key and Value, once
+        a Node has been copied. These are NULL while the Node is the only holder,
+        and the Key or Value is only released by the last of its holders.
+    */
+    size_t* KeyShares;
+    size_t* ValueShares;
 };
 
 /*
@@ -115,6 +158,10 @@ struct Binary_Tree_Node_t {
     properly manage resources held by the Value.
 
     Inputs:
+    Pool                -   Pointer to the Pool_t to allocate the Node from, or NULL to
+                                allocate it on its own. If the pooled objects have room
+                                for the Key and the Key is released by free(), the Key is
+                                copied inline into the Node.
     Key                 -   The Key to associate with this Node.
     KeySize             -   The size of the Key, in bytes.
     KeyReleaseFunc      -   Pointer to the function to release the Key when the Node is released.
@@ -125,7 +172,25 @@ struct Binary_Tree_Node_t {
     Outputs:
     Binary_Tree_Node_t*     -   Pointer to the created and initialized Node, or NULL on failure.
 */
-Binary_Tree_Node_t* Binary_Tree_Node_Create(void* Key, size_t KeySize, ReleaseFunc_t* KeyReleaseFunc, void* Value, size_t ValueSize, ReleaseFunc_t* ValueReleaseFunc);
+Binary_Tree_Node_t* Binary_Tree_Node_Create(Pool_t* Pool, void* Key, size_t KeySize, ReleaseFunc_t* KeyReleaseFunc, void* Value, size_t ValueSize, ReleaseFunc_t* ValueReleaseFunc);
+
+/*
+    Binary_Tree_Node_Copy
+
+    This function creates a copy of a Node, sharing the Key, Value and both
+    subtrees of the original.
+
+    Inputs:
+    Node    -   Pointer to the Node to copy.
+
+    Outputs:
+    Binary_Tree_Node_t*     -   Pointer to the copied Node, or NULL on failure.
+
+    Note:
+    The Children of the Node are re-parented to the copy, which is left to be linked
+    into the Tree in place of the original by the caller.
+*/
+Binary_Tree_Node_t* Binary_Tree_Node_Copy(Binary_Tree_Node_t* Node);
 
 /*
     Binary_Tree_Node_Height
@@ -138,9 +203,29 @@ Binary_Tree_Node_t* Binary_Tree_Node_Create(void* Key, size_t KeySize, ReleaseFu
 
     Outputs:
     size_t  -   The height of the Binary Tree below this Node. If NULL is provided, returns 0.
+
+    Note:
+    This is O(1), returning the Height cached within the Node.
 */
 size_t Binary_Tree_Node_Height(Binary_Tree_Node_t* Root);
 
+/*
+    Binary_Tree_Node_Size
+
+    This function returns the number of Nodes in the (sub)tree rooted at the given Node,
+    including the Node itself.
+
+    Inputs:
+    Root    -   Pointer to the Node to return the subtree size of.
+
+    Outputs:
+    size_t  -   The number of Nodes below and including this Node. If NULL is provided, returns 0.
+
+    Note:
+    This is O(1), returning the Size cached within the Node.
+*/
+size_t Binary_Tree_Node_Size(Binary_Tree_Node_t* Root);
+
 /*
     Binary_Tree_Node_UpdateKey
 
@@ -186,9 +271,81 @@ int Binary_Tree_Node_UpdateValue(Binary_Tree_Node_t* Node, void* NewValue, size_
     Note:
     This will also release the full sub-trees of the Node.
     If this is not desired, set the Child pointers to NULL before calling this.
+
+    A Node shared with a Snapshot only drops one reference, and is released
+    along with its subtrees by whichever holder drops the last one.
 */
 void Binary_Tree_Node_Release(Binary_Tree_Node_t* Node);
 
+/*
+    Binary_Tree_Node_ReleaseEntries
+
+    This function releases the Key and Value held by every Node of the given (sub)tree,
+    without releasing the Nodes themselves.
+
+    Inputs:
+    Root    -   Pointer to the root of the (sub)tree to operate on.
+
+    Outputs:
+    None, the Keys and Values are released.
+
+    Note:
+    This is intended for pooled Nodes, which are then all released at once with
+    Pool_Reset() rather than individually. The walk follows the Parent pointers,
+    so this must not be used while any Node of the (sub)tree is shared with a Snapshot.
+*/
+void Binary_Tree_Node_ReleaseEntries(Binary_Tree_Node_t* Root);
+
+/* ++++++++++ Private Functions ++++++++++ */
+
+/*
+    Binary_Tree_Node_releaseKey
+
+    This function drops the hold of a Node on its Key, releasing the Key if no
+    other Node shares it.
+
+    Inputs:
+    Node    -   Pointer to the Node to release the Key of.
+
+    Outputs:
+    None, the Node no longer holds a share of its Key.
+*/
+void Binary_Tree_Node_releaseKey(Binary_Tree_Node_t* Node);
+
+/*
+    Binary_Tree_Node_releaseValue
+
+    This function drops the hold of a Node on its Value, releasing the Value if no
+    other Node shares it.
+
+    Inputs:
+    Node    -   Pointer to the Node to release the Value of.
+
+    Outputs:
+    None, the Node no longer holds a share of its Value.
+*/
+void Binary_Tree_Node_releaseValue(Binary_Tree_Node_t* Node);
+
+/*
+    Binary_Tree_Node_shareCount
+
+    This function returns the share count of a Key or Value, creating a count of
+    its single current holder if it is not yet shared.
+
+    Inputs:
+    Shares  -   Pointer to the existing share count, or NULL if not yet shared.
+    Created -   Set to true if the share count had to be created.
+
+    Outputs:
+    size_t* -   The share count, or NULL on failure.
+
+    Note:
+    The count is not incremented, so a failed copy can simply free a created count.
+*/
+size_t* Binary_Tree_Node_shareCount(size_t* Shares, bool* Created);
+
+/* ---------- Private Functions ---------- */
+
 #if defined(TESTING) || defined(DEBUGGER)
 
 #include "binary_tree_node_test.h"
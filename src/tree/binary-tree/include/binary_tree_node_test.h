@@ -40,6 +40,7 @@ int Test_binary_tree_node(void);
 int Test_Binary_Tree_Node_Create(void);
 int Test_Binary_Tree_Node_UpdateKey(void);
 int Test_Binary_Tree_Node_UpdateValue(void);
+int Test_Binary_Tree_Node_Pooled(void);
 
 #ifdef __cplusplus
 }
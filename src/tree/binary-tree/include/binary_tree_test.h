@@ -39,10 +39,18 @@ int Test_binary_tree(void);
 
 int Test_Binary_Tree_Create(void);
 int Test_Binary_Tree_Insert(void);
+int Test_Binary_Tree_Upsert(void);
+int Test_Binary_Tree_GetOrInsert(void);
 int Test_Binary_Tree_Get(void);
 int Test_Binary_Tree_Pop(void);
 int Test_Binary_Tree_DoCallback(void);
 int Test_Binary_Tree_DoCallbackArg(void);
+int Test_Binary_Tree_Bounds(void);
+int Test_Binary_Tree_RangeCallback(void);
+int Test_Binary_Tree_RankSelect(void);
+int Test_Binary_Tree_BuildFromSorted(void);
+int Test_Binary_Tree_NodePool(void);
+int Test_Binary_Tree_Snapshot(void);
 int Test_Binary_Tree_Remove(void);
 int Test_Binary_Tree_Balancing(void);
 int Test_Binary_Tree_Clear(void);
@@ -47,6 +47,21 @@ extern "C" {
 */
 int Binary_Tree_balanceFactor(Binary_Tree_Node_t* Root);
 
+/*
+    Binary_Tree_updateNode
+
+    This function recomputes the cached Height and Size of the given Node from the
+    cached values of its children. This must be called on a Node whenever either of
+    its subtrees changes, working from the bottom of the tree upwards.
+
+    Inputs:
+    Root    -   The node to update the height and size of. May be NULL.
+
+    Outputs:
+    None, the Height and Size of the Node are updated.
+*/
+void Binary_Tree_updateNode(Binary_Tree_Node_t* Root);
+
 /*
     Binary_Tree_rebalance
 
@@ -41,6 +41,23 @@ int Binary_Tree_balanceFactor(Binary_Tree_Node_t *Root) {
     return (int)(RightHeight - LeftHeight);
 }
 
+void Binary_Tree_updateNode(Binary_Tree_Node_t *Root) {
+
+    size_t LeftHeight = 0, RightHeight = 0;
+
+    if ( NULL == Root ) {
+        return;
+    }
+
+    LeftHeight  = Binary_Tree_Node_Height(Root->LeftChild);
+    RightHeight = Binary_Tree_Node_Height(Root->RightChild);
+
+    Root->Height = 1 + ((LeftHeight > RightHeight) ? (LeftHeight) : RightHeight);
+    Root->Size =
+        1 + Binary_Tree_Node_Size(Root->LeftChild) + Binary_Tree_Node_Size(Root->RightChild);
+    return;
+}
+
 Binary_Tree_Node_t *Binary_Tree_rebalance(Binary_Tree_Node_t *Root) {
 
     int BalanceFactor = 0;
@@ -52,6 +69,9 @@ Binary_Tree_Node_t *Binary_Tree_rebalance(Binary_Tree_Node_t *Root) {
         return NULL;
     }
 
+    /* The subtrees of Root are already balanced, with up-to-date Heights and Sizes. */
+    Binary_Tree_updateNode(Root);
+
     BalanceFactor = Binary_Tree_balanceFactor(Root);
 
     if ( 2 <= BalanceFactor ) {
@@ -98,6 +118,9 @@ Binary_Tree_Node_t *Binary_Tree_rotateLeft(Binary_Tree_Node_t *Root) {
     }
     Pivot->LeftChild = Root;
 
+    Binary_Tree_updateNode(Root);
+    Binary_Tree_updateNode(Pivot);
+
     return Pivot;
 }
 
@@ -128,6 +151,9 @@ Binary_Tree_Node_t *Binary_Tree_rotateRight(Binary_Tree_Node_t *Root) {
     }
     Pivot->RightChild = Root;
 
+    Binary_Tree_updateNode(Root);
+    Binary_Tree_updateNode(Pivot);
+
     return Pivot;
 }
 
@@ -45,7 +45,7 @@ int Test_Binary_Tree_rotateLeft() {
     int                 Keys[3] = {1, 2, 3}, Values[3] = {10, 20, 30};
 
     for ( i = 0; i < 3; i++ ) {
-        Nodes[i] = Binary_Tree_Node_Create(&(Keys[i]), sizeof(Keys[i]), NULL, &(Values[i]),
+        Nodes[i] = Binary_Tree_Node_Create(NULL, &(Keys[i]), sizeof(Keys[i]), NULL, &(Values[i]),
                                            sizeof(Values[i]), NULL);
         if ( NULL == Nodes[i] ) {
             TEST_PRINTF("%s", "Test Failure - Failed to create Nodes for testing.");
@@ -90,7 +90,7 @@ int Test_Binary_Tree_rotateRight() {
     int                 Keys[3] = {3, 2, 1}, Values[3] = {10, 20, 30};
 
     for ( i = 0; i < 3; i++ ) {
-        Nodes[i] = Binary_Tree_Node_Create(&(Keys[i]), sizeof(Keys[i]), NULL, &(Values[i]),
+        Nodes[i] = Binary_Tree_Node_Create(NULL, &(Keys[i]), sizeof(Keys[i]), NULL, &(Values[i]),
                                            sizeof(Values[i]), NULL);
         if ( NULL == Nodes[i] ) {
             TEST_PRINTF("%s", "Test Failure - Failed to create Nodes for testing.");